@@ -1,4 +1,5 @@
 #include <string.h>
+#include <net/ethernet.h>
 #include "logger.h"
 #include "dbconnector.h"
 #include "producerstatetable.h"
@@ -25,10 +26,11 @@ using namespace swss;
 #define VRF_PREFIX          "Vrf"
 #define VRF_MGMT            "mgmt"
 
-#define LOOPBACK_DEFAULT_MTU_STR "65536"
+#define LOOPBACK_DEFAULT_MTU 65536
 #define DEFAULT_MTU_STR 9100
 
-IntfMgr::IntfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames) :
+IntfMgr::IntfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames,
+        shared_ptr<NetlinkProgrammer> netlink) :
         Orch(cfgDb, tableNames),
         m_cfgIntfTable(cfgDb, CFG_INTF_TABLE_NAME),
         m_cfgVlanIntfTable(cfgDb, CFG_VLAN_INTF_TABLE_NAME),
@@ -40,7 +42,8 @@ IntfMgr::IntfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
         m_stateVrfTable(stateDb, STATE_VRF_TABLE_NAME),
         m_stateIntfTable(stateDb, STATE_INTERFACE_TABLE_NAME),
         m_appIntfTableProducer(appDb, APP_INTF_TABLE_NAME),
-        m_neighTable(appDb, APP_NEIGH_TABLE_NAME)
+        m_neighTable(appDb, APP_NEIGH_TABLE_NAME),
+        m_netlink(netlink ? netlink : make_shared<RtnlProgrammer>())
 {
     auto subscriberStateTable = new swss::SubscriberStateTable(stateDb,
             STATE_PORT_TABLE_NAME, TableConsumable::DEFAULT_POP_BATCH_SIZE, 100);
@@ -78,91 +81,83 @@ IntfMgr::IntfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
 void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
                         const IpPrefix &ipPrefix)
 {
-    stringstream    cmd;
-    string          res;
-    string          ipPrefixStr = ipPrefix.to_string();
-    string          broadcastIpStr = ipPrefix.getBroadcastIp().to_string();
-    int             prefixLen = ipPrefix.getMaskLength();
+    uint32_t metric = 0;
 
-    if (ipPrefix.isV4())
+    // Kernel adds connected route with default metric of 256. But the metric is not
+    // communicated to frr unless the ip address is added with explicit metric
+    // In voq system, We need the static route to the remote neighbor and connected
+    // route to have the same metric to enable BGP to choose paths from routes learned
+    // via eBGP and iBGP over the internal inband port be part of same ecmp group.
+    // For v4 both the metrics (connected and static) are default 0 so we do not need
+    // to set the metric explicitly.
+    if (!ipPrefix.isV4() && mySwitchType == "voq")
     {
-        (prefixLen < 31) ?
-        (cmd << IP_CMD << " address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " broadcast " << shellquote(broadcastIpStr) <<" dev " << shellquote(alias)) :
-        (cmd << IP_CMD << " address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " dev " << shellquote(alias));
+        metric = 256;
     }
-    else
-    {
-        string metric = "";
-        // Kernel adds connected route with default metric of 256. But the metric is not
-        // communicated to frr unless the ip address is added with explicit metric
-        // In voq system, We need the static route to the remote neighbor and connected
-        // route to have the same metric to enable BGP to choose paths from routes learned
-        // via eBGP and iBGP over the internal inband port be part of same ecmp group.
-        // For v4 both the metrics (connected and static) are default 0 so we do not need
-        // to set the metric explicitly.
-        if(mySwitchType == "voq")
+
+    // ip address {{opCmd}} {{ipPrefix}} [broadcast {{broadcast}}] dev {{alias}} [metric 256]
+    auto queue = [&]() {
+        if (opCmd == "add")
         {
-           metric = " metric 256";
+            m_netlink->addAddress(alias, ipPrefix, metric);
         }
-
-        (prefixLen < 127) ?
-        (cmd << IP_CMD << " -6 address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " broadcast " << shellquote(broadcastIpStr) <<
-         " dev " << shellquote(alias) << metric) :
-        (cmd << IP_CMD << " -6 address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " dev " << shellquote(alias) << metric);
-    }
-
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
-    {
-        if (!ipPrefix.isV4() && opCmd == "add")
+        else
         {
-            SWSS_LOG_NOTICE("Failed to assign IPv6 on interface %s with return code %d, trying to enable IPv6 and retry", alias.c_str(), ret);
-            if (!enableIpv6Flag(alias))
-            {
-                SWSS_LOG_ERROR("Failed to enable IPv6 on interface %s", alias.c_str());
-                return;
-            }
-            ret = swss::exec(cmd.str(), res);
+            m_netlink->delAddress(alias, ipPrefix);
         }
+    };
 
-        if (ret)
+    queue();
+    NetlinkResult result = m_netlink->commit().front();
+    if (result.error && !ipPrefix.isV4() && opCmd == "add")
+    {
+        SWSS_LOG_NOTICE("Failed to assign IPv6 on interface %s with error %s, trying to enable IPv6 and retry",
+                        alias.c_str(), strerror(-result.error));
+        if (!enableIpv6Flag(alias))
         {
-            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+            SWSS_LOG_ERROR("Failed to enable IPv6 on interface %s", alias.c_str());
+            return;
         }
+        queue();
+        result = m_netlink->commit().front();
+    }
+
+    if (result.error)
+    {
+        SWSS_LOG_ERROR("%s : %s", result.request.c_str(), strerror(-result.error));
     }
 }
 
 void IntfMgr::setIntfMac(const string &alias, const string &mac_str)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD << " link set " << alias << " address " << mac_str;
+    uint8_t mac[ETHER_ADDR_LEN];
 
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
+    if (!MacAddress::parseMacString(mac_str, mac))
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+        SWSS_LOG_ERROR("Invalid mac address %s of %s", mac_str.c_str(), alias.c_str());
+        return;
     }
+
+    // ip link set {{alias}} address {{mac_str}}
+    m_netlink->setLinkAddress(alias, MacAddress(mac));
+    logFailures();
 }
 
 void IntfMgr::setIntfVrf(const string &alias, const string &vrfName)
 {
-    stringstream cmd;
-    string res;
+    // ip link set {{alias}} master {{vrfName}}, or nomaster without VRF
+    m_netlink->setLinkMaster(alias, vrfName);
+    logFailures();
+}
 
-    if (!vrfName.empty())
-    {
-        cmd << IP_CMD << " link set " << shellquote(alias) << " master " << shellquote(vrfName);
-    }
-    else
-    {
-        cmd << IP_CMD << " link set " << shellquote(alias) << " nomaster";
-    }
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
+void IntfMgr::logFailures()
+{
+    for (const auto &result : m_netlink->commit())
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+        if (result.error)
+        {
+            SWSS_LOG_ERROR("%s : %s", result.request.c_str(), strerror(-result.error));
+        }
     }
 }
 
@@ -195,73 +190,65 @@ bool IntfMgr::setIntfMpls(const string &alias, const string& mpls)
 
 void IntfMgr::addLoopbackIntf(const string &alias)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD << " link add " << alias << " mtu " << LOOPBACK_DEFAULT_MTU_STR << " type dummy";
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
-    }
+    // ip link add {{alias}} mtu 65536 type dummy
+    NetlinkLink loopback;
+    loopback.name = alias;
+    loopback.kind = "dummy";
+    loopback.mtu = LOOPBACK_DEFAULT_MTU;
+
+    m_netlink->addLink(loopback);
+    logFailures();
 }
 
 void IntfMgr::delLoopbackIntf(const string &alias)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD << " link del " << alias;
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
-    }
+    // ip link del {{alias}}
+    m_netlink->delLink(alias);
+    logFailures();
 }
 
 void IntfMgr::flushLoopbackIntfs()
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD << " link show type dummy | grep -o '" << LOOPBACK_PREFIX << "[^:]*'";
+    vector<string> aliases;
 
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
+    // ip link show type dummy | grep -o 'Loopback[^:]*'
+    if (!m_netlink->getLinks("dummy", aliases))
     {
-        SWSS_LOG_DEBUG("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
         return;
     }
 
-    auto aliases = tokenize(res, '\n');
-    for (string &alias : aliases)
+    for (const string &alias : aliases)
     {
-        SWSS_LOG_NOTICE("Remove loopback device %s", alias.c_str());
-        delLoopbackIntf(alias);
+        if (!alias.compare(0, strlen(LOOPBACK_PREFIX), LOOPBACK_PREFIX))
+        {
+            SWSS_LOG_NOTICE("Remove loopback device %s", alias.c_str());
+            m_netlink->delLink(alias);
+        }
     }
+    logFailures();
 }
 
 int IntfMgr::getIntfIpCount(const string &alias)
 {
-    stringstream cmd;
-    string res;
-
-    /* query ip address of the device with master name, it is much faster */
-    // ip address show {{intf_name}}
-    // $(ip link show {{intf_name}} | grep -o 'master [^\\s]*') ==> [master {{vrf_name}}]
-    // | grep inet | grep -v 'inet6 fe80:' | wc -l
-    cmd << IP_CMD << " address show " << alias
-        << " $(" << IP_CMD << " link show " << alias << " | grep -o 'master [^\\s]*')"
-        << " | grep inet | grep -v 'inet6 fe80:' | wc -l";
+    vector<IpPrefix> prefixes;
 
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
+    // ip address show {{alias}} | grep inet | grep -v 'inet6 fe80:' | wc -l
+    if (!m_netlink->getAddresses(alias, prefixes))
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+        SWSS_LOG_ERROR("Failed to get the addresses of %s", alias.c_str());
         return 0;
     }
 
-    return std::stoi(res);
+    int count = 0;
+    for (const auto &prefix : prefixes)
+    {
+        if (prefix.isV4() || prefix.getIp().getAddrScope() != IpAddress::AddrScope::LINK_SCOPE)
+        {
+            count++;
+        }
+    }
+
+    return count;
 }
 
 void IntfMgr::buildIntfReplayList(void)
@@ -330,11 +317,15 @@ bool IntfMgr::isIntfChangeVrf(const string &alias, const string &vrfName)
 
 void IntfMgr::addHostSubIntf(const string&intf, const string &subIntf, const string &vlan)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD " link add link " << shellquote(intf) << " name " << shellquote(subIntf) << " type vlan id " << shellquote(vlan);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    // ip link add link {{intf}} name {{subIntf}} type vlan id {{vlan}}
+    NetlinkLink link;
+    link.name = subIntf;
+    link.kind = "vlan";
+    link.parent = intf;
+    link.vlan_id = static_cast<uint16_t>(stoul(vlan));
+
+    m_netlink->addLink(link);
+    m_netlink->commitOrThrow();
 }
 
 
@@ -430,9 +421,6 @@ void IntfMgr::updateSubIntfMtu(const string &alias, const string &mtu)
 
 std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, const string &parent_mtu)
 {
-    stringstream cmd;
-    string res;
-
     string subifMtu = mtu;
     subIntf subIf(alias);
 
@@ -444,19 +432,19 @@ std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, c
         subifMtu = parent_mtu;
     }
     SWSS_LOG_INFO("subintf %s active mtu: %s", alias.c_str(), subifMtu.c_str());
-    cmd << IP_CMD " link set " << shellquote(alias) << " mtu " << shellquote(subifMtu);
-    std::string cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
+    m_netlink->setLinkMtu(alias, static_cast<uint32_t>(stoul(subifMtu)));
+    NetlinkResult result = m_netlink->commit().front();
 
-    if (ret && !isIntfStateOk(alias))
+    if (result.error && !isIntfStateOk(alias))
     {
         // Can happen when a SET notification on the PORT_TABLE in the State DB
         // followed by a new DEL notification that send by portmgrd
-        SWSS_LOG_WARN("Setting mtu to %s netdev failed with cmd:%s, rc:%d, error:%s", alias.c_str(), cmd_str.c_str(), ret, res.c_str());
+        SWSS_LOG_WARN("Setting mtu to %s netdev failed with cmd:%s, error:%s",
+                      alias.c_str(), result.request.c_str(), strerror(-result.error));
     }
-    else if (ret)
+    else if (result.error)
     {
-        throw runtime_error(cmd_str + " : " + res);
+        throw runtime_error(result.request + " : " + strerror(-result.error));
     }
     return subifMtu;
 }
@@ -488,23 +476,19 @@ void IntfMgr::updateSubIntfAdminStatus(const string &alias, const string &admin)
 
 bool IntfMgr::setIntfAdminStatus(const string &alias, const string &admin_status)
 {
-    stringstream cmd;
-    string res, cmd_str;
-
     SWSS_LOG_INFO("intf %s admin_status: %s", alias.c_str(), admin_status.c_str());
-    cmd << IP_CMD " link set " << shellquote(alias) << " " << shellquote(admin_status);
-    cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
-    if (ret && !isIntfStateOk(alias))
+    m_netlink->setLinkAdminState(alias, admin_status == "up");
+    NetlinkResult result = m_netlink->commit().front();
+    if (result.error && !isIntfStateOk(alias))
     {
         // Can happen when a DEL notification is sent by portmgrd immediately followed by a new SET notification
-        SWSS_LOG_WARN("Setting admin_status to %s netdev failed with cmd:%s, rc:%d, error:%s",
-                      alias.c_str(), cmd_str.c_str(), ret, res.c_str());
+        SWSS_LOG_WARN("Setting admin_status to %s netdev failed with cmd:%s, error:%s",
+                      alias.c_str(), result.request.c_str(), strerror(-result.error));
         return false;
     }
-    else if (ret)
+    else if (result.error)
     {
-        throw runtime_error(cmd_str + " : " + res);
+        throw runtime_error(result.request + " : " + strerror(-result.error));
     }
     return true;
 }
@@ -532,11 +516,9 @@ std::string IntfMgr::setHostSubIntfAdminStatus(const string &alias, const string
 
 void IntfMgr::removeHostSubIntf(const string &subIntf)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD " link del " << shellquote(subIntf);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    // ip link del {{subIntf}}
+    m_netlink->delLink(subIntf);
+    m_netlink->commitOrThrow();
 }
 
 void IntfMgr::setSubIntfStateOk(const string &alias)
@@ -726,16 +708,13 @@ void IntfMgr::delIpv6LinkLocalNeigh(const string &alias)
                 IpAddress ipAddress(keys[1]);
                 if (ipAddress.getAddrScope() == IpAddress::AddrScope::LINK_SCOPE)
                 {
-                    stringstream cmd;
-                    string res;
-
-                    cmd << IP_CMD << " neigh del dev " << keys[0] << " " << keys[1] ;
-                    swss::exec(cmd.str(), res);
+                    m_netlink->delNeighbor(keys[0], ipAddress);
                     SWSS_LOG_INFO("Deleted ipv6 link local neighbor - %s", keys[1].c_str());
                 }
             }
         }
     }
+    m_netlink->commit();
 }
 
 bool IntfMgr::doIntfGeneralTask(const vector<string>& keys,
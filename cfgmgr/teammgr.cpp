@@ -26,7 +26,7 @@ using namespace swss;
 
 
 TeamMgr::TeamMgr(DBConnector *confDb, DBConnector *applDb, DBConnector *statDb,
-        const vector<TableConnector> &tables) :
+        const vector<TableConnector> &tables, shared_ptr<NetlinkProgrammer> netlink) :
     Orch(tables),
     m_cfgMetadataTable(confDb, CFG_DEVICE_METADATA_TABLE_NAME),
     m_cfgPortTable(confDb, CFG_PORT_TABLE_NAME),
@@ -36,7 +36,8 @@ TeamMgr::TeamMgr(DBConnector *confDb, DBConnector *applDb, DBConnector *statDb,
     m_appLagTable(applDb, APP_LAG_TABLE_NAME),
     m_statePortTable(statDb, STATE_PORT_TABLE_NAME),
     m_stateLagTable(statDb, STATE_LAG_TABLE_NAME),
-    m_stateMACsecIngressSATable(statDb, STATE_MACSEC_INGRESS_SA_TABLE_NAME)
+    m_stateMACsecIngressSATable(statDb, STATE_MACSEC_INGRESS_SA_TABLE_NAME),
+    m_netlink(netlink ? netlink : make_shared<RtnlProgrammer>())
 {
     SWSS_LOG_ENTER();
 
@@ -485,12 +486,9 @@ bool TeamMgr::setLagAdminStatus(const string &alias, const string &admin_status)
 {
     SWSS_LOG_ENTER();
 
-    stringstream cmd;
-    string res;
-
     // ip link set dev <port_channel_name> [up|down]
-    cmd << IP_CMD << " link set dev " << shellquote(alias) << " " << shellquote(admin_status);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_netlink->setLinkAdminState(alias, admin_status == "up");
+    m_netlink->commitOrThrow();
 
     SWSS_LOG_NOTICE("Set port channel %s admin status to %s",
             alias.c_str(), admin_status.c_str());
@@ -502,12 +500,9 @@ bool TeamMgr::setLagMtu(const string &alias, const string &mtu)
 {
     SWSS_LOG_ENTER();
 
-    stringstream cmd;
-    string res;
-
     // ip link set dev <port_channel_name> mtu <mtu_value>
-    cmd << IP_CMD << " link set dev " << shellquote(alias) << " mtu " << shellquote(mtu);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_netlink->setLinkMtu(alias, static_cast<uint32_t>(stoul(mtu)));
+    m_netlink->commitOrThrow();
 
     vector<FieldValueTuple> fvs;
     FieldValueTuple fv("mtu", mtu);
@@ -737,8 +732,7 @@ task_process_status TeamMgr::addLagMember(const string &lag, const string &membe
     string res;
 
     // If port was already deleted, ignore this operation
-    cmd << IP_CMD << " link show " << shellquote(member);
-    if (exec(cmd.str(), res) != 0)
+    if (!m_netlink->linkExists(member))
     {
 	SWSS_LOG_WARN("Unable to find port %s", member.c_str());
 	return task_ignore;
@@ -752,14 +746,14 @@ task_process_status TeamMgr::addLagMember(const string &lag, const string &membe
     }
 
     uint16_t keyId = generateLacpKey(lag);
-    cmd.str("");
-    cmd.clear();
 
     // Set admin down LAG member (required by teamd) and enslave it
     // ip link set dev <member> down;
     // teamdctl <port_channel_name> port config update <member> { "lacp_key": <lacp_key>, "link_watch": { "name": "ethtool" } };
     // teamdctl <port_channel_name> port add <member>;
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " down; ";
+    m_netlink->setLinkAdminState(member, false);
+    m_netlink->commit();
+
     cmd << TEAMDCTL_CMD << " " << shellquote(lag) << " port config update " << shellquote(member)
         << " '{\"lacp_key\":"
         << keyId
@@ -816,9 +810,8 @@ task_process_status TeamMgr::addLagMember(const string &lag, const string &membe
     }
 
     // ip link set dev <member> [up|down]
-    cmd.str(string());
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " " << shellquote(admin_status);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_netlink->setLinkAdminState(member, admin_status == "up");
+    m_netlink->commitOrThrow();
 
     fvs.clear();
     FieldValueTuple fv("mtu", mtu);
@@ -840,7 +833,8 @@ bool TeamMgr::removeLagMember(const string &lag, const string &member)
     string res;
 
     // teamdctl <port_channel_name> port remove <member>;
-    cmd << TEAMDCTL_CMD << " " << lag << " port remove " << member << "; ";
+    cmd << TEAMDCTL_CMD << " " << lag << " port remove " << member;
+    exec(cmd.str(), res);
 
     vector<FieldValueTuple> fvs;
     m_cfgPortTable.get(member, fvs);
@@ -862,10 +856,9 @@ bool TeamMgr::removeLagMember(const string &lag, const string &member)
 
     // ip link set dev <port_name> [up|down];
     // ip link set dev <port_name> mtu
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " " << shellquote(admin_status) << "; ";
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " mtu " << shellquote(mtu);
-
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_netlink->setLinkAdminState(member, admin_status == "up");
+    m_netlink->setLinkMtu(member, static_cast<uint32_t>(stoul(mtu)));
+    m_netlink->commitOrThrow();
     fvs.clear();
     FieldValueTuple fv("admin_status", admin_status);
     fvs.push_back(fv);
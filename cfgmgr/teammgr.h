@@ -4,6 +4,7 @@
 #include <string>
 
 #include "dbconnector.h"
+#include "netlinkprogrammer.h"
 #include "netmsg.h"
 #include "orch.h"
 #include "producerstatetable.h"
@@ -15,7 +16,7 @@ class TeamMgr : public Orch
 {
 public:
     TeamMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *staDb,
-            const std::vector<TableConnector> &tables);
+            const std::vector<TableConnector> &tables, std::shared_ptr<NetlinkProgrammer> netlink = nullptr);
 
     using Orch::doTask;
     void cleanTeamProcesses();
@@ -36,6 +37,8 @@ private:
 
     MacAddress m_mac;
 
+    std::shared_ptr<NetlinkProgrammer> m_netlink;
+
     void doTask(Consumer &consumer);
     void doLagTask(Consumer &consumer);
     void doLagMemberTask(Consumer &consumer);
@@ -1,14 +1,13 @@
 #include <algorithm>
-#include <regex>
-#include <sstream>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
 #include <string>
 #include <net/if.h>
 
 #include "logger.h"
 #include "tunnelmgr.h"
 #include "tokenize.h"
-#include "shellcmd.h"
-#include "exec.h"
 #include "warm_restart.h"
 
 using namespace std;
@@ -18,99 +17,81 @@ using namespace swss;
 #define TUNIF "tun0"
 #define LOOPBACK_SRC "Loopback3"
 
-static int cmdIpTunnelIfCreate(const swss::TunnelInfo & info, std::string & res)
+// Send the queued request, res is its failure
+static int commitTunnelRequest(NetlinkProgrammer & netlink, std::string & res)
+{
+    NetlinkResult result = netlink.commit().front();
+    if (result.error)
+    {
+        res = result.request + " : " + strerror(-result.error);
+    }
+    return result.error;
+}
+
+static int cmdIpTunnelIfCreate(NetlinkProgrammer & netlink, const swss::TunnelInfo & info, std::string & res)
 {
     // ip tunnel add {{tunnel intf}} mode ipip local {{dst ip}} remote {{remote ip}}
-    ostringstream cmd;
-    cmd << IP_CMD " tunnel add "
-        << TUNIF << " mode ipip local "
-        << shellquote(info.dst_ip)
-        << " remote "
-        << shellquote(info.remote_ip);
-    return swss::exec(cmd.str(), res);
+    NetlinkLink link;
+    link.name = TUNIF;
+    link.kind = "ipip";
+    try
+    {
+        link.local = IpAddress(info.dst_ip);
+        link.remote = IpAddress(info.remote_ip);
+    }
+    catch (const std::invalid_argument & e)
+    {
+        res = e.what();
+        return -EINVAL;
+    }
+    netlink.addLink(link);
+    return commitTunnelRequest(netlink, res);
 }
 
-static int cmdIpTunnelIfRemove(std::string & res)
+static int cmdIpTunnelIfRemove(NetlinkProgrammer & netlink, std::string & res)
 {
     // ip tunnel del {{tunnel intf}}
-    ostringstream cmd;
-    cmd << IP_CMD " tunnel del "
-        << TUNIF;
-    return swss::exec(cmd.str(), res);
+    netlink.delLink(TUNIF);
+    return commitTunnelRequest(netlink, res);
 }
 
-static int cmdIpTunnelIfUp(std::string & res)
+static int cmdIpTunnelIfUp(NetlinkProgrammer & netlink, std::string & res)
 {
     // ip link set dev {{tunnel intf}} up
-    ostringstream cmd;
-    cmd << IP_CMD " link set dev "
-        << TUNIF
-        << " up";
-    return swss::exec(cmd.str(), res);
+    netlink.setLinkAdminState(TUNIF, true);
+    return commitTunnelRequest(netlink, res);
 }
 
-static int cmdIpTunnelIfAddress(const std::string& ip, std::string & res)
+static int cmdIpTunnelIfAddress(NetlinkProgrammer & netlink, const IpPrefix & ip, std::string & res)
 {
     // ip addr add {{loopback3 ip}} dev {{tunnel intf}}
-    ostringstream cmd;
-    cmd << IP_CMD " addr add "
-        << shellquote(ip)
-        << " dev "
-        << TUNIF;
-    return swss::exec(cmd.str(), res);
+    netlink.addAddress(TUNIF, ip, 0);
+    return commitTunnelRequest(netlink, res);
 }
 
-static int cmdIpTunnelRouteAdd(const std::string& pfx, std::string & res)
+static int cmdIpTunnelRouteAdd(NetlinkProgrammer & netlink, const std::string& pfx, std::string & res)
 {
     // ip route add/replace {{ip prefix}} dev {{tunnel intf}}
     // Replace route if route already exists
-    ostringstream cmd;
-    if (IpPrefix(pfx).isV4())
-    {
-        cmd << IP_CMD " route replace "
-            << shellquote(pfx)
-            << " dev "
-            << TUNIF;
-    }
-    else
-    {
-        cmd << IP_CMD " -6 route replace "
-            << shellquote(pfx)
-            << " dev "
-            << TUNIF;
-    }
-
-    return swss::exec(cmd.str(), res);
+    netlink.replaceRoute(TUNIF, IpPrefix(pfx));
+    return commitTunnelRequest(netlink, res);
 }
 
-static int cmdIpTunnelRouteDel(const std::string& pfx, std::string & res)
+static int cmdIpTunnelRouteDel(NetlinkProgrammer & netlink, const std::string& pfx, std::string & res)
 {
     // ip route del {{ip prefix}} dev {{tunnel intf}}
-    ostringstream cmd;
-    if (IpPrefix(pfx).isV4())
-    {
-        cmd << IP_CMD " route del "
-            << shellquote(pfx)
-            << " dev "
-            << TUNIF;
-    }
-    else
-    {
-        cmd << IP_CMD " -6 route del "
-            << shellquote(pfx)
-            << " dev "
-            << TUNIF;
-    }
-
-    return swss::exec(cmd.str(), res);
+    netlink.delRoute(TUNIF, IpPrefix(pfx));
+    return commitTunnelRequest(netlink, res);
 }
 
-TunnelMgr::TunnelMgr(DBConnector *cfgDb, DBConnector *appDb, const std::vector<std::string> &tableNames) :
+TunnelMgr::TunnelMgr(DBConnector *cfgDb, DBConnector *appDb, const std::vector<std::string> &tableNames,
+                     shared_ptr<NetlinkProgrammer> netlink) :
         Orch(cfgDb, tableNames),
         m_appIpInIpTunnelTable(appDb, APP_TUNNEL_DECAP_TABLE_NAME),
         m_appIpInIpTunnelDecapTermTable(appDb, APP_TUNNEL_DECAP_TERM_TABLE_NAME),
         m_cfgPeerTable(cfgDb, CFG_PEER_SWITCH_TABLE_NAME),
-        m_cfgTunnelTable(cfgDb, CFG_TUNNEL_TABLE_NAME)
+        m_cfgTunnelTable(cfgDb, CFG_TUNNEL_TABLE_NAME),
+        m_netlink(netlink ? netlink : make_shared<RtnlProgrammer>())
 {
     std::vector<string> peer_keys;
     m_cfgPeerTable.getKeys(peer_keys);
@@ -154,7 +135,7 @@ TunnelMgr::TunnelMgr(DBConnector *cfgDb, DBConnector *appDb, const std::vector<s
 
     // Cleanup any existing tunnel intf
     std::string res;
-    cmdIpTunnelIfRemove(res);
+    cmdIpTunnelIfRemove(*m_netlink, res);
 }
 
 void TunnelMgr::doTask(Consumer &consumer)
@@ -340,7 +321,7 @@ bool TunnelMgr::doLpbkIntfTask(const KeyOpFieldsValuesTuple & t)
     {
         int ret = 0;
         std::string res;
-        ret = cmdIpTunnelIfAddress(ipPrefix.to_string(), res);
+        ret = cmdIpTunnelIfAddress(*m_netlink, ipPrefix, res);
         if (ret != 0)
         {
             SWSS_LOG_WARN("Failed to assign IP addr for tun if %s, res %s",
@@ -363,7 +344,7 @@ bool TunnelMgr::doTunnelRouteTask(const KeyOpFieldsValuesTuple & t)
     std::string res;
     if (op == SET_COMMAND)
     {
-        ret = cmdIpTunnelRouteAdd(prefix, res);
+        ret = cmdIpTunnelRouteAdd(*m_netlink, prefix, res);
         if (ret != 0)
         {
             SWSS_LOG_WARN("Failed to add route %s, res %s", prefix.c_str(), res.c_str());
@@ -371,7 +352,7 @@ bool TunnelMgr::doTunnelRouteTask(const KeyOpFieldsValuesTuple & t)
     }
     else
     {
-        ret = cmdIpTunnelRouteDel(prefix, res);
+        ret = cmdIpTunnelRouteDel(*m_netlink, prefix, res);
         if (ret != 0)
         {
             SWSS_LOG_WARN("Failed to del route %s, res %s", prefix.c_str(), res.c_str());
@@ -388,14 +369,14 @@ bool TunnelMgr::configIpTunnel(const TunnelInfo& tunInfo)
     int ret = 0;
     std::string res;
 
-    ret = cmdIpTunnelIfCreate(tunInfo, res);
+    ret = cmdIpTunnelIfCreate(*m_netlink, tunInfo, res);
     if (ret != 0)
     {
         SWSS_LOG_WARN("Failed to create IP tunnel if (dst ip: %s, peer ip %s), res %s",
                        tunInfo.dst_ip.c_str(),tunInfo.remote_ip.c_str(), res.c_str());
     }
 
-    ret = cmdIpTunnelIfUp(res);
+    ret = cmdIpTunnelIfUp(*m_netlink, res);
     if (ret != 0)
     {
         SWSS_LOG_WARN("Failed to enable IP tunnel intf (dst ip: %s, peer ip %s), res %s",
@@ -405,7 +386,7 @@ bool TunnelMgr::configIpTunnel(const TunnelInfo& tunInfo)
     auto it = m_intfCache.find(LOOPBACK_SRC);
     if (it != m_intfCache.end())
     {
-        ret = cmdIpTunnelIfAddress(it->second.to_string(), res);
+        ret = cmdIpTunnelIfAddress(*m_netlink, it->second, res);
         if (ret != 0)
         {
             SWSS_LOG_WARN("Failed to assign IP addr for tun if %s, res %s",
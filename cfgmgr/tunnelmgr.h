@@ -3,6 +3,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkprogrammer.h"
 
 #include <set>
 
@@ -18,7 +19,8 @@ struct TunnelInfo
 class TunnelMgr : public Orch
 {
 public:
-    TunnelMgr(DBConnector *cfgDb, DBConnector *appDb, const std::vector<std::string> &tableNames);
+    TunnelMgr(DBConnector *cfgDb, DBConnector *appDb, const std::vector<std::string> &tableNames,
+              std::shared_ptr<NetlinkProgrammer> netlink = nullptr);
     using Orch::doTask;
 
 private:
@@ -37,6 +39,8 @@ private:
     Table m_cfgPeerTable;
     Table m_cfgTunnelTable;
 
+    std::shared_ptr<NetlinkProgrammer> m_netlink;
+
     std::map<std::string, TunnelInfo > m_tunnelCache;
     std::map<std::string, IpPrefix> m_intfCache;
     std::string m_peerIp;
@@ -1,11 +1,10 @@
 #include <string.h>
+#include <fstream>
 #include "logger.h"
 #include "producerstatetable.h"
 #include "macaddress.h"
 #include "vlanmgr.h"
-#include "exec.h"
 #include "tokenize.h"
-#include "shellcmd.h"
 #include "warm_restart.h"
 #include <swss/redisutility.h>
 
@@ -15,14 +14,15 @@ using namespace swss;
 #define DOT1Q_BRIDGE_NAME   "Bridge"
 #define VLAN_PREFIX         "Vlan"
 #define LAG_PREFIX          "PortChannel"
-#define DEFAULT_VLAN_ID     "1"
+#define DEFAULT_VLAN_ID     1
+#define DEFAULT_MTU         9100
 #define DEFAULT_MTU_STR     "9100"
 #define VLAN_HLEN            4
 
 extern MacAddress gMacAddress;
 
 VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames,
-        const vector<string> &stateTableNames) :
+        const vector<string> &stateTableNames, shared_ptr<NetlinkProgrammer> netlink) :
         Orch(cfgDb, stateDb, tableNames, stateTableNames),
         m_cfgVlanTable(cfgDb, CFG_VLAN_TABLE_NAME),
         m_cfgVlanMemberTable(cfgDb, CFG_VLAN_MEMBER_TABLE_NAME),
@@ -34,7 +34,8 @@ VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
         m_appVlanMemberTableProducer(appDb, APP_VLAN_MEMBER_TABLE_NAME),
         m_appFdbTableProducer(appDb, APP_FDB_TABLE_NAME),
         m_appPortTableProducer(appDb, APP_PORT_TABLE_NAME),
-        replayDone(false)
+        replayDone(false),
+        m_netlink(netlink ? netlink : make_shared<RtnlProgrammer>())
 {
     SWSS_LOG_ENTER();
 
@@ -61,83 +62,79 @@ VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
             WarmStart::setWarmStartState("vlanmgrd", WarmStart::RECONCILED);
             SWSS_LOG_NOTICE("vlanmgr warmstart state set to RECONCILED");
         }
-        const std::string cmds = std::string("")
-          + IP_CMD + " link show " + DOT1Q_BRIDGE_NAME + " 2>/dev/null";
-
-        std::string res;
-        int ret = swss::exec(cmds, res);
-        if (ret == 0)
+        if (m_netlink->linkExists(DOT1Q_BRIDGE_NAME))
         {
             // Don't reset vlan aware bridge upon swss docker warm restart.
             SWSS_LOG_INFO("vlanmgrd warm start, skipping bridge create");
             return;
         }
     }
-    // Initialize Linux dot1q bridge and enable vlan filtering
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/ip link del Bridge 2>/dev/null ;
-    //               /sbin/ip link add Bridge up type bridge &&
-    //               /sbin/ip link set Bridge mtu {{ mtu_size }} &&
-    //               /sbin/ip link set Bridge address {{gMacAddress}} &&
-    //               /sbin/bridge vlan del vid 1 dev Bridge self;
-    //               /sbin/ip link del dummy 2>/dev/null;
-    //               /sbin/ip link add dummy type dummy &&
-    //               /sbin/ip link set dummy master Bridge &&
-    //               /sbin/ip link set dummy up;
-    //               /sbin/ip link set Bridge down &&
-    //               /sbin/ip link set Bridge up"
-    // Note: We shutdown and start-up the Bridge at the end to ensure that its
-    //       link-local IPv6 address matches its MAC address.
+    // Initialize Linux dot1q bridge and enable vlan filtering, as with:
+    // ip link del Bridge; ip link del dummy
+    m_netlink->delLink(DOT1Q_BRIDGE_NAME);
+    m_netlink->delLink("dummy");
+    m_netlink->commit();
+
+    // ip link add Bridge up mtu {{ mtu_size }} address {{gMacAddress}} type bridge
+    NetlinkLink bridge;
+    bridge.name = DOT1Q_BRIDGE_NAME;
+    bridge.kind = "bridge";
+    bridge.mtu = DEFAULT_MTU;
+    bridge.address = gMacAddress;
+    bridge.up = true;
+    m_netlink->addLink(bridge);
+    m_netlink->commitOrThrow();
+
+    // bridge vlan del vid 1 dev Bridge self;
+    // ip link add dummy type dummy && ip link set dummy master Bridge && ip link set dummy up
+    NetlinkLink dummy;
+    dummy.name = "dummy";
+    dummy.kind = "dummy";
+    m_netlink->delBridgeVlan(DOT1Q_BRIDGE_NAME, DEFAULT_VLAN_ID, NETLINK_VLAN_SELF);
+    m_netlink->addLink(dummy);
+    m_netlink->setLinkMaster("dummy", DOT1Q_BRIDGE_NAME);
+    m_netlink->setLinkAdminState("dummy", true);
+    for (const auto &result : m_netlink->commit())
+    {
+        if (result.error)
+        {
+            SWSS_LOG_WARN("%s : %s", result.request.c_str(), strerror(-result.error));
+        }
+    }
 
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + IP_CMD + " link del " + DOT1Q_BRIDGE_NAME + " 2>/dev/null; "
-      + IP_CMD + " link add " + DOT1Q_BRIDGE_NAME + " up type bridge && "
-      + IP_CMD + " link set " + DOT1Q_BRIDGE_NAME + " mtu " + DEFAULT_MTU_STR + " && "
-      + IP_CMD + " link set " + DOT1Q_BRIDGE_NAME + " address " + gMacAddress.to_string() + " && "
-      + BRIDGE_CMD + " vlan del vid " + DEFAULT_VLAN_ID + " dev " + DOT1Q_BRIDGE_NAME + " self; "
-      + IP_CMD + " link del dev dummy 2>/dev/null; "
-      + IP_CMD + " link add dummy type dummy && "
-      + IP_CMD + " link set dummy master " + DOT1Q_BRIDGE_NAME + " && "
-      + IP_CMD + " link set dummy up; "
-      + IP_CMD + " link set " + DOT1Q_BRIDGE_NAME + " down && "
-      + IP_CMD + " link set " + DOT1Q_BRIDGE_NAME + " up\"";
-
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
-
-    // /sbin/ip link set Bridge type bridge vlan_filtering 1
-    const std::string vlan_filtering_cmd = std::string(IP_CMD) + " link set " + DOT1Q_BRIDGE_NAME + " type bridge vlan_filtering 1";
-    EXEC_WITH_ERROR_THROW(vlan_filtering_cmd, res);
-
-    // /sbin/ip link set Bridge type bridge no_linklocal_learn 1
-    const std::string no_ll_learn_cmd = std::string(IP_CMD) + " link set " + DOT1Q_BRIDGE_NAME + " type bridge no_linklocal_learn 1";
-    EXEC_WITH_ERROR_THROW(no_ll_learn_cmd, res);
+    // ip link set Bridge down && ip link set Bridge up
+    // ip link set Bridge type bridge vlan_filtering 1
+    // ip link set Bridge type bridge no_linklocal_learn 1
+    // Note: We shutdown and start-up the Bridge to ensure that its
+    //       link-local IPv6 address matches its MAC address.
+    m_netlink->setLinkAdminState(DOT1Q_BRIDGE_NAME, false);
+    m_netlink->setLinkAdminState(DOT1Q_BRIDGE_NAME, true);
+    m_netlink->setBridgeVlanFiltering(DOT1Q_BRIDGE_NAME, true);
+    m_netlink->setBridgeNoLinkLocalLearn(DOT1Q_BRIDGE_NAME, true);
+    m_netlink->commitOrThrow();
 }
 
 bool VlanMgr::addHostVlan(int vlan_id)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/bridge vlan add vid {{vlan_id}} dev Bridge self &&
-    //               /sbin/ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + BRIDGE_CMD + " vlan add vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self && "
-      + IP_CMD + " link add link " + DOT1Q_BRIDGE_NAME
-               + " up"
-               + " name " + VLAN_PREFIX + std::to_string(vlan_id)
-               + " address " + gMacAddress.to_string()
-               + " type vlan id " + std::to_string(vlan_id) + "\"";
-
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
-
-    res.clear();
-    const std::string echo_cmd = std::string("")
-      + ECHO_CMD + " 0 > /proc/sys/net/ipv4/conf/" + VLAN_PREFIX + std::to_string(vlan_id) + "/arp_evict_nocarrier";
-    swss::exec(echo_cmd, res);
+    // bridge vlan add vid {{vlan_id}} dev Bridge self &&
+    // ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}
+    NetlinkLink vlan;
+    vlan.name = VLAN_PREFIX + std::to_string(vlan_id);
+    vlan.kind = "vlan";
+    vlan.parent = DOT1Q_BRIDGE_NAME;
+    vlan.vlan_id = static_cast<uint16_t>(vlan_id);
+    vlan.address = gMacAddress;
+    vlan.up = true;
+
+    m_netlink->addBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), NETLINK_VLAN_SELF);
+    m_netlink->addLink(vlan);
+    m_netlink->commitOrThrow();
+
+    // echo 0 > /proc/sys/net/ipv4/conf/Vlan{{vlan_id}}/arp_evict_nocarrier, not on older kernels
+    std::ofstream arpEvict("/proc/sys/net/ipv4/conf/" + vlan.name + "/arp_evict_nocarrier");
+    arpEvict << "0";
 
     return true;
 }
@@ -146,16 +143,10 @@ bool VlanMgr::removeHostVlan(int vlan_id)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/ip link del Vlan{{vlan_id}} &&
-    //               /sbin/bridge vlan del vid {{vlan_id}} dev Bridge self"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + IP_CMD + " link del " + VLAN_PREFIX + std::to_string(vlan_id) + " && "
-      + BRIDGE_CMD + " vlan del vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self\"";
-
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
+    // ip link del Vlan{{vlan_id}} && bridge vlan del vid {{vlan_id}} dev Bridge self
+    m_netlink->delLink(VLAN_PREFIX + std::to_string(vlan_id));
+    m_netlink->delBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), NETLINK_VLAN_SELF);
+    m_netlink->commitOrThrow();
 
     return true;
 }
@@ -164,13 +155,9 @@ bool VlanMgr::setHostVlanAdminState(int vlan_id, const string &admin_status)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /sbin/ip link set Vlan{{vlan_id}} {{admin_status}}
-    ostringstream cmds;
-    cmds << IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " " << shellquote(admin_status);
-
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    // ip link set Vlan{{vlan_id}} {{admin_status}}
+    m_netlink->setLinkAdminState(VLAN_PREFIX + std::to_string(vlan_id), admin_status == "up");
+    m_netlink->commitOrThrow();
 
     return true;
 }
@@ -179,53 +166,33 @@ bool VlanMgr::setHostVlanMtu(int vlan_id, uint32_t mtu)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /sbin/ip link set Vlan{{vlan_id}} mtu {{mtu}}
-    const std::string cmds = std::string("")
-      + IP_CMD + " link set " + VLAN_PREFIX + std::to_string(vlan_id) + " mtu " + std::to_string(mtu);
-
-    std::string res;
-    int ret = swss::exec(cmds, res);
-    if (ret == 0)
-    {
-        return true;
-    }
+    // ip link set Vlan{{vlan_id}} mtu {{mtu}}
+    m_netlink->setLinkMtu(VLAN_PREFIX + std::to_string(vlan_id), mtu);
 
     /* VLAN mtu should not be larger than member mtu */
-    return false;
+    return m_netlink->commit().front().error == 0;
 }
 
 bool VlanMgr::setHostVlanMac(int vlan_id, const string &mac)
 {
     SWSS_LOG_ENTER();
 
-    std::string res;
-
     /*
      * Bring down the bridge before changing MAC addresses of the bridge and the VLAN interface.
      * This is done so that the IPv6 link-local addresses of the bridge and the VLAN interface
      * are updated after MAC change.
-     * /sbin/ip link set Bridge down
+     * ip link set Bridge down &&
+     * ip link set Vlan{{vlan_id}} address {{mac}} &&
+     * ip link set Bridge address {{mac}} &&
+     * ip link set Bridge up
      */
-    string bridge_down(IP_CMD " link set " DOT1Q_BRIDGE_NAME " down");
-    EXEC_WITH_ERROR_THROW(bridge_down, res);
-
-    // The command should be generated as:
-    // /sbin/ip link set Vlan{{vlan_id}} address {{mac}} &&
-    // /sbin/ip link set Bridge address {{mac}}
-    ostringstream cmds;
-    cmds << IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " address " << shellquote(mac) << " && "
-            IP_CMD " link set " DOT1Q_BRIDGE_NAME " address " << shellquote(mac);
-    res.clear();
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    MacAddress address(mac);
 
-    /*
-     * Start up the bridge again.
-     * /sbin/ip link set Bridge up
-     */
-    string bridge_up(IP_CMD " link set " DOT1Q_BRIDGE_NAME " up");
-    res.clear();
-    EXEC_WITH_ERROR_THROW(bridge_up, res);
+    m_netlink->setLinkAdminState(DOT1Q_BRIDGE_NAME, false);
+    m_netlink->setLinkAddress(VLAN_PREFIX + std::to_string(vlan_id), address);
+    m_netlink->setLinkAddress(DOT1Q_BRIDGE_NAME, address);
+    m_netlink->setLinkAdminState(DOT1Q_BRIDGE_NAME, true);
+    m_netlink->commitOrThrow();
 
     return true;
 }
@@ -234,39 +201,39 @@ bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const str
 {
     SWSS_LOG_ENTER();
 
-    std::string tagging_cmd;
+    uint16_t flags = 0;
     if (tagging_mode == "untagged" || tagging_mode == "priority_tagged")
     {
-        tagging_cmd = "pvid untagged";
+        flags = NETLINK_VLAN_PVID | NETLINK_VLAN_UNTAGGED;
     }
 
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/ip link set {{port_alias}} master Bridge &&
-    //               /sbin/bridge vlan del vid 1 dev {{ port_alias }} &&
-    //               /sbin/bridge vlan add vid {{vlan_id}} dev {{port_alias}} {{tagging_mode}}"
-    ostringstream cmds, inner;
-    inner << IP_CMD " link set " << shellquote(port_alias) << " master " DOT1Q_BRIDGE_NAME " && "
-      BRIDGE_CMD " vlan del vid " DEFAULT_VLAN_ID " dev " << shellquote(port_alias) << " && "
-      BRIDGE_CMD " vlan add vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " " + tagging_cmd;
-    cmds << BASH_CMD " -c " << shellquote(inner.str());
-
-    std::string res;
-    try
-    {
-        EXEC_WITH_ERROR_THROW(cmds.str(), res);
-    }
-    catch (const std::runtime_error& e)
+    // ip link set {{port_alias}} master Bridge &&
+    // bridge vlan del vid 1 dev {{ port_alias }} &&
+    // bridge vlan add vid {{vlan_id}} dev {{port_alias}} {{tagging_mode}}
+    auto queueMember = [&]() {
+        m_netlink->setLinkMaster(port_alias, DOT1Q_BRIDGE_NAME);
+        m_netlink->delBridgeVlan(port_alias, DEFAULT_VLAN_ID, 0);
+        m_netlink->addBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id), flags);
+    };
+
+    queueMember();
+    for (const auto &result : m_netlink->commit())
     {
+        if (result.error == 0)
+        {
+            continue;
+        }
+
         // Race conidtion can happen with portchannel removal might happen
-	// but state db is not updated yet so we can do retry instead of sending exception
-	if (!port_alias.compare(0, strlen(LAG_PREFIX), LAG_PREFIX))
-	{
+        // but state db is not updated yet so we can do retry instead of sending exception
+        if (!port_alias.compare(0, strlen(LAG_PREFIX), LAG_PREFIX))
+        {
             return false;
-	}
-        else
-	{
-            EXEC_WITH_ERROR_THROW(cmds.str(), res);
-	}
+        }
+
+        queueMember();
+        m_netlink->commitOrThrow();
+        break;
     }
 
     return true;
@@ -276,34 +243,22 @@ bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /bin/bash -c '/sbin/bridge vlan del vid {{vlan_id}} dev {{port_alias}} &&
-    //               ( vlanShow=$(/sbin/bridge vlan show dev {{port_alias}});
-    //               ret=$?;
-    //               if [ $ret -eq 0 ]; then
-    //               if (! echo "$vlanShow" | grep -q {{port_alias}})
-    //                 || (echo "$vlanShow" | grep -q None$)
-    //                 || (echo "$vlanShow" | grep -q {{port_alias}}$); then
-    //               /sbin/ip link set {{port_alias}} nomaster;
-    //               fi;
-    //               else exit $ret; fi )'
+    // bridge vlan del vid {{vlan_id}} dev {{port_alias}}
+    m_netlink->delBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id), 0);
+    m_netlink->commitOrThrow();
 
     // When port is not member of any VLAN, it shall be detached from Dot1Q bridge!
-    ostringstream cmds, inner;
-    inner << BRIDGE_CMD " vlan del vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " && ( "
-      "vlanShow=$(" BRIDGE_CMD " vlan show dev " << shellquote(port_alias) << "); "
-      "ret=$?; "
-      "if [ $ret -eq 0 ]; then "
-      "if (! echo \"$vlanShow\" | " GREP_CMD " -q " << shellquote(port_alias) << ") "
-      " || (echo \"$vlanShow\" | " GREP_CMD " -q None$) "
-      " || (echo \"$vlanShow\" | " GREP_CMD " -q " << shellquote(port_alias) << "$); then "
-      IP_CMD " link set " << shellquote(port_alias) << " nomaster; "
-      "fi; "
-      "else exit $ret; fi )";
-    cmds << BASH_CMD " -c " << shellquote(inner.str());
-
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    // ip link set {{port_alias}} nomaster
+    vector<uint16_t> vids;
+    if (!m_netlink->getBridgeVlans(port_alias, vids))
+    {
+        throw runtime_error("bridge vlan show dev " + port_alias + " : failed");
+    }
+    if (vids.empty())
+    {
+        m_netlink->setLinkMaster(port_alias, "");
+        m_netlink->commitOrThrow();
+    }
 
     return true;
 }
@@ -592,6 +547,10 @@ void VlanMgr::processUntaggedVlanMembers(string vlan, const string &members)
 
 void VlanMgr::doVlanMemberTask(Consumer &consumer)
 {
+    /* Member changes of the drain, applied together once all the tasks are parsed */
+    vector<VlanMemberChange> changes;
+    set<string> removedMembers;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -630,7 +589,7 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
        // TODO:  store port/lag/VLAN data in local data structure and perform more validations.
         if (op == SET_COMMAND)
         {
-             if (isVlanMemberStateOk(kfvKey(t)))
+             if (isVlanMemberStateOk(kfvKey(t)) && !removedMembers.count(kfvKey(t)))
              {
                 SWSS_LOG_DEBUG("%s already set", kfvKey(t).c_str());
                 m_vlanMemberReplay.erase(kfvKey(t));
@@ -664,39 +623,19 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
                 continue;
             }
 
-            if (addHostVlanMember(vlan_id, port_alias, tagging_mode))
-            {
-                key = VLAN_PREFIX + to_string(vlan_id);
-                key += DEFAULT_KEY_SEPARATOR;
-                key += port_alias;
-                m_appVlanMemberTableProducer.set(key, kfvFieldsValues(t));
-
-                vector<FieldValueTuple> fvVector;
-                FieldValueTuple s("state", "ok");
-                fvVector.push_back(s);
-                m_stateVlanMemberTable.set(kfvKey(t), fvVector);
-
-                m_vlanMemberReplay.erase(kfvKey(t));
-                m_PortVlanMember[port_alias][vlan_alias] = tagging_mode;
-            }
-            else
-            {
-                SWSS_LOG_INFO("Netdevice for  %s not ready, delaying", kfvKey(t).c_str());
-                it++;
-                continue;
-            }
+            /* Left in m_toSync until applied */
+            changes.push_back({ it, static_cast<uint16_t>(vlan_id), port_alias, tagging_mode });
+            it++;
+            continue;
         }
         else if (op == DEL_COMMAND)
         {
             if (isVlanMemberStateOk(kfvKey(t)))
             {
-                removeHostVlanMember(vlan_id, port_alias);
-                key = VLAN_PREFIX + to_string(vlan_id);
-                key += DEFAULT_KEY_SEPARATOR;
-                key += port_alias;
-                m_appVlanMemberTableProducer.del(key);
-                m_stateVlanMemberTable.del(kfvKey(t));
-                m_PortVlanMember[port_alias].erase(vlan_alias);
+                removedMembers.insert(kfvKey(t));
+                changes.push_back({ it, static_cast<uint16_t>(vlan_id), port_alias, "" });
+                it++;
+                continue;
             }
             else
             {
@@ -711,6 +650,9 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
         /* Other than the case of member port/lag is not ready, no retry will be performed */
         it = consumer.m_toSync.erase(it);
     }
+
+    applyVlanMemberChanges(consumer, changes);
+
     if (!replayDone && m_vlanMemberReplay.empty() &&
         WarmStart::isWarmStart())
     {
@@ -723,6 +665,186 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
     }
 }
 
+/*
+ * Apply the member changes of a drain with per port requests: the removed
+ * VLANs and the added tagged VLANs of a port are sent as ranges of
+ * consecutive VLANs, all the ports in the same batches. Per member, it is
+ * one request to remove the VLAN, then a dump to know if the port is still
+ * a member of a VLAN, and three requests to add the VLAN.
+ */
+void VlanMgr::applyVlanMemberChanges(Consumer &consumer, const vector<VlanMemberChange> &changes)
+{
+    SWSS_LOG_ENTER();
+
+    if (changes.empty())
+    {
+        return;
+    }
+
+    struct PortVlanChanges
+    {
+        set<uint16_t> removed;
+        set<uint16_t> tagged;
+        set<uint16_t> untagged;
+        size_t firstRequest = 0;
+        size_t lastRequest = 0;
+        bool failed = false;
+    };
+
+    map<string, PortVlanChanges> ports;
+    size_t added = 0;
+
+    for (const auto &change : changes)
+    {
+        auto &port = ports[change.port_alias];
+
+        if (change.tagging_mode.empty())
+        {
+            port.removed.insert(change.vlan_id);
+        }
+        else if (change.tagging_mode == "tagged")
+        {
+            port.tagged.insert(change.vlan_id);
+            added++;
+        }
+        else
+        {
+            port.untagged.insert(change.vlan_id);
+            added++;
+        }
+    }
+
+    // bridge vlan del vid {{removed}} dev {{port_alias}}
+    // ip link set {{port_alias}} master Bridge &&
+    // bridge vlan del vid 1 dev {{port_alias}} &&
+    // bridge vlan add vid {{tagged}} dev {{port_alias}} &&
+    // bridge vlan add vid {{untagged}} dev {{port_alias}} pvid untagged
+    auto queuePort = [this](const string &port_alias, const PortVlanChanges &port) {
+        m_netlink->delBridgeVlans(port_alias, port.removed, 0);
+        if (!port.tagged.empty() || !port.untagged.empty())
+        {
+            m_netlink->setLinkMaster(port_alias, DOT1Q_BRIDGE_NAME);
+            m_netlink->delBridgeVlan(port_alias, DEFAULT_VLAN_ID, 0);
+            m_netlink->addBridgeVlans(port_alias, port.tagged, 0);
+            m_netlink->addBridgeVlans(port_alias, port.untagged, NETLINK_VLAN_PVID | NETLINK_VLAN_UNTAGGED);
+        }
+    };
+
+    for (auto &it : ports)
+    {
+        it.second.firstRequest = m_netlink->pending();
+        queuePort(it.first, it.second);
+        it.second.lastRequest = m_netlink->pending();
+    }
+
+    size_t operations = m_netlink->pending();
+    auto results = m_netlink->commit();
+
+    for (auto &it : ports)
+    {
+        for (size_t i = it.second.firstRequest; i < it.second.lastRequest; i++)
+        {
+            if (results[i].error)
+            {
+                SWSS_LOG_WARN("%s : %s", results[i].request.c_str(), strerror(-results[i].error));
+                it.second.failed = true;
+                break;
+            }
+        }
+
+        // Race conidtion can happen with portchannel removal might happen
+        // but state db is not updated yet so we can do retry instead of sending exception
+        if (it.second.failed && it.first.compare(0, strlen(LAG_PREFIX), LAG_PREFIX))
+        {
+            queuePort(it.first, it.second);
+            it.second.failed = false;
+        }
+    }
+
+    operations += m_netlink->pending();
+    m_netlink->commitOrThrow();
+
+    // When port is not member of any VLAN, it shall be detached from Dot1Q bridge!
+    // ip link set {{port_alias}} nomaster
+    size_t detached = 0;
+    for (const auto &it : ports)
+    {
+        if (it.second.removed.empty() || it.second.failed)
+        {
+            continue;
+        }
+
+        vector<uint16_t> vids;
+        if (!m_netlink->getBridgeVlans(it.first, vids))
+        {
+            throw runtime_error("bridge vlan show dev " + it.first + " : failed");
+        }
+        operations++;
+
+        if (vids.empty())
+        {
+            m_netlink->setLinkMaster(it.first, "");
+            detached++;
+        }
+    }
+    m_netlink->commitOrThrow();
+
+    for (const auto &change : changes)
+    {
+        auto &t = change.entry->second;
+        const auto &port = ports[change.port_alias];
+        string vlan_alias = VLAN_PREFIX + to_string(change.vlan_id);
+        string key = vlan_alias + DEFAULT_KEY_SEPARATOR + change.port_alias;
+
+        if (!change.tagging_mode.empty())
+        {
+            if (port.failed)
+            {
+                SWSS_LOG_INFO("Netdevice for  %s not ready, delaying", kfvKey(t).c_str());
+                continue;
+            }
+
+            m_appVlanMemberTableProducer.set(key, kfvFieldsValues(t));
+
+            vector<FieldValueTuple> fvVector;
+            FieldValueTuple s("state", "ok");
+            fvVector.push_back(s);
+            m_stateVlanMemberTable.set(kfvKey(t), fvVector);
+
+            m_vlanMemberReplay.erase(kfvKey(t));
+            m_PortVlanMember[change.port_alias][vlan_alias] = change.tagging_mode;
+        }
+        else
+        {
+            // The VLAN members of a LAG are gone with the LAG
+            if (port.failed)
+            {
+                SWSS_LOG_WARN("Failed to remove %s from the kernel", kfvKey(t).c_str());
+            }
+
+            m_appVlanMemberTableProducer.del(key);
+            m_stateVlanMemberTable.del(kfvKey(t));
+            m_PortVlanMember[change.port_alias].erase(vlan_alias);
+            SWSS_LOG_DEBUG("%s", (consumer.dumpTuple(t)).c_str());
+        }
+
+        consumer.m_toSync.erase(change.entry);
+    }
+
+    size_t perMember = 3 * added + 2 * (changes.size() - added);
+    size_t saved = perMember > operations ? perMember - operations : 0;
+
+    m_vlanMemberChanges += changes.size();
+    m_vlanMemberOperations += operations + detached;
+    m_vlanMemberOperationsSaved += saved;
+
+    if (saved)
+    {
+        SWSS_LOG_NOTICE("Applied %zu VLAN member changes on %zu ports with %zu kernel operations, %zu saved",
+                        changes.size(), ports.size(), operations + detached, saved);
+    }
+}
+
 void VlanMgr::doVlanPacPortTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
@@ -4,9 +4,11 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkprogrammer.h"
 
 #include <set>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace swss {
@@ -15,7 +17,7 @@ class VlanMgr : public Orch
 {
 public:
     VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const std::vector<std::string> &tableNames,
-        const std::vector<std::string> &stateTableNames);
+        const std::vector<std::string> &stateTableNames, std::shared_ptr<NetlinkProgrammer> netlink = nullptr);
     using Orch::doTask;
 
 private:
@@ -29,10 +31,26 @@ private:
     std::set<std::string> m_vlanMemberReplay;
     bool replayDone;
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_PortVlanMember;
+    std::shared_ptr<NetlinkProgrammer> m_netlink;
+
+    /* VLAN member change of a drain of the member table, applied with the other changes of the drain */
+    struct VlanMemberChange
+    {
+        SyncMap::iterator entry;
+        uint16_t vlan_id;
+        std::string port_alias;
+        std::string tagging_mode;       // empty for a removal
+    };
+
+    /* VLAN member changes applied, their kernel operations, and the operations saved by batching them */
+    uint64_t m_vlanMemberChanges = 0;
+    uint64_t m_vlanMemberOperations = 0;
+    uint64_t m_vlanMemberOperationsSaved = 0;
     
     void doTask(Consumer &consumer);
     void doVlanTask(Consumer &consumer);
     void doVlanMemberTask(Consumer &consumer);
+    void applyVlanMemberChanges(Consumer &consumer, const std::vector<VlanMemberChange> &changes);
     void processUntaggedVlanMembers(std::string vlan, const std::string &members);
 
     bool addHostVlan(int vlan_id);
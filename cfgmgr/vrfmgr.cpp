@@ -2,7 +2,6 @@
 #include "logger.h"
 #include "dbconnector.h"
 #include "producerstatetable.h"
-#include "tokenize.h"
 #include "ipprefix.h"
 #include "vrfmgr.h"
 #include "exec.h"
@@ -17,13 +16,15 @@
 
 using namespace swss;
 
-VrfMgr::VrfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames) :
+VrfMgr::VrfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames,
+        shared_ptr<NetlinkProgrammer> netlink) :
         Orch(cfgDb, tableNames),
         m_appVrfTableProducer(appDb, APP_VRF_TABLE_NAME),
         m_appVnetTableProducer(appDb, APP_VNET_TABLE_NAME),
         m_appVxlanVrfTableProducer(appDb, APP_VXLAN_VRF_TABLE_NAME),
         m_stateVrfTable(stateDb, STATE_VRF_TABLE_NAME),
-        m_stateVrfObjectTable(stateDb, STATE_VRF_OBJECT_TABLE_NAME)
+        m_stateVrfObjectTable(stateDb, STATE_VRF_OBJECT_TABLE_NAME),
+        m_netlink(netlink ? netlink : make_shared<RtnlProgrammer>())
 {
     for (uint32_t i = VRF_TABLE_START; i < VRF_TABLE_END; i++)
     {
@@ -31,70 +32,42 @@ VrfMgr::VrfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, con
     }
 
     /* Get existing VRFs from Linux */
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD << " -d link show type vrf";
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
-
-    enum IpShowRowType
+    vector<NetlinkLink> vrfs;
+    if (!m_netlink->getLinks("vrf", vrfs))
     {
-        LINK_ROW,
-        MAC_ROW,
-        DETAILS_ROW,
-    };
-
-    string vrfName;
-    uint32_t table;
-    IpShowRowType rowType = LINK_ROW;
-    const auto& rows = tokenize(res, '\n');
-    for (const auto& row : rows)
+        throw runtime_error("Failed to get the vrf devices");
+    }
+
+    for (const auto &vrf : vrfs)
     {
-        const auto& items = tokenize(row, ' ');
-        switch(rowType)
+        if (WarmStart::isWarmStart())
         {
-            case LINK_ROW:
-                vrfName = items[1];
-                vrfName.pop_back();
-                rowType = MAC_ROW;
-                break;
-            case MAC_ROW:
-                rowType = DETAILS_ROW;
-                break;
-            case DETAILS_ROW:
-                if (WarmStart::isWarmStart())
-                {
-                    table = static_cast<uint32_t>(stoul(items[6]));
-                    m_vrfTableMap[vrfName] = table;
-                    m_freeTables.erase(table);
-                }
-                else
-                {
-                    // No deletion of mgmt table from kernel
-                    if (vrfName.compare("mgmt") == 0)
-                    { 
-                        SWSS_LOG_NOTICE("Skipping remove vrf device %s", vrfName.c_str());
-                        rowType = LINK_ROW;
-                        break;
-                    }
+            m_vrfTableMap[vrf.name] = vrf.vrf_table;
+            m_freeTables.erase(vrf.vrf_table);
+        }
+        else if (vrf.name == MGMT_VRF)
+        {
+            // No deletion of mgmt table from kernel
+            SWSS_LOG_NOTICE("Skipping remove vrf device %s", vrf.name.c_str());
+        }
+        else
+        {
+            SWSS_LOG_NOTICE("Remove vrf device %s", vrf.name.c_str());
+            m_netlink->delLink(vrf.name);
+        }
+    }
 
-                    SWSS_LOG_NOTICE("Remove vrf device %s", vrfName.c_str());
-                    cmd.str("");
-                    cmd.clear();
-                    cmd << IP_CMD << " link del " << vrfName;
-                    int ret = swss::exec(cmd.str(), res);
-                    if (ret)
-                    {
-                        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
-                    }
-                }
-                rowType = LINK_ROW;
-                break;
+    for (const auto &result : m_netlink->commit())
+    {
+        if (result.error)
+        {
+            SWSS_LOG_ERROR("Command '%s' failed: %s", result.request.c_str(), strerror(-result.error));
         }
     }
 
-    cmd.str("");
-    cmd.clear();
+    stringstream cmd;
+    string res;
+
     cmd << IP_CMD << " rule | grep '^0:'";
     if (swss::exec(cmd.str(), res) == 0)
     {
@@ -137,9 +110,6 @@ bool VrfMgr::delLink(const string& vrfName)
 {
     SWSS_LOG_ENTER();
 
-    stringstream cmd;
-    string res;
-
     if (m_vrfTableMap.find(vrfName) == m_vrfTableMap.end())
     {
         return false;
@@ -152,8 +122,8 @@ bool VrfMgr::delLink(const string& vrfName)
         return true;
     }
 
-    cmd << IP_CMD << " link del " << shellquote(vrfName);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_netlink->delLink(vrfName);
+    m_netlink->commitOrThrow();
 
     recycleTable(m_vrfTableMap[vrfName]);
     m_vrfTableMap.erase(vrfName);
@@ -165,9 +135,6 @@ bool VrfMgr::setLink(const string& vrfName)
 {
     SWSS_LOG_ENTER();
 
-    stringstream cmd;
-    string res;
-
     if (m_vrfTableMap.find(vrfName) != m_vrfTableMap.end())
     {
         return true;
@@ -188,16 +155,17 @@ bool VrfMgr::setLink(const string& vrfName)
         return false;
     }
 
-    cmd << IP_CMD << " link add " << shellquote(vrfName) << " type vrf table " << table;
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    // ip link add {{vrfName}} up type vrf table {{table}}
+    NetlinkLink vrf;
+    vrf.name = vrfName;
+    vrf.kind = "vrf";
+    vrf.vrf_table = table;
+    vrf.up = true;
+    m_netlink->addLink(vrf);
+    m_netlink->commitOrThrow();
 
     m_vrfTableMap.emplace(vrfName, table);
 
-    cmd.str("");
-    cmd.clear();
-    cmd << IP_CMD << " link set " << shellquote(vrfName) << " up";
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
-
     return true;
 }
 
@@ -3,10 +3,12 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <set>
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkprogrammer.h"
 
 using namespace std;
 
@@ -17,7 +19,8 @@ typedef std::unordered_map<std::string, uint32_t> VRFNameVNIMapTable;
 class VrfMgr : public Orch
 {
 public:
-    VrfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const std::vector<std::string> &tableNames);
+    VrfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const std::vector<std::string> &tableNames,
+           std::shared_ptr<NetlinkProgrammer> netlink = nullptr);
     using Orch::doTask;
     std::string m_evpnVxlanTunnel;
 
@@ -44,6 +47,7 @@ private:
 
     Table m_stateVrfTable, m_stateVrfObjectTable;
     ProducerStateTable m_appVrfTableProducer, m_appVnetTableProducer, m_appVxlanVrfTableProducer;
+    std::shared_ptr<NetlinkProgrammer> m_netlink;
 };
 
 }
@@ -1,17 +1,16 @@
 #include <unistd.h>
 #include <algorithm>
-#include <regex>
-#include <sstream>
+#include <cerrno>
+#include <cstring>
 #include <string>
 #include <net/if.h>
+#include <net/ethernet.h>
 
 #include "logger.h"
 #include "producerstatetable.h"
 #include "macaddress.h"
+#include "converter.h"
 #include "vxlanmgr.h"
-#include "exec.h"
-#include "tokenize.h"
-#include "shellcmd.h"
 #include "warm_restart.h"
 
 using namespace std;
@@ -33,6 +32,8 @@ extern MacAddress gMacAddress;
 #define VXLAN_NAME_PREFIX "Vxlan"
 #define VXLAN_IF_NAME_PREFIX "Brvxlan"
 
+#define DOT1Q_BRIDGE_NAME "Bridge"
+
 #define VLAN "vlan"
 #define DST_IP "dst_ip"
 #define SOURCE_VTEP "source_vtep"
@@ -50,137 +51,156 @@ static std::string getVxlanIfName(const swss::VxlanMgr::VxlanInfo & info)
 // Commands
 
 #define RET_SUCCESS 0
+#define VXLAN_DST_PORT 4789
+
+// Send the queued requests, returns the first error
+static int commitVxlanRequests(NetlinkProgrammer & netlink)
+{
+    int ret = RET_SUCCESS;
+    for (const auto & result : netlink.commit())
+    {
+        if (result.error)
+        {
+            SWSS_LOG_INFO("%s : %s", result.request.c_str(), strerror(-result.error));
+            ret = ret ? ret : result.error;
+        }
+    }
+    return ret;
+}
+
+// Vxlan link of a VNI, false if the VNI or an address is invalid
+static bool getVxlanLink(const std::string & name, const std::string & vni,
+                         const std::string & srcIp, const std::string & dstIp,
+                         NetlinkLink & link)
+{
+    try
+    {
+        link.name = name;
+        link.kind = "vxlan";
+        link.vni = to_uint<uint32_t>(vni);
+        link.dst_port = VXLAN_DST_PORT;
+        if (!srcIp.empty())
+        {
+            link.local = IpAddress(srcIp);
+        }
+        if (!dstIp.empty())
+        {
+            link.remote = IpAddress(dstIp);
+        }
+    }
+    catch (const std::exception & e)
+    {
+        SWSS_LOG_ERROR("Invalid vxlan %s (vni: %s, source ip: %s, remote ip: %s): %s",
+                       name.c_str(), vni.c_str(), srcIp.c_str(), dstIp.c_str(), e.what());
+        return false;
+    }
+    return true;
+}
 
-static int cmdCreateVxlan(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdCreateVxlan(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // ip link add {{VXLAN}} type vxlan id {{VNI}} [local {{SOURCE IP}}] dstport 4789
-    ostringstream cmd;
-    cmd << IP_CMD " link add "
-        << shellquote(info.m_vxlan)
-        << " type vxlan id "
-        << shellquote(info.m_vni)
-        << " ";
-    if (!info.m_sourceIp.empty())
-    {
-        cmd << " local " << shellquote(info.m_sourceIp);
-    }
-    cmd << " dstport 4789";
-    return swss::exec(cmd.str(), res);
+    NetlinkLink link;
+    if (!getVxlanLink(info.m_vxlan, info.m_vni, info.m_sourceIp, "", link))
+    {
+        return -EINVAL;
+    }
+    netlink.addLink(link);
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdUpVxlan(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdUpVxlan(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // ip link set dev {{VXLAN}} up
-    ostringstream cmd;
-    cmd << IP_CMD " link set dev "
-        << shellquote(info.m_vxlan)
-        << " up";
-    return swss::exec(cmd.str(), res);
+    netlink.setLinkAdminState(info.m_vxlan, true);
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdCreateVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdCreateVxlanIf(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // ip link add {{VXLAN_IF}} type bridge
-    ostringstream cmd;
-    cmd << IP_CMD " link add "
-        << shellquote(info.m_vxlanIf)
-        << " type bridge";
-    return swss::exec(cmd.str(), res);
+    NetlinkLink link;
+    link.name = info.m_vxlanIf;
+    link.kind = "bridge";
+    netlink.addLink(link);
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdAddVxlanIntoVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdAddVxlanIntoVxlanIf(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // brctl addif {{VXLAN_IF}} {{VXLAN}}
-    ostringstream cmd;
-    cmd << BRCTL_CMD " addif "
-        << shellquote(info.m_vxlanIf)
-        << " "
-        << shellquote(info.m_vxlan);
-    if (!info.m_macAddress.empty())
+    netlink.setLinkMaster(info.m_vxlan, info.m_vxlanIf);
+    int ret = commitVxlanRequests(netlink);
+    if (ret == RET_SUCCESS && !info.m_macAddress.empty())
     {
         // Change the MAC address of Vxlan bridge interface to ensure it's same with switch's.
         // Otherwise it will not response traceroute packets.
         // ip link set dev {{VXLAN_IF}} address {{MAC_ADDRESS}}
-        cmd << " && " IP_CMD " link set dev "
-            << shellquote(info.m_vxlanIf)
-            << " address "
-            << shellquote(info.m_macAddress);
+        uint8_t mac[ETHER_ADDR_LEN];
+        if (!MacAddress::parseMacString(info.m_macAddress, mac))
+        {
+            SWSS_LOG_ERROR("Invalid mac address %s of %s", info.m_macAddress.c_str(), info.m_vxlanIf.c_str());
+            return -EINVAL;
+        }
+        netlink.setLinkAddress(info.m_vxlanIf, MacAddress(mac));
+        ret = commitVxlanRequests(netlink);
     }
-    return swss::exec(cmd.str(), res);
+    return ret;
 }
 
-static int cmdAttachVxlanIfToVnet(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdAttachVxlanIfToVnet(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // ip link set dev {{VXLAN_IF}} master {{VNET}}
-    ostringstream cmd;
-    cmd << IP_CMD " link set dev "
-        << shellquote(info.m_vxlanIf)
-        << " master "
-        << shellquote(info.m_vnet);
-    return swss::exec(cmd.str(), res);
+    netlink.setLinkMaster(info.m_vxlanIf, info.m_vnet);
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdUpVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdUpVxlanIf(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // ip link set dev {{VXLAN_IF}} up
-    ostringstream cmd;
-    cmd << IP_CMD " link set dev "
-        << shellquote(info.m_vxlanIf)
-        << " up";
-    return swss::exec(cmd.str(), res);
+    netlink.setLinkAdminState(info.m_vxlanIf, true);
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdDeleteVxlan(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdDeleteVxlan(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // ip link del dev {{VXLAN}}
-    ostringstream cmd;
-    cmd << IP_CMD " link del dev "
-        << shellquote(info.m_vxlan);
-    return swss::exec(cmd.str(), res);
+    netlink.delLink(info.m_vxlan);
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdVxlanLearningOff(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdVxlanLearningOff(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // bridge link set dev {{VXLAN}} learning off
-    ostringstream cmd;
-    cmd << BRIDGE_CMD << " link set dev "
-        << shellquote(info.m_vxlan) << " learning off";
-    return swss::exec(cmd.str(), res);
+    netlink.setBridgePortLearning(info.m_vxlan, false);
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdDeleteVxlanFromVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdDeleteVxlanFromVxlanIf(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // brctl delif {{VXLAN_IF}} {{VXLAN}}
-    ostringstream cmd;
-    cmd << BRCTL_CMD " delif "
-        << shellquote(info.m_vxlanIf)
-        << " " 
-        << shellquote(info.m_vxlan);
-    return swss::exec(cmd.str(), res);
+    netlink.setLinkMaster(info.m_vxlan, "");
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdDeleteVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdDeleteVxlanIf(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // ip link del {{VXLAN_IF}}
-    ostringstream cmd;
-    cmd << IP_CMD " link del "
-        << shellquote(info.m_vxlanIf);
-    return swss::exec(cmd.str(), res);
+    netlink.delLink(info.m_vxlanIf);
+    return commitVxlanRequests(netlink);
 }
 
-static int cmdDetachVxlanIfFromVnet(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdDetachVxlanIfFromVnet(NetlinkProgrammer & netlink, const swss::VxlanMgr::VxlanInfo & info)
 {
     // ip link set dev {{VXLAN_IF}} nomaster
-    ostringstream cmd;
-    cmd << IP_CMD " link set dev "
-        << shellquote(info.m_vxlanIf)
-        << " nomaster";
-    return swss::exec(cmd.str(), res);
+    netlink.setLinkMaster(info.m_vxlanIf, "");
+    return commitVxlanRequests(netlink);
 }
 
 // Vxlanmgr
 
-VxlanMgr::VxlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<std::string> &tables) :
+VxlanMgr::VxlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<std::string> &tables,
+                   shared_ptr<NetlinkProgrammer> netlink) :
         m_app_db(appDb),
         Orch(cfgDb, tables),
         m_appVxlanTunnelTable(appDb, APP_VXLAN_TUNNEL_TABLE_NAME),
@@ -193,7 +213,8 @@ VxlanMgr::VxlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb,
         m_stateVxlanTable(stateDb, STATE_VXLAN_TABLE_NAME),
         m_stateVlanTable(stateDb, STATE_VLAN_TABLE_NAME),
         m_stateNeighSuppressVlanTable(stateDb, STATE_NEIGH_SUPPRESS_VLAN_TABLE_NAME),
-        m_stateVxlanTunnelTable(stateDb, STATE_VXLAN_TUNNEL_TABLE_NAME)
+        m_stateVxlanTunnelTable(stateDb, STATE_VXLAN_TUNNEL_TABLE_NAME),
+        m_netlink(netlink ? netlink : make_shared<RtnlProgrammer>())
 {
     getAllVxlanNetDevices();
 
@@ -808,11 +829,10 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
 {
     SWSS_LOG_ENTER();
     
-    std::string res;
     int ret = 0;
 
     // Create Vxlan
-    ret = cmdCreateVxlan(info, res);
+    ret = cmdCreateVxlan(*m_netlink, info);
     if (ret != RET_SUCCESS)
     {
         SWSS_LOG_WARN(
@@ -824,10 +844,10 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Up Vxlan
-    ret = cmdUpVxlan(info, res);
+    ret = cmdUpVxlan(*m_netlink, info);
     if (ret != RET_SUCCESS)
     {
-        cmdDeleteVxlan(info, res);
+        cmdDeleteVxlan(*m_netlink, info);
         SWSS_LOG_WARN(
             "Fail to up vxlan %s",
             info.m_vxlan.c_str());
@@ -835,10 +855,10 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Create Vxlan Interface
-    ret = cmdCreateVxlanIf(info, res);
+    ret = cmdCreateVxlanIf(*m_netlink, info);
     if (ret != RET_SUCCESS)
     {
-        cmdDeleteVxlan(info, res);
+        cmdDeleteVxlan(*m_netlink, info);
         SWSS_LOG_WARN(
             "Fail to create vxlan interface %s",
             info.m_vxlanIf.c_str());
@@ -846,11 +866,11 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Add vxlan into vxlan interface
-    ret = cmdAddVxlanIntoVxlanIf(info, res);
+    ret = cmdAddVxlanIntoVxlanIf(*m_netlink, info);
     if ( ret != RET_SUCCESS )
     {
-        cmdDeleteVxlanIf(info, res);
-        cmdDeleteVxlan(info, res);
+        cmdDeleteVxlanIf(*m_netlink, info);
+        cmdDeleteVxlan(*m_netlink, info);
         SWSS_LOG_WARN(
             "Fail to add %s into %s",
             info.m_vxlan.c_str(),
@@ -859,12 +879,12 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Attach vxlan interface to vnet
-    ret = cmdAttachVxlanIfToVnet(info, res);
+    ret = cmdAttachVxlanIfToVnet(*m_netlink, info);
     if ( ret != RET_SUCCESS )
     {
-        cmdDeleteVxlanFromVxlanIf(info, res);
-        cmdDeleteVxlanIf(info, res);
-        cmdDeleteVxlan(info, res);
+        cmdDeleteVxlanFromVxlanIf(*m_netlink, info);
+        cmdDeleteVxlanIf(*m_netlink, info);
+        cmdDeleteVxlan(*m_netlink, info);
         SWSS_LOG_WARN(
             "Fail to set %s master %s",
             info.m_vxlanIf.c_str(),
@@ -874,13 +894,13 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Up Vxlan Interface
-    ret = cmdUpVxlanIf(info, res);
+    ret = cmdUpVxlanIf(*m_netlink, info);
     if ( ret != RET_SUCCESS )
     {
-        cmdDetachVxlanIfFromVnet(info, res);
-        cmdDeleteVxlanFromVxlanIf(info, res);
-        cmdDeleteVxlanIf(info, res);
-        cmdDeleteVxlan(info, res);
+        cmdDetachVxlanIfFromVnet(*m_netlink, info);
+        cmdDeleteVxlanFromVxlanIf(*m_netlink, info);
+        cmdDeleteVxlanIf(*m_netlink, info);
+        cmdDeleteVxlan(*m_netlink, info);
         SWSS_LOG_WARN(
             "Fail to up bridge %s",
             info.m_vxlanIf.c_str());
@@ -898,12 +918,10 @@ bool VxlanMgr::deleteVxlan(const VxlanInfo & info)
 {
     SWSS_LOG_ENTER();
 
-    std::string res;
-
-    cmdDetachVxlanIfFromVnet(info, res);
-    cmdDeleteVxlanFromVxlanIf(info, res);
-    cmdDeleteVxlanIf(info, res);
-    cmdDeleteVxlan(info, res);
+    cmdDetachVxlanIfFromVnet(*m_netlink, info);
+    cmdDeleteVxlanFromVxlanIf(*m_netlink, info);
+    cmdDeleteVxlanIf(*m_netlink, info);
+    cmdDeleteVxlan(*m_netlink, info);
 
     m_stateVxlanTable.del(info.m_vxlan);
 
@@ -954,9 +972,6 @@ int VxlanMgr::createVxlanNetdevice(std::string vxlanTunnelName, std::string vni_
                                    std::string src_ip, std::string dst_ip,
                                    std::string vlan_id)
 {
-    std::string res, cmds;
-    std::string link_add_cmd, link_set_master_cmd, link_up_cmd;
-    std::string bridge_add_cmd, bridge_untagged_add_cmd, bridge_del_vid_cmd, bridge_learn_off_cmd;
     std::string vxlan_dev_name;
     bool evpn_nvo = false;
 
@@ -1007,113 +1022,89 @@ int VxlanMgr::createVxlanNetdevice(std::string vxlanTunnelName, std::string vni_
     // bridge vlan add vid <vlan_id> untagged pvid dev <vxlan_dev_name>
     // bridge link set dev <vxlan_dev_name> learning off
     // ip link set <vxlan_dev_name> up
+    NetlinkLink link;
+    uint16_t vid;
+    try
+    {
+        vid = to_uint<uint16_t>(vlan_id);
+    }
+    catch (const std::exception & e)
+    {
+        SWSS_LOG_ERROR("Invalid vlan id %s of %s: %s", vlan_id.c_str(), vxlan_dev_name.c_str(), e.what());
+        return -EINVAL;
+    }
+    if (!getVxlanLink(vxlan_dev_name, vni_id, src_ip, dst_ip, link))
+    {
+        return -EINVAL;
+    }
+    link.address = gMacAddress;
+    link.learning = false;
 
-    link_add_cmd = std::string("") + IP_CMD + " link add " + vxlan_dev_name + 
-                   " address " + gMacAddress.to_string() + " type vxlan id " + 
-                   std::string(vni_id) + " local " + src_ip + 
-                   ((dst_ip  == "")? "":(" remote " + dst_ip)) + 
-                   " nolearning " + " dstport 4789 ";
-    
-    link_set_master_cmd = std::string("") + IP_CMD + " link set " + 
-                          vxlan_dev_name + " master Bridge ";
-
-    link_up_cmd = std::string("") + IP_CMD + " link set " + vxlan_dev_name + " up ";
-
-    bridge_add_cmd = std::string("") + BRIDGE_CMD + " vlan add vid " + 
-                     std::string(vlan_id) + " dev " + vxlan_dev_name;
-
-    bridge_untagged_add_cmd = std::string("") + BRIDGE_CMD + " vlan add vid " + 
-                              std::string(vlan_id) + " untagged pvid dev " + vxlan_dev_name;
-
-    bridge_del_vid_cmd = std::string("") + BRIDGE_CMD + " vlan del vid 1 dev " + 
-                         vxlan_dev_name;
-
-    bridge_learn_off_cmd = std::string("") + BRIDGE_CMD + " link set dev " +
-                           vxlan_dev_name + " learning off ";
-    
-    
-    cmds = std::string("") + BASH_CMD + " -c \"" + 
-           link_add_cmd + " && " + 
-           link_set_master_cmd + " && " + 
-           bridge_add_cmd + " && " + 
-           bridge_untagged_add_cmd + " && "; 
-        
-    if ( vlan_id != "1")
+    // Each request depends on the previous ones, stop at the first failure
+    // like the && chain of commands did
+    m_netlink->addLink(link);
+    m_netlink->setLinkMaster(vxlan_dev_name, DOT1Q_BRIDGE_NAME);
+    int ret = commitVxlanRequests(*m_netlink);
+    if (ret != RET_SUCCESS)
     {
-        cmds += bridge_del_vid_cmd + " && ";
+        return ret;
     }
 
+    m_netlink->addBridgeVlan(vxlan_dev_name, vid, 0);
+    m_netlink->addBridgeVlan(vxlan_dev_name, vid, NETLINK_VLAN_PVID | NETLINK_VLAN_UNTAGGED);
+    if (vid != 1)
+    {
+        m_netlink->delBridgeVlan(vxlan_dev_name, 1, 0);
+    }
     if (evpn_nvo)
     {
-        cmds += bridge_learn_off_cmd + " && ";
+        m_netlink->setBridgePortLearning(vxlan_dev_name, false);
+    }
+    ret = commitVxlanRequests(*m_netlink);
+    if (ret != RET_SUCCESS)
+    {
+        return ret;
     }
 
-    cmds += link_up_cmd + "\"";
-
-    return swss::exec(cmds,res);
+    m_netlink->setLinkAdminState(vxlan_dev_name, true);
+    return commitVxlanRequests(*m_netlink);
 }
 
 int VxlanMgr::downVxlanNetdevice(std::string vxlan_dev_name)
 {
     int ret = 0;
-    std::string res;
-    const std::string cmd = std::string("") + IP_CMD + " link set dev " + vxlan_dev_name + " down";
-    exec(cmd, res);
+    m_netlink->setLinkAdminState(vxlan_dev_name, false);
+    m_netlink->commit();
     return ret;
 }
 
 int VxlanMgr::deleteVxlanNetdevice(std::string vxlan_dev_name)
 {    
-    std::string res;
-    const std::string cmd = std::string("") + IP_CMD  + " link del dev " + vxlan_dev_name;
-    return swss::exec(cmd, res);
-}
-
-std::vector<std::string> VxlanMgr::parseNetDev(const string& stdout){
-    std::vector<std::string> netdevs;
-    std::regex device_name_pattern("^\\d+:\\s+([^:]+)");
-    std::smatch match_result;
-    auto lines = tokenize(stdout, '\n');
-    for (const std::string & line : lines)
-    {
-        SWSS_LOG_DEBUG("line : %s\n",line.c_str());
-        if (!std::regex_search(line, match_result, device_name_pattern))
-        {
-            continue;
-        }
-        std::string dev_name = match_result[1];
-        netdevs.push_back(dev_name);
-    }
-    return netdevs;
+    m_netlink->delLink(vxlan_dev_name);
+    return commitVxlanRequests(*m_netlink);
 }
 
 void VxlanMgr::getAllVxlanNetDevices()
 {
-    std::string stdout;
+    std::vector<std::string> netdevs;
 
     // Get VxLan Netdev Interfaces
-    std::string cmd = std::string("") + IP_CMD + " link show type vxlan";
-    int ret = swss::exec(cmd, stdout);
-    if (ret != 0)
+    if (!m_netlink->getLinks("vxlan", netdevs))
     {
-        SWSS_LOG_ERROR("Cannot get vxlan devices by command : %s", cmd.c_str());
-        stdout.clear();
+        SWSS_LOG_ERROR("Cannot get vxlan devices");
+        netdevs.clear();
     }
-    std::vector<std::string> netdevs = parseNetDev(stdout);
     for (auto netdev : netdevs)
     {
         m_vxlanNetDevices[netdev] = VXLAN;
     }
 
     // Get VxLanIf Netdev Interfaces
-    cmd = std::string("") + IP_CMD + " link show type bridge";
-    ret = swss::exec(cmd, stdout);
-    if (ret != 0)
+    if (!m_netlink->getLinks("bridge", netdevs))
     {
-        SWSS_LOG_ERROR("Cannot get vxlanIf devices by command : %s", cmd.c_str());
-        stdout.clear();
+        SWSS_LOG_ERROR("Cannot get vxlanIf devices");
+        netdevs.clear();
     }
-    netdevs = parseNetDev(stdout);
     for (auto netdev : netdevs)
     {
         if (netdev.find(VXLAN_IF_NAME_PREFIX) == 0)
@@ -1222,17 +1213,16 @@ void VxlanMgr::clearAllVxlanDevices()
         std::string netdev_type = it->second;
         SWSS_LOG_INFO("Deleting Stale NetDevice %s, type: %s\n", netdev_name.c_str(), netdev_type.c_str());
         VxlanInfo info;
-        std::string res;
         if (netdev_type.compare(VXLAN))
         {
             info.m_vxlan = netdev_name;
             downVxlanNetdevice(netdev_name);
-            cmdDeleteVxlan(info, res);
+            cmdDeleteVxlan(*m_netlink, info);
         }
         else if(netdev_type.compare(VXLAN_IF))
         {
             info.m_vxlanIf = netdev_name;
-            cmdDeleteVxlanIf(info, res);
+            cmdDeleteVxlanIf(*m_netlink, info);
         }
         it = m_vxlanNetDevices.erase(it);
     }
@@ -1244,12 +1234,11 @@ void VxlanMgr::disableLearningForAllVxlanNetdevices()
     {
         std::string netdev_name = it->second.vxlan_dev_name;
         VxlanInfo info;
-        std::string res;
         if (!netdev_name.empty())
         {
             SWSS_LOG_INFO("Disable learning for NetDevice %s\n", netdev_name.c_str());
             info.m_vxlan = netdev_name;
-            cmdVxlanLearningOff(info, res);
+            cmdVxlanLearningOff(*m_netlink, info);
         }
     }
 }
@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkprogrammer.h"
 
 #include <map>
 #include <vector>
@@ -16,7 +17,8 @@ namespace swss {
 class VxlanMgr : public Orch
 {
 public:
-    VxlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const std::vector<std::string> &tableNames);
+    VxlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const std::vector<std::string> &tableNames,
+             std::shared_ptr<NetlinkProgrammer> netlink = nullptr);
     using Orch::doTask;
 
     typedef struct VxlanInfo
@@ -72,7 +74,6 @@ private:
                              std::string src_ip, std::string dst_ip, std::string vlan_id);
     int downVxlanNetdevice(std::string vxlan_dev_name);
     int deleteVxlanNetdevice(std::string vxlan_dev_name);
-    std::vector<std::string> parseNetDev(const std::string& stdout);
     void getAllVxlanNetDevices();
 
     /*
@@ -96,6 +97,8 @@ private:
     Table m_cfgVxlanTunnelTable,m_cfgVnetTable,m_stateVrfTable,m_stateVxlanTable, m_appSwitchTable;
     Table m_stateVlanTable, m_stateNeighSuppressVlanTable, m_stateVxlanTunnelTable;
 
+    std::shared_ptr<NetlinkProgrammer> m_netlink;
+
     /*
     * Vxlan Tunnel Cache
     * Key: tunnel name
@@ -268,14 +268,6 @@ void FpmLink::processFpmMessage(fpm_msg_hdr_t* hdr)
          */
         bool isRaw = isRawProcessing(nl_hdr);
 
-        nl_msg *msg = nlmsg_convert(nl_hdr);
-        if (msg == NULL)
-        {
-            throw system_error(make_error_code(errc::bad_message), "Unable to convert nlmsg");
-        }
-
-        nlmsg_set_proto(msg, NETLINK_ROUTE);
-
         if (isRaw)
         {
             /* EVPN Type5 Add route processing */
@@ -296,11 +288,23 @@ void FpmLink::processFpmMessage(fpm_msg_hdr_t* hdr)
             /* rtnl api dont support RTM_NEWPICCONTEXT/RTM_DELPICCONTEXT yet. Processing as raw message*/
             processRawMsg(nl_hdr);
         }
-        else
+        else if (!m_routesync->onRouteMsgRaw(nl_hdr))
         {
+            /*
+             * Plain IPv4/IPv6 routes are parsed in place by onRouteMsgRaw(),
+             * the others go through a libnl route object.
+             */
+            nl_msg *msg = nlmsg_convert(nl_hdr);
+            if (msg == NULL)
+            {
+                throw system_error(make_error_code(errc::bad_message), "Unable to convert nlmsg");
+            }
+
+            nlmsg_set_proto(msg, NETLINK_ROUTE);
+
             NetDispatcher::getInstance().onNetlinkMessage(msg);
+            nlmsg_free(msg);
         }
-        nlmsg_free(msg);
     }
 }
 
@@ -1,3 +1,4 @@
+#include <getopt.h>
 #include <iostream>
 #include <inttypes.h>
 #include "logger.h"
@@ -32,10 +33,25 @@ static int gFlushTimeout = FLUSH_TIMEOUT;
  * but fpmsyncd can invoke pipeline's flush even if it's not full yet.
  * 
  * By setting gSelectTimeout, fpmsyncd controls the flush interval.
+ * The route updates held by the coalescing stage of RouteSync are written
+ * to the pipeline by the same timer once they are due.
  * 
+ * @param sync reference to the route sync holding coalesced route updates
  * @param pipeline reference to the pipeline to be flushed
  */
-void flushPipeline(RedisPipeline& pipeline);
+void flushPipeline(RouteSync& sync, RedisPipeline& pipeline);
+
+/* Publish the route coalescing counters to STATE_DB when they changed */
+static void publishCoalescingCounters(RouteSync& sync, Table& table);
+
+void usage()
+{
+    cout << "Usage: fpmsyncd [-d max_delay] [-n max_entries]" << endl;
+    cout << "    -d max_delay: hold route updates up to max_delay milliseconds and only write" << endl;
+    cout << "                  the last update of each prefix, 0 disables the coalescing (default: 0)" << endl;
+    cout << "    -n max_entries: write the held route updates once max_entries prefixes are held" << endl;
+    cout << "                    (default: " << ROUTE_COALESCING_MAX_ENTRIES << ")" << endl;
+}
 
 /*
  * Default warm-restart timer interval for routing-stack app. To be used only if
@@ -73,6 +89,29 @@ int main(int argc, char **argv)
 {
     swss::Logger::linkToDbNative("fpmsyncd");
 
+    uint32_t coalescingDelay = 0;
+    size_t coalescingMaxEntries = ROUTE_COALESCING_MAX_ENTRIES;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "d:n:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'd':
+                coalescingDelay = static_cast<uint32_t>(stoul(optarg));
+                break;
+            case 'n':
+                coalescingMaxEntries = stoul(optarg);
+                break;
+            case 'h':
+                usage();
+                return 1;
+            default: /* '?' */
+                usage();
+                return EXIT_FAILURE;
+        }
+    }
+
     const auto routeResponseChannelName = std::string("APPL_DB_") + APP_ROUTE_TABLE_NAME + "_RESPONSE_CHANNEL";
 
     DBConnector db("APPL_DB", 0);
@@ -87,6 +126,14 @@ int main(int argc, char **argv)
 
     DBConnector stateDb("STATE_DB", 0);
     Table bgpStateTable(&stateDb, STATE_BGP_TABLE_NAME);
+    Table coalescingTable(&stateDb, STATE_FPMSYNCD_ROUTE_COALESCING_TABLE_NAME);
+
+    if (coalescingDelay)
+    {
+        sync.setRouteCoalescing(coalescingDelay, coalescingMaxEntries);
+        SWSS_LOG_NOTICE("Route coalescing enabled, max delay %u ms, max entries %zu",
+                        coalescingDelay, coalescingMaxEntries);
+    }
 
     NetLink netlink;
 
@@ -96,6 +143,8 @@ int main(int argc, char **argv)
     NetDispatcher::getInstance().registerMessageHandler(RTM_DELROUTE, &sync);
     NetDispatcher::getInstance().registerMessageHandler(RTM_NEWLINK, &sync);
     NetDispatcher::getInstance().registerMessageHandler(RTM_DELLINK, &sync);
+    /* sync is the route handler, FpmLink can hand it plain routes directly */
+    sync.setRawRouteParsingEnabled(true);
 
     rtnl_route_read_protocol_names(DefaultRtProtoPath);
     nlmsg_set_default_size(FPM_MAX_MSG_LEN);
@@ -125,6 +174,7 @@ int main(int argc, char **argv)
              * Pipeline should be flushed right away to deal with state pending
              * from previous try/catch iterations.
              */
+            sync.flushCoalescedRoutes();
             pipeline.flush();
 
             cout << "Waiting for fpm-client connection..." << endl;
@@ -310,7 +360,8 @@ int main(int argc, char **argv)
                 }
                 else if (!warmStartEnabled || sync.getWarmStartHelper().isReconciled())
                 {
-                    flushPipeline(pipeline);
+                    flushPipeline(sync, pipeline);
+                    publishCoalescingCounters(sync, coalescingTable);
                 }
             }
         }
@@ -323,12 +374,19 @@ int main(int argc, char **argv)
     return 1;
 }
 
-void flushPipeline(RedisPipeline& pipeline) {
+void flushPipeline(RouteSync& sync, RedisPipeline& pipeline) {
+
+    // write the coalesced route updates which have been held long enough
+    int coalescingTimeout = sync.getRouteCoalescingTimeout();
+    if (coalescingTimeout == 0) {
+        sync.flushCoalescedRoutes();
+        coalescingTimeout = INFINITE;
+    }
 
     size_t remaining = pipeline.size();
 
     if (remaining == 0) {
-        gSelectTimeout = INFINITE;
+        gSelectTimeout = coalescingTimeout;
         return;
     }
 
@@ -342,7 +400,7 @@ void flushPipeline(RedisPipeline& pipeline) {
 
         pipeline.flush();
 
-        gSelectTimeout = INFINITE;
+        gSelectTimeout = coalescingTimeout;
 
         SWSS_LOG_DEBUG("Pipeline flushed");
     }
@@ -352,5 +410,26 @@ void flushPipeline(RedisPipeline& pipeline) {
         // so that fpmsyncd select function would block at most for (gFlushTimeout - idle)
         // by doing this, we make sure every entry eventually gets flushed
         gSelectTimeout = gFlushTimeout - idle;
+        if (coalescingTimeout != INFINITE && coalescingTimeout < gSelectTimeout) {
+            gSelectTimeout = coalescingTimeout;
+        }
+    }
+}
+
+static void publishCoalescingCounters(RouteSync& sync, Table& table)
+{
+    static uint64_t lastFlushed = 0;
+
+    const auto& counters = sync.getRouteCoalescingCounters();
+    if (!sync.isRouteCoalescingEnabled() || counters.flushed == lastFlushed) {
+        return;
     }
+    lastFlushed = counters.flushed;
+
+    vector<FieldValueTuple> fvs = {
+        {"received", to_string(counters.received)},
+        {"suppressed", to_string(counters.suppressed)},
+        {"flushed", to_string(counters.flushed)},
+    };
+    table.set("route", fvs);
 }
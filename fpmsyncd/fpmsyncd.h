@@ -5,4 +5,10 @@
 // redispipeline has a maximum capacity of 50000 entries
 #define ROUTE_SYNC_PPL_SIZE 50000
 
+// default bound of the prefixes held by the route coalescing stage
+#define ROUTE_COALESCING_MAX_ENTRIES 10000
+
+// STATE_DB table of the route coalescing counters
+#define STATE_FPMSYNCD_ROUTE_COALESCING_TABLE_NAME "FPMSYNCD_ROUTE_COALESCING_TABLE"
+
 #endif
\ No newline at end of file
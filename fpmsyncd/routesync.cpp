@@ -174,13 +174,17 @@ void RouteSync::setRouteWithWarmRestart(FieldValueTupleWrapperBase & fvw,
 {
     bool warmRestartInProgress = m_warmStartHelper.inProgress();
 
-    if (!warmRestartInProgress)
+    if (warmRestartInProgress)
     {
-        table.set(fvw.KeyOpFieldsValuesTupleVector());
+        m_warmStartHelper.insertRefreshMap(fvw.KeyOpFieldsValuesTupleVector()[0]);
+    }
+    else if (isRouteCoalescingEnabled() && &table == m_routeTable.get())
+    {
+        coalesceRoute(std::move(fvw.KeyOpFieldsValuesTupleVector()[0]));
     }
     else
     {
-        m_warmStartHelper.insertRefreshMap(fvw.KeyOpFieldsValuesTupleVector()[0]);
+        table.set(fvw.KeyOpFieldsValuesTupleVector());
     }
 }
 
@@ -194,11 +198,132 @@ void RouteSync::setTable(FieldValueTupleWrapperBase & fvw,
 void RouteSync::delWithWarmRestart(FieldValueTupleWrapperBase && fvw,
 				   ProducerStateTable & table) {
     bool warmRestartInProgress = m_warmStartHelper.inProgress();
-    if (!warmRestartInProgress) {
-        table.del(fvw.key);
-    } else {
+    if (warmRestartInProgress) {
         m_warmStartHelper.insertRefreshMap(fvw.KeyOpFieldsValuesTupleVectorForDel());
+    } else if (isRouteCoalescingEnabled() && &table == m_routeTable.get()) {
+        coalesceRoute(fvw.KeyOpFieldsValuesTupleVectorForDel());
+    } else {
+        table.del(fvw.key);
+    }
+}
+
+void RouteSync::setRouteCoalescing(uint32_t max_delay, size_t max_entries)
+{
+    flushCoalescedRoutes();
+
+    m_coalesceMaxDelay = max_delay;
+    m_coalesceMaxEntries = max_entries;
+}
+
+void RouteSync::coalesceRoute(KeyOpFieldsValuesTuple &&kfv)
+{
+    m_coalesceCounters.received++;
+
+    auto it = m_coalescedIndex.find(kfvKey(kfv));
+    if (it != m_coalescedIndex.end())
+    {
+        CoalescedRoute &held = m_coalescedRoutes[it->second];
+        bool set = kfvOp(kfv) == SET_COMMAND;
+
+        /* A DEL replaced by a SET is still written, anything else is dropped */
+        if (kfvOp(held.kfv) == SET_COMMAND || !set)
+        {
+            m_coalesceCounters.suppressed++;
+        }
+        held.del_first = set && (held.del_first || kfvOp(held.kfv) == DEL_COMMAND);
+        held.kfv = std::move(kfv);
+        return;
+    }
+
+    if (m_coalescedRoutes.empty())
+    {
+        m_coalesceStart = chrono::steady_clock::now();
+    }
+    m_coalescedIndex.emplace(kfvKey(kfv), m_coalescedRoutes.size());
+    m_coalescedRoutes.push_back(CoalescedRoute{std::move(kfv), false});
+
+    if (m_coalesceMaxEntries && m_coalescedRoutes.size() >= m_coalesceMaxEntries)
+    {
+        flushCoalescedRoutes();
+    }
+}
+
+void RouteSync::flushCoalescedRoutes()
+{
+    if (m_coalescedRoutes.empty())
+    {
+        return;
+    }
+
+    vector<KeyOpFieldsValuesTuple> sets;
+    sets.reserve(m_coalescedRoutes.size());
+
+    for (auto &held : m_coalescedRoutes)
+    {
+        const string &op = kfvOp(held.kfv);
+
+        /* Already written by flushCoalescedRoute() */
+        if (op.empty())
+        {
+            continue;
+        }
+
+        if (op == DEL_COMMAND || held.del_first)
+        {
+            m_routeTable->del(kfvKey(held.kfv));
+        }
+        if (op == SET_COMMAND)
+        {
+            sets.push_back(std::move(held.kfv));
+        }
+        m_coalesceCounters.flushed++;
+    }
+
+    if (!sets.empty())
+    {
+        m_routeTable->set(sets);
+    }
+
+    SWSS_LOG_INFO("Flushed %zu coalesced routes, %" PRIu64 " updates suppressed so far",
+                  m_coalescedIndex.size(), m_coalesceCounters.suppressed);
+
+    m_coalescedRoutes.clear();
+    m_coalescedIndex.clear();
+}
+
+void RouteSync::flushCoalescedRoute(const string &key)
+{
+    auto it = m_coalescedIndex.find(key);
+    if (it == m_coalescedIndex.end())
+    {
+        return;
+    }
+
+    CoalescedRoute &held = m_coalescedRoutes[it->second];
+    if (kfvOp(held.kfv) == DEL_COMMAND || held.del_first)
+    {
+        m_routeTable->del(key);
+    }
+    if (kfvOp(held.kfv) == SET_COMMAND)
+    {
+        m_routeTable->set(vector<KeyOpFieldsValuesTuple>{held.kfv});
+    }
+    m_coalesceCounters.flushed++;
+
+    std::get<1>(held.kfv).clear();
+    m_coalescedIndex.erase(it);
+}
+
+int RouteSync::getRouteCoalescingTimeout() const
+{
+    if (m_coalescedRoutes.empty())
+    {
+        return -1;
     }
+
+    auto held = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - m_coalesceStart).count();
+
+    return held >= static_cast<int64_t>(m_coalesceMaxDelay) ? 0 : static_cast<int>(m_coalesceMaxDelay - held);
 }
 
 char *RouteSync::prefixMac2Str(char *mac, char *buf, int size)
@@ -1011,6 +1136,21 @@ RouteTableFieldValueTupleWrapper::fieldValueTupleVector() {
     return fvVector;
 }
 
+void RouteTableFieldValueTupleWrapper::clear() {
+    key.clear();
+    protocol.clear();
+    blackhole.assign("false");
+    nexthop.clear();
+    ifname.clear();
+    nexthop_group.clear();
+    mpls_nh.clear();
+    weight.clear();
+    vni_label.clear();
+    router_mac.clear();
+    segment.clear();
+    seg_src.clear();
+}
+
 
 
 vector<FieldValueTuple>
@@ -1737,6 +1877,7 @@ void RouteSync::onSrv6VpnRouteMsg(struct nlmsghdr *h, int len)
                 FieldValueTuple wg("weight", weights.c_str());
                 fvVector.push_back(wg);
             }
+            flushCoalescedRoute(routeTableKey);
             m_routeTable->set(routeTableKey, fvVector);
 
             SWSS_LOG_DEBUG("NextHop group id %d is a single nexthop address. Filling the route table %s with nexthop and ifname", nhg_id, destipprefix);
@@ -1765,6 +1906,7 @@ void RouteSync::onSrv6VpnRouteMsg(struct nlmsghdr *h, int len)
             fvVectorVpnRoute.push_back(vpn_sid);
             fvVectorVpnRoute.push_back(seg_srcs_route);
             fvVectorVpnRoute.push_back(intf);
+            flushCoalescedRoute(routeTableKey);
             m_routeTable->set(routeTableKey, fvVectorVpnRoute);
         }
     }
@@ -1927,6 +2069,7 @@ void RouteSync::onMsg(int nlmsg_type, struct nl_object *obj)
 {
     if (nlmsg_type == RTM_NEWLINK || nlmsg_type == RTM_DELLINK)
     {
+        updateIfNameCache(nlmsg_type, (struct rtnl_link *)obj);
         nl_cache_refill(m_nl_sock, m_link_cache);
         return;
     }
@@ -2070,37 +2213,13 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
     string mpls_list;
     string weights;
 
-    string nhg_id_key;
     uint32_t nhg_id = rtnl_route_get_nh_id(route_obj);
     if(nhg_id)
     {
-        const auto itg = m_nh_groups.find(nhg_id);
-        if(itg == m_nh_groups.end())
+        if (!fillNextHopGroupRoute(nhg_id, rtnl_route_get_family(route_obj), fvw))
         {
-            SWSS_LOG_ERROR("NextHop group id %d not found. Dropping the route %s", nhg_id, destipprefix);
             return;
         }
-        NextHopGroup& nhg = itg->second;
-        if(nhg.group.size() == 0)
-        {
-            // Using route-table only for single next-hop
-            string nexthops = nhg.nexthop.empty() ? (rtnl_route_get_family(route_obj) == AF_INET ? "0.0.0.0" : "::") : nhg.nexthop;
-            string ifnames, weights;
-
-            getNextHopGroupFields(nhg, nexthops, ifnames, weights, rtnl_route_get_family(route_obj));
-            fvw.nexthop = std::move(nexthops);
-            fvw.ifname = std::move(ifnames);
-            if (!weights.empty())
-                fvw.weight = std::move(weights);
-
-            SWSS_LOG_DEBUG("NextHop group id %d is a single nexthop address. Filling the route table %s with nexthop and ifname", nhg_id, destipprefix);
-        }
-        else
-        {
-            nhg_id_key = getNextHopGroupKeyAsString(nhg_id);
-            fvw.nexthop_group = std::move(nhg_id_key);
-            installNextHopGroup(nhg_id);
-        }
     }
     else
     {
@@ -2175,6 +2294,318 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
     }
 }
 
+/*
+ * Fill the next hop fields of a route using a next hop group
+ * @arg nhg_id          Next hop group id
+ * @arg af              Address family of the route
+ * @arg fvw             Route fields, the key is the route prefix
+ *
+ * Return false if the next hop group is unknown and the route has to be dropped.
+ */
+bool RouteSync::fillNextHopGroupRoute(uint32_t nhg_id, uint8_t af, RouteTableFieldValueTupleWrapper &fvw)
+{
+    const auto itg = m_nh_groups.find(nhg_id);
+    if(itg == m_nh_groups.end())
+    {
+        SWSS_LOG_ERROR("NextHop group id %d not found. Dropping the route %s", nhg_id, fvw.key.c_str());
+        return false;
+    }
+    NextHopGroup& nhg = itg->second;
+    if(nhg.group.size() == 0)
+    {
+        // Using route-table only for single next-hop
+        string nexthops = nhg.nexthop.empty() ? (af == AF_INET ? "0.0.0.0" : "::") : nhg.nexthop;
+        string ifnames, weights;
+
+        getNextHopGroupFields(nhg, nexthops, ifnames, weights, af);
+        fvw.nexthop = std::move(nexthops);
+        fvw.ifname = std::move(ifnames);
+        if (!weights.empty())
+            fvw.weight = std::move(weights);
+
+        SWSS_LOG_DEBUG("NextHop group id %d is a single nexthop address. Filling the route table %s with nexthop and ifname", nhg_id, fvw.key.c_str());
+    }
+    else
+    {
+        fvw.nexthop_group = getNextHopGroupKeyAsString(nhg_id);
+        installNextHopGroup(nhg_id);
+    }
+
+    return true;
+}
+
+/*
+ * Handle a plain IPv4/IPv6 unicast or blackhole route of the default VRF or
+ * of a VRF, walking the netlink attributes in place instead of building a
+ * libnl route object. The route fields are written into m_rawRouteFvw, whose
+ * buffers are reused from one message to the next, and interface names come
+ * from m_ifNameCache. Produces the same entries as onMsg()/onRouteMsg().
+ * @arg h               Netlink message
+ *
+ * Return false, without any side effect on the tables, if the message has to
+ * go through onMsg() (VNET or management VRF route, MPLS or encap next hops,
+ * other route types, ...).
+ */
+bool RouteSync::onRouteMsgRaw(struct nlmsghdr *h)
+{
+    int nlmsg_type = h->nlmsg_type;
+    struct rtattr *tb[RTA_MAX + 1] = {};
+    char destipprefix[IFNAMSIZ + MAX_ADDR_SIZE + 2] = {0};
+    char buf[MAX_ADDR_SIZE];
+
+    if (!m_isRawRouteParsingEnabled
+        || (nlmsg_type != RTM_NEWROUTE && nlmsg_type != RTM_DELROUTE))
+    {
+        return false;
+    }
+
+    int len = (int)(h->nlmsg_len - NLMSG_LENGTH(sizeof(struct rtmsg)));
+    if (len < 0)
+    {
+        return false;
+    }
+
+    struct rtmsg *rtm = (struct rtmsg *)NLMSG_DATA(h);
+    uint8_t af = rtm->rtm_family;
+    if (af != AF_INET && af != AF_INET6)
+    {
+        return false;
+    }
+
+    unsigned int addr_len = (af == AF_INET) ? IPV4_MAX_BYTE : IPV6_MAX_BYTE;
+    if (rtm->rtm_dst_len > addr_len * 8)
+    {
+        return false;
+    }
+
+    netlink_parse_rtattr(tb, RTA_MAX, RTM_RTA(rtm), len);
+
+    if (!tb[RTA_DST] || RTA_PAYLOAD(tb[RTA_DST]) != addr_len
+        || tb[RTA_ENCAP] || tb[RTA_ENCAP_TYPE] || tb[RTA_VIA] || tb[RTA_NEWDST])
+    {
+        return false;
+    }
+
+    /* Table corresponding to route, i.e. the VRF index */
+    uint32_t vrf_index = tb[RTA_TABLE] ? *(uint32_t *)RTA_DATA(tb[RTA_TABLE]) : rtm->rtm_table;
+    if (vrf_index)
+    {
+        const char *vrf = getCachedIfName(vrf_index);
+
+        /* VNET routes, management VRF and unknown tables are left to onMsg() */
+        if (!vrf || strncmp(vrf, VRF_PREFIX, strlen(VRF_PREFIX)))
+        {
+            return false;
+        }
+        snprintf(destipprefix, sizeof(destipprefix), "%s:", vrf);
+    }
+
+    size_t prefix_len = strlen(destipprefix);
+    inet_ntop(af, RTA_DATA(tb[RTA_DST]), buf, MAX_ADDR_SIZE);
+    if (rtm->rtm_dst_len == addr_len * 8)
+    {
+        snprintf(destipprefix + prefix_len, sizeof(destipprefix) - prefix_len, "%s", buf);
+    }
+    else
+    {
+        snprintf(destipprefix + prefix_len, sizeof(destipprefix) - prefix_len, "%s/%u", buf, rtm->rtm_dst_len);
+    }
+
+    if (nlmsg_type == RTM_DELROUTE)
+    {
+        SWSS_LOG_INFO("RouteTable del msg: %s", destipprefix);
+        delWithWarmRestart(RouteTableFieldValueTupleWrapper{destipprefix, ""},
+                           *m_routeTable);
+        return true;
+    }
+
+    if (rtm->rtm_type != RTN_UNICAST && rtm->rtm_type != RTN_BLACKHOLE)
+    {
+        return false;
+    }
+
+    RouteTableFieldValueTupleWrapper &fvw = m_rawRouteFvw;
+    fvw.clear();
+    fvw.key.assign(destipprefix);
+
+    char proto_str[128];
+    if (!rtnl_route_proto2str(rtm->rtm_protocol, proto_str, sizeof(proto_str)))
+    {
+        snprintf(proto_str, sizeof(proto_str), "%u", rtm->rtm_protocol);
+    }
+    fvw.protocol.assign(proto_str);
+
+    uint32_t nhg_id = tb[RTA_NH_ID] ? *(uint32_t *)RTA_DATA(tb[RTA_NH_ID]) : 0;
+    if (rtm->rtm_type == RTN_UNICAST && !nhg_id && !getNextHopListRaw(af, tb, fvw))
+    {
+        return false;
+    }
+
+    if (!isSuppressionEnabled())
+    {
+        sendOffloadReply(h);
+    }
+
+    if (rtm->rtm_type == RTN_BLACKHOLE)
+    {
+        SWSS_LOG_INFO("RouteTable set blackhole msg: %s", destipprefix);
+        fvw.blackhole.assign("true");
+        setRouteWithWarmRestart(fvw, *m_routeTable);
+        return true;
+    }
+
+    if (nhg_id)
+    {
+        if (!fillNextHopGroupRoute(nhg_id, af, fvw))
+        {
+            return true;
+        }
+    }
+    else if (fvw.ifname == "eth0" || fvw.ifname == "docker0" || fvw.ifname == "eth1-midplane")
+    {
+        SWSS_LOG_DEBUG("Skip routes to eth0 or docker0 or eth1-midplane: %s %s %s",
+                       destipprefix, fvw.nexthop.c_str(), fvw.ifname.c_str());
+        SWSS_LOG_INFO("RouteTable del msg for eth0/docker0/eth1-midplane route: %s", destipprefix);
+        delWithWarmRestart(RouteTableFieldValueTupleWrapper{destipprefix, ""},
+                           *m_routeTable);
+        return true;
+    }
+
+    setRouteWithWarmRestart(fvw, *m_routeTable);
+    if (nhg_id)
+    {
+        SWSS_LOG_INFO("RouteTable set msg with NHG: %s nhg_id:%d", destipprefix, nhg_id);
+    }
+    else
+    {
+        SWSS_LOG_INFO("RouteTable set msg: %s nexthop:%s ifname:%s mpls:na weight:%s",
+                      destipprefix, fvw.nexthop.c_str(), fvw.ifname.c_str(), fvw.weight.c_str());
+    }
+
+    return true;
+}
+
+/*
+ * getNextHopListRaw() - parses the next hops of a route message, same output
+ * as getNextHopList() and getNextHopWt() for routes without MPLS next hops
+ * @arg af            (input) Address family of the route
+ * @arg tb            (input) Route attributes
+ * @arg fvw           (output) nexthop, ifname and weight lists
+ *
+ * Return false if the route has no next hop or one the libnl path must handle
+ */
+bool RouteSync::getNextHopListRaw(uint8_t af, struct rtattr *tb[], RouteTableFieldValueTupleWrapper &fvw)
+{
+    if (!tb[RTA_MULTIPATH])
+    {
+        if (!tb[RTA_OIF] && !tb[RTA_GATEWAY])
+        {
+            return false;
+        }
+        int if_index = tb[RTA_OIF] ? *(int *)RTA_DATA(tb[RTA_OIF]) : 0;
+        return appendNextHopRaw(af, tb[RTA_GATEWAY], if_index, 0, fvw);
+    }
+
+    /* libnl rejects a route mixing both next hop formats */
+    if (tb[RTA_OIF] || tb[RTA_GATEWAY])
+    {
+        return false;
+    }
+
+    struct rtnexthop *rtnh = (struct rtnexthop *)RTA_DATA(tb[RTA_MULTIPATH]);
+    int len = (int)RTA_PAYLOAD(tb[RTA_MULTIPATH]);
+    bool first = true;
+
+    while (len >= (int)sizeof(*rtnh) && rtnh->rtnh_len >= sizeof(*rtnh) && rtnh->rtnh_len <= len)
+    {
+        struct rtattr *subtb[RTA_MAX + 1] = {};
+        netlink_parse_rtattr(subtb, RTA_MAX, RTNH_DATA(rtnh), (int)(rtnh->rtnh_len - sizeof(*rtnh)));
+
+        if (subtb[RTA_ENCAP] || subtb[RTA_ENCAP_TYPE] || subtb[RTA_VIA] || subtb[RTA_NEWDST])
+        {
+            return false;
+        }
+
+        if (!first)
+        {
+            fvw.nexthop += NHG_DELIMITER;
+            fvw.ifname += NHG_DELIMITER;
+            fvw.weight += NHG_DELIMITER;
+        }
+        first = false;
+
+        if (!appendNextHopRaw(af, subtb[RTA_GATEWAY], rtnh->rtnh_ifindex, rtnh->rtnh_hops, fvw))
+        {
+            return false;
+        }
+
+        len -= RTNH_ALIGN(rtnh->rtnh_len);
+        rtnh = RTNH_NEXT(rtnh);
+    }
+
+    return !first;
+}
+
+bool RouteSync::appendNextHopRaw(uint8_t af, struct rtattr *gateway, int if_index,
+                                 uint8_t weight, RouteTableFieldValueTupleWrapper &fvw)
+{
+    char buf[MAX_ADDR_SIZE + 1];
+
+    if (gateway)
+    {
+        if (RTA_PAYLOAD(gateway) != (af == AF_INET ? IPV4_MAX_BYTE : IPV6_MAX_BYTE))
+        {
+            return false;
+        }
+        fvw.nexthop += inet_ntop(af, RTA_DATA(gateway), buf, MAX_ADDR_SIZE);
+    }
+    else
+    {
+        fvw.nexthop += (af == AF_INET6) ? "::" : "0.0.0.0";
+    }
+
+    const char *if_name = getCachedIfName(if_index);
+    fvw.ifname += if_name ? if_name : "unknown";
+
+    /* default weight is 1 */
+    snprintf(buf, sizeof(buf), "%u", weight ? weight : 1);
+    fvw.weight += buf;
+
+    return true;
+}
+
+const char *RouteSync::getCachedIfName(int if_index)
+{
+    auto it = m_ifNameCache.find(if_index);
+    if (it != m_ifNameCache.end())
+    {
+        return it->second.c_str();
+    }
+
+    char if_name[IFNAMSIZ];
+    if (!getIfName(if_index, if_name, IFNAMSIZ))
+    {
+        return nullptr;
+    }
+
+    return m_ifNameCache.emplace(if_index, if_name).first->second.c_str();
+}
+
+void RouteSync::updateIfNameCache(int nlmsg_type, struct rtnl_link *link)
+{
+    int if_index = rtnl_link_get_ifindex(link);
+    const char *if_name = rtnl_link_get_name(link);
+
+    if (nlmsg_type == RTM_DELLINK || !if_name)
+    {
+        m_ifNameCache.erase(if_index);
+    }
+    else
+    {
+        m_ifNameCache[if_index] = if_name;
+    }
+}
+
 /*
  * Handle Nexthop msg
  * @arg nlmsghdr      Netlink messaged
@@ -3240,6 +3671,8 @@ void RouteSync::deleteNextHopGroup(uint32_t nh_id)
     {
         string key = getNextHopGroupKeyAsString(nh_id);
         SWSS_LOG_DEBUG("NextHopGroup table del: key [%s]", key.c_str());
+        /* The held route updates may move routes off the group, write them first */
+        flushCoalescedRoutes();
         m_nexthop_groupTable.del(key);
     }
     m_nh_groups.erase(git);
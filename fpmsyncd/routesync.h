@@ -96,6 +96,9 @@ class RouteTableFieldValueTupleWrapper : public FieldValueTupleWrapperBase {
 
     vector<FieldValueTuple> fieldValueTupleVector() override;
 
+    /* Reset all the fields, keeping the string buffers for reuse */
+    void clear();
+
     string protocol = string();
     string blackhole = string("false");
     string nexthop = string();
@@ -188,6 +191,17 @@ class Srv6SidListTableFieldValueTupleWrapper : public FieldValueTupleWrapperBase
     string path = string();
 };
 
+/* Counters of the route update coalescing stage */
+struct RouteCoalescingCounters
+{
+    /* Route table updates held by the coalescing stage */
+    uint64_t received = 0;
+    /* Updates replaced by a later update of the same prefix before being written */
+    uint64_t suppressed = 0;
+    /* Updates written to the route table */
+    uint64_t flushed = 0;
+};
+
 class RouteSync : public NetMsg
 {
 public:
@@ -199,6 +213,13 @@ public:
 
     virtual void onMsgRaw(struct nlmsghdr *obj);
 
+    /*
+     * Handle a plain IPv4/IPv6 unicast or blackhole route straight from the
+     * netlink message, without building a libnl route object.
+     * Return false if the message has to go through onMsg().
+     */
+    bool onRouteMsgRaw(struct nlmsghdr *h);
+
     void setSuppressionEnabled(bool enabled);
 
     bool isSuppressionEnabled() const
@@ -206,6 +227,43 @@ public:
         return m_isSuppressionEnabled;
     }
 
+    /*
+     * onRouteMsgRaw() bypasses the NetDispatcher, only enable it when this
+     * object is the registered handler of RTM_NEWROUTE/RTM_DELROUTE.
+     */
+    void setRawRouteParsingEnabled(bool enabled)
+    {
+        m_isRawRouteParsingEnabled = enabled;
+    }
+
+    bool isRawRouteParsingEnabled() const
+    {
+        return m_isRawRouteParsingEnabled;
+    }
+
+    /*
+     * Hold the route table updates, last writer wins per prefix, until the
+     * oldest one has waited max_delay milliseconds or max_entries prefixes
+     * are pending. A max_delay of 0 disables the coalescing.
+     */
+    void setRouteCoalescing(uint32_t max_delay, size_t max_entries);
+
+    bool isRouteCoalescingEnabled() const
+    {
+        return m_coalesceMaxDelay > 0;
+    }
+
+    /* Write all the held route updates */
+    void flushCoalescedRoutes();
+
+    /* Milliseconds until the held route updates are due, -1 if none is held */
+    int getRouteCoalescingTimeout() const;
+
+    const RouteCoalescingCounters& getRouteCoalescingCounters() const
+    {
+        return m_coalesceCounters;
+    }
+
     /* Helper method to set route table with warm restart support */
     void setRouteWithWarmRestart(
         FieldValueTupleWrapperBase & fvw,
@@ -269,11 +327,54 @@ private:
     map<string, uint32_t> m_srv6_sidlist_refcnt;
 
     bool                m_isSuppressionEnabled{false};
+    bool                m_isRawRouteParsingEnabled{false};
     FpmInterface*       m_fpmInterface {nullptr};
 
+    /* Interface/VRF names by index, kept up to date from RTM_NEWLINK/RTM_DELLINK */
+    unordered_map<int, string> m_ifNameCache;
+    /* Route fields filled by onRouteMsgRaw(), reused across messages */
+    RouteTableFieldValueTupleWrapper m_rawRouteFvw{string(), string()};
+
+    /* Route table update held by the coalescing stage */
+    struct CoalescedRoute
+    {
+        KeyOpFieldsValuesTuple kfv;
+        /* A DEL was replaced by this SET, the prefix is removed before being set again */
+        bool del_first;
+    };
+
+    uint32_t                        m_coalesceMaxDelay{0};
+    size_t                          m_coalesceMaxEntries{0};
+    vector<CoalescedRoute>          m_coalescedRoutes;
+    unordered_map<string, size_t>   m_coalescedIndex;
+    chrono::steady_clock::time_point m_coalesceStart;
+    RouteCoalescingCounters         m_coalesceCounters;
+
+    /* Hold a route table update, replacing the one held for the same prefix */
+    void coalesceRoute(KeyOpFieldsValuesTuple &&kfv);
+
+    /* Write the update held for a prefix, before writing the prefix directly */
+    void flushCoalescedRoute(const string &key);
+
     /* Handle regular route (include VRF route) */
     void onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf);
 
+    /* Fill the next hop fields of a route using a next hop group */
+    bool fillNextHopGroupRoute(uint32_t nhg_id, uint8_t af, RouteTableFieldValueTupleWrapper &fvw);
+
+    /* Get the next hop lists of a route from its netlink attributes */
+    bool getNextHopListRaw(uint8_t af, struct rtattr *tb[], RouteTableFieldValueTupleWrapper &fvw);
+
+    /* Append a next hop to the lists built by getNextHopListRaw() */
+    bool appendNextHopRaw(uint8_t af, struct rtattr *gateway, int if_index,
+                          uint8_t weight, RouteTableFieldValueTupleWrapper &fvw);
+
+    /* Get interface/VRF name from m_ifNameCache, looking it up on a miss */
+    const char *getCachedIfName(int if_index);
+
+    /* Update m_ifNameCache on RTM_NEWLINK/RTM_DELLINK */
+    void updateIfNameCache(int nlmsg_type, struct rtnl_link *link);
+
     /* Handle label route */
     void onLabelRouteMsg(int nlmsg_type, struct nl_object *obj);
 
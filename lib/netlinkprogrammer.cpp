@@ -0,0 +1,1040 @@
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <linux/if_bridge.h>
+#include <linux/if_ether.h>
+#include <linux/if_link.h>
+#include <linux/if_tunnel.h>
+#include <linux/neighbour.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+
+#include "logger.h"
+#include "netlinkprogrammer.h"
+
+using namespace std;
+using namespace swss;
+
+#define NETLINK_BATCH_SIZE          (32 * 1024)
+#define NETLINK_BATCH_REQUESTS      256
+#define NETLINK_RCVBUF_SIZE         (4 * 1024 * 1024)
+#define NETLINK_ACK_TIMEOUT_SEC     10
+
+#ifndef SOL_NETLINK
+#define SOL_NETLINK 270
+#endif
+
+namespace {
+
+template <typename T>
+vector<char> newMessage(uint16_t type, uint16_t flags, const T &body)
+{
+    vector<char> msg(NLMSG_SPACE(sizeof(T)));
+    auto *hdr = reinterpret_cast<struct nlmsghdr *>(msg.data());
+
+    hdr->nlmsg_type = type;
+    hdr->nlmsg_flags = static_cast<uint16_t>(NLM_F_REQUEST | flags);
+    memcpy(NLMSG_DATA(hdr), &body, sizeof(T));
+    return msg;
+}
+
+void putAttr(vector<char> &msg, unsigned short type, const void *data, size_t len)
+{
+    size_t off = msg.size();
+
+    msg.resize(off + RTA_SPACE(len));
+    auto *rta = reinterpret_cast<struct rtattr *>(&msg[off]);
+    rta->rta_type = type;
+    rta->rta_len = static_cast<unsigned short>(RTA_LENGTH(len));
+    if (len)
+    {
+        memcpy(RTA_DATA(rta), data, len);
+    }
+}
+
+template <typename T>
+void putValue(vector<char> &msg, unsigned short type, const T &value)
+{
+    putAttr(msg, type, &value, sizeof(T));
+}
+
+void putString(vector<char> &msg, unsigned short type, const string &value)
+{
+    putAttr(msg, type, value.c_str(), value.size() + 1);
+}
+
+void putIp(vector<char> &msg, unsigned short type, const IpAddress &ip)
+{
+    const ip_addr_t &addr = ip.getIpAddr();
+
+    if (addr.family == AF_INET)
+    {
+        putAttr(msg, type, &addr.ip_addr.ipv4_addr, sizeof(addr.ip_addr.ipv4_addr));
+    }
+    else
+    {
+        putAttr(msg, type, addr.ip_addr.ipv6_addr, sizeof(addr.ip_addr.ipv6_addr));
+    }
+}
+
+size_t beginNest(vector<char> &msg, unsigned short type)
+{
+    size_t off = msg.size();
+    putAttr(msg, type, nullptr, 0);
+    return off;
+}
+
+void endNest(vector<char> &msg, size_t off)
+{
+    reinterpret_cast<struct rtattr *>(&msg[off])->rta_len = static_cast<unsigned short>(msg.size() - off);
+}
+
+string vlanRange(uint16_t first, uint16_t last)
+{
+    return first == last ? to_string(first) : to_string(first) + "-" + to_string(last);
+}
+
+string vlanFlags(uint16_t flags)
+{
+    string desc;
+
+    if (flags & NETLINK_VLAN_PVID)
+    {
+        desc += " pvid";
+    }
+    if (flags & NETLINK_VLAN_UNTAGGED)
+    {
+        desc += " untagged";
+    }
+    if (flags & NETLINK_VLAN_SELF)
+    {
+        desc += " self";
+    }
+    return desc;
+}
+
+/* Scope of an address, as chosen by "ip address add" */
+uint8_t addressScope(const IpAddress &ip)
+{
+    switch (ip.getAddrScope())
+    {
+        case IpAddress::AddrScope::LINK_SCOPE:
+            return RT_SCOPE_LINK;
+        case IpAddress::AddrScope::HOST_SCOPE:
+            return RT_SCOPE_HOST;
+        default:
+            return RT_SCOPE_UNIVERSE;
+    }
+}
+
+/* Call f on the ranges of consecutive VLANs, or on each VLAN for the pvid */
+template <typename F>
+size_t forEachVlanRange(const set<uint16_t> &vids, uint16_t flags, F f)
+{
+    size_t count = 0;
+
+    for (auto it = vids.begin(); it != vids.end(); count++)
+    {
+        uint16_t first = *it;
+        uint16_t last = *it;
+
+        while (++it != vids.end() && *it == last + 1 && !(flags & NETLINK_VLAN_PVID))
+        {
+            last = *it;
+        }
+        f(first, last);
+    }
+
+    return count;
+}
+
+}
+
+size_t NetlinkProgrammer::addBridgeVlans(const string &dev, const set<uint16_t> &vids, uint16_t flags)
+{
+    return forEachVlanRange(vids, flags, [&](uint16_t first, uint16_t last) {
+        addBridgeVlanRange(dev, first, last, flags);
+    });
+}
+
+size_t NetlinkProgrammer::delBridgeVlans(const string &dev, const set<uint16_t> &vids, uint16_t flags)
+{
+    return forEachVlanRange(vids, flags, [&](uint16_t first, uint16_t last) {
+        delBridgeVlanRange(dev, first, last, flags);
+    });
+}
+
+void NetlinkProgrammer::commitOrThrow()
+{
+    for (const auto &result : commit())
+    {
+        if (result.error)
+        {
+            throw runtime_error(result.request + " : " + strerror(-result.error));
+        }
+    }
+}
+
+bool NetlinkProgrammer::getLinks(const string &kind, vector<string> &names)
+{
+    vector<NetlinkLink> links;
+
+    names.clear();
+    if (!getLinks(kind, links))
+    {
+        return false;
+    }
+
+    for (const auto &link : links)
+    {
+        names.push_back(link.name);
+    }
+    return true;
+}
+
+RtnlProgrammer::RtnlProgrammer()
+{
+    m_fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (m_fd < 0)
+    {
+        throw runtime_error(string("Failed to open the rtnetlink socket: ") + strerror(errno));
+    }
+
+    // Room for the ACKs of a whole batch, they are dropped when the socket is full
+    int size = NETLINK_RCVBUF_SIZE;
+    if (setsockopt(m_fd, SOL_SOCKET, SO_RCVBUFFORCE, &size, sizeof(size)) < 0)
+    {
+        setsockopt(m_fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    }
+
+    // Don't copy the requests in their ACKs
+    int one = 1;
+    setsockopt(m_fd, SOL_NETLINK, NETLINK_CAP_ACK, &one, sizeof(one));
+
+    struct timeval timeout = { NETLINK_ACK_TIMEOUT_SEC, 0 };
+    setsockopt(m_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    struct sockaddr_nl addr = {};
+    addr.nl_family = AF_NETLINK;
+    if (bind(m_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0)
+    {
+        int error = errno;
+        close(m_fd);
+        throw runtime_error(string("Failed to bind the rtnetlink socket: ") + strerror(error));
+    }
+}
+
+RtnlProgrammer::~RtnlProgrammer()
+{
+    close(m_fd);
+}
+
+void RtnlProgrammer::queue(const string &desc, Encoder encode)
+{
+    m_requests.push_back({ desc, encode });
+}
+
+void RtnlProgrammer::addLink(const NetlinkLink &link)
+{
+    string desc = "ip link add " + link.name;
+    if (!link.parent.empty())
+    {
+        desc = "ip link add link " + link.parent + " name " + link.name;
+    }
+    desc += " type " + link.kind;
+    if (link.kind == "vlan")
+    {
+        desc += " id " + to_string(link.vlan_id);
+    }
+    else if (link.kind == "vrf")
+    {
+        desc += " table " + to_string(link.vrf_table);
+    }
+    else if (link.kind == "vxlan" || link.kind == "ipip")
+    {
+        if (link.kind == "vxlan")
+        {
+            desc += " id " + to_string(link.vni);
+        }
+        if (!link.local.isZero())
+        {
+            desc += " local " + link.local.to_string();
+        }
+        if (!link.remote.isZero())
+        {
+            desc += " remote " + link.remote.to_string();
+        }
+        if (link.kind == "vxlan" && !link.learning)
+        {
+            desc += " nolearning";
+        }
+        if (link.dst_port)
+        {
+            desc += " dstport " + to_string(link.dst_port);
+        }
+    }
+
+    queue(desc, [link](vector<char> &msg) {
+        uint32_t parent = 0;
+        if (!link.parent.empty() && (parent = if_nametoindex(link.parent.c_str())) == 0)
+        {
+            return false;
+        }
+
+        struct ifinfomsg ifi = {};
+        ifi.ifi_family = AF_UNSPEC;
+        if (link.up)
+        {
+            ifi.ifi_flags = IFF_UP;
+            ifi.ifi_change = IFF_UP;
+        }
+
+        msg = newMessage(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, ifi);
+        putString(msg, IFLA_IFNAME, link.name);
+        if (parent)
+        {
+            putValue(msg, IFLA_LINK, parent);
+        }
+        if (link.mtu)
+        {
+            putValue(msg, IFLA_MTU, link.mtu);
+        }
+        if (link.address)
+        {
+            putAttr(msg, IFLA_ADDRESS, link.address.getMac(), ETH_ALEN);
+        }
+
+        size_t info = beginNest(msg, IFLA_LINKINFO);
+        putString(msg, IFLA_INFO_KIND, link.kind);
+        if (link.kind == "vlan")
+        {
+            size_t data = beginNest(msg, IFLA_INFO_DATA);
+            putValue(msg, IFLA_VLAN_ID, link.vlan_id);
+            endNest(msg, data);
+        }
+        else if (link.kind == "vrf")
+        {
+            size_t data = beginNest(msg, IFLA_INFO_DATA);
+            putValue(msg, IFLA_VRF_TABLE, link.vrf_table);
+            endNest(msg, data);
+        }
+        else if (link.kind == "vxlan")
+        {
+            size_t data = beginNest(msg, IFLA_INFO_DATA);
+            putValue(msg, IFLA_VXLAN_ID, link.vni);
+            if (!link.local.isZero())
+            {
+                putIp(msg, link.local.isV4() ? IFLA_VXLAN_LOCAL : IFLA_VXLAN_LOCAL6, link.local);
+            }
+            if (!link.remote.isZero())
+            {
+                putIp(msg, link.remote.isV4() ? IFLA_VXLAN_GROUP : IFLA_VXLAN_GROUP6, link.remote);
+            }
+            putValue<uint8_t>(msg, IFLA_VXLAN_LEARNING, link.learning);
+            if (link.dst_port)
+            {
+                putValue<uint16_t>(msg, IFLA_VXLAN_PORT, htons(link.dst_port));
+            }
+            endNest(msg, data);
+        }
+        else if (link.kind == "ipip")
+        {
+            size_t data = beginNest(msg, IFLA_INFO_DATA);
+            if (!link.local.isZero())
+            {
+                putIp(msg, IFLA_IPTUN_LOCAL, link.local);
+            }
+            if (!link.remote.isZero())
+            {
+                putIp(msg, IFLA_IPTUN_REMOTE, link.remote);
+            }
+            endNest(msg, data);
+        }
+        endNest(msg, info);
+        return true;
+    });
+}
+
+void RtnlProgrammer::delLink(const string &name)
+{
+    queue("ip link del " + name, [name](vector<char> &msg) {
+        struct ifinfomsg ifi = {};
+        ifi.ifi_family = AF_UNSPEC;
+
+        msg = newMessage(RTM_DELLINK, 0, ifi);
+        putString(msg, IFLA_IFNAME, name);
+        return true;
+    });
+}
+
+void RtnlProgrammer::setLink(const string &desc, const string &name, Encoder attrs, unsigned flags, unsigned change)
+{
+    queue(desc, [name, attrs, flags, change](vector<char> &msg) {
+        uint32_t index = if_nametoindex(name.c_str());
+        if (index == 0)
+        {
+            return false;
+        }
+
+        struct ifinfomsg ifi = {};
+        ifi.ifi_family = AF_UNSPEC;
+        ifi.ifi_index = static_cast<int>(index);
+        ifi.ifi_flags = flags;
+        ifi.ifi_change = change;
+
+        msg = newMessage(RTM_NEWLINK, 0, ifi);
+        return !attrs || attrs(msg);
+    });
+}
+
+void RtnlProgrammer::setLinkAdminState(const string &name, bool up)
+{
+    setLink("ip link set " + name + (up ? " up" : " down"), name, nullptr, up ? IFF_UP : 0, IFF_UP);
+}
+
+void RtnlProgrammer::setLinkMtu(const string &name, uint32_t mtu)
+{
+    setLink("ip link set " + name + " mtu " + to_string(mtu), name, [mtu](vector<char> &msg) {
+        putValue(msg, IFLA_MTU, mtu);
+        return true;
+    });
+}
+
+void RtnlProgrammer::setLinkAddress(const string &name, const MacAddress &mac)
+{
+    setLink("ip link set " + name + " address " + mac.to_string(), name, [mac](vector<char> &msg) {
+        putAttr(msg, IFLA_ADDRESS, mac.getMac(), ETH_ALEN);
+        return true;
+    });
+}
+
+void RtnlProgrammer::setLinkMaster(const string &name, const string &master)
+{
+    string desc = "ip link set " + name + (master.empty() ? " nomaster" : " master " + master);
+
+    setLink(desc, name, [master](vector<char> &msg) {
+        uint32_t index = 0;
+        if (!master.empty() && (index = if_nametoindex(master.c_str())) == 0)
+        {
+            return false;
+        }
+        putValue(msg, IFLA_MASTER, index);
+        return true;
+    });
+}
+
+void RtnlProgrammer::setBridgeVlanFiltering(const string &bridge, bool enable)
+{
+    string desc = "ip link set " + bridge + " type bridge vlan_filtering " + (enable ? "1" : "0");
+
+    setLink(desc, bridge, [enable](vector<char> &msg) {
+        size_t info = beginNest(msg, IFLA_LINKINFO);
+        putString(msg, IFLA_INFO_KIND, "bridge");
+        size_t data = beginNest(msg, IFLA_INFO_DATA);
+        putValue<uint8_t>(msg, IFLA_BR_VLAN_FILTERING, enable);
+        endNest(msg, data);
+        endNest(msg, info);
+        return true;
+    });
+}
+
+void RtnlProgrammer::setBridgeNoLinkLocalLearn(const string &bridge, bool enable)
+{
+    string desc = "ip link set " + bridge + " type bridge no_linklocal_learn " + (enable ? "1" : "0");
+
+    setLink(desc, bridge, [enable](vector<char> &msg) {
+        struct br_boolopt_multi opts = {};
+        opts.optmask = 1u << BR_BOOLOPT_NO_LL_LEARN;
+        opts.optval = enable ? opts.optmask : 0;
+
+        size_t info = beginNest(msg, IFLA_LINKINFO);
+        putString(msg, IFLA_INFO_KIND, "bridge");
+        size_t data = beginNest(msg, IFLA_INFO_DATA);
+        putValue(msg, IFLA_BR_MULTI_BOOLOPT, opts);
+        endNest(msg, data);
+        endNest(msg, info);
+        return true;
+    });
+}
+
+void RtnlProgrammer::setBridgePortLearning(const string &dev, bool enable)
+{
+    string desc = "bridge link set dev " + dev + " learning " + (enable ? "on" : "off");
+
+    queue(desc, [dev, enable](vector<char> &msg) {
+        uint32_t index = if_nametoindex(dev.c_str());
+        if (index == 0)
+        {
+            return false;
+        }
+
+        struct ifinfomsg ifi = {};
+        ifi.ifi_family = AF_BRIDGE;
+        ifi.ifi_index = static_cast<int>(index);
+
+        msg = newMessage(RTM_SETLINK, 0, ifi);
+        size_t info = beginNest(msg, IFLA_PROTINFO | NLA_F_NESTED);
+        putValue<uint8_t>(msg, IFLA_BRPORT_LEARNING, enable);
+        endNest(msg, info);
+        return true;
+    });
+}
+
+void RtnlProgrammer::bridgeVlan(const string &desc, uint16_t type, const string &dev,
+                                uint16_t first, uint16_t last, uint16_t flags)
+{
+    queue(desc, [type, dev, first, last, flags](vector<char> &msg) {
+        uint32_t index = if_nametoindex(dev.c_str());
+        if (index == 0)
+        {
+            return false;
+        }
+
+        struct ifinfomsg ifi = {};
+        ifi.ifi_family = AF_BRIDGE;
+        ifi.ifi_index = static_cast<int>(index);
+
+        struct bridge_vlan_info info = {};
+        info.vid = first;
+        if (flags & NETLINK_VLAN_PVID)
+        {
+            info.flags |= BRIDGE_VLAN_INFO_PVID;
+        }
+        if (flags & NETLINK_VLAN_UNTAGGED)
+        {
+            info.flags |= BRIDGE_VLAN_INFO_UNTAGGED;
+        }
+
+        msg = newMessage(type, 0, ifi);
+        size_t spec = beginNest(msg, IFLA_AF_SPEC);
+        if (flags & NETLINK_VLAN_SELF)
+        {
+            putValue<uint16_t>(msg, IFLA_BRIDGE_FLAGS, BRIDGE_FLAGS_SELF);
+        }
+        if (first == last)
+        {
+            putValue(msg, IFLA_BRIDGE_VLAN_INFO, info);
+        }
+        else
+        {
+            struct bridge_vlan_info end = info;
+            info.flags |= BRIDGE_VLAN_INFO_RANGE_BEGIN;
+            end.flags |= BRIDGE_VLAN_INFO_RANGE_END;
+            end.vid = last;
+            putValue(msg, IFLA_BRIDGE_VLAN_INFO, info);
+            putValue(msg, IFLA_BRIDGE_VLAN_INFO, end);
+        }
+        endNest(msg, spec);
+        return true;
+    });
+}
+
+void RtnlProgrammer::addBridgeVlanRange(const string &dev, uint16_t first, uint16_t last, uint16_t flags)
+{
+    string desc = "bridge vlan add vid " + vlanRange(first, last) + " dev " + dev + vlanFlags(flags);
+    bridgeVlan(desc, RTM_SETLINK, dev, first, last, flags);
+}
+
+void RtnlProgrammer::delBridgeVlanRange(const string &dev, uint16_t first, uint16_t last, uint16_t flags)
+{
+    string desc = "bridge vlan del vid " + vlanRange(first, last) + " dev " + dev + vlanFlags(flags);
+    bridgeVlan(desc, RTM_DELLINK, dev, first, last, flags);
+}
+
+void RtnlProgrammer::addAddress(const string &dev, const IpPrefix &prefix, uint32_t metric)
+{
+    // Same broadcast as "ip address add ... broadcast +"
+    bool broadcast = prefix.isV4() && prefix.getMaskLength() < 31;
+
+    string desc = "ip address add " + prefix.to_string();
+    if (broadcast)
+    {
+        desc += " broadcast " + prefix.getBroadcastIp().to_string();
+    }
+    desc += " dev " + dev;
+    if (metric)
+    {
+        desc += " metric " + to_string(metric);
+    }
+
+    queue(desc, [dev, prefix, broadcast, metric](vector<char> &msg) {
+        uint32_t index = if_nametoindex(dev.c_str());
+        if (index == 0)
+        {
+            return false;
+        }
+
+        struct ifaddrmsg ifa = {};
+        ifa.ifa_family = static_cast<uint8_t>(prefix.getIp().getIpAddr().family);
+        ifa.ifa_prefixlen = static_cast<uint8_t>(prefix.getMaskLength());
+        ifa.ifa_scope = addressScope(prefix.getIp());
+        ifa.ifa_index = index;
+
+        msg = newMessage(RTM_NEWADDR, NLM_F_CREATE | NLM_F_EXCL, ifa);
+        putIp(msg, IFA_LOCAL, prefix.getIp());
+        putIp(msg, IFA_ADDRESS, prefix.getIp());
+        if (broadcast)
+        {
+            putIp(msg, IFA_BROADCAST, prefix.getBroadcastIp());
+        }
+        if (metric)
+        {
+            putValue(msg, IFA_RT_PRIORITY, metric);
+        }
+        return true;
+    });
+}
+
+void RtnlProgrammer::delAddress(const string &dev, const IpPrefix &prefix)
+{
+    queue("ip address del " + prefix.to_string() + " dev " + dev, [dev, prefix](vector<char> &msg) {
+        uint32_t index = if_nametoindex(dev.c_str());
+        if (index == 0)
+        {
+            return false;
+        }
+
+        struct ifaddrmsg ifa = {};
+        ifa.ifa_family = static_cast<uint8_t>(prefix.getIp().getIpAddr().family);
+        ifa.ifa_prefixlen = static_cast<uint8_t>(prefix.getMaskLength());
+        ifa.ifa_index = index;
+
+        msg = newMessage(RTM_DELADDR, 0, ifa);
+        putIp(msg, IFA_LOCAL, prefix.getIp());
+        return true;
+    });
+}
+
+void RtnlProgrammer::addNeighbor(const string &dev, const IpAddress &ip, const MacAddress &mac)
+{
+    string desc = "ip neigh replace " + ip.to_string() + " lladdr " + mac.to_string() + " dev " + dev;
+
+    queue(desc, [dev, ip, mac](vector<char> &msg) {
+        uint32_t index = if_nametoindex(dev.c_str());
+        if (index == 0)
+        {
+            return false;
+        }
+
+        struct ndmsg ndm = {};
+        ndm.ndm_family = static_cast<uint8_t>(ip.getIpAddr().family);
+        ndm.ndm_ifindex = static_cast<int>(index);
+        ndm.ndm_state = NUD_PERMANENT;
+
+        msg = newMessage(RTM_NEWNEIGH, NLM_F_CREATE | NLM_F_REPLACE, ndm);
+        putIp(msg, NDA_DST, ip);
+        putAttr(msg, NDA_LLADDR, mac.getMac(), ETH_ALEN);
+        return true;
+    });
+}
+
+void RtnlProgrammer::delNeighbor(const string &dev, const IpAddress &ip)
+{
+    queue("ip neigh del " + ip.to_string() + " dev " + dev, [dev, ip](vector<char> &msg) {
+        uint32_t index = if_nametoindex(dev.c_str());
+        if (index == 0)
+        {
+            return false;
+        }
+
+        struct ndmsg ndm = {};
+        ndm.ndm_family = static_cast<uint8_t>(ip.getIpAddr().family);
+        ndm.ndm_ifindex = static_cast<int>(index);
+
+        msg = newMessage(RTM_DELNEIGH, 0, ndm);
+        putIp(msg, NDA_DST, ip);
+        return true;
+    });
+}
+
+void RtnlProgrammer::route(const string &desc, uint16_t type, const string &dev, const IpPrefix &prefix)
+{
+    queue(desc, [type, dev, prefix](vector<char> &msg) {
+        uint32_t index = if_nametoindex(dev.c_str());
+        if (index == 0)
+        {
+            return false;
+        }
+
+        struct rtmsg rtm = {};
+        rtm.rtm_family = static_cast<uint8_t>(prefix.getIp().getIpAddr().family);
+        rtm.rtm_dst_len = static_cast<uint8_t>(prefix.getMaskLength());
+        rtm.rtm_table = RT_TABLE_MAIN;
+        rtm.rtm_type = RTN_UNICAST;
+        if (type == RTM_NEWROUTE)
+        {
+            rtm.rtm_protocol = RTPROT_BOOT;
+            rtm.rtm_scope = RT_SCOPE_LINK;
+        }
+        else
+        {
+            rtm.rtm_scope = RT_SCOPE_NOWHERE;
+        }
+
+        msg = newMessage(type, type == RTM_NEWROUTE ? NLM_F_CREATE | NLM_F_REPLACE : 0, rtm);
+        putIp(msg, RTA_DST, prefix.getSubnet().getIp());
+        putValue(msg, RTA_OIF, index);
+        return true;
+    });
+}
+
+void RtnlProgrammer::replaceRoute(const string &dev, const IpPrefix &prefix)
+{
+    route("ip route replace " + prefix.to_string() + " dev " + dev, RTM_NEWROUTE, dev, prefix);
+}
+
+void RtnlProgrammer::delRoute(const string &dev, const IpPrefix &prefix)
+{
+    route("ip route del " + prefix.to_string() + " dev " + dev, RTM_DELROUTE, dev, prefix);
+}
+
+vector<NetlinkResult> RtnlProgrammer::commit()
+{
+    vector<NetlinkResult> results;
+    vector<char> batch;
+    size_t first = 0;
+
+    results.reserve(m_requests.size());
+    for (const auto &request : m_requests)
+    {
+        vector<char> msg;
+        if (!request.encode(msg))
+        {
+            // The link may be created by the requests of the batch
+            flush(batch, results, first);
+            first = results.size();
+
+            msg.clear();
+            if (!request.encode(msg))
+            {
+                results.push_back({ request.desc, -ENODEV });
+                first = results.size();
+                continue;
+            }
+        }
+
+        if (batch.size() + msg.size() > NETLINK_BATCH_SIZE || results.size() - first >= NETLINK_BATCH_REQUESTS)
+        {
+            flush(batch, results, first);
+            first = results.size();
+        }
+
+        auto *hdr = reinterpret_cast<struct nlmsghdr *>(msg.data());
+        hdr->nlmsg_len = static_cast<uint32_t>(msg.size());
+        hdr->nlmsg_flags |= NLM_F_ACK;
+        hdr->nlmsg_seq = ++m_seq;
+        batch.insert(batch.end(), msg.begin(), msg.end());
+        results.push_back({ request.desc, 0 });
+    }
+
+    flush(batch, results, first);
+    m_requests.clear();
+
+    return results;
+}
+
+void RtnlProgrammer::flush(vector<char> &batch, vector<NetlinkResult> &results, size_t first)
+{
+    SWSS_LOG_ENTER();
+
+    if (batch.empty())
+    {
+        return;
+    }
+
+    size_t count = results.size() - first;
+    uint32_t firstSeq = m_seq - static_cast<uint32_t>(count) + 1;
+
+    m_requestCount += count;
+    m_batchCount++;
+
+    ssize_t sent = send(m_fd, batch.data(), batch.size(), 0);
+    batch.clear();
+    if (sent < 0)
+    {
+        int error = errno;
+        SWSS_LOG_ERROR("Failed to send %zu netlink requests: %s", count, strerror(error));
+        for (size_t i = first; i < results.size(); i++)
+        {
+            results[i].error = -error;
+        }
+        return;
+    }
+
+    vector<bool> acked(count, false);
+    vector<char> buf(8192);
+    size_t remaining = count;
+
+    while (remaining)
+    {
+        ssize_t len = recv(m_fd, buf.data(), buf.size(), MSG_PEEK | MSG_TRUNC);
+        if (len > 0 && static_cast<size_t>(len) > buf.size())
+        {
+            buf.resize(len);
+        }
+        if (len >= 0)
+        {
+            len = recv(m_fd, buf.data(), buf.size(), 0);
+        }
+        if (len < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // ENOBUFS when ACKs were dropped, EAGAIN on timeout
+            int error = errno;
+            SWSS_LOG_ERROR("Failed to receive %zu netlink ACKs: %s", remaining, strerror(error));
+            for (size_t i = 0; i < count; i++)
+            {
+                if (!acked[i])
+                {
+                    results[first + i].error = -error;
+                }
+            }
+            return;
+        }
+
+        int left = static_cast<int>(len);
+        for (auto *hdr = reinterpret_cast<struct nlmsghdr *>(buf.data()); NLMSG_OK(hdr, left); hdr = NLMSG_NEXT(hdr, left))
+        {
+            // Skip the late ACKs of a batch which timed out
+            uint32_t index = hdr->nlmsg_seq - firstSeq;
+            if (hdr->nlmsg_type != NLMSG_ERROR || index >= count || acked[index])
+            {
+                continue;
+            }
+
+            auto *err = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(hdr));
+            results[first + index].error = err->error;
+            acked[index] = true;
+            remaining--;
+        }
+    }
+}
+
+bool RtnlProgrammer::linkExists(const string &name)
+{
+    return if_nametoindex(name.c_str()) != 0;
+}
+
+bool RtnlProgrammer::dump(const string &what, vector<char> &msg, const function<void(const struct nlmsghdr *hdr)> &handler)
+{
+    SWSS_LOG_ENTER();
+
+    auto *req = reinterpret_cast<struct nlmsghdr *>(msg.data());
+    req->nlmsg_len = static_cast<uint32_t>(msg.size());
+    req->nlmsg_seq = ++m_seq;
+    if (send(m_fd, msg.data(), msg.size(), 0) < 0)
+    {
+        SWSS_LOG_ERROR("Failed to dump the %s: %s", what.c_str(), strerror(errno));
+        return false;
+    }
+
+    vector<char> buf(32768);
+    while (true)
+    {
+        ssize_t len = recv(m_fd, buf.data(), buf.size(), MSG_PEEK | MSG_TRUNC);
+        if (len > 0 && static_cast<size_t>(len) > buf.size())
+        {
+            buf.resize(len);
+        }
+        if (len >= 0)
+        {
+            len = recv(m_fd, buf.data(), buf.size(), 0);
+        }
+        if (len < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            SWSS_LOG_ERROR("Failed to dump the %s: %s", what.c_str(), strerror(errno));
+            return false;
+        }
+
+        int left = static_cast<int>(len);
+        for (auto *hdr = reinterpret_cast<struct nlmsghdr *>(buf.data()); NLMSG_OK(hdr, left); hdr = NLMSG_NEXT(hdr, left))
+        {
+            if (hdr->nlmsg_seq != req->nlmsg_seq)
+            {
+                continue;
+            }
+            if (hdr->nlmsg_type == NLMSG_DONE)
+            {
+                return true;
+            }
+            if (hdr->nlmsg_type == NLMSG_ERROR)
+            {
+                auto *err = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(hdr));
+                SWSS_LOG_ERROR("Failed to dump the %s: %s", what.c_str(), strerror(-err->error));
+                return false;
+            }
+            handler(hdr);
+        }
+    }
+}
+
+bool RtnlProgrammer::getBridgeVlans(const string &dev, vector<uint16_t> &vids)
+{
+    int index = static_cast<int>(if_nametoindex(dev.c_str()));
+    if (index == 0)
+    {
+        return false;
+    }
+
+    struct ifinfomsg ifi = {};
+    ifi.ifi_family = AF_BRIDGE;
+
+    vector<char> msg = newMessage(RTM_GETLINK, NLM_F_DUMP, ifi);
+    putValue<uint32_t>(msg, IFLA_EXT_MASK, RTEXT_FILTER_BRVLAN);
+
+    vids.clear();
+    return dump("bridge VLANs of " + dev, msg, [&](const struct nlmsghdr *hdr) {
+        auto *link = reinterpret_cast<const struct ifinfomsg *>(NLMSG_DATA(hdr));
+        if (hdr->nlmsg_type != RTM_NEWLINK || link->ifi_index != index)
+        {
+            return;
+        }
+
+        int attrLen = static_cast<int>(IFLA_PAYLOAD(hdr));
+        for (auto *rta = IFLA_RTA(link); RTA_OK(rta, attrLen); rta = RTA_NEXT(rta, attrLen))
+        {
+            if ((rta->rta_type & NLA_TYPE_MASK) != IFLA_AF_SPEC)
+            {
+                continue;
+            }
+
+            int specLen = static_cast<int>(RTA_PAYLOAD(rta));
+            for (auto *info = static_cast<const struct rtattr *>(RTA_DATA(rta)); RTA_OK(info, specLen); info = RTA_NEXT(info, specLen))
+            {
+                if (info->rta_type == IFLA_BRIDGE_VLAN_INFO)
+                {
+                    vids.push_back(static_cast<const struct bridge_vlan_info *>(RTA_DATA(info))->vid);
+                }
+            }
+        }
+    });
+}
+
+bool RtnlProgrammer::getLinks(const string &kind, vector<NetlinkLink> &links)
+{
+    struct ifinfomsg ifi = {};
+    ifi.ifi_family = AF_UNSPEC;
+
+    vector<char> msg = newMessage(RTM_GETLINK, NLM_F_DUMP, ifi);
+
+    links.clear();
+    return dump(kind + " links", msg, [&](const struct nlmsghdr *hdr) {
+        if (hdr->nlmsg_type != RTM_NEWLINK)
+        {
+            return;
+        }
+
+        auto *ifinfo = reinterpret_cast<const struct ifinfomsg *>(NLMSG_DATA(hdr));
+        NetlinkLink link;
+        link.up = (ifinfo->ifi_flags & IFF_UP) != 0;
+
+        int attrLen = static_cast<int>(IFLA_PAYLOAD(hdr));
+        for (auto *rta = IFLA_RTA(ifinfo); RTA_OK(rta, attrLen); rta = RTA_NEXT(rta, attrLen))
+        {
+            if (rta->rta_type == IFLA_IFNAME)
+            {
+                link.name = static_cast<const char *>(RTA_DATA(rta));
+            }
+            else if (rta->rta_type == IFLA_MTU)
+            {
+                link.mtu = *static_cast<const uint32_t *>(RTA_DATA(rta));
+            }
+            else if ((rta->rta_type & NLA_TYPE_MASK) == IFLA_LINKINFO)
+            {
+                const struct rtattr *data = nullptr;
+                int infoLen = static_cast<int>(RTA_PAYLOAD(rta));
+                for (auto *info = static_cast<const struct rtattr *>(RTA_DATA(rta)); RTA_OK(info, infoLen); info = RTA_NEXT(info, infoLen))
+                {
+                    if (info->rta_type == IFLA_INFO_KIND)
+                    {
+                        link.kind = static_cast<const char *>(RTA_DATA(info));
+                    }
+                    else if ((info->rta_type & NLA_TYPE_MASK) == IFLA_INFO_DATA)
+                    {
+                        data = info;
+                    }
+                }
+
+                // The attributes of the data depend on the kind, which may follow them
+                if (data && (link.kind == "vrf" || link.kind == "vlan"))
+                {
+                    int dataLen = static_cast<int>(RTA_PAYLOAD(data));
+                    for (auto *attr = static_cast<const struct rtattr *>(RTA_DATA(data)); RTA_OK(attr, dataLen); attr = RTA_NEXT(attr, dataLen))
+                    {
+                        if (link.kind == "vrf" && attr->rta_type == IFLA_VRF_TABLE)
+                        {
+                            link.vrf_table = *static_cast<const uint32_t *>(RTA_DATA(attr));
+                        }
+                        else if (link.kind == "vlan" && attr->rta_type == IFLA_VLAN_ID)
+                        {
+                            link.vlan_id = *static_cast<const uint16_t *>(RTA_DATA(attr));
+                        }
+                    }
+                }
+            }
+        }
+
+        if (link.kind == kind)
+        {
+            links.push_back(link);
+        }
+    });
+}
+
+bool RtnlProgrammer::getAddresses(const string &dev, vector<IpPrefix> &prefixes)
+{
+    uint32_t index = if_nametoindex(dev.c_str());
+    if (index == 0)
+    {
+        return false;
+    }
+
+    struct ifaddrmsg ifa = {};
+    ifa.ifa_family = AF_UNSPEC;
+
+    vector<char> msg = newMessage(RTM_GETADDR, NLM_F_DUMP, ifa);
+
+    prefixes.clear();
+    return dump("addresses of " + dev, msg, [&](const struct nlmsghdr *hdr) {
+        auto *addr = reinterpret_cast<const struct ifaddrmsg *>(NLMSG_DATA(hdr));
+        if (hdr->nlmsg_type != RTM_NEWADDR || addr->ifa_index != index)
+        {
+            return;
+        }
+
+        int attrLen = static_cast<int>(IFA_PAYLOAD(hdr));
+        for (auto *rta = IFA_RTA(addr); RTA_OK(rta, attrLen); rta = RTA_NEXT(rta, attrLen))
+        {
+            // IFA_LOCAL is the address of the point-to-point links, IFA_ADDRESS their peer
+            if (rta->rta_type != IFA_ADDRESS)
+            {
+                continue;
+            }
+
+            ip_addr_t ip = {};
+            ip.family = addr->ifa_family;
+            if (addr->ifa_family == AF_INET)
+            {
+                memcpy(&ip.ip_addr.ipv4_addr, RTA_DATA(rta), sizeof(ip.ip_addr.ipv4_addr));
+            }
+            else
+            {
+                memcpy(ip.ip_addr.ipv6_addr, RTA_DATA(rta), sizeof(ip.ip_addr.ipv6_addr));
+            }
+            prefixes.emplace_back(IpAddress(ip).to_string() + "/" + to_string(addr->ifa_prefixlen));
+        }
+    });
+}
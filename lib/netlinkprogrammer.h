@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+#include "macaddress.h"
+
+namespace swss {
+
+/* Bridge VLAN flags, as the pvid, untagged and self keywords of "bridge vlan" */
+#define NETLINK_VLAN_PVID       0x1
+#define NETLINK_VLAN_UNTAGGED   0x2
+#define NETLINK_VLAN_SELF       0x4
+
+/* Link created by NetlinkProgrammer::addLink(), the unset attributes are left to the kernel */
+struct NetlinkLink
+{
+    std::string name;
+    std::string kind;           // "bridge", "vlan", "vrf", "dummy", "vxlan", "ipip"
+    std::string parent;         // lower link of a vlan
+    uint16_t vlan_id = 0;
+    uint32_t vrf_table = 0;
+    uint32_t vni = 0;           // vxlan
+    uint16_t dst_port = 0;      // vxlan UDP port
+    bool learning = true;       // vxlan, "nolearning" when false
+    IpAddress local;            // vxlan and ipip endpoints, unset when zero
+    IpAddress remote;
+    uint32_t mtu = 0;
+    MacAddress address;
+    bool up = false;
+};
+
+struct NetlinkResult
+{
+    std::string request;        // the request, as the equivalent ip or bridge command
+    int error;                  // 0 or a negative errno
+};
+
+/*
+ * Kernel link, bridge VLAN, address, neighbor and route programming for the cfgmgr
+ * daemons, in place of the ip and bridge commands. The requests are queued
+ * and sent by commit() in batches, with one ACK per request. The requests of
+ * a batch are independent: a failure doesn't stop the following ones, queue
+ * the dependent requests in the next commit() when it matters.
+ *
+ * The interface is implemented over rtnetlink by RtnlProgrammer, the tests
+ * record the requests instead.
+ */
+class NetlinkProgrammer
+{
+public:
+    virtual ~NetlinkProgrammer() {}
+
+    virtual void addLink(const NetlinkLink &link) = 0;
+    virtual void delLink(const std::string &name) = 0;
+    virtual void setLinkAdminState(const std::string &name, bool up) = 0;
+    virtual void setLinkMtu(const std::string &name, uint32_t mtu) = 0;
+    virtual void setLinkAddress(const std::string &name, const MacAddress &mac) = 0;
+    /* Enslave the link to a bridge or a VRF, detach it with an empty master */
+    virtual void setLinkMaster(const std::string &name, const std::string &master) = 0;
+    virtual void setBridgeVlanFiltering(const std::string &bridge, bool enable) = 0;
+    virtual void setBridgeNoLinkLocalLearn(const std::string &bridge, bool enable) = 0;
+    /* Learning of a bridge port, as "bridge link set dev <dev> learning on|off" */
+    virtual void setBridgePortLearning(const std::string &dev, bool enable) = 0;
+
+    /* flags are NETLINK_VLAN_*, a range of VLANs is a single request but can't be the pvid */
+    virtual void addBridgeVlanRange(const std::string &dev, uint16_t first, uint16_t last, uint16_t flags) = 0;
+    virtual void delBridgeVlanRange(const std::string &dev, uint16_t first, uint16_t last, uint16_t flags) = 0;
+
+    void addBridgeVlan(const std::string &dev, uint16_t vid, uint16_t flags)
+    {
+        addBridgeVlanRange(dev, vid, vid, flags);
+    }
+
+    void delBridgeVlan(const std::string &dev, uint16_t vid, uint16_t flags)
+    {
+        delBridgeVlanRange(dev, vid, vid, flags);
+    }
+
+    /* Queue one request per range of consecutive VLANs, returns the number of requests */
+    size_t addBridgeVlans(const std::string &dev, const std::set<uint16_t> &vids, uint16_t flags);
+    size_t delBridgeVlans(const std::string &dev, const std::set<uint16_t> &vids, uint16_t flags);
+
+    /*
+     * IPv4 prefixes shorter than /31 get their broadcast address. metric is
+     * the metric of the prefix route, 0 for the kernel default. The scope is
+     * the one of the address: link for the link-local addresses, host for
+     * the loopback ones, global otherwise.
+     */
+    virtual void addAddress(const std::string &dev, const IpPrefix &prefix, uint32_t metric) = 0;
+    virtual void delAddress(const std::string &dev, const IpPrefix &prefix) = 0;
+    virtual void addNeighbor(const std::string &dev, const IpAddress &ip, const MacAddress &mac) = 0;
+    virtual void delNeighbor(const std::string &dev, const IpAddress &ip) = 0;
+
+    /* Route of the main table through a link, without gateway */
+    virtual void replaceRoute(const std::string &dev, const IpPrefix &prefix) = 0;
+    virtual void delRoute(const std::string &dev, const IpPrefix &prefix) = 0;
+
+    /* Number of queued requests */
+    virtual size_t pending() const = 0;
+
+    /* Send the queued requests, one result per request in the queue order */
+    virtual std::vector<NetlinkResult> commit() = 0;
+
+    /* Send the queued requests, throw std::runtime_error on the first failure */
+    void commitOrThrow();
+
+    /* Synchronous queries, they don't send the queued requests */
+    virtual bool linkExists(const std::string &name) = 0;
+    /* VLANs of a bridge port, or of the bridge itself; false if the link can't be dumped */
+    virtual bool getBridgeVlans(const std::string &dev, std::vector<uint16_t> &vids) = 0;
+    /*
+     * Links of a kind, as "ip -d link show type <kind>". Only the name, kind,
+     * vlan_id, vrf_table, mtu and up of NetlinkLink are filled.
+     */
+    virtual bool getLinks(const std::string &kind, std::vector<NetlinkLink> &links) = 0;
+    /* Names of the links of a kind, as "ip link show type <kind>" */
+    bool getLinks(const std::string &kind, std::vector<std::string> &names);
+    virtual bool getAddresses(const std::string &dev, std::vector<IpPrefix> &prefixes) = 0;
+};
+
+class RtnlProgrammer : public NetlinkProgrammer
+{
+public:
+    RtnlProgrammer();
+    ~RtnlProgrammer() override;
+
+    void addLink(const NetlinkLink &link) override;
+    void delLink(const std::string &name) override;
+    void setLinkAdminState(const std::string &name, bool up) override;
+    void setLinkMtu(const std::string &name, uint32_t mtu) override;
+    void setLinkAddress(const std::string &name, const MacAddress &mac) override;
+    void setLinkMaster(const std::string &name, const std::string &master) override;
+    void setBridgeVlanFiltering(const std::string &bridge, bool enable) override;
+    void setBridgeNoLinkLocalLearn(const std::string &bridge, bool enable) override;
+    void setBridgePortLearning(const std::string &dev, bool enable) override;
+
+    void addBridgeVlanRange(const std::string &dev, uint16_t first, uint16_t last, uint16_t flags) override;
+    void delBridgeVlanRange(const std::string &dev, uint16_t first, uint16_t last, uint16_t flags) override;
+
+    void addAddress(const std::string &dev, const IpPrefix &prefix, uint32_t metric) override;
+    void delAddress(const std::string &dev, const IpPrefix &prefix) override;
+    void addNeighbor(const std::string &dev, const IpAddress &ip, const MacAddress &mac) override;
+    void delNeighbor(const std::string &dev, const IpAddress &ip) override;
+
+    void replaceRoute(const std::string &dev, const IpPrefix &prefix) override;
+    void delRoute(const std::string &dev, const IpPrefix &prefix) override;
+
+    size_t pending() const override { return m_requests.size(); }
+    std::vector<NetlinkResult> commit() override;
+
+    bool linkExists(const std::string &name) override;
+    bool getBridgeVlans(const std::string &dev, std::vector<uint16_t> &vids) override;
+    using NetlinkProgrammer::getLinks;
+    bool getLinks(const std::string &kind, std::vector<NetlinkLink> &links) override;
+    bool getAddresses(const std::string &dev, std::vector<IpPrefix> &prefixes) override;
+
+    /* Requests and batches sent since the creation */
+    uint64_t requestCount() const { return m_requestCount; }
+    uint64_t batchCount() const { return m_batchCount; }
+
+private:
+    /*
+     * Builds the message of a request when the batch is sent, once the links
+     * created by the previous batches have an index. Returns false if a link
+     * of the request doesn't exist.
+     */
+    typedef std::function<bool(std::vector<char> &msg)> Encoder;
+
+    struct Request
+    {
+        std::string desc;
+        Encoder encode;
+    };
+
+    void queue(const std::string &desc, Encoder encode);
+    /* Change a link, attrs adds the attributes to the message */
+    void setLink(const std::string &desc, const std::string &name, Encoder attrs,
+                 unsigned flags = 0, unsigned change = 0);
+    void bridgeVlan(const std::string &desc, uint16_t type, const std::string &dev,
+                    uint16_t first, uint16_t last, uint16_t flags);
+    void route(const std::string &desc, uint16_t type, const std::string &dev, const IpPrefix &prefix);
+
+    /* Send a dump request and pass its replies to handler, false on failure */
+    bool dump(const std::string &what, std::vector<char> &msg,
+              const std::function<void(const struct nlmsghdr *hdr)> &handler);
+
+    /* Send the batch and wait for the ACKs of its requests, from results[first] on */
+    void flush(std::vector<char> &batch, std::vector<NetlinkResult> &results, size_t first);
+
+    int m_fd = -1;
+    uint32_t m_seq = 0;
+    std::vector<Request> m_requests;
+    uint64_t m_requestCount = 0;
+    uint64_t m_batchCount = 0;
+};
+
+}
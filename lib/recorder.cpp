@@ -1,7 +1,9 @@
 #include "recorder.h"
-#include "timestamp.h"
 #include "logger.h"
+#include <cstdio>
 #include <cstring>
+#include <ctime>
+#include <sys/time.h>
 
 using namespace swss;
 
@@ -11,6 +13,7 @@ const std::string Recorder::SWSS_FNAME = "swss.rec";
 const std::string Recorder::SAIREDIS_FNAME = "sairedis.rec";
 const std::string Recorder::RESPPUB_FNAME = "responsepublisher.rec";
 const std::string Recorder::RETRY_FNAME = "retry.rec";
+const std::string Recorder::BINARY_MAGIC = std::string("SWSSREC\0", 8);
 
 Recorder& Recorder::Instance()
 {
@@ -19,6 +22,29 @@ Recorder& Recorder::Instance()
 }
 
 
+uint64_t Recorder::now()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+
+    return static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec);
+}
+
+
+std::string Recorder::formatTimestamp(uint64_t timestamp)
+{
+    char buffer[64];
+    time_t sec = static_cast<time_t>(timestamp / 1000000);
+    struct tm tm;
+
+    localtime_r(&sec, &tm);
+    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &tm);
+    snprintf(&buffer[size], 32, "%06lu", static_cast<unsigned long>(timestamp % 1000000));
+
+    return std::string(buffer);
+}
+
+
 RetryRec::RetryRec() 
 {
     /* Set Default values */
@@ -82,15 +108,41 @@ void RecWriter::startRec(bool exit_if_failure)
         else
         {
             setRecord(false);
+            return ;
+        }
+    }
+    if (!writeHeader())
+    {
+        if (exit_if_failure)
+        {
+            exit(EXIT_FAILURE);
         }
+        setRecord(false);
+        return ;
     }
-    record_ofs << swss::getTimestamp() << Recorder::REC_START << std::endl;
+    write(RecEntry{Recorder::now(), Recorder::REC_START.substr(1)});
+    record_ofs.flush();
+
+    m_stop = false;
+    m_writer = std::thread(&RecWriter::writerThread, this);
     SWSS_LOG_NOTICE("%s Recorder: Recording started at %s", getName().c_str(), fname.c_str());
 }
 
 
-RecWriter::~RecWriter()
+void RecWriter::stopRec()
 {
+    if (!m_writer.joinable())
+    {
+        return ;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_one();
+    m_writer.join();
+
     if (record_ofs.is_open())
     {
         record_ofs.close();      
@@ -98,18 +150,187 @@ RecWriter::~RecWriter()
 }
 
 
+RecWriter::~RecWriter()
+{
+    stopRec();
+}
+
+
 void RecWriter::record(const std::string& val)
 {
-    if (!isRecord())
+    record(std::string(val));
+}
+
+
+void RecWriter::record(std::string&& val)
+{
+    if (!isRecord() || !m_writer.joinable())
     {
         return ;
     }
-    if (isRotate())
+
+    // Only take the time here, it's formatted by the writer thread
+    uint64_t timestamp = Recorder::now();
+    bool wakeup;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        wakeup = m_queue.empty();
+        m_queue.push_back(RecEntry{timestamp, std::move(val)});
+    }
+
+    // The writer only waits when the queue is empty
+    if (wakeup)
+    {
+        m_cv.notify_one();
+    }
+}
+
+
+void RecWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_flushedCv.wait(lock, [this]() { return !m_writer.joinable() || (m_queue.empty() && !m_writing); });
+}
+
+
+void RecWriter::writerThread()
+{
+    std::vector<RecEntry> batch;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            // m_stop is set and every record has been written
+            break;
+        }
+
+        batch.swap(m_queue);
+        m_writing = true;
+        lock.unlock();
+
+        if (isRotate())
+        {
+            setRotate(false);
+            logfileReopen();
+        }
+        for (const auto &rec : batch)
+        {
+            write(rec);
+        }
+        record_ofs.flush();
+        batch.clear();
+
+        lock.lock();
+        m_writing = false;
+        if (m_queue.empty())
+        {
+            m_flushedCv.notify_all();
+        }
+    }
+    m_flushedCv.notify_all();
+}
+
+
+bool RecWriter::writeHeader()
+{
+    auto size = record_ofs.seekp(0, std::ios::end).tellp();
+
+    if (size > 0)
+    {
+        std::ifstream ifs(fname, std::ios::binary);
+        RecReader reader(ifs);
+
+        if (reader.isBinary() != isBinary())
+        {
+            /*
+             * Records of the other format can't be appended to the file, the
+             * player would reject it. The existing file is moved aside.
+             */
+            std::string moved = fname + "." + std::to_string(Recorder::now());
+
+            record_ofs.close();
+            if (rename(fname.c_str(), moved.c_str()) != 0)
+            {
+                SWSS_LOG_ERROR("%s Recorder: Failed to move %s recording %s to %s: %s", getName().c_str(),
+                               isBinary() ? "text" : "binary", fname.c_str(), moved.c_str(), strerror(errno));
+                return false;
+            }
+            SWSS_LOG_NOTICE("%s Recorder: Moved %s recording %s to %s", getName().c_str(),
+                            isBinary() ? "text" : "binary", fname.c_str(), moved.c_str());
+
+            record_ofs.open(fname, std::ofstream::out | std::ofstream::app);
+            if (!record_ofs.is_open())
+            {
+                SWSS_LOG_ERROR("%s Recorder: Failed to open recording file %s: error %s", getName().c_str(), fname.c_str(), strerror(errno));
+                return false;
+            }
+            size = 0;
+        }
+    }
+
+    // A rotated or new file gets the binary header, appending to a file doesn't
+    if (isBinary() && size == 0)
     {
-        setRotate(false);
-        logfileReopen();
+        record_ofs.write(Recorder::BINARY_MAGIC.data(), Recorder::BINARY_MAGIC.size());
     }
-    record_ofs << swss::getTimestamp() << "|" << val << std::endl;
+
+    return true;
+}
+
+
+void RecWriter::write(const RecEntry& entry)
+{
+    if (isBinary())
+    {
+        uint32_t len = static_cast<uint32_t>(entry.value.size());
+
+        record_ofs.write(reinterpret_cast<const char *>(&len), sizeof(len));
+        record_ofs.write(reinterpret_cast<const char *>(&entry.timestamp), sizeof(entry.timestamp));
+        record_ofs.write(entry.value.data(), len);
+    }
+    else
+    {
+        record_ofs << Recorder::formatTimestamp(entry.timestamp) << "|" << entry.value << "\n";
+    }
+}
+
+
+bool RecReader::isBinary()
+{
+    std::string magic(Recorder::BINARY_MAGIC.size(), '\0');
+
+    if (m_is.read(&magic[0], magic.size()) && magic == Recorder::BINARY_MAGIC)
+    {
+        return true;
+    }
+
+    m_is.clear();
+    m_is.seekg(0);
+    return false;
+}
+
+
+bool RecReader::next(RecEntry& entry)
+{
+    uint32_t len;
+
+    if (!m_is.read(reinterpret_cast<char *>(&len), sizeof(len)) ||
+        !m_is.read(reinterpret_cast<char *>(&entry.timestamp), sizeof(entry.timestamp)))
+    {
+        return false;
+    }
+
+    entry.value.resize(len);
+    if (len && !m_is.read(&entry.value[0], len))
+    {
+        SWSS_LOG_ERROR("Truncated record, expected %u bytes", len);
+        return false;
+    }
+
+    return true;
 }
 
 
@@ -128,5 +349,10 @@ void RecWriter::logfileReopen()
         SWSS_LOG_ERROR("%s Recorder: Failed to open file %s: %s", getName().c_str(), fname.c_str(), strerror(errno));
         return;
     }
+    if (!writeHeader())
+    {
+        record_ofs.close();
+        return;
+    }
     SWSS_LOG_INFO("%s Recorder: LogRotate request handled", getName().c_str());
 }
@@ -5,6 +5,14 @@
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include <cstdint>
 
 namespace swss {
 
@@ -17,6 +25,7 @@ public:
     void setLocation(const std::string& loc) { m_location = loc; }
     void setFileName(const std::string& name) { m_filename = name; }
     void setName(const std::string& name)  { m_name = name; }
+    void setBinary(bool binary)  { m_binary = binary; }
 
     /* getters */
     bool isRecord()  { return m_recording; }
@@ -24,28 +33,96 @@ public:
     std::string getLoc() { return m_location; }
     std::string getFile() { return m_filename; }
     std::string getName() { return m_name; }
+    bool isBinary()  { return m_binary; }
 
 private:
-    bool m_recording;
-    bool m_rotate;
+    // set by the signal handler / main thread, read by the writer thread
+    std::atomic<bool> m_recording{false};
+    std::atomic<bool> m_rotate{false};
+    bool m_binary = false;
     std::string m_location;
     std::string m_filename;
     std::string m_name;
 };
 
+/* A single record, timestamp in microseconds since the epoch */
+struct RecEntry {
+    uint64_t timestamp;
+    std::string value;
+};
+
+/*
+ * Records are queued by the callers and written to the file by a dedicated
+ * writer thread started by startRec(), so the orchagent threads never block
+ * on the file.
+ *
+ * In binary mode (setBinary) the file starts with Recorder::BINARY_MAGIC and
+ * each record is stored as its uint32_t value length, its uint64_t timestamp
+ * and the value itself, in host byte order. Use RecReader to read it back.
+ * A file recorded in the other format is moved aside to <file>.<timestamp>
+ * when the recording starts.
+ */
 class RecWriter : public RecBase {
 public:
     RecWriter() = default;
     virtual ~RecWriter();
     void startRec(bool exit_if_failure);
+    void stopRec();
     void record(const std::string& val);
+    void record(std::string&& val);
+
+    /*
+     * Lazy variant, the record is built by calling format() only when
+     * recording is active, e.g. record([&]() { return dumpTuple(entry); })
+     */
+    template <typename F,
+              typename = typename std::enable_if<!std::is_convertible<F, std::string>::value>::type>
+    void record(F&& format)
+    {
+        if (!isRecord() || !m_writer.joinable())
+        {
+            return ;
+        }
+        record(format());
+    }
+
+    /* Wait until all the queued records are written to the file */
+    void flush();
 
 protected:
     void logfileReopen();
 
 private:
+    void writerThread();
+    // False when the file can't be recorded to in the current format
+    bool writeHeader();
+    void write(const RecEntry& entry);
+
     std::ofstream record_ofs;
     std::string fname;
+
+    // record() may be called from several ring threads
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_flushedCv;
+    // records waiting for the writer thread
+    std::vector<RecEntry> m_queue;
+    std::thread m_writer;
+    bool m_writing = false;
+    bool m_stop = false;
+};
+
+/* Reads back the records of a binary recording */
+class RecReader {
+public:
+    explicit RecReader(std::istream& is) : m_is(is) {}
+
+    /* Check for the binary header, consumes it if present */
+    bool isBinary();
+    bool next(RecEntry& entry);
+
+private:
+    std::istream& m_is;
 };
 
 class RetryRec : public RecWriter {
@@ -79,6 +156,11 @@ public:
     static const std::string SAIREDIS_FNAME;
     static const std::string RESPPUB_FNAME;
     static const std::string RETRY_FNAME;
+    static const std::string BINARY_MAGIC;
+
+    /* Same format as swss::getTimestamp() */
+    static std::string formatTimestamp(uint64_t timestamp);
+    static uint64_t now();
 
     Recorder() = default;
     /* Individual Handlers */
@@ -0,0 +1,70 @@
+#include <deque>
+
+#include "logger.h"
+#include "subscribertablecache.h"
+
+using namespace std;
+using namespace swss;
+
+SubscriberTableCache::SubscriberTableCache(DBConnector *db, const string &tableName) :
+    SubscriberStateTable(db, tableName)
+{
+    /* The subscriber starts with the existing entries of the table */
+    size_t count = update();
+    SWSS_LOG_INFO("Loaded %zu entries of %s", count, tableName.c_str());
+}
+
+size_t SubscriberTableCache::update()
+{
+    deque<KeyOpFieldsValuesTuple> entries;
+    pops(entries);
+
+    for (auto &entry : entries)
+    {
+        const string &key = kfvKey(entry);
+        const string &op = kfvOp(entry);
+
+        /* A SET carries all the fields of the entry */
+        if (op == SET_COMMAND)
+        {
+            m_entries[key] = move(kfvFieldsValues(entry));
+        }
+        else if (op == DEL_COMMAND)
+        {
+            m_entries.erase(key);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Unknown operation type %s for %s", op.c_str(), key.c_str());
+        }
+    }
+
+    return entries.size();
+}
+
+bool SubscriberTableCache::get(const string &key, vector<FieldValueTuple> &values) const
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+
+    values = it->second;
+    return true;
+}
+
+bool SubscriberTableCache::exists(const string &key) const
+{
+    return m_entries.find(key) != m_entries.end();
+}
+
+void SubscriberTableCache::getKeys(vector<string> &keys) const
+{
+    keys.clear();
+    keys.reserve(m_entries.size());
+    for (const auto &it : m_entries)
+    {
+        keys.push_back(it.first);
+    }
+}
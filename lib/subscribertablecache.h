@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dbconnector.h"
+#include "subscriberstatetable.h"
+
+namespace swss {
+
+/*
+ * In memory copy of a table, kept up to date from its keyspace
+ * notifications, for the daemons looking the table up on every message they
+ * handle. The copy is loaded at the creation; add the cache to the Select of
+ * the daemon and call update() when it is selected.
+ */
+class SubscriberTableCache : public SubscriberStateTable
+{
+public:
+    SubscriberTableCache(DBConnector *db, const std::string &tableName);
+
+    /* Apply the pending changes of the table, returns the number of changes */
+    size_t update();
+
+    /* Same as Table::get() and Table::getKeys(), without a round trip to the DB */
+    bool get(const std::string &key, std::vector<FieldValueTuple> &values) const;
+    bool exists(const std::string &key) const;
+    void getKeys(std::vector<std::string> &keys) const;
+    size_t size() const { return m_entries.size(); }
+
+private:
+    std::unordered_map<std::string, std::vector<FieldValueTuple>> m_entries;
+};
+
+}
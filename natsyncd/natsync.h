@@ -20,6 +20,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "notificationproducer.h"
+#include "subscribertablecache.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
 #include "ipaddress.h"
@@ -56,6 +57,13 @@ public:
         return m_AppRestartAssist;
     }
 
+    /* APPL_DB NAT tables looked up by onMsg(), to be selected and updated by the main loop */
+    std::vector<SubscriberTableCache *> getCheckTables()
+    {
+        return { &m_natCheckTable, &m_naptCheckTable, &m_naptPoolCheckTable,
+                 &m_twiceNatCheckTable, &m_twiceNaptCheckTable };
+    }
+
 private:
     static int  parseConnTrackMsg(const struct nfnl_ct *ct, struct naptEntry &entry);
     void        updateConnTrackEntry(struct nfnl_ct *ct);
@@ -73,11 +81,11 @@ private:
     ProducerStateTable m_natTwiceTable;
     ProducerStateTable m_naptTwiceTable;
 
-    Table              m_natCheckTable;
-    Table              m_naptCheckTable;
-    Table              m_naptPoolCheckTable;
-    Table              m_twiceNatCheckTable;
-    Table              m_twiceNaptCheckTable;
+    SubscriberTableCache m_natCheckTable;
+    SubscriberTableCache m_naptCheckTable;
+    SubscriberTableCache m_naptPoolCheckTable;
+    SubscriberTableCache m_twiceNatCheckTable;
+    SubscriberTableCache m_twiceNaptCheckTable;
 
     Table              m_stateNatRestoreTable;
     AppRestartAssist  *m_AppRestartAssist;
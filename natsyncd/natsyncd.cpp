@@ -71,10 +71,23 @@ int main(int argc, char **argv)
             nfnl.dumpRequest(IPCTNL_MSG_CT_GET);
 
             s.addSelectable(&nfnl);
+            for (auto table : sync.getCheckTables())
+            {
+                s.addSelectable(table);
+            }
+
             while (true)
             {
                 Selectable *temps;
                 s.select(&temps);
+
+                /* Keep the NAT entries cached by sync up to date */
+                auto checkTable = dynamic_cast<SubscriberTableCache *>(temps);
+                if (checkTable)
+                {
+                    checkTable->update();
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
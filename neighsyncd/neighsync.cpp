@@ -1,4 +1,5 @@
 #include <string>
+#include <inttypes.h>
 #include <netinet/in.h>
 #include <netlink/route/link.h>
 #include <netlink/route/neighbour.h>
@@ -20,7 +21,7 @@ using namespace std;
 using namespace swss;
 
 NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector *cfgDb) :
-    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME),
+    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME, true),
     m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME),
     m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
     m_cfgLagInterfaceTable(cfgDb, CFG_LAG_INTF_TABLE_NAME),
@@ -64,9 +65,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     string key;
     string family;
     string intfName;
-    std::vector<std::string> peerSwitchKeys;
-    m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
-    bool is_dualtor = peerSwitchKeys.size() > 0;
+    bool is_dualtor = m_cfgPeerSwitchTable.size() > 0;
 
     if ((nlmsg_type != RTM_NEWNEIGH) && (nlmsg_type != RTM_GETNEIGH) &&
         (nlmsg_type != RTM_DELNEIGH))
@@ -178,15 +177,96 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     {
         m_AppRestartAssist->insertToMap(APP_NEIGH_TABLE_NAME, key, fvVector, delete_key);
     }
+    else if (delete_key == true)
+    {
+        holdNeigh(KeyOpFieldsValuesTuple(key, DEL_COMMAND, vector<FieldValueTuple>()));
+    }
     else
     {
-        if (delete_key == true)
+        holdNeigh(KeyOpFieldsValuesTuple(key, SET_COMMAND, fvVector));
+    }
+}
+
+/*
+ * A later update of a neighbor replaces the held one, a DEL followed by a SET
+ * is written as the SET since neighorch updates the MAC of an existing neighbor.
+ */
+void NeighSync::holdNeigh(KeyOpFieldsValuesTuple &&kfv)
+{
+    m_batchCounters.received++;
+
+    auto it = m_heldIndex.find(kfvKey(kfv));
+    if (it != m_heldIndex.end())
+    {
+        m_heldNeighs[it->second] = std::move(kfv);
+        m_batchCounters.suppressed++;
+        return;
+    }
+
+    if (m_heldNeighs.empty())
+    {
+        m_batchStart = chrono::steady_clock::now();
+    }
+    m_heldIndex.emplace(kfvKey(kfv), m_heldNeighs.size());
+    m_heldNeighs.push_back(std::move(kfv));
+
+    if (m_heldNeighs.size() >= NEIGH_BATCH_MAX_ENTRIES)
+    {
+        flushNeighbors();
+    }
+}
+
+void NeighSync::flushNeighbors()
+{
+    if (!m_heldNeighs.empty())
+    {
+        vector<KeyOpFieldsValuesTuple> sets;
+        vector<string> dels;
+
+        for (auto &held : m_heldNeighs)
         {
-            m_neighTable.del(key);
-            return;
+            if (kfvOp(held) == SET_COMMAND)
+            {
+                sets.push_back(std::move(held));
+            }
+            else
+            {
+                dels.push_back(kfvKey(held));
+            }
         }
-        m_neighTable.set(key, fvVector);
+
+        /* The neighbors are unique in the batch, their order doesn't matter */
+        if (!dels.empty())
+        {
+            m_neighTable.del(dels);
+        }
+        if (!sets.empty())
+        {
+            m_neighTable.set(sets);
+        }
+        m_batchCounters.flushed += m_heldNeighs.size();
+
+        SWSS_LOG_INFO("Flushed %zu neighbors, %" PRIu64 " updates suppressed so far",
+                      m_heldNeighs.size(), m_batchCounters.suppressed);
+
+        m_heldNeighs.clear();
+        m_heldIndex.clear();
     }
+
+    /* Also written by the warm restart reconciliation */
+    m_neighTable.flush();
+}
+
+int NeighSync::getNeighFlushTimeout() const
+{
+    if (m_heldNeighs.empty())
+    {
+        return -1;
+    }
+
+    auto held = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - m_batchStart).count();
+
+    return held >= NEIGH_BATCH_MAX_DELAY ? 0 : static_cast<int>(NEIGH_BATCH_MAX_DELAY - held);
 }
 
 /* To check the ipv6 link local is enabled on a given port */
@@ -1,8 +1,13 @@
 #ifndef __NEIGHSYNC__
 #define __NEIGHSYNC__
 
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "subscribertablecache.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
 
@@ -16,8 +21,29 @@
  */
 #define RESTORE_NEIGH_WAIT_TIME_OUT 180
 
+/*
+ * The neighbor updates are held and written to APPL_DB in batches, as soon
+ * as no netlink message is waiting or once the oldest update has been held
+ * NEIGH_BATCH_MAX_DELAY milliseconds or NEIGH_BATCH_MAX_ENTRIES neighbors
+ * are held.
+ */
+#define NEIGH_BATCH_MAX_DELAY 200
+#define NEIGH_BATCH_MAX_ENTRIES 4096
+#define NEIGH_SYNC_PPL_SIZE 4096
+
 namespace swss {
 
+/* Counters of the neighbor update batching */
+struct NeighBatchCounters
+{
+    /* Neighbor updates held */
+    uint64_t received = 0;
+    /* Updates replaced by a later update of the same neighbor before being written */
+    uint64_t suppressed = 0;
+    /* Updates written to the neighbor table */
+    uint64_t flushed = 0;
+};
+
 class NeighSync : public NetMsg
 {
 public:
@@ -35,13 +61,40 @@ public:
         return m_AppRestartAssist;
     }
 
+    /* Write the held neighbor updates and flush the pipeline */
+    void flushNeighbors();
+
+    /* Milliseconds until the held neighbor updates are due, -1 if none is held */
+    int getNeighFlushTimeout() const;
+
+    const NeighBatchCounters& getNeighBatchCounters() const
+    {
+        return m_batchCounters;
+    }
+
+    /* CONFIG_DB tables looked up by onMsg(), to be selected and updated by the main loop */
+    std::vector<SubscriberTableCache *> getCfgTables()
+    {
+        return { &m_cfgPeerSwitchTable, &m_cfgVlanInterfaceTable, &m_cfgLagInterfaceTable, &m_cfgInterfaceTable };
+    }
+
 private:
-    Table m_stateNeighRestoreTable, m_cfgPeerSwitchTable;
+    Table m_stateNeighRestoreTable;
     ProducerStateTable m_neighTable;
     AppRestartAssist  *m_AppRestartAssist;
-    Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+    SubscriberTableCache m_cfgPeerSwitchTable;
+    SubscriberTableCache m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+
+    /* Neighbor updates held for the next batch, one per neighbor */
+    std::vector<KeyOpFieldsValuesTuple> m_heldNeighs;
+    std::unordered_map<std::string, size_t> m_heldIndex;
+    std::chrono::steady_clock::time_point m_batchStart;
+    NeighBatchCounters m_batchCounters;
 
     bool isLinkLocalEnabled(const std::string &port);
+
+    /* Hold a neighbor update, replacing the one held for the same neighbor */
+    void holdNeigh(KeyOpFieldsValuesTuple &&kfv);
 };
 
 }
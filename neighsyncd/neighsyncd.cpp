@@ -16,7 +16,7 @@ int main(int argc, char **argv)
     Logger::linkToDbNative("neighsyncd");
 
     DBConnector appDb("APPL_DB", 0);
-    RedisPipeline pipelineAppDB(&appDb);
+    RedisPipeline pipelineAppDB(&appDb, NEIGH_SYNC_PPL_SIZE);
     DBConnector stateDb("STATE_DB", 0);
     DBConnector cfgDb("CONFIG_DB", 0);
 
@@ -67,10 +67,34 @@ int main(int argc, char **argv)
             netlink.dumpRequest(RTM_GETNEIGH);
 
             s.addSelectable(&netlink);
+            for (auto table : sync.getCfgTables())
+            {
+                s.addSelectable(table);
+            }
+
             while (true)
             {
                 Selectable *temps;
-                s.select(&temps);
+
+                /*
+                 * Poll while neighbor updates are held: they are written as
+                 * soon as no message is waiting, so that a single neighbor
+                 * isn't delayed, and in batches when the messages keep coming.
+                 */
+                int ret = s.select(&temps, sync.getNeighFlushTimeout() < 0 ? -1 : 0);
+                if (ret == Select::TIMEOUT)
+                {
+                    sync.flushNeighbors();
+                    continue;
+                }
+
+                /* Keep the interface configuration cached by sync up to date */
+                auto cfgTable = dynamic_cast<SubscriberTableCache *>(temps);
+                if (cfgTable)
+                {
+                    cfgTable->update();
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -81,8 +105,14 @@ int main(int argc, char **argv)
                     {
                         sync.getRestartAssist()->stopReconcileTimer(s);
                         sync.getRestartAssist()->reconcile();
+                        sync.flushNeighbors();
                     }
                 }
+
+                if (sync.getNeighFlushTimeout() == 0)
+                {
+                    sync.flushNeighbors();
+                }
             }
         }
         catch (const std::exception& e)
@@ -966,20 +966,20 @@ bool AclRule::validateAddMatch(string attr_name, string attr_value)
 
             for (auto alias : ports)
             {
-                Port port;
-                if (!gPortsOrch->getPort(alias, port))
+                const Port *port = gPortsOrch->findPort(alias);
+                if (!port)
                 {
                     SWSS_LOG_ERROR("Failed to locate port %s", alias.c_str());
                     return false;
                 }
 
-                if (port.m_type != Port::PHY)
+                if (port->m_type != Port::PHY)
                 {
                     SWSS_LOG_ERROR("Cannot bind rule to %s: IN_PORTS can only match physical interfaces", alias.c_str());
                     return false;
                 }
 
-                inPorts.push_back(port.m_port_id);
+                inPorts.push_back(port->m_port_id);
             }
 
             matchData.data.objlist.count = static_cast<uint32_t>(inPorts.size());
@@ -996,20 +996,20 @@ bool AclRule::validateAddMatch(string attr_name, string attr_value)
 
             for (auto alias : ports)
             {
-                Port port;
-                if (!gPortsOrch->getPort(alias, port))
+                const Port *port = gPortsOrch->findPort(alias);
+                if (!port)
                 {
                     SWSS_LOG_ERROR("Failed to locate port %s", alias.c_str());
                     return false;
                 }
 
-                if (port.m_type != Port::PHY)
+                if (port->m_type != Port::PHY)
                 {
                     SWSS_LOG_ERROR("Cannot bind rule to %s: OUT_PORTS can only match physical interfaces", alias.c_str());
                     return false;
                 }
 
-                outPorts.push_back(port.m_port_id);
+                outPorts.push_back(port->m_port_id);
             }
 
             matchData.data.objlist.count = static_cast<uint32_t>(outPorts.size());
@@ -1018,19 +1018,19 @@ bool AclRule::validateAddMatch(string attr_name, string attr_value)
         else if (attr_name == MATCH_OUT_PORT)
         {
             auto alias = attr_value;
-            Port port;
-            if (!gPortsOrch->getPort(alias, port))
+            const Port *port = gPortsOrch->findPort(alias);
+            if (!port)
             {
                 SWSS_LOG_ERROR("Failed to locate port %s", alias.c_str());
                 return false;
             }
-            if (port.m_type != Port::PHY)
+            if (port->m_type != Port::PHY)
             {
                 SWSS_LOG_ERROR("Cannot bind rule to %s: OUT_PORT can only match physical interfaces", alias.c_str());
                 return false;
             }
 
-            matchData.data.oid = port.m_port_id;
+            matchData.data.oid = port->m_port_id;
         }
         else if (attr_name == MATCH_IP_TYPE)
         {
@@ -2077,16 +2077,16 @@ sai_object_id_t AclRulePacket::getRedirectObjectId(const string& redirect_value)
     string target = redirect_value;
 
     // Try to parse physical port and LAG first
-    Port port;
-    if (gPortsOrch->getPort(target, port))
+    const Port *port = gPortsOrch->findPort(target);
+    if (port)
     {
-        if (port.m_type == Port::PHY)
+        if (port->m_type == Port::PHY)
         {
-            return port.m_port_id;
+            return port->m_port_id;
         }
-        else if (port.m_type == Port::LAG)
+        else if (port->m_type == Port::LAG)
         {
-            return port.m_lag_id;
+            return port->m_lag_id;
         }
         else
         {
@@ -3713,8 +3713,8 @@ void AclOrch::init(vector<TableConnector>& connectors, PortsOrch *portOrch, Mirr
     initDefaultTableTypes(platform, sub_platform);
 
     // Attach observers
-    m_mirrorOrch->attach(this);
-    gPortsOrch->attach(this);
+    m_mirrorOrch->attach(this, SUBJECT_TYPE_MIRROR_SESSION_CHANGE);
+    gPortsOrch->attach(this, SUBJECT_TYPE_PORT_CHANGE);
 }
 
 void AclOrch::initDefaultTableTypes(const string& platform, const string& sub_platform)
@@ -4214,7 +4214,7 @@ AclOrch::AclOrch(vector<TableConnector>& connectors, DBConnector* stateDb, Switc
 
     if (m_dTelOrch)
     {
-        m_dTelOrch->attach(this);
+        m_dTelOrch->attach(this, SUBJECT_TYPE_INT_SESSION_CHANGE);
         createDTelWatchListTables();
     }
 }
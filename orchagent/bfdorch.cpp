@@ -221,17 +221,27 @@ void BfdOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
-
-    consumer.pop(op, data, values);
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
 
     if (&consumer != m_bfdStateNotificationConsumer)
     {
         return;
     }
 
+    for (auto& entry : entries)
+    {
+        handleNotification(consumer, entry);
+    }
+}
+
+void BfdOrch::handleNotification(NotificationConsumer &consumer, KeyOpFieldsValuesTuple& entry)
+{
+    SWSS_LOG_ENTER();
+
+    const auto &op = kfvOp(entry);
+    const auto &data = kfvKey(entry);
+
     if (op == "bfd_session_state_change")
     {
         uint32_t count;
@@ -35,6 +35,7 @@ private:
     uint32_t bfd_gen_id(void);
     uint32_t bfd_src_port(void);
 
+    void handleNotification(swss::NotificationConsumer &consumer, swss::KeyOpFieldsValuesTuple& entry);
     void notify_session_state_down(const std::string& key);
     bool register_bfd_state_change_notification(void);
     void update_port_number(std::vector<sai_attribute_t> &attrs);
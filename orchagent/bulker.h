@@ -103,6 +103,14 @@ static inline bool operator==(const sai_inseg_entry_t& a, const sai_inseg_entry_
         ;
 }
 
+static inline bool operator==(const sai_fdb_entry_t& a, const sai_fdb_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && memcmp(a.mac_address, b.mac_address, sizeof(a.mac_address)) == 0
+        && a.bv_id == b.bv_id
+        ;
+}
+
 static inline bool operator==(const sai_neighbor_entry_t& a, const sai_neighbor_entry_t& b)
 {
     return a.switch_id == b.switch_id
@@ -423,6 +431,19 @@ struct SaiBulkerTraits<sai_dash_meter_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_dash_acl_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_dash_acl_api_t;
+    using create_entry_fn = sai_create_dash_acl_rule_fn;
+    using remove_entry_fn = sai_remove_dash_acl_rule_fn;
+    using set_entry_attribute_fn = sai_set_dash_acl_rule_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_vnet_api_t>
 {
@@ -948,13 +969,10 @@ template <>
 inline EntityBulker<sai_fdb_api_t>::EntityBulker(sai_fdb_api_t *api, size_t max_bulk_size) :
     max_bulk_size(max_bulk_size)
 {
-    // TODO: implement after create_fdb_entries() is available in SAI
-    throw std::logic_error("Not implemented");
-    /*
+    // The bulk functions are null if the SAI implementation doesn't provide them
     create_entries = api->create_fdb_entries;
     remove_entries = api->remove_fdb_entries;
     set_entries_attribute = api->set_fdb_entries_attribute;
-    */
 }
 
 template <>
@@ -1377,6 +1395,16 @@ inline ObjectBulker<sai_dash_meter_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash
     set_entries_attribute = nullptr;
 }
 
+template <>
+inline ObjectBulker<sai_dash_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_acl_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_dash_acl_rules;
+    remove_entries = api->remove_dash_acl_rules;
+    set_entries_attribute = nullptr;
+}
+
 template <>
 inline ObjectBulker<sai_dash_tunnel_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_tunnel_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_object_type_extensions_t object_type) :
     switch_id(switch_id),
@@ -477,6 +477,8 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     for (auto i : data)
     {
         const auto &field = fvField(i);
@@ -543,6 +545,8 @@ void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter++;
@@ -558,6 +562,8 @@ void CrmOrch::decCrmResUsedCounter(CrmResourceType resource)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter--;
@@ -573,6 +579,8 @@ void CrmOrch::incCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter++;
@@ -588,6 +596,8 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter--;
@@ -627,6 +637,8 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
@@ -643,6 +655,8 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter--;
@@ -658,6 +672,8 @@ void CrmOrch::incCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter++;
@@ -673,6 +689,8 @@ void CrmOrch::decCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter--;
@@ -688,6 +706,8 @@ void CrmOrch::incCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
@@ -721,6 +741,8 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     try
     {
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
@@ -752,6 +774,8 @@ void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_mutex);
+
     getResAvailableCounters();
     updateCrmCountersTable();
     checkCrmThresholds();
@@ -845,7 +869,12 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
     sai_object_type_t objType = crmResSaiObjAttrMap.at(type);
 
     for (auto &cnt : res.countersMap)
-    { 
+    {
+        if (!takePollBudget(cnt.second))
+        {
+            continue;
+        }
+
         sai_attribute_t attr;
         attr.id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
         attr.value.oid = cnt.second.id;
@@ -869,16 +898,42 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
             break;
         }
 
-        cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+        cnt.second.setPolledAvailableCounter(static_cast<uint32_t>(availCount));
     }
 
     return true;
 }
 
+bool CrmOrch::takePollBudget(const CrmResourceCounter &cnt)
+{
+    if (!cnt.pollPending() || (m_pollBudget == 0))
+    {
+        return false;
+    }
+
+    m_pollBudget--;
+    return true;
+}
+
 void CrmOrch::getResAvailableCounters()
 {
     SWSS_LOG_ENTER();
 
+    if ((m_pollCount++ % CRM_FULL_REFRESH_POLLS) == 0)
+    {
+        // Query and write all the counters again, the resources can be shared with other objects
+        for (auto &res : m_resourcesMap)
+        {
+            for (auto &cnt : res.second.countersMap)
+            {
+                cnt.second.polled = false;
+                cnt.second.publishedUsedCounter = -1;
+                cnt.second.publishedAvailableCounter = -1;
+            }
+        }
+    }
+    m_pollBudget = CRM_POLL_BATCH_SIZE;
+
     for (auto &res : m_resourcesMap)
     {
         // ignore unsupported resources
@@ -996,6 +1051,11 @@ void CrmOrch::getResAvailableCounters()
 
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!takePollBudget(cnt.second))
+                    {
+                        continue;
+                    }
+
                     sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
                     if ((status == SAI_STATUS_NOT_SUPPORTED) ||
                         (status == SAI_STATUS_NOT_IMPLEMENTED) ||
@@ -1013,7 +1073,7 @@ void CrmOrch::getResAvailableCounters()
                         break;
                     }
 
-                    cnt.second.availableCounter = attr.value.u32;
+                    cnt.second.setPolledAvailableCounter(attr.value.u32);
                 }
 
                 break;
@@ -1023,6 +1083,11 @@ void CrmOrch::getResAvailableCounters()
             {
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!takePollBudget(cnt.second))
+                    {
+                        continue;
+                    }
+
                     std::string table_name = cnt.first;
                     sai_object_type_t objType = crmResSaiObjAttrMap.at(res.first);
                     sai_attribute_t attr;
@@ -1041,7 +1106,7 @@ void CrmOrch::getResAvailableCounters()
                         break;
                     }
 
-                    cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+                    cnt.second.setPolledAvailableCounter(static_cast<uint32_t>(availCount));
                 }
                 break;
             }
@@ -1058,28 +1123,37 @@ void CrmOrch::getResAvailableCounters()
                 return;
         }
     }
+
+    SWSS_LOG_INFO("CRM poll %" PRIu64 " queried %u table/group resources",
+                  m_pollCount, CRM_POLL_BATCH_SIZE - m_pollBudget);
 }
 
 void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
-    // Update CRM used counters in COUNTERS_DB
+    // Update the changed CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
+                if (cnt.second.publishedUsedCounter == cnt.second.usedCounter)
+                {
+                    continue;
+                }
+
                 FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
                 vector<FieldValueTuple> attrs = { attr };
                 m_countersCrmTable->set(cnt.first, attrs);
+                cnt.second.publishedUsedCounter = cnt.second.usedCounter;
             }
         }
         catch(const out_of_range &e)
@@ -1088,22 +1162,28 @@ void CrmOrch::updateCrmCountersTable()
         }
     }
 
-    // Update CRM available counters in COUNTERS_DB
+    // Update the changed CRM available counters in COUNTERS_DB
     for (const auto &i : crmAvailCntsTableMap)
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
+                if (cnt.second.publishedAvailableCounter == cnt.second.availableCounter)
+                {
+                    continue;
+                }
+
                 FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
                 vector<FieldValueTuple> attrs = { attr };
                 m_countersCrmTable->set(cnt.first, attrs);
+                cnt.second.publishedAvailableCounter = cnt.second.availableCounter;
             }
         }
         catch(const out_of_range &e)
@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <map>
+#include <mutex>
 #include "orch.h"
 #include "port.h"
 #include "events.h"
@@ -11,6 +12,15 @@ extern "C" {
 #include "sai.h"
 }
 
+/*
+ * The "available" counters of the per ACL table, EXT table and DASH ACL group
+ * resources are only queried when their "used" counter changed, up to
+ * CRM_POLL_BATCH_SIZE queries per poll, the remaining ones are queried by the
+ * next polls. All of them are queried again every CRM_FULL_REFRESH_POLLS polls.
+ */
+#define CRM_POLL_BATCH_SIZE 1024
+#define CRM_FULL_REFRESH_POLLS 10
+
 enum class CrmResourceType
 {
     CRM_IPV4_ROUTE,
@@ -104,6 +114,27 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+
+        // "used" counter when the "available" counter was last queried
+        uint32_t polledUsedCounter = 0;
+        bool polled = false;
+
+        // Counters last written to COUNTERS_DB, -1 if not written since the last full refresh
+        int64_t publishedUsedCounter = -1;
+        int64_t publishedAvailableCounter = -1;
+
+        // The "available" counter of a per table/group resource is queried again when the "used" one changed
+        bool pollPending() const
+        {
+            return !polled || usedCounter != polledUsedCounter;
+        }
+
+        void setPolledAvailableCounter(uint32_t available)
+        {
+            availableCounter = available;
+            polledUsedCounter = usedCounter;
+            polled = true;
+        }
     };
 
     struct CrmResourceEntry
@@ -123,14 +154,29 @@ private:
 
     std::chrono::seconds m_pollingInterval;
 
+    // Polls since the start, the per table/group resources are all queried every CRM_FULL_REFRESH_POLLS polls
+    uint64_t m_pollCount = 0;
+    // Per table/group queries left in the current poll
+    uint32_t m_pollBudget = 0;
+
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
+    /*
+     * Serializes the "used" counter updates of the orchs served by different
+     * ring threads (routes, DASH routes) with each other and with the polls
+     * of the main thread. Recursive as the DASH ACL group counters update the
+     * global ones.
+     */
+    std::recursive_mutex m_mutex;
+
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
     bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
     void getResAvailableCounters();
+    // Take a query from the budget of the poll if the counter needs one
+    bool takePollBudget(const CrmResourceCounter &cnt);
     void updateCrmCountersTable();
     void checkCrmThresholds();
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
@@ -1,5 +1,7 @@
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <algorithm>
+#include <deque>
 #include <map>
 
 #include "dashaclgroupmgr.h"
@@ -14,6 +16,7 @@
 extern sai_dash_acl_api_t* sai_dash_acl_api;
 extern sai_dash_eni_api_t* sai_dash_eni_api;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern CrmOrch *gCrmOrch;
 
 using namespace std;
@@ -128,21 +131,21 @@ sai_attr_id_t getSaiStage(DashAclDirection d, sai_ip_addr_family_t f, DashAclSta
 }
 
 DashAclRuleInfo::DashAclRuleInfo(const DashAclRule &rule) :
-    m_src_tags(rule.m_src_tags),
-    m_dst_tags(rule.m_dst_tags)
+    m_rule(rule)
 {
     SWSS_LOG_ENTER();
 }
 
 bool DashAclRuleInfo::isTagUsed(const std::string &tag_id) const
 {
-    return (m_src_tags.find(tag_id) != end(m_src_tags)) || (m_dst_tags.find(tag_id) != end(m_dst_tags));
+    return (m_rule.m_src_tags.find(tag_id) != end(m_rule.m_src_tags)) || (m_rule.m_dst_tags.find(tag_id) != end(m_rule.m_dst_tags));
 }
 
 DashAclGroupMgr::DashAclGroupMgr(DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch) :
     m_dash_orch(dashorch),
     m_dash_acl_orch(aclorch),
-    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME))
+    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME)),
+    m_rule_bulker(sai_dash_acl_api, gSwitchId, gMaxBulkSize)
 {
     SWSS_LOG_ENTER();
 }
@@ -237,10 +240,15 @@ task_process_status DashAclGroupMgr::remove(const string& group_id)
         return task_need_retry;
     }
 
+    if (!group.m_dash_acl_rule_table.empty())
+    {
+        SWSS_LOG_INFO("ACL group %s still has %zu rules", group_id.c_str(), group.m_dash_acl_rule_table.size());
+        return task_need_retry;
+    }
+
     remove(group);
 
-    m_groups_table.erase(group_id);
-    detachTags(group_id, group.m_tags);
+    m_groups_table.erase(group_it);
     SWSS_LOG_INFO("Removed ACL group %s", group_id.c_str());
 
     return task_success;
@@ -253,15 +261,12 @@ bool DashAclGroupMgr::exists(const string& group_id) const
     return m_groups_table.find(group_id) != m_groups_table.end();
 }
 
-DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& rule)
+void DashAclGroupMgr::queueCreateRule(const DashAclGroup& group, DashAclRuleBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
     vector<sai_attribute_t> attrs;
-    vector<sai_ip_prefix_t> src_prefixes = {};
-    vector<sai_ip_prefix_t> dst_prefixes = {};
-
-    DashAclRuleInfo rule_info = rule;
+    auto& rule = ctxt.m_rule_info.m_rule;
 
     auto any_ip = [] (const auto& g)
     {
@@ -291,7 +296,7 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PROTOCOL;
 
-    vector<uint8_t> protocols;
+    auto& protocols = ctxt.m_protocols;
     if (rule.m_protocols.size()) {
         protocols = rule.m_protocols;
     } else {
@@ -301,24 +306,17 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.back().value.u8list.count = static_cast<uint32_t>(protocols.size());
     attrs.back().value.u8list.list = protocols.data();
 
-    if (!rule.m_src_prefixes.empty())
-    {
-        src_prefixes.insert(src_prefixes.end(),
-                 rule.m_src_prefixes.begin(),  rule.m_src_prefixes.end());
-    }
+    auto& src_prefixes = ctxt.m_src_prefixes;
+    auto& dst_prefixes = ctxt.m_dst_prefixes;
 
-    if (!rule.m_dst_prefixes.empty())
-    {
-        dst_prefixes.insert(dst_prefixes.end(),
-                rule.m_dst_prefixes.begin(), rule.m_dst_prefixes.end());
-    }
+    src_prefixes = rule.m_src_prefixes;
+    dst_prefixes = rule.m_dst_prefixes;
 
     for (const auto &tag : rule.m_src_tags)
     {
         const auto& prefixes = m_dash_acl_orch->getDashAclTagMgr().getPrefixes(tag);
         src_prefixes.insert(src_prefixes.end(),
             prefixes.begin(), prefixes.end());
-        group.m_tags.insert(tag);
     }
 
     for (const auto &tag : rule.m_dst_tags)
@@ -327,7 +325,6 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
 
         dst_prefixes.insert(dst_prefixes.end(),
             prefixes.begin(), prefixes.end());
-        group.m_tags.insert(tag);
     }
 
     if (src_prefixes.empty())
@@ -362,23 +359,29 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
-    attrs.back().value.oid = group.m_dash_acl_group_id;
+    attrs.back().value.oid = ctxt.m_group_oid;
 
-    auto status = sai_dash_acl_api->create_dash_acl_rule(&rule_info.m_dash_acl_rule_id, gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to create ACL rule: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status);
-    }
+    ctxt.m_ip_version = group.m_ip_version;
+    ctxt.m_create = true;
+    m_rule_bulker.create_entry(&ctxt.m_rule_info.m_dash_acl_rule_id, static_cast<uint32_t>(attrs.size()), attrs.data());
+}
 
-    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
-            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
-    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+void DashAclGroupMgr::queueRemoveRule(DashAclRuleBulkContext& ctxt, sai_object_id_t rule_oid)
+{
+    SWSS_LOG_ENTER();
 
-    return rule_info;
+    ctxt.m_removed_rule_id = rule_oid;
+    m_rule_bulker.remove_entry(&ctxt.m_remove_status, rule_oid);
 }
 
-task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRule& rule)
+void DashAclGroupMgr::flushRules()
+{
+    SWSS_LOG_ENTER();
+
+    m_rule_bulker.flush();
+}
+
+task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRule& rule, DashAclRuleBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
@@ -408,16 +411,330 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
         }
     }
 
-    auto rule_info = createRule(group, rule);
+    ctxt.m_group_id = group_id;
+    ctxt.m_rule_id = rule_id;
+    ctxt.m_group_oid = group.m_dash_acl_group_id;
+    ctxt.m_rule_info = rule;
+
+    // The attributes of a rule can't be set, an existing rule is replaced
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    if (rule_it != group.m_dash_acl_rule_table.end())
+    {
+        queueRemoveRule(ctxt, rule_it->second.m_dash_acl_rule_id);
+    }
+
+    queueCreateRule(group, ctxt);
+
+    return task_success;
+}
+
+task_process_status DashAclGroupMgr::createRulePost(const DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    auto group_it = m_groups_table.find(ctxt.m_group_id);
+    ABORT_IF_NOT(group_it != m_groups_table.end(), "ACL group %s does not exist", ctxt.m_group_id.c_str());
+    auto& group = group_it->second;
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+
+    if (ctxt.m_removed_rule_id != SAI_NULL_OBJECT_ID)
+    {
+        if (ctxt.m_remove_status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %d, %s", ctxt.m_group_id.c_str(), ctxt.m_rule_id.c_str(),
+                           ctxt.m_remove_status, sai_serialize_status(ctxt.m_remove_status).c_str());
+            auto handle_status = handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, ctxt.m_remove_status);
+            if (handle_status != task_success)
+            {
+                // The replaced rule is still programmed and kept, the new rule
+                // is removed so that the update is done again on the retry
+                if (ctxt.m_rule_info.m_dash_acl_rule_id != SAI_NULL_OBJECT_ID)
+                {
+                    auto status = sai_dash_acl_api->remove_dash_acl_rule(ctxt.m_rule_info.m_dash_acl_rule_id);
+                    if (status != SAI_STATUS_SUCCESS)
+                    {
+                        SWSS_LOG_ERROR("Failed to remove new ACL rule %s:%s: %d, %s", ctxt.m_group_id.c_str(), ctxt.m_rule_id.c_str(),
+                                       status, sai_serialize_status(status).c_str());
+                        handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status);
+                    }
+                }
+                return handle_status;
+            }
+        }
+
+        gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+
+        auto rule_it = group.m_dash_acl_rule_table.find(ctxt.m_rule_id);
+        detachTags(ctxt.m_group_id, group, rule_it->second.m_rule);
+        group.m_dash_acl_rule_table.erase(rule_it);
+    }
+
+    if (ctxt.m_rule_info.m_dash_acl_rule_id == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("Failed to create ACL rule %s:%s", ctxt.m_group_id.c_str(), ctxt.m_rule_id.c_str());
+        return task_need_retry;
+    }
+
+    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+
+    group.m_dash_acl_rule_table[ctxt.m_rule_id] = ctxt.m_rule_info;
+    attachTags(ctxt.m_group_id, group, ctxt.m_rule_info.m_rule);
+
+    SWSS_LOG_INFO("Created ACL rule %s:%s", ctxt.m_group_id.c_str(), ctxt.m_rule_id.c_str());
+
+    return task_success;
+}
+
+task_process_status DashAclGroupMgr::removeRule(const string& group_id, const string& rule_id, DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
+    {
+        SWSS_LOG_INFO("ACL group %s doesn't exist", group_id.c_str());
+        return task_success;
+    }
+    auto& group = group_it->second;
+
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    if (rule_it == group.m_dash_acl_rule_table.end())
+    {
+        SWSS_LOG_INFO("ACL rule %s:%s doesn't exist", group_id.c_str(), rule_id.c_str());
+        return task_success;
+    }
+
+    ctxt.m_group_id = group_id;
+    ctxt.m_rule_id = rule_id;
+    ctxt.m_group_oid = group.m_dash_acl_group_id;
+    queueRemoveRule(ctxt, rule_it->second.m_dash_acl_rule_id);
+
+    return task_success;
+}
+
+task_process_status DashAclGroupMgr::removeRulePost(const DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    auto group_it = m_groups_table.find(ctxt.m_group_id);
+    ABORT_IF_NOT(group_it != m_groups_table.end(), "ACL group %s does not exist", ctxt.m_group_id.c_str());
+    auto& group = group_it->second;
+
+    if (ctxt.m_remove_status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %d, %s", ctxt.m_group_id.c_str(), ctxt.m_rule_id.c_str(),
+                       ctxt.m_remove_status, sai_serialize_status(ctxt.m_remove_status).c_str());
+        auto handle_status = handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, ctxt.m_remove_status);
+        if (handle_status != task_success)
+        {
+            return handle_status;
+        }
+    }
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+    gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
 
-    group.m_rule_count++;
-    attachTags(group_id, group.m_tags);
+    auto rule_it = group.m_dash_acl_rule_table.find(ctxt.m_rule_id);
+    detachTags(ctxt.m_group_id, group, rule_it->second.m_rule);
+    group.m_dash_acl_rule_table.erase(rule_it);
 
-    SWSS_LOG_INFO("Created ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
+    SWSS_LOG_INFO("Removed ACL rule %s:%s", ctxt.m_group_id.c_str(), ctxt.m_rule_id.c_str());
 
     return task_success;
 }
 
+task_process_status DashAclGroupMgr::onTagUpdate(const string& tag_id, const unordered_set<string>& group_ids)
+{
+    SWSS_LOG_ENTER();
+
+    // The rules of an unbound group using the tag are replaced in place. A
+    // bound group is copied with the new prefixes to a shadow group, which is
+    // bound to the ENIs in place of the group once all its rules are created.
+    struct GroupUpdate
+    {
+        DashAclGroup *m_group = nullptr;
+        DashAclGroup m_shadow;
+        bool m_bound = false;
+        bool m_swapped = false;
+        size_t m_begin = 0;
+        size_t m_end = 0;
+    };
+
+    deque<DashAclRuleBulkContext> ctxts;
+    map<string, GroupUpdate> updates;
+    task_process_status status = task_success;
+
+    for (const auto& group_id : group_ids)
+    {
+        auto group_it = m_groups_table.find(group_id);
+        if (group_it == m_groups_table.end())
+        {
+            continue;
+        }
+        auto& group = group_it->second;
+
+        GroupUpdate update;
+        update.m_group = &group;
+        update.m_bound = isBound(group);
+        if (update.m_bound)
+        {
+            update.m_shadow.m_ip_version = group.m_ip_version;
+            create(update.m_shadow);
+            if (update.m_shadow.m_dash_acl_group_id == SAI_NULL_OBJECT_ID)
+            {
+                SWSS_LOG_ERROR("Failed to create shadow of ACL group %s", group_id.c_str());
+                status = task_need_retry;
+                continue;
+            }
+        }
+
+        update.m_begin = ctxts.size();
+        for (const auto& rule_it : group.m_dash_acl_rule_table)
+        {
+            if (!update.m_bound && !rule_it.second.isTagUsed(tag_id))
+            {
+                continue;
+            }
+
+            ctxts.emplace_back();
+            auto& ctxt = ctxts.back();
+            ctxt.m_group_id = group_id;
+            ctxt.m_rule_id = rule_it.first;
+            ctxt.m_group_oid = update.m_bound ? update.m_shadow.m_dash_acl_group_id : group.m_dash_acl_group_id;
+            ctxt.m_rule_info.m_rule = rule_it.second.m_rule;
+            queueCreateRule(group, ctxt);
+        }
+
+        update.m_end = ctxts.size();
+        updates.emplace(group_id, update);
+    }
+
+    flushRules();
+
+    // The old rules are removed only once their replacement is in place
+    for (auto& update_it : updates)
+    {
+        const auto& group_id = update_it.first;
+        auto& update = update_it.second;
+        auto& group = *update.m_group;
+
+        if (!update.m_bound)
+        {
+            for (size_t i = update.m_begin; i < update.m_end; i++)
+            {
+                auto& ctxt = ctxts[i];
+                if (ctxt.m_rule_info.m_dash_acl_rule_id == SAI_NULL_OBJECT_ID)
+                {
+                    SWSS_LOG_ERROR("Failed to update ACL rule %s:%s with tag %s", group_id.c_str(), ctxt.m_rule_id.c_str(), tag_id.c_str());
+                    status = task_need_retry;
+                    continue;
+                }
+
+                auto& rule_info = group.m_dash_acl_rule_table[ctxt.m_rule_id];
+                queueRemoveRule(ctxt, rule_info.m_dash_acl_rule_id);
+                rule_info.m_dash_acl_rule_id = ctxt.m_rule_info.m_dash_acl_rule_id;
+            }
+            continue;
+        }
+
+        bool created = all_of(ctxts.begin() + update.m_begin, ctxts.begin() + update.m_end,
+            [] (const DashAclRuleBulkContext& ctxt) { return ctxt.m_rule_info.m_dash_acl_rule_id != SAI_NULL_OBJECT_ID; });
+        if (!created)
+        {
+            SWSS_LOG_ERROR("Failed to update ACL group %s with tag %s", group_id.c_str(), tag_id.c_str());
+            status = task_need_retry;
+
+            for (size_t i = update.m_begin; i < update.m_end; i++)
+            {
+                auto& ctxt = ctxts[i];
+                if (ctxt.m_rule_info.m_dash_acl_rule_id != SAI_NULL_OBJECT_ID)
+                {
+                    queueRemoveRule(ctxt, ctxt.m_rule_info.m_dash_acl_rule_id);
+                }
+            }
+            continue;
+        }
+
+        for (auto direction : { DashAclDirection::IN, DashAclDirection::OUT })
+        {
+            const auto& table = (direction == DashAclDirection::IN) ? group.m_in_tables : group.m_out_tables;
+            for (const auto& eni_it : table)
+            {
+                auto eni = m_dash_orch->getEni(eni_it.first);
+                if (!eni)
+                {
+                    continue;
+                }
+                for (auto stage : eni_it.second)
+                {
+                    bind(update.m_shadow, *eni, direction, stage);
+                }
+            }
+        }
+
+        for (size_t i = update.m_begin; i < update.m_end; i++)
+        {
+            auto& ctxt = ctxts[i];
+            auto& rule_info = group.m_dash_acl_rule_table[ctxt.m_rule_id];
+            queueRemoveRule(ctxt, rule_info.m_dash_acl_rule_id);
+            rule_info.m_dash_acl_rule_id = ctxt.m_rule_info.m_dash_acl_rule_id;
+        }
+
+        // The shadow takes the place of the group, the old SAI group is removed below
+        swap(group.m_dash_acl_group_id, update.m_shadow.m_dash_acl_group_id);
+        update.m_swapped = true;
+    }
+
+    flushRules();
+
+    for (auto& update_it : updates)
+    {
+        const auto& group_id = update_it.first;
+        auto& update = update_it.second;
+        auto& group = *update.m_group;
+
+        CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+                CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+
+        for (size_t i = update.m_begin; i < update.m_end; i++)
+        {
+            const auto& ctxt = ctxts[i];
+            if (ctxt.m_removed_rule_id == SAI_NULL_OBJECT_ID)
+            {
+                continue;
+            }
+
+            if (ctxt.m_remove_status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %d, %s", group_id.c_str(), ctxt.m_rule_id.c_str(),
+                               ctxt.m_remove_status, sai_serialize_status(ctxt.m_remove_status).c_str());
+                handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, ctxt.m_remove_status);
+            }
+        }
+
+        if (update.m_shadow.m_dash_acl_group_id != SAI_NULL_OBJECT_ID)
+        {
+            // Removes the replaced group, or the shadow when its rules could not be created
+            remove(update.m_shadow);
+        }
+
+        if (update.m_swapped)
+        {
+            for (size_t i = update.m_begin; i < update.m_end; i++)
+            {
+                gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+            }
+        }
+
+        SWSS_LOG_INFO("Updated %zu rules of ACL group %s with tag %s", update.m_end - update.m_begin, group_id.c_str(), tag_id.c_str());
+    }
+
+    return status;
+}
+
 void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
 {
     SWSS_LOG_ENTER();
@@ -448,7 +765,7 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
 
     auto& group = group_it->second;
 
-    if (group.m_rule_count == 0)
+    if (group.m_dash_acl_rule_table.empty())
     {
         SWSS_LOG_INFO("Failed to bind ACL group %s to ENI %s. ACL group has no rules attached.", group_id.c_str(), eni_id.c_str());
         return task_failed;
@@ -555,22 +872,36 @@ bool DashAclGroupMgr::isBound(const DashAclGroup& group)
     return !group.m_in_tables.empty() || !group.m_out_tables.empty();
 }
 
-void DashAclGroupMgr::attachTags(const string &group_id, const unordered_set<string>& tags)
+void DashAclGroupMgr::attachTags(const string &group_id, DashAclGroup& group, const DashAclRule& rule)
 {
     SWSS_LOG_ENTER();
 
-    for (const auto& tag_id : tags)
+    for (const auto& tags : { &rule.m_src_tags, &rule.m_dst_tags })
     {
-        m_dash_acl_orch->getDashAclTagMgr().attach(tag_id, group_id);
+        for (const auto& tag_id : *tags)
+        {
+            if (group.m_tags[tag_id]++ == 0)
+            {
+                m_dash_acl_orch->getDashAclTagMgr().attach(tag_id, group_id);
+            }
+        }
     }
 }
 
-void DashAclGroupMgr::detachTags(const string &group_id, const unordered_set<string>& tags)
+void DashAclGroupMgr::detachTags(const string &group_id, DashAclGroup& group, const DashAclRule& rule)
 {
     SWSS_LOG_ENTER();
 
-    for (const auto& tag_id : tags)
+    for (const auto& tags : { &rule.m_src_tags, &rule.m_dst_tags })
     {
-        m_dash_acl_orch->getDashAclTagMgr().detach(tag_id, group_id);
+        for (const auto& tag_id : *tags)
+        {
+            auto tag_it = group.m_tags.find(tag_id);
+            if (tag_it != group.m_tags.end() && --tag_it->second == 0)
+            {
+                group.m_tags.erase(tag_it);
+                m_dash_acl_orch->getDashAclTagMgr().detach(tag_id, group_id);
+            }
+        }
     }
 }
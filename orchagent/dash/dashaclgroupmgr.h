@@ -7,6 +7,7 @@
 #include <sai.h>
 #include <logger.h>
 
+#include "bulker.h"
 #include "dashorch.h"
 #include "dashtagmgr.h"
 #include "table.h"
@@ -55,8 +56,8 @@ struct DashAclRuleInfo
 {
     sai_object_id_t m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
 
-    std::unordered_set<std::string> m_src_tags;
-    std::unordered_set<std::string> m_dst_tags;
+    // Kept to create the rule again when the prefixes of its tags change
+    DashAclRule m_rule;
 
     DashAclRuleInfo() = default;
     DashAclRuleInfo(const DashAclRule &rule);
@@ -64,12 +65,47 @@ struct DashAclRuleInfo
     bool isTagUsed(const std::string &tag_id) const;
 };
 
+using DashAclRuleTable = std::unordered_map<std::string, DashAclRuleInfo>;
+
+// SAI operations of a rule queued in the rule bulker. The lists pointed by the
+// queued attributes are owned by the context, so it must not move until the
+// bulker is flushed.
+struct DashAclRuleBulkContext
+{
+    std::string m_group_id;
+    std::string m_rule_id;
+    sai_ip_addr_family_t m_ip_version = SAI_IP_ADDR_FAMILY_IPV4;
+    sai_object_id_t m_group_oid = SAI_NULL_OBJECT_ID;
+
+    // Rule to create, its oid is set on the flush
+    DashAclRuleInfo m_rule_info;
+    bool m_create = false;
+    std::vector<std::uint8_t> m_protocols;
+    std::vector<sai_ip_prefix_t> m_src_prefixes;
+    std::vector<sai_ip_prefix_t> m_dst_prefixes;
+
+    // Rule to remove
+    sai_object_id_t m_removed_rule_id = SAI_NULL_OBJECT_ID;
+    sai_status_t m_remove_status = SAI_STATUS_NOT_EXECUTED;
+
+    DashAclRuleBulkContext() {}
+
+    DashAclRuleBulkContext(const DashAclRuleBulkContext&) = delete;
+    DashAclRuleBulkContext(DashAclRuleBulkContext&&) = delete;
+
+    bool isQueued() const
+    {
+        return m_create || m_removed_rule_id != SAI_NULL_OBJECT_ID;
+    }
+};
+
 struct DashAclGroup
 {
     using EniTable = std::unordered_map<std::string, std::unordered_set<DashAclStage>>;
     sai_object_id_t m_dash_acl_group_id = SAI_NULL_OBJECT_ID;
-    std::unordered_set<std::string> m_tags;
-    int m_rule_count = 0;
+    // Number of rules using each tag
+    std::unordered_map<std::string, size_t> m_tags;
+    DashAclRuleTable m_dash_acl_rule_table;
 
     sai_ip_addr_family_t m_ip_version;
     
@@ -98,6 +134,7 @@ class DashAclGroupMgr
     DashAclOrch *m_dash_acl_orch;
     std::unordered_map<std::string, DashAclGroup> m_groups_table;
     std::unique_ptr<swss::Table> m_dash_acl_rules_table;
+    ObjectBulker<sai_dash_acl_api_t> m_rule_bulker;
 
 public:
     DashAclGroupMgr(swss::DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch);
@@ -107,7 +144,18 @@ public:
     bool exists(const std::string& group_id) const;
     bool isBound(const std::string& group_id);
 
-    task_process_status createRule(const std::string& group_id, const std::string& rule_id, DashAclRule& rule);
+    // The rules are created and removed in bulk: createRule() and removeRule()
+    // queue the SAI operations of a rule in its context, flushRules() executes
+    // all the queued operations, then createRulePost() and removeRulePost()
+    // apply their result.
+    task_process_status createRule(const std::string& group_id, const std::string& rule_id, DashAclRule& rule, DashAclRuleBulkContext& ctxt);
+    task_process_status createRulePost(const DashAclRuleBulkContext& ctxt);
+    task_process_status removeRule(const std::string& group_id, const std::string& rule_id, DashAclRuleBulkContext& ctxt);
+    task_process_status removeRulePost(const DashAclRuleBulkContext& ctxt);
+    void flushRules();
+
+    // Creates again the rules of the groups using the tag, after its prefixes changed
+    task_process_status onTagUpdate(const std::string& tag_id, const std::unordered_set<std::string>& group_ids);
 
     task_process_status bind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
     task_process_status unbind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
@@ -117,11 +165,12 @@ private:
     void create(DashAclGroup& group);
     void remove(DashAclGroup& group);
 
-    DashAclRuleInfo createRule(DashAclGroup& group, DashAclRule& rule);
+    void queueCreateRule(const DashAclGroup& group, DashAclRuleBulkContext& ctxt);
+    void queueRemoveRule(DashAclRuleBulkContext& ctxt, sai_object_id_t rule_oid);
 
     void bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     void unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     bool isBound(const DashAclGroup& group);
-    void attachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
-    void detachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
+    void attachTags(const std::string &group_id, DashAclGroup& group, const DashAclRule& rule);
+    void detachTags(const std::string &group_id, DashAclGroup& group, const DashAclRule& rule);
 };
@@ -107,12 +107,17 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_OUT_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclOut, this),
         PbWorker<AclGroup>::makeMemberTask(APP_DASH_ACL_GROUP_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclGroup, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_GROUP_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclGroup, this),
-        PbWorker<AclRule>::makeMemberTask(APP_DASH_ACL_RULE_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclRule, this),
         PbWorker<PrefixTag>::makeMemberTask(APP_DASH_PREFIX_TAG_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashPrefixTag, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_PREFIX_TAG_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashPrefixTag, this),
      };
 
     const string &table_name = consumer.getTableName();
+    if (table_name == APP_DASH_ACL_RULE_TABLE_NAME)
+    {
+        doTaskAclRuleTable(consumer);
+        return;
+    }
+
     auto itr = consumer.m_toSync.begin();
     while (itr != consumer.m_toSync.end())
     {
@@ -162,6 +167,120 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
     }
 }
 
+void DashAclOrch::doTaskAclRuleTable(ConsumerBase &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    // Rules with an operation left for the next doTask, their later
+    // operations wait behind it
+    set<string> pending;
+
+    auto it = consumer.m_toSync.begin();
+    while (it != consumer.m_toSync.end())
+    {
+        // Rules queued in the rule bulker, an operation on a rule already
+        // queued waits for the next bulk
+        map<string, DashAclRuleBulkContext> toBulk;
+
+        while (it != consumer.m_toSync.end())
+        {
+            const auto &message = it->second;
+            const string &key = kfvKey(message);
+            const string &op = kfvOp(message);
+
+            if (pending.count(key))
+            {
+                it++;
+                continue;
+            }
+
+            auto rc = toBulk.emplace(piecewise_construct,
+                    forward_as_tuple(key),
+                    forward_as_tuple());
+            if (!rc.second)
+            {
+                break;
+            }
+            auto &ctxt = rc.first->second;
+
+            task_process_status task_status = task_failed;
+            if (op == SET_COMMAND)
+            {
+                AclRule data;
+                if (parsePbMessage(kfvFieldsValues(message), data))
+                {
+                    task_status = taskUpdateDashAclRule(key, data, ctxt);
+                }
+                else
+                {
+                    SWSS_LOG_WARN("Requires protobuf at ACL rule :%s", key.c_str());
+                }
+            }
+            else if (op == DEL_COMMAND)
+            {
+                task_status = taskRemoveDashAclRule(key, ctxt);
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Invalid command %s", op.c_str());
+            }
+
+            if (task_status == task_need_retry)
+            {
+                pending.insert(key);
+                it++;
+                continue;
+            }
+
+            if (ctxt.isQueued())
+            {
+                it++;
+                continue;
+            }
+
+            if (task_status != task_success)
+            {
+                SWSS_LOG_WARN("Task %s - %s fail", key.c_str(), op.c_str());
+            }
+            it = consumer.m_toSync.erase(it);
+        }
+
+        m_group_mgr.flushRules();
+
+        auto it_prev = consumer.m_toSync.begin();
+        while (it_prev != it)
+        {
+            const auto &message = it_prev->second;
+            const string &key = kfvKey(message);
+            const string &op = kfvOp(message);
+
+            auto found = toBulk.find(key);
+            if (found == toBulk.end() || !found->second.isQueued())
+            {
+                it_prev++;
+                continue;
+            }
+
+            const auto &ctxt = found->second;
+            auto task_status = (op == SET_COMMAND) ?
+                m_group_mgr.createRulePost(ctxt) : m_group_mgr.removeRulePost(ctxt);
+
+            if (task_status == task_need_retry)
+            {
+                pending.insert(key);
+                it_prev++;
+                continue;
+            }
+
+            if (task_status != task_success)
+            {
+                SWSS_LOG_WARN("Task %s - %s fail", key.c_str(), op.c_str());
+            }
+            it_prev = consumer.m_toSync.erase(it_prev);
+        }
+    }
+}
+
 task_process_status DashAclOrch::taskUpdateDashAclIn(
     const string &key,
     const AclIn &data)
@@ -253,7 +372,8 @@ task_process_status DashAclOrch::taskRemoveDashAclGroup(
 
 task_process_status DashAclOrch::taskUpdateDashAclRule(
     const string &key,
-    const AclRule &data)
+    const AclRule &data,
+    DashAclRuleBulkContext &ctxt)
 {
     SWSS_LOG_ENTER();
 
@@ -274,10 +394,32 @@ task_process_status DashAclOrch::taskUpdateDashAclRule(
     if (m_group_mgr.isBound(group_id))
     {
         SWSS_LOG_INFO("Failed to set dash ACL rule %s:%s, ACL group is bound to the ENI", group_id.c_str(), rule_id.c_str());
+        return task_need_retry;
+    }
+
+    return m_group_mgr.createRule(group_id, rule_id, rule, ctxt);
+}
+
+task_process_status DashAclOrch::taskRemoveDashAclRule(
+    const string &key,
+    DashAclRuleBulkContext &ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    string group_id, rule_id;
+    if (!extractVariables(key, ':', group_id, rule_id))
+    {
+        SWSS_LOG_ERROR("Failed to parse key %s", key.c_str());
         return task_failed;
     }
 
-    return m_group_mgr.createRule(group_id, rule_id, rule);
+    if (m_group_mgr.isBound(group_id))
+    {
+        SWSS_LOG_INFO("Failed to remove dash ACL rule %s:%s, ACL group is bound to the ENI", group_id.c_str(), rule_id.c_str());
+        return task_need_retry;
+    }
+
+    return m_group_mgr.removeRule(group_id, rule_id, ctxt);
 }
 
 task_process_status DashAclOrch::taskUpdateDashPrefixTag(
@@ -41,6 +41,7 @@ public:
 
 private:
     void doTask(ConsumerBase &consumer);
+    void doTaskAclRuleTable(ConsumerBase &consumer);
 
     task_process_status taskUpdateDashAclIn(
         const std::string &key,
@@ -62,7 +63,11 @@ private:
 
     task_process_status taskUpdateDashAclRule(
         const std::string &key,
-        const dash::acl_rule::AclRule &data);
+        const dash::acl_rule::AclRule &data,
+        DashAclRuleBulkContext &ctxt);
+    task_process_status taskRemoveDashAclRule(
+        const std::string &key,
+        DashAclRuleBulkContext &ctxt);
 
     task_process_status taskUpdateDashPrefixTag(
         const std::string &key,
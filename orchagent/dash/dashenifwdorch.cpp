@@ -16,7 +16,7 @@ DashEniFwdOrch::DashEniFwdOrch(DBConnector* cfgDb, DBConnector* applDb, const st
     if (neighorch_)
     {
         /* Listen to Neighbor events */
-        neighorch_->attach(this);
+        neighorch_->attach(this, SUBJECT_TYPE_NEIGH_CHANGE);
     }
 }
 
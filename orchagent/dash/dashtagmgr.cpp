@@ -1,11 +1,30 @@
 #include "dashtagmgr.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "dashaclorch.h"
 #include "saihelper.h"
 
 using namespace std;
 using namespace swss;
 
+static bool isEqual(const sai_ip_prefix_t& lhs, const sai_ip_prefix_t& rhs)
+{
+    if (lhs.addr_family != rhs.addr_family)
+    {
+        return false;
+    }
+
+    if (lhs.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+    {
+        return lhs.addr.ip4 == rhs.addr.ip4 && lhs.mask.ip4 == rhs.mask.ip4;
+    }
+
+    return memcmp(lhs.addr.ip6, rhs.addr.ip6, sizeof(lhs.addr.ip6)) == 0 &&
+           memcmp(lhs.mask.ip6, rhs.mask.ip6, sizeof(lhs.mask.ip6)) == 0;
+}
+
 bool from_pb(const dash::tag::PrefixTag& data, DashTag& tag)
 {
     if (!to_sai(data.ip_version(), tag.m_ip_version))
@@ -64,10 +83,25 @@ task_process_status DashTagMgr::update(const string& tag_id, const DashTag& new_
         return task_failed;
     }
 
-    // Update tag prefixes
+    if (equal(tag.m_prefixes.begin(), tag.m_prefixes.end(),
+              new_tag.m_prefixes.begin(), new_tag.m_prefixes.end(), isEqual))
+    {
+        SWSS_LOG_INFO("Prefixes of tag %s are not changed", tag_id.c_str());
+        return task_success;
+    }
+
+    // Update tag prefixes, then the rules of the ACL groups using them
+    auto prefixes = move(tag.m_prefixes);
     tag.m_prefixes = new_tag.m_prefixes;
 
-    return task_success;
+    auto status = m_dash_acl_orch->getDashAclGroupMgr().onTagUpdate(tag_id, tag.m_groups);
+    if (status != task_success)
+    {
+        // The groups are updated again with the retry
+        tag.m_prefixes = move(prefixes);
+    }
+
+    return status;
 }
 
 task_process_status DashTagMgr::remove(const string& tag_id)
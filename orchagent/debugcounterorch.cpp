@@ -36,7 +36,7 @@ DebugCounterOrch::DebugCounterOrch(DBConnector *db, const vector<string>& table_
     SWSS_LOG_ENTER();
     publishDropCounterCapabilities();
 
-    gPortsOrch->attach(this);
+    gPortsOrch->attach(this, SUBJECT_TYPE_PORT_CHANGE);
 
     // Add drop monitor lua script
     string dropMonitorPluginName = "drop_monitor.lua";
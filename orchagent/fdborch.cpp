@@ -1,5 +1,7 @@
 #include <assert.h>
 #include <iostream>
+#include <list>
+#include <set>
 #include <vector>
 #include <unordered_map>
 #include <utility>
@@ -18,6 +20,7 @@
 extern sai_fdb_api_t    *sai_fdb_api;
 
 extern sai_object_id_t  gSwitchId;
+extern size_t           gMaxBulkSize;
 extern CrmOrch *        gCrmOrch;
 extern MlagOrch*        gMlagOrch;
 extern Directory<Orch*> gDirectory;
@@ -29,14 +32,21 @@ FdbOrch::FdbOrch(DBConnector* applDbConnector, vector<table_name_with_pri_t> app
     Orch(applDbConnector, appFdbTables),
     m_portsOrch(port),
     m_fdbStateTable(stateDbFdbConnector.first, stateDbFdbConnector.second),
-    m_mclagFdbStateTable(stateDbMclagFdbConnector.first, stateDbMclagFdbConnector.second)
+    m_mclagFdbStateTable(stateDbMclagFdbConnector.first, stateDbMclagFdbConnector.second),
+    gFdbBulker(sai_fdb_api, gMaxBulkSize)
 {
+    /* Program the FDB entries one at a time if the SAI has no FDB bulk API */
+    m_fdbBulkSupported = sai_fdb_api->create_fdb_entries && sai_fdb_api->remove_fdb_entries &&
+                         sai_fdb_api->set_fdb_entries_attribute;
+    SWSS_LOG_NOTICE("FDB bulk programming is %s", m_fdbBulkSupported ? "enabled" : "not supported");
+
     for(auto it: appFdbTables)
     {
         m_appTables.push_back(new Table(applDbConnector, it.first));
     }
 
-    m_portsOrch->attach(this);
+    m_portsOrch->attach(this, SUBJECT_TYPE_VLAN_MEMBER_CHANGE);
+    m_portsOrch->attach(this, SUBJECT_TYPE_PORT_OPER_STATE_CHANGE);
     m_flushNotificationsConsumer = new NotificationConsumer(applDbConnector, "FLUSHFDBREQUEST");
     auto flushNotifier = new Notifier(m_flushNotificationsConsumer, this, "FLUSHFDBREQUEST");
     Orch::addExecutor(flushNotifier);
@@ -73,10 +83,10 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     const Port& port = update.port;
     const MacAddress& mac = entry.mac;
     string portName = port.m_alias;
-    Port vlan;
 
     oldFdbData.origin = FDB_ORIGIN_INVALID;
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+    if (!vlan)
     {
         SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate \
                          vlan port from bv_id 0x%" PRIx64, entry.bv_id);
@@ -84,7 +94,7 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     }
 
     // ref: https://github.com/Azure/sonic-swss/blob/master/doc/swss-schema.md#fdb_table
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + mac.to_string();
+    string key = "Vlan" + to_string(vlan->m_vlan_info.vlan_id) + ":" + mac.to_string();
 
     if (update.add)
     {
@@ -115,11 +125,11 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
         fdbdata.esi = "";
         fdbdata.vni = 0;
 
-        m_entries[entry] = fdbdata;
+        auto inserted = m_entries.set(entry, fdbdata);
         SWSS_LOG_INFO("FdbOrch notification: mac %s was inserted in port %s into bv_id 0x%" PRIx64,
                         entry.mac.to_string().c_str(), portName.c_str(), entry.bv_id);
         SWSS_LOG_INFO("m_entries size=%zu mac=%s port=0x%" PRIx64,
-            m_entries.size(), entry.mac.to_string().c_str(),  m_entries[entry].bridge_port_id);
+            m_entries.size(), entry.mac.to_string().c_str(), inserted->second.bridge_port_id);
 
         if (mac_move && (oldFdbData.origin == FDB_ORIGIN_MCLAG_ADVERTIZED))
         {
@@ -185,10 +195,10 @@ void FdbOrch::clearFdbEntry(const FdbEntry& entry)
     update.add = false;
 
     /* Fetch Vlan and decrement the counter */
-    Port temp_vlan;
-    if (m_portsOrch->getPort(entry.bv_id, temp_vlan))
+    const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+    if (vlan)
     {
-        m_portsOrch->decrFdbCount(temp_vlan.m_alias, 1);
+        m_portsOrch->decrFdbCount(vlan->m_alias, 1);
     }
 
     /* Decrement port fdb_counter */
@@ -196,7 +206,7 @@ void FdbOrch::clearFdbEntry(const FdbEntry& entry)
 
     /* Remove the FdbEntry from the internal cache, update state DB and CRM counter */
     storeFdbEntryState(update);
-    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+    notify<SUBJECT_TYPE_FDB_CHANGE>(update, SubjectKey(update.entry.bv_id, update.entry.mac));
 
     SWSS_LOG_INFO("FdbEntry removed from internal cache, MAC: %s , port: %s, BVID: 0x%" PRIx64,
                    update.entry.mac.to_string().c_str(), update.entry.port_name.c_str(), update.entry.bv_id);
@@ -213,66 +223,34 @@ void FdbOrch::handleSyncdFlushNotif(const sai_object_id_t& bv_id,
     // Consolidated flush will have a zero mac
     MacAddress flush_mac("00:00:00:00:00:00");
 
-    if (bridge_port_id == SAI_NULL_OBJECT_ID && bv_id == SAI_NULL_OBJECT_ID)
-    {
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->second.sai_fdb_type == sai_fdb_type &&
-                (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-            {
-                clearFdbEntry(curr->first);
-            }
-        }
-    }
-    else if (bv_id == SAI_NULL_OBJECT_ID)
-    {
-        /* FLUSH based on PORT */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->second.bridge_port_id == bridge_port_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
-        }
-    }
-    else if (bridge_port_id == SAI_NULL_OBJECT_ID)
+    auto flushed = [&](FdbEntryMap::iterator it) {
+        return it->second.sai_fdb_type == sai_fdb_type &&
+            (it->first.mac == mac || mac == flush_mac) && it->second.is_flush_pending;
+    };
+
+    if (mac != flush_mac && bv_id != SAI_NULL_OBJECT_ID)
     {
-        /* FLUSH based on BV_ID */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+        /* FLUSH of a single MAC */
+        FdbEntry entry;
+        entry.mac = mac;
+        entry.bv_id = bv_id;
+
+        auto it = m_entries.find(entry);
+        if (it != m_entries.end() && flushed(it) &&
+            (bridge_port_id == SAI_NULL_OBJECT_ID || it->second.bridge_port_id == bridge_port_id))
         {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
+            clearFdbEntry(it->first);
         }
+        return;
     }
-    else
-    {
-        /* FLUSH based on port and VLAN */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+
+    /* FLUSH based on PORT, on BV_ID, on both or on neither */
+    m_entries.forEach(bridge_port_id, bv_id, [&](FdbEntryMap::iterator it) {
+        if (flushed(it))
         {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id && curr->second.bridge_port_id == bridge_port_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
+            clearFdbEntry(it->first);
         }
-    }
+    });
 }
 
 void FdbOrch::update(sai_fdb_event_t        type,
@@ -286,7 +264,9 @@ void FdbOrch::update(sai_fdb_event_t        type,
     update.entry.mac = entry->mac_address;
     update.entry.bv_id = entry->bv_id;
     update.type = "dynamic";
-    Port vlan;
+    /* Flush notifications of all the vlans have no bv_id */
+    static const Port noVlan;
+    const Port *vlan = &noVlan;
 
     SWSS_LOG_INFO("FDB event:%d, MAC: %s , BVID: 0x%" PRIx64 " , \
                    bridge port ID: 0x%" PRIx64 ".",
@@ -312,11 +292,14 @@ void FdbOrch::update(sai_fdb_event_t        type,
         }
     }
 
-    if (entry->bv_id &&
-        !m_portsOrch->getPort(entry->bv_id, vlan))
+    if (entry->bv_id)
     {
-        SWSS_LOG_NOTICE("FdbOrch notification type %d: Failed to locate vlan port from bv_id 0x%" PRIx64, type, entry->bv_id);
-        return;
+        vlan = m_portsOrch->findPort(entry->bv_id);
+        if (!vlan)
+        {
+            SWSS_LOG_NOTICE("FdbOrch notification type %d: Failed to locate vlan port from bv_id 0x%" PRIx64, type, entry->bv_id);
+            return;
+        }
     }
 
     switch (type)
@@ -334,20 +317,18 @@ void FdbOrch::update(sai_fdb_event_t        type,
                 // If the bp is different MOVE the MAC entry.
                 if (existing_entry->second.bridge_port_id != bridge_port_id)
                 {
-                    Port port;
                     SWSS_LOG_NOTICE("FdbOrch LEARN notification: mac %s is already in bv_id 0x%" PRIx64 "with different existing-bp 0x%" PRIx64 " new-bp:0x%" PRIx64,
                             update.entry.mac.to_string().c_str(), entry->bv_id, existing_entry->second.bridge_port_id, bridge_port_id);
-                    if (!m_portsOrch->getPortByBridgePortId(existing_entry->second.bridge_port_id, port))
+                    const Port *port = m_portsOrch->findPortByBridgePortId(existing_entry->second.bridge_port_id);
+                    if (!port)
                     {
                         SWSS_LOG_NOTICE("FdbOrch LEARN notification: Failed to get port by bridge port ID 0x%" PRIx64, existing_entry->second.bridge_port_id);
                         return;
                     }
                     else
                     {
-                        port.m_fdb_count--;
-                        m_portsOrch->setPort(port.m_alias, port);
-                        vlan.m_fdb_count--;
-                        m_portsOrch->setPort(vlan.m_alias, vlan);
+                        m_portsOrch->decrFdbCount(port->m_alias, 1);
+                        m_portsOrch->decrFdbCount(vlan->m_alias, 1);
                     }
                     // Continue to add (update/move) the MAC
                 }
@@ -388,7 +369,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
                     update.add = true;
                     update.type = "dynamic";
                     storeFdbEntryState(update);
-                    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+                    notify<SUBJECT_TYPE_FDB_CHANGE>(update, SubjectKey(update.entry.bv_id, update.entry.mac));
 
                     return;
                 }
@@ -407,12 +388,11 @@ void FdbOrch::update(sai_fdb_event_t        type,
         update.sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
         update.type = "dynamic";
         update.port.m_fdb_count++;
-        m_portsOrch->setPort(update.port.m_alias, update.port);
-        vlan.m_fdb_count++;
-        m_portsOrch->setPort(vlan.m_alias, vlan);
+        m_portsOrch->incrFdbCount(update.port.m_alias, 1);
+        m_portsOrch->incrFdbCount(vlan->m_alias, 1);
 
         storeFdbEntryState(update);
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notify<SUBJECT_TYPE_FDB_CHANGE>(update, SubjectKey(update.entry.bv_id, update.entry.mac));
 
         break;
     }
@@ -447,7 +427,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         {
             update.type = "static";
 
-            if (vlan.m_members.find(update.port.m_alias) == vlan.m_members.end())
+            if (vlan->m_members.find(update.port.m_alias) == vlan->m_members.end())
             {
                 FdbData fdbData;
                 fdbData.bridge_port_id = SAI_NULL_OBJECT_ID;
@@ -456,8 +436,8 @@ void FdbOrch::update(sai_fdb_event_t        type,
                 fdbData.remote_ip = existing_entry->second.remote_ip;
                 fdbData.esi = existing_entry->second.esi;
                 fdbData.vni = existing_entry->second.vni;
-                saved_fdb_entries[update.port.m_alias].push_back(
-                        {existing_entry->first.mac, vlan.m_vlan_info.vlan_id, fdbData});
+                saved_fdb_entries[update.port.m_alias][vlan->m_vlan_info.vlan_id].push_back(
+                        {existing_entry->first.mac, vlan->m_vlan_info.vlan_id, fdbData});
             }
             else
             {
@@ -515,7 +495,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
             SWSS_LOG_NOTICE("fdbEvent: MAC age event received, MAC is MCLAG origin, added back"
                 "to HW type %s FDB %s in %s on %s",
                 existing_entry->second.type.c_str(),
-                update.entry.mac.to_string().c_str(), vlan.m_alias.c_str(),
+                update.entry.mac.to_string().c_str(), vlan->m_alias.c_str(),
                 update.port.m_alias.c_str());
 
             status = sai_fdb_api->create_fdb_entry(&fdb_entry, (uint32_t)attrs.size(), attrs.data());
@@ -523,7 +503,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
             {
                 SWSS_LOG_ERROR("Failed to create %s FDB %s in %s on %s, rv:%d",
                         existing_entry->second.type.c_str(), update.entry.mac.to_string().c_str(),
-                        vlan.m_alias.c_str(), update.port.m_alias.c_str(), status);
+                        vlan->m_alias.c_str(), update.port.m_alias.c_str(), status);
             }
             return;
         }
@@ -532,16 +512,15 @@ void FdbOrch::update(sai_fdb_event_t        type,
         if (!update.port.m_alias.empty())
         {
             update.port.m_fdb_count--;
-            m_portsOrch->setPort(update.port.m_alias, update.port);
+            m_portsOrch->decrFdbCount(update.port.m_alias, 1);
         }
-        if (!vlan.m_alias.empty())
+        if (!vlan->m_alias.empty())
         {
-            vlan.m_fdb_count--;
-            m_portsOrch->setPort(vlan.m_alias, vlan);
+            m_portsOrch->decrFdbCount(vlan->m_alias, 1);
         }
         storeFdbEntryState(update);
 
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notify<SUBJECT_TYPE_FDB_CHANGE>(update, SubjectKey(update.entry.bv_id, update.entry.mac));
 
         notifyTunnelOrch(update.port);
         break;
@@ -609,14 +588,14 @@ void FdbOrch::update(sai_fdb_event_t        type,
         if (!port_old.m_alias.empty())
         {
             port_old.m_fdb_count--;
-            m_portsOrch->setPort(port_old.m_alias, port_old);
+            m_portsOrch->decrFdbCount(port_old.m_alias, 1);
         }
         update.port.m_fdb_count++;
-        m_portsOrch->setPort(update.port.m_alias, update.port);
+        m_portsOrch->incrFdbCount(update.port.m_alias, 1);
         update.sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
         storeFdbEntryState(update);
 
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notify<SUBJECT_TYPE_FDB_CHANGE>(update, SubjectKey(update.entry.bv_id, update.entry.mac));
 
         notifyTunnelOrch(port_old);
 
@@ -630,8 +609,8 @@ void FdbOrch::update(sai_fdb_event_t        type,
                        bridge_port_id);
 
         string vlanName = "-";
-        if (!vlan.m_alias.empty()) {
-            vlanName = "Vlan" + to_string(vlan.m_vlan_info.vlan_id);
+        if (!vlan->m_alias.empty()) {
+            vlanName = "Vlan" + to_string(vlan->m_vlan_info.vlan_id);
         }
 
         SWSS_LOG_INFO("FDB Flush: [ %s , %s ] = { port: %s }", update.entry.mac.to_string().c_str(),
@@ -729,193 +708,233 @@ void FdbOrch::doTask(Consumer& consumer)
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
-        KeyOpFieldsValuesTuple t = it->second;
-
-        /* format: <VLAN_name>:<MAC_address> */
-        vector<string> keys = tokenize(kfvKey(t), ':', 1);
-        string op = kfvOp(t);
+        // Tasks whose SAI calls are queued in the FDB bulker, post-processed after the flush
+        std::list<std::pair<decltype(it), FdbBulkContext>> toBulk;
+        // Entries of the tasks in toBulk, an entry has at most one request per bulk
+        std::set<FdbEntry> bulkEntries;
 
-        Port vlan;
-        if (!m_portsOrch->getPort(keys[0], vlan))
+        while (it != consumer.m_toSync.end())
         {
-            SWSS_LOG_INFO("Failed to locate %s", keys[0].c_str());
-            if(op == DEL_COMMAND)
-            {
-                /* Delete if it is in saved_fdb_entry */
-                unsigned short vlan_id;
-                try {
-                    vlan_id = (unsigned short) stoi(keys[0].substr(4));
-                } catch(exception &e) {
-                    it = consumer.m_toSync.erase(it);
-                    continue;
-                }
-                deleteFdbEntryFromSavedFDB(MacAddress(keys[1]), vlan_id, origin);
-
-                it = consumer.m_toSync.erase(it);
-            }
-            else
-            {
-                it++;
-            }
-            continue;
-        }
-
-        FdbEntry entry;
-        entry.mac = MacAddress(keys[1]);
-        entry.bv_id = vlan.m_vlan_info.vlan_oid;
+            KeyOpFieldsValuesTuple t = it->second;
 
-        if (op == SET_COMMAND)
-        {
-            string port = "";
-            string type = "dynamic";
-            string remote_ip = "";
-            string esi = "";
-            unsigned int vni = 0;
-            string sticky = "";
-            string discard = "false";
+            /* format: <VLAN_name>:<MAC_address> */
+            vector<string> keys = tokenize(kfvKey(t), ':', 1);
+            string op = kfvOp(t);
 
-            for (auto i : kfvFieldsValues(t))
+            const Port *vlan = m_portsOrch->findPort(keys[0]);
+            if (!vlan)
             {
-                if (fvField(i) == "port")
+                SWSS_LOG_INFO("Failed to locate %s", keys[0].c_str());
+                if(op == DEL_COMMAND)
                 {
-                    port = fvValue(i);
-                }
+                    /* Delete if it is in saved_fdb_entry */
+                    unsigned short vlan_id;
+                    try {
+                        vlan_id = (unsigned short) stoi(keys[0].substr(4));
+                    } catch(exception &e) {
+                        it = consumer.m_toSync.erase(it);
+                        continue;
+                    }
+                    deleteFdbEntryFromSavedFDB(MacAddress(keys[1]), vlan_id, origin);
 
-                if (fvField(i) == "type")
-                {
-                    type = fvValue(i);
+                    it = consumer.m_toSync.erase(it);
                 }
-                if (fvField(i) == "discard")
+                else
                 {
-                    discard = fvValue(i);
+                    it++;
                 }
+                continue;
+            }
 
-                if(origin == FDB_ORIGIN_VXLAN_ADVERTIZED)
+            FdbEntry entry;
+            entry.mac = MacAddress(keys[1]);
+            entry.bv_id = vlan->m_vlan_info.vlan_oid;
+
+            /* Flush the bulk first if the entry already has a request in it */
+            if (bulkEntries.find(entry) != bulkEntries.end())
+            {
+                break;
+            }
+
+            if (op == SET_COMMAND)
+            {
+                string port = "";
+                string type = "dynamic";
+                string remote_ip = "";
+                string esi = "";
+                unsigned int vni = 0;
+                string sticky = "";
+                string discard = "false";
+
+                for (auto i : kfvFieldsValues(t))
                 {
-                    if (fvField(i) == "remote_vtep")
+                    if (fvField(i) == "port")
                     {
-                        remote_ip = fvValue(i);
-                        // Creating an IpAddress object to validate if remote_ip is valid
-                        // if invalid it will throw the exception and we will ignore the
-                        // event
-                        try {
-                            IpAddress valid_ip = IpAddress(remote_ip);
-                            (void)valid_ip; // To avoid g++ warning
-                        } catch(exception &e) {
-                            SWSS_LOG_NOTICE("Invalid IP address in remote MAC %s", remote_ip.c_str());
-                            remote_ip = "";
-                            break;
-                        }
+                        port = fvValue(i);
                     }
 
-                    if (fvField(i) == "esi")
+                    if (fvField(i) == "type")
                     {
-                        esi = fvValue(i);
+                        type = fvValue(i);
+                    }
+                    if (fvField(i) == "discard")
+                    {
+                        discard = fvValue(i);
                     }
 
-                    if (fvField(i) == "vni")
+                    if(origin == FDB_ORIGIN_VXLAN_ADVERTIZED)
                     {
-                        try {
-                            vni = (unsigned int) stoi(fvValue(i));
-                        } catch(exception &e) {
-                            SWSS_LOG_INFO("Invalid VNI in remote MAC %s", fvValue(i).c_str());
-                            vni = 0;
-                            break;
+                        if (fvField(i) == "remote_vtep")
+                        {
+                            remote_ip = fvValue(i);
+                            // Creating an IpAddress object to validate if remote_ip is valid
+                            // if invalid it will throw the exception and we will ignore the
+                            // event
+                            try {
+                                IpAddress valid_ip = IpAddress(remote_ip);
+                                (void)valid_ip; // To avoid g++ warning
+                            } catch(exception &e) {
+                                SWSS_LOG_NOTICE("Invalid IP address in remote MAC %s", remote_ip.c_str());
+                                remote_ip = "";
+                                break;
+                            }
+                        }
+
+                        if (fvField(i) == "esi")
+                        {
+                            esi = fvValue(i);
+                        }
+
+                        if (fvField(i) == "vni")
+                        {
+                            try {
+                                vni = (unsigned int) stoi(fvValue(i));
+                            } catch(exception &e) {
+                                SWSS_LOG_INFO("Invalid VNI in remote MAC %s", fvValue(i).c_str());
+                                vni = 0;
+                                break;
+                            }
                         }
                     }
                 }
-            }
 
-            /* FDB type is either dynamic or static */
-            assert(type == "dynamic" || type == "dynamic_local" || type == "static" );
+                /* FDB type is either dynamic or static */
+                assert(type == "dynamic" || type == "dynamic_local" || type == "static" );
 
-            if(origin == FDB_ORIGIN_VXLAN_ADVERTIZED)
-            {
-                VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
-
-                if (tunnel_orch->isDipTunnelsSupported())
+                if(origin == FDB_ORIGIN_VXLAN_ADVERTIZED)
                 {
-                    if(!remote_ip.length())
+                    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+
+                    if (tunnel_orch->isDipTunnelsSupported())
                     {
-                        it = consumer.m_toSync.erase(it);
-                        continue;
+                        if(!remote_ip.length())
+                        {
+                            it = consumer.m_toSync.erase(it);
+                            continue;
+                        }
+                        port = tunnel_orch->getTunnelPortName(remote_ip);
                     }
-                    port = tunnel_orch->getTunnelPortName(remote_ip);
-                }
-                else
-                {
-                    EvpnNvoOrch* evpn_nvo_orch = gDirectory.get<EvpnNvoOrch*>();
-                    VxlanTunnel* sip_tunnel = evpn_nvo_orch->getEVPNVtep();
-                    if (sip_tunnel == NULL)
+                    else
                     {
-                        it = consumer.m_toSync.erase(it);
-                        continue;
+                        EvpnNvoOrch* evpn_nvo_orch = gDirectory.get<EvpnNvoOrch*>();
+                        VxlanTunnel* sip_tunnel = evpn_nvo_orch->getEVPNVtep();
+                        if (sip_tunnel == NULL)
+                        {
+                            it = consumer.m_toSync.erase(it);
+                            continue;
+                        }
+                        port = tunnel_orch->getTunnelPortName(sip_tunnel->getSrcIP().to_string(), true);
                     }
-                    port = tunnel_orch->getTunnelPortName(sip_tunnel->getSrcIP().to_string(), true);
                 }
-            }
 
-            // set entry port_name, which is used in mux fdb update logic
-            entry.port_name = port;
-
-            FdbData fdbData;
-            fdbData.bridge_port_id = SAI_NULL_OBJECT_ID;
-            fdbData.type = type;
-            fdbData.origin = origin;
-            fdbData.remote_ip = remote_ip;
-            fdbData.esi = esi;
-            fdbData.vni = vni;
-            fdbData.is_flush_pending = false;
-            fdbData.discard = discard;
-            if (addFdbEntry(entry, port, fdbData))
-            {
-                if (origin == FDB_ORIGIN_MCLAG_ADVERTIZED)
+                // set entry port_name, which is used in mux fdb update logic
+                entry.port_name = port;
+
+                toBulk.emplace_back(std::piecewise_construct,
+                        std::forward_as_tuple(it),
+                        std::forward_as_tuple(entry, true));
+                auto& ctx = toBulk.back().second;
+
+                ctx.port_name = port;
+                ctx.fdbData.bridge_port_id = SAI_NULL_OBJECT_ID;
+                ctx.fdbData.type = type;
+                ctx.fdbData.origin = origin;
+                ctx.fdbData.remote_ip = remote_ip;
+                ctx.fdbData.esi = esi;
+                ctx.fdbData.vni = vni;
+                ctx.fdbData.is_flush_pending = false;
+                ctx.fdbData.discard = discard;
+                if (!addFdbEntry(ctx, m_fdbBulkSupported))
                 {
-                    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
-                    if (type == "dynamic_local")
-                    {
-                        m_mclagFdbStateTable.del(key);
-                    }
+                    toBulk.pop_back();
+                    it++;
+                    continue;
                 }
+            }
+            else if (op == DEL_COMMAND)
+            {
+                toBulk.emplace_back(std::piecewise_construct,
+                        std::forward_as_tuple(it),
+                        std::forward_as_tuple(entry, false));
+                auto& ctx = toBulk.back().second;
 
-                if(origin == FDB_ORIGIN_VXLAN_ADVERTIZED)
+                ctx.origin = origin;
+                if (!removeFdbEntry(ctx, m_fdbBulkSupported))
                 {
-                    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
-
-                    if(!remote_ip.length())
-                    {
-                        it = consumer.m_toSync.erase(it);
-                        continue;
-                    }
-                    port = tunnel_orch->getTunnelPortName(remote_ip);
+                    toBulk.pop_back();
+                    it++;
+                    continue;
                 }
-                it = consumer.m_toSync.erase(it);
             }
             else
-                it++;
+            {
+                SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
+                it = consumer.m_toSync.erase(it);
+                continue;
+            }
+
+            bulkEntries.insert(entry);
+            it++;
         }
-        else if (op == DEL_COMMAND)
+
+        // Program the queued FDB entries in the ASIC
+        gFdbBulker.flush();
+
+        // Go through the bulker results
+        for (auto& task : toBulk)
         {
-            if (removeFdbEntry(entry, origin))
+            const auto& ctx = task.second;
+            string key = "Vlan" + to_string(ctx.vlan_id) + ":" + ctx.entry.mac.to_string();
+
+            if (ctx.is_set)
+            {
+                /* Nothing to post-process for a saved, duplicate or ignored entry */
+                if (!ctx.object_statuses.empty() && !addFdbEntryPost(ctx))
+                {
+                    continue;
+                }
+
+                if ((origin == FDB_ORIGIN_MCLAG_ADVERTIZED) && (ctx.fdbData.type == "dynamic_local"))
+                {
+                    m_mclagFdbStateTable.del(key);
+                }
+            }
+            else
             {
+                if (!ctx.object_statuses.empty() && !removeFdbEntryPost(ctx))
+                {
+                    continue;
+                }
+
                 if (origin == FDB_ORIGIN_MCLAG_ADVERTIZED)
                 {
-                    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
                     m_mclagFdbStateTable.del(key);
                     SWSS_LOG_NOTICE("fdbEvent: do Task Delete MCLAG FDB from state mclag remote fdb table: "
-                            "Mac: %s Vlan: %d ",entry.mac.to_string().c_str(), vlan.m_vlan_info.vlan_id );
+                            "Mac: %s Vlan: %d ", ctx.entry.mac.to_string().c_str(), ctx.vlan_id);
                 }
-
-                it = consumer.m_toSync.erase(it);
             }
-            else
-                it++;
 
-        }
-        else
-        {
-            SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
-            it = consumer.m_toSync.erase(it);
+            consumer.m_toSync.erase(task.first);
         }
     }
 }
@@ -929,129 +948,154 @@ void FdbOrch::doTask(NotificationConsumer& consumer)
         return;
     }
 
+    /* Drain every notification queued since the last wakeup */
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
+
+    if (&consumer == m_flushNotificationsConsumer)
+    {
+        for (const auto& entry : entries)
+        {
+            handleFlushRequest(kfvOp(entry), kfvKey(entry));
+        }
+    }
+    else if (&consumer == m_fdbNotificationConsumer)
+    {
+        handleFdbNotifications(entries);
+    }
+}
+
+void FdbOrch::handleFlushRequest(const string& op, const string& data)
+{
+    SWSS_LOG_ENTER();
+
     sai_status_t status;
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
     string alias;
     string vlan;
     Port port;
     Port vlanPort;
 
-    consumer.pop(op, data, values);
-
-    if (&consumer == m_flushNotificationsConsumer)
+    if (op == "ALL")
     {
-        if (op == "ALL")
+        vector<sai_attribute_t>    attrs;
+        sai_attribute_t            attr;
+        attr.id = SAI_FDB_FLUSH_ATTR_ENTRY_TYPE;
+        attr.value.s32 = SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC;
+        attrs.push_back(attr);
+        status = sai_fdb_api->flush_fdb_entries(gSwitchId, (uint32_t)attrs.size(), attrs.data());
+        if (status != SAI_STATUS_SUCCESS)
         {
-            vector<sai_attribute_t>    attrs;
-            sai_attribute_t            attr;
-            attr.id = SAI_FDB_FLUSH_ATTR_ENTRY_TYPE;
-            attr.value.s32 = SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC;
-            attrs.push_back(attr);
-            status = sai_fdb_api->flush_fdb_entries(gSwitchId, (uint32_t)attrs.size(), attrs.data());
-            if (status != SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_ERROR("Flush fdb failed, return code %x", status);
-            }
+            SWSS_LOG_ERROR("Flush fdb failed, return code %x", status);
+        }
 
-            if (status == SAI_STATUS_SUCCESS) {
-                for (map<FdbEntry, FdbData>::iterator it = m_entries.begin();
-                        it != m_entries.end(); it++)
-                {
-                    it->second.is_flush_pending = true;
-                }
+        if (status == SAI_STATUS_SUCCESS) {
+            for (auto& it : m_entries)
+            {
+                it.second.is_flush_pending = true;
             }
+        }
 
+        return;
+    }
+    else if (op == "PORT")
+    {
+        alias = data;
+        if (alias.empty())
+        {
+            SWSS_LOG_ERROR("Receive wrong port to flush fdb!");
             return;
         }
-        else if (op == "PORT")
+        if (!m_portsOrch->getPort(alias, port))
         {
-            alias = data;
-            if (alias.empty())
-            {
-                SWSS_LOG_ERROR("Receive wrong port to flush fdb!");
-                return;
-            }
-            if (!m_portsOrch->getPort(alias, port))
-            {
-                SWSS_LOG_ERROR("Get Port from port(%s) failed!", alias.c_str());
-                return;
-            }
-            if (port.m_bridge_port_id == SAI_NULL_OBJECT_ID)
-            {
-                return;
-            }
-            flushFDBEntries(port.m_bridge_port_id, SAI_NULL_OBJECT_ID);
-            SWSS_LOG_NOTICE("Clear fdb by port(%s)", alias.c_str());
+            SWSS_LOG_ERROR("Get Port from port(%s) failed!", alias.c_str());
             return;
         }
-        else if (op == "VLAN")
+        if (port.m_bridge_port_id == SAI_NULL_OBJECT_ID)
         {
-            vlan = data;
-            if (vlan.empty())
-            {
-                SWSS_LOG_ERROR("Receive wrong vlan to flush fdb!");
-                return;
-            }
-            if (!m_portsOrch->getPort(vlan, vlanPort))
-            {
-                SWSS_LOG_ERROR("Get Port from vlan(%s) failed!", vlan.c_str());
-                return;
-            }
-            if (vlanPort.m_vlan_info.vlan_oid == SAI_NULL_OBJECT_ID)
-            {
-                return;
-            }
-            flushFDBEntries(SAI_NULL_OBJECT_ID, vlanPort.m_vlan_info.vlan_oid);
-            SWSS_LOG_NOTICE("Clear fdb by vlan(%s)", vlan.c_str());
             return;
         }
-        else if (op == "PORTVLAN")
+        flushFDBEntries(port.m_bridge_port_id, SAI_NULL_OBJECT_ID);
+        SWSS_LOG_NOTICE("Clear fdb by port(%s)", alias.c_str());
+        return;
+    }
+    else if (op == "VLAN")
+    {
+        vlan = data;
+        if (vlan.empty())
         {
-            size_t found = data.find('|');
-            if (found != string::npos)
-            {
-                alias = data.substr(0, found);
-                vlan = data.substr(found+1);
-            }
-            if (alias.empty() || vlan.empty())
-            {
-                SWSS_LOG_ERROR("Receive wrong port or vlan to flush fdb!");
-                return;
-            }
-            if (!m_portsOrch->getPort(alias, port))
-            {
-                SWSS_LOG_ERROR("Get Port from port(%s) failed!", alias.c_str());
-                return;
-            }
-            if (!m_portsOrch->getPort(vlan, vlanPort))
-            {
-                SWSS_LOG_ERROR("Get Port from vlan(%s) failed!", vlan.c_str());
-                return;
-            }
-            if (port.m_bridge_port_id == SAI_NULL_OBJECT_ID ||
-                vlanPort.m_vlan_info.vlan_oid == SAI_NULL_OBJECT_ID)
-            {
-                return;
-            }
-            flushFDBEntries(port.m_bridge_port_id, vlanPort.m_vlan_info.vlan_oid); 
-            SWSS_LOG_NOTICE("Clear fdb by port(%s)+vlan(%s)", alias.c_str(), vlan.c_str());
+            SWSS_LOG_ERROR("Receive wrong vlan to flush fdb!");
             return;
         }
-        else
+        if (!m_portsOrch->getPort(vlan, vlanPort))
+        {
+            SWSS_LOG_ERROR("Get Port from vlan(%s) failed!", vlan.c_str());
+            return;
+        }
+        if (vlanPort.m_vlan_info.vlan_oid == SAI_NULL_OBJECT_ID)
+        {
+            return;
+        }
+        flushFDBEntries(SAI_NULL_OBJECT_ID, vlanPort.m_vlan_info.vlan_oid);
+        SWSS_LOG_NOTICE("Clear fdb by vlan(%s)", vlan.c_str());
+        return;
+    }
+    else if (op == "PORTVLAN")
+    {
+        size_t found = data.find('|');
+        if (found != string::npos)
+        {
+            alias = data.substr(0, found);
+            vlan = data.substr(found+1);
+        }
+        if (alias.empty() || vlan.empty())
+        {
+            SWSS_LOG_ERROR("Receive wrong port or vlan to flush fdb!");
+            return;
+        }
+        if (!m_portsOrch->getPort(alias, port))
+        {
+            SWSS_LOG_ERROR("Get Port from port(%s) failed!", alias.c_str());
+            return;
+        }
+        if (!m_portsOrch->getPort(vlan, vlanPort))
         {
-            SWSS_LOG_ERROR("Received unknown flush fdb request");
+            SWSS_LOG_ERROR("Get Port from vlan(%s) failed!", vlan.c_str());
             return;
         }
+        if (port.m_bridge_port_id == SAI_NULL_OBJECT_ID ||
+            vlanPort.m_vlan_info.vlan_oid == SAI_NULL_OBJECT_ID)
+        {
+            return;
+        }
+        flushFDBEntries(port.m_bridge_port_id, vlanPort.m_vlan_info.vlan_oid); 
+        SWSS_LOG_NOTICE("Clear fdb by port(%s)+vlan(%s)", alias.c_str(), vlan.c_str());
+        return;
     }
-    else if (&consumer == m_fdbNotificationConsumer && op == "fdb_event")
+    else
     {
+        SWSS_LOG_ERROR("Received unknown flush fdb request");
+        return;
+    }
+}
+
+void FdbOrch::handleFdbNotifications(const std::deque<KeyOpFieldsValuesTuple>& notifications)
+{
+    SWSS_LOG_ENTER();
+
+    m_fdbEvents.clear();
+
+    for (const auto& notification : notifications)
+    {
+        if (kfvOp(notification) != "fdb_event")
+        {
+            continue;
+        }
+
         uint32_t count;
         sai_fdb_event_notification_data_t *fdbevent = nullptr;
         sai_fdb_entry_type_t sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
 
-        sai_deserialize_fdb_event_ntf(data, count, &fdbevent);
+        sai_deserialize_fdb_event_ntf(kfvKey(notification), count, &fdbevent);
 
         for (uint32_t i = 0; i < count; ++i)
         {
@@ -1069,11 +1113,101 @@ void FdbOrch::doTask(NotificationConsumer& consumer)
                 }
             }
 
-            this->update(fdbevent[i].event_type, &fdbevent[i].fdb_entry, oid, sai_fdb_type);
+            m_fdbEvents.push_back({ fdbevent[i].event_type, fdbevent[i].fdb_entry, oid, sai_fdb_type, false });
         }
 
         sai_deserialize_free_fdb_event_ntf(count, fdbevent);
     }
+
+    coalesceFdbEvents(m_fdbEvents);
+
+    for (const auto& event : m_fdbEvents)
+    {
+        if (!event.coalesced)
+        {
+            update(event.type, &event.entry, event.bridge_port_id, event.sai_fdb_type);
+        }
+    }
+}
+
+/*
+ * Name: coalesceFdbEvents
+ * Params:
+ *     events - FDB events of a batch of notifications, in arrival order
+ * Description:
+ *     Marks the events of a MAC storm that don't change the final state of
+ *     their MAC and bv_id, so they are not written to SAI and STATE_DB:
+ *     1. A LEARN repeating the previous LEARN on the same bridge port is a
+ *        no-op, the later one is dropped.
+ *     2. A MOVE followed by another MOVE only leaves the last bridge port,
+ *        the earlier one is dropped. The earlier MOVE is kept if its port is
+ *        a tunnel, which is removed when its last entry moves away, or if
+ *        the port of the later MOVE is unknown and the later one would be
+ *        ignored.
+ *     AGE events end the sequence of their MAC and FLUSH events, which may
+ *     match any MAC, end all of them, so the events are never reordered.
+ */
+void FdbOrch::coalesceFdbEvents(vector<FdbEvent>& events)
+{
+    SWSS_LOG_ENTER();
+
+    size_t coalesced = 0;
+
+    m_fdbEventIndex.clear();
+
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        FdbEvent& event = events[i];
+
+        if (event.type == SAI_FDB_EVENT_FLUSHED)
+        {
+            m_fdbEventIndex.clear();
+            continue;
+        }
+        if (event.type == SAI_FDB_EVENT_AGED)
+        {
+            m_fdbEventIndex.erase(event.entry);
+            continue;
+        }
+
+        auto rc = m_fdbEventIndex.emplace(event.entry, i);
+        if (rc.second)
+        {
+            continue;
+        }
+
+        FdbEvent& previous = events[rc.first->second];
+
+        if (event.type == SAI_FDB_EVENT_LEARNED)
+        {
+            if (previous.type == SAI_FDB_EVENT_LEARNED &&
+                previous.bridge_port_id == event.bridge_port_id &&
+                previous.sai_fdb_type == event.sai_fdb_type)
+            {
+                event.coalesced = true;
+                coalesced++;
+                continue;
+            }
+        }
+        else if (event.type == SAI_FDB_EVENT_MOVE && previous.type == SAI_FDB_EVENT_MOVE)
+        {
+            const Port *previousPort = m_portsOrch->findPortByBridgePortId(previous.bridge_port_id);
+
+            if (previousPort && previousPort->m_type != Port::TUNNEL &&
+                m_portsOrch->findPortByBridgePortId(event.bridge_port_id))
+            {
+                previous.coalesced = true;
+                coalesced++;
+            }
+        }
+
+        rc.first->second = i;
+    }
+
+    if (coalesced)
+    {
+        SWSS_LOG_INFO("Coalesced %zu of %zu FDB events", coalesced, events.size());
+    }
 }
 
 /*
@@ -1133,32 +1267,34 @@ void FdbOrch::flushFDBEntries(sai_object_id_t bridge_port_oid,
     }
 
     if (SAI_STATUS_SUCCESS == rv) {
-        for (map<FdbEntry, FdbData>::iterator it = m_entries.begin();
-                it != m_entries.end(); it++)
+        /* Mark the entries of the port and the entries of the VLAN */
+        auto markFlushPending = [](FdbEntryMap::iterator it) {
+            it->second.is_flush_pending = true;
+        };
+
+        if (bridge_port_oid != SAI_NULL_OBJECT_ID)
         {
-            if ((bridge_port_oid != SAI_NULL_OBJECT_ID &&
-                    it->second.bridge_port_id == bridge_port_oid) ||
-                    (vlan_oid != SAI_NULL_OBJECT_ID &&
-                    it->first.bv_id == vlan_oid))
-            {
-                it->second.is_flush_pending = true;
-            }
+            m_entries.forEach(bridge_port_oid, SAI_NULL_OBJECT_ID, markFlushPending);
+        }
+        if (vlan_oid != SAI_NULL_OBJECT_ID)
+        {
+            m_entries.forEach(SAI_NULL_OBJECT_ID, vlan_oid, markFlushPending);
         }
     }
 }
 void FdbOrch::flushFdbByVlan(const string &alias)
 {
     sai_status_t status;
-    swss::Port vlan;
     sai_attribute_t vlan_attr[2];
 
-    if (!m_portsOrch->getPort(alias, vlan))
+    const Port *vlan = m_portsOrch->findPort(alias);
+    if (!vlan)
     {
         return;
     }
 
     vlan_attr[0].id = SAI_FDB_FLUSH_ATTR_BV_ID;
-    vlan_attr[0].value.oid = vlan.m_vlan_info.vlan_oid;
+    vlan_attr[0].value.oid = vlan->m_vlan_info.vlan_oid;
     vlan_attr[1].id = SAI_FDB_FLUSH_ATTR_ENTRY_TYPE;
     vlan_attr[1].value.s32 = SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC;
     status = sai_fdb_api->flush_fdb_entries(gSwitchId, 2, vlan_attr);
@@ -1170,7 +1306,7 @@ void FdbOrch::flushFdbByVlan(const string &alias)
     else
     {
         SWSS_LOG_INFO("Flush by vlan %s vlan_oid 0x%" PRIx64 "",
-                    alias.c_str(), vlan.m_vlan_info.vlan_oid);
+                    alias.c_str(), vlan->m_vlan_info.vlan_oid);
     }
 
     return;
@@ -1181,10 +1317,8 @@ void FdbOrch::notifyObserversFDBFlush(Port &port, sai_object_id_t& bvid)
     FdbFlushUpdate flushUpdate;
     flushUpdate.port = port;
 
-    for (auto itr = m_entries.begin(); itr != m_entries.end(); ++itr)
-    {
-        if ((itr->first.port_name == port.m_alias) &&
-            (itr->first.bv_id == bvid))
+    m_entries.forEach(SAI_NULL_OBJECT_ID, bvid, [&](FdbEntryMap::iterator itr) {
+        if (itr->first.port_name == port.m_alias)
         {
             SWSS_LOG_INFO("Adding MAC learnt on [ port:%s , bvid:0x%" PRIx64 "]\
                            to ARP flush", port.m_alias.c_str(), bvid);
@@ -1193,11 +1327,11 @@ void FdbOrch::notifyObserversFDBFlush(Port &port, sai_object_id_t& bvid)
             entry.bv_id = itr->first.bv_id;
             flushUpdate.entries.push_back(entry);
         }
-    }
+    });
 
     if (!flushUpdate.entries.empty())
     {
-        notify(SUBJECT_TYPE_FDB_FLUSH_CHANGE, &flushUpdate);
+        notify<SUBJECT_TYPE_FDB_FLUSH_CHANGE>(flushUpdate);
     }
 }
 
@@ -1224,14 +1358,15 @@ void FdbOrch::updatePortOperState(const PortOperStateUpdate& update)
         m_portsOrch->getPortVlanMembers(p, vlan_members);
         for (const auto& vlan_member: vlan_members)
         {
-            swss::Port vlan;
             string vlan_alias = VLAN_PREFIX + to_string(vlan_member.first);
-            if (!m_portsOrch->getPort(vlan_alias, vlan))
+            const Port *vlan = m_portsOrch->findPort(vlan_alias);
+            if (!vlan)
             {
                 SWSS_LOG_INFO("Failed to locate VLAN %s", vlan_alias.c_str());
                 continue;
             }
-            notifyObserversFDBFlush(p, vlan.m_vlan_info.vlan_oid);
+            sai_object_id_t bvid = vlan->m_vlan_info.vlan_oid;
+            notifyObserversFDBFlush(p, bvid);
         }
 
     }
@@ -1252,34 +1387,62 @@ void FdbOrch::updateVlanMember(const VlanMemberUpdate& update)
     }
 
     string port_name = update.member.m_alias;
-    auto fdb_list = std::move(saved_fdb_entries[port_name]);
-    saved_fdb_entries[port_name].clear();
-    if(!fdb_list.empty())
+    auto port_it = saved_fdb_entries.find(port_name);
+    if (port_it == saved_fdb_entries.end())
     {
-        for (const auto& fdb: fdb_list)
-        {
-            // try to insert an FDB entry. If the FDB entry is not ready to be inserted yet,
-            // it would be added back to the saved_fdb_entries structure by addFDBEntry()
-            if(fdb.vlanId == update.vlan.m_vlan_info.vlan_id)
-            {
-                FdbEntry entry;
-                entry.mac = fdb.mac;
-                entry.bv_id = update.vlan.m_vlan_info.vlan_oid;
-                (void)addFdbEntry(entry, port_name, fdb.fdbData);
-            }
-            else
-            {
-                saved_fdb_entries[port_name].push_back(fdb);
-            }
-        }
+        return;
+    }
+
+    auto vlan_it = port_it->second.find(update.vlan.m_vlan_info.vlan_id);
+    if (vlan_it == port_it->second.end())
+    {
+        return;
+    }
+
+    auto fdb_list = std::move(vlan_it->second);
+    port_it->second.erase(vlan_it);
+    if (port_it->second.empty())
+    {
+        saved_fdb_entries.erase(port_it);
+    }
+
+    for (const auto& fdb: fdb_list)
+    {
+        // try to insert an FDB entry. If the FDB entry is not ready to be inserted yet,
+        // it would be added back to the saved_fdb_entries structure by addFDBEntry()
+        FdbEntry entry;
+        entry.mac = fdb.mac;
+        entry.bv_id = update.vlan.m_vlan_info.vlan_oid;
+        (void)addFdbEntry(entry, port_name, fdb.fdbData);
     }
 }
 
 bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         FdbData fdbData)
 {
-    Port vlan;
-    Port port;
+    FdbBulkContext ctx(entry, true);
+    ctx.port_name = port_name;
+    ctx.fdbData = fdbData;
+
+    if (!addFdbEntry(ctx, false))
+    {
+        return false;
+    }
+
+    /* Saved, duplicate or ignored entry */
+    if (ctx.object_statuses.empty())
+    {
+        return true;
+    }
+
+    return addFdbEntryPost(ctx);
+}
+
+bool FdbOrch::addFdbEntry(FdbBulkContext& ctx, bool bulk)
+{
+    const FdbEntry& entry = ctx.entry;
+    const string& port_name = ctx.port_name;
+    FdbData& fdbData = ctx.fdbData;
     string end_point_ip = "";
 
     VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
@@ -1289,18 +1452,21 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
             entry.mac.to_string().c_str(), entry.bv_id, port_name.c_str(),
             fdbData.type.c_str(), fdbData.origin, fdbData.remote_ip.c_str());
 
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+    if (!vlan)
     {
         SWSS_LOG_NOTICE("addFdbEntry: Failed to locate vlan port from bv_id 0x%" PRIx64, entry.bv_id);
         return false;
     }
+    ctx.vlan_id = vlan->m_vlan_info.vlan_id;
 
     /* Retry until port is created */
-    if (!m_portsOrch->getPort(port_name, port) || (port.m_bridge_port_id == SAI_NULL_OBJECT_ID))
+    const Port *port = m_portsOrch->findPort(port_name);
+    if (!port || (port->m_bridge_port_id == SAI_NULL_OBJECT_ID))
     {
         SWSS_LOG_INFO("Saving a fdb entry until port %s becomes active", port_name.c_str());
-        saved_fdb_entries[port_name].push_back({entry.mac,
-                vlan.m_vlan_info.vlan_id, fdbData});
+        saved_fdb_entries[port_name][vlan->m_vlan_info.vlan_id].push_back({entry.mac,
+                vlan->m_vlan_info.vlan_id, fdbData});
         return true;
     }
 
@@ -1311,46 +1477,45 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         end_point_ip = fdbData.remote_ip;
     }
     /* Retry until port is member of vlan*/
-    if (!m_portsOrch->isVlanMember(vlan, port, end_point_ip))
+    if (!m_portsOrch->isVlanMember(*vlan, *port, end_point_ip))
     {
-        SWSS_LOG_INFO("Saving a fdb entry until port %s becomes vlan %s member", port_name.c_str(), vlan.m_alias.c_str());
-        saved_fdb_entries[port_name].push_back({entry.mac,
-                vlan.m_vlan_info.vlan_id, fdbData});
+        SWSS_LOG_INFO("Saving a fdb entry until port %s becomes vlan %s member", port_name.c_str(), vlan->m_alias.c_str());
+        saved_fdb_entries[port_name][vlan->m_vlan_info.vlan_id].push_back({entry.mac,
+                vlan->m_vlan_info.vlan_id, fdbData});
         return true;
     }
 
-    sai_status_t status;
     sai_fdb_entry_t fdb_entry;
     fdb_entry.switch_id = gSwitchId;
     memcpy(fdb_entry.mac_address, entry.mac.getMac(), sizeof(sai_mac_t));
     fdb_entry.bv_id = entry.bv_id;
 
-    Port oldPort;
-    string oldType;
-    string oldRemoteIp;
-    FdbOrigin oldOrigin = FDB_ORIGIN_INVALID ;
-    bool macUpdate = false;
+    const string& oldType = ctx.old_type;
+    const FdbOrigin& oldOrigin = ctx.old_origin;
 
     auto it = m_entries.find(entry);
     if (it != m_entries.end())
     {
         /* get existing port and type */
-        oldType = it->second.type;
-        oldOrigin = it->second.origin;
-        oldRemoteIp = it->second.remote_ip;
+        ctx.old_type = it->second.type;
+        ctx.old_origin = it->second.origin;
+        const string& oldRemoteIp = it->second.remote_ip;
 
-        if (!m_portsOrch->getPortByBridgePortId(it->second.bridge_port_id, oldPort))
+        const Port *oldPort = m_portsOrch->findPortByBridgePortId(it->second.bridge_port_id);
+        if (!oldPort)
         {
             SWSS_LOG_ERROR("Existing port 0x%" PRIx64 " details not found", it->second.bridge_port_id);
             return false;
         }
+        ctx.old_port_name = oldPort->m_alias;
+        ctx.old_bridge_port_id = oldPort->m_bridge_port_id;
 
-        if ((oldOrigin == fdbData.origin) && (oldType == fdbData.type) && (port.m_bridge_port_id == it->second.bridge_port_id)
+        if ((oldOrigin == fdbData.origin) && (oldType == fdbData.type) && (port->m_bridge_port_id == it->second.bridge_port_id)
             && (oldRemoteIp == fdbData.remote_ip))
         {
             /* Duplicate Mac */
             SWSS_LOG_INFO("FdbOrch: mac=%s %s port=%s type=%s origin=%d  remote_ip=%s is duplicate", entry.mac.to_string().c_str(),
-                    vlan.m_alias.c_str(), port_name.c_str(),
+                    vlan->m_alias.c_str(), port_name.c_str(),
                     fdbData.type.c_str(), fdbData.origin, fdbData.remote_ip.c_str());
             return true;
         }
@@ -1363,7 +1528,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                 SWSS_LOG_NOTICE("Already existing static MAC:%s in Vlan:%d. "
                         "Received same MAC from peer:%s; "
                         "Peer mac ignored",
-                        entry.mac.to_string().c_str(), vlan.m_vlan_info.vlan_id,
+                        entry.mac.to_string().c_str(), vlan->m_vlan_info.vlan_id,
                         fdbData.remote_ip.c_str());
 
                 return true;
@@ -1375,7 +1540,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                 SWSS_LOG_INFO("Already existing static MAC:%s in Vlan:%d "
                         "from Peer:%s. Now same is provisioned as dynamic; "
                         "Provisioned dynamic mac is ignored",
-                        entry.mac.to_string().c_str(), vlan.m_vlan_info.vlan_id,
+                        entry.mac.to_string().c_str(), vlan->m_vlan_info.vlan_id,
                         it->second.remote_ip.c_str());
                 return true;
             }
@@ -1387,18 +1552,18 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                             "in Vlan:%d from Peer:%s, "
                             "If it is a mistake, it will result in inconsistent Traffic Forwarding",
                             entry.mac.to_string().c_str(),
-                            vlan.m_vlan_info.vlan_id,
+                            vlan->m_vlan_info.vlan_id,
                             it->second.remote_ip.c_str());
                 }
             }
             else if ((oldOrigin == FDB_ORIGIN_LEARN) && (fdbData.origin == FDB_ORIGIN_MCLAG_ADVERTIZED))
             {
-                if ((port.m_bridge_port_id == it->second.bridge_port_id) && (oldType == "dynamic") && (fdbData.type == "dynamic_local"))
+                if ((port->m_bridge_port_id == it->second.bridge_port_id) && (oldType == "dynamic") && (fdbData.type == "dynamic_local"))
                 {
                     SWSS_LOG_INFO("FdbOrch: mac=%s %s port=%s type=%s origin=%d old_origin=%d"
                         " old_type=%s local mac exists,"
                         " received dynamic_local from iccpd, ignore update",
-                        entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str(),
+                        entry.mac.to_string().c_str(), vlan->m_alias.c_str(), port_name.c_str(),
                         fdbData.type.c_str(), fdbData.origin, oldOrigin, oldType.c_str());
 
                     return true;
@@ -1416,8 +1581,9 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
              */
         }
 
-        macUpdate = true;
+        ctx.mac_update = true;
     }
+    bool macUpdate = ctx.mac_update;
 
     sai_attribute_t attr;
     vector<sai_attribute_t> attrs;
@@ -1448,7 +1614,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
     }
 
     attr.id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
-    attr.value.oid = port.m_bridge_port_id;
+    attr.value.oid = port->m_bridge_port_id;
     attrs.push_back(attr);
 
     if (fdbData.origin == FDB_ORIGIN_VXLAN_ADVERTIZED)
@@ -1500,16 +1666,68 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
     if (macUpdate)
     {
         SWSS_LOG_INFO("MAC-Update FDB %s in %s on from-%s:to-%s from-%s:to-%s origin-%d-to-%d",
-                entry.mac.to_string().c_str(), vlan.m_alias.c_str(), oldPort.m_alias.c_str(),
+                entry.mac.to_string().c_str(), vlan->m_alias.c_str(), ctx.old_port_name.c_str(),
                 port_name.c_str(), oldType.c_str(), fdbData.type.c_str(),
                 oldOrigin, fdbData.origin);
-        for (auto itr : attrs)
+        for (const auto& itr : attrs)
+        {
+            ctx.object_statuses.emplace_back();
+            if (bulk)
+            {
+                gFdbBulker.set_entry_attribute(&ctx.object_statuses.back(), &fdb_entry, &itr);
+            }
+            else
+            {
+                ctx.object_statuses.back() = sai_fdb_api->set_fdb_entry_attribute(&fdb_entry, &itr);
+            }
+        }
+    }
+    else
+    {
+        SWSS_LOG_INFO("MAC-Create %s FDB %s in %s on %s", fdbData.type.c_str(), entry.mac.to_string().c_str(), vlan->m_alias.c_str(), port_name.c_str());
+
+        ctx.object_statuses.emplace_back();
+        if (bulk)
+        {
+            gFdbBulker.create_entry(&ctx.object_statuses.back(), &fdb_entry, (uint32_t)attrs.size(), attrs.data());
+        }
+        else
+        {
+            ctx.object_statuses.back() = sai_fdb_api->create_fdb_entry(&fdb_entry, (uint32_t)attrs.size(), attrs.data());
+        }
+    }
+
+    return true;
+}
+
+bool FdbOrch::addFdbEntryPost(const FdbBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    const FdbEntry& entry = ctx.entry;
+    const string& port_name = ctx.port_name;
+    const FdbData& fdbData = ctx.fdbData;
+    const string& oldType = ctx.old_type;
+    const FdbOrigin& oldOrigin = ctx.old_origin;
+    bool macUpdate = ctx.mac_update;
+
+    const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+    const Port *port = m_portsOrch->findPort(port_name);
+    if (!vlan || !port)
+    {
+        SWSS_LOG_ERROR("Failed to locate vlan 0x%" PRIx64 " or port %s of FDB %s",
+                entry.bv_id, port_name.c_str(), entry.mac.to_string().c_str());
+        return false;
+    }
+
+    if (macUpdate)
+    {
+        for (const auto& status : ctx.object_statuses)
         {
-            status = sai_fdb_api->set_fdb_entry_attribute(&fdb_entry, &itr);
             if (status != SAI_STATUS_SUCCESS)
             {
-                SWSS_LOG_ERROR("macUpdate-Failed for attr.id=0x%x for FDB %s in %s on %s, rv:%d",
-                            itr.id, entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str(), status);
+                SWSS_LOG_ERROR("macUpdate-Failed for FDB %s in %s on %s, rv:%d",
+                            entry.mac.to_string().c_str(), vlan->m_alias.c_str(), port_name.c_str(), status);
                 task_process_status handle_status = handleSaiSetStatus(SAI_API_FDB, status);
                 if (handle_status != task_success)
                 {
@@ -1517,45 +1735,39 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                 }
             }
         }
-        if (oldPort.m_bridge_port_id != port.m_bridge_port_id)
+        if (ctx.old_bridge_port_id != port->m_bridge_port_id)
         {
-            oldPort.m_fdb_count--;
-            m_portsOrch->setPort(oldPort.m_alias, oldPort);
-            port.m_fdb_count++;
-            m_portsOrch->setPort(port.m_alias, port);
+            m_portsOrch->decrFdbCount(ctx.old_port_name, 1);
+            m_portsOrch->incrFdbCount(port->m_alias, 1);
         }
     }
     else
     {
-        SWSS_LOG_INFO("MAC-Create %s FDB %s in %s on %s", fdbData.type.c_str(), entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str());
-
-        status = sai_fdb_api->create_fdb_entry(&fdb_entry, (uint32_t)attrs.size(), attrs.data());
+        sai_status_t status = ctx.object_statuses.front();
         if (status != SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_ERROR("Failed to create %s FDB %s in %s on %s, rv:%d",
                     fdbData.type.c_str(), entry.mac.to_string().c_str(),
-                    vlan.m_alias.c_str(), port_name.c_str(), status);
+                    vlan->m_alias.c_str(), port_name.c_str(), status);
             task_process_status handle_status = handleSaiCreateStatus(SAI_API_FDB, status); //FIXME: it should be based on status. Some could be retried, some not
             if (handle_status != task_success)
             {
                 return parseHandleSaiStatusFailure(handle_status);
             }
         }
-        port.m_fdb_count++;
-        m_portsOrch->setPort(port.m_alias, port);
-        vlan.m_fdb_count++;
-        m_portsOrch->setPort(vlan.m_alias, vlan);
+        m_portsOrch->incrFdbCount(port->m_alias, 1);
+        m_portsOrch->incrFdbCount(vlan->m_alias, 1);
     }
 
     FdbData storeFdbData = fdbData;
-    storeFdbData.bridge_port_id = port.m_bridge_port_id;
+    storeFdbData.bridge_port_id = port->m_bridge_port_id;
     // overwrite the type and origin
     if ((fdbData.origin == FDB_ORIGIN_MCLAG_ADVERTIZED) && (fdbData.type == "dynamic_local"))
     {
         //If the MAC is dynamic_local change the origin accordingly
         //MAC is added/updated as dynamic to allow aging.
         SWSS_LOG_INFO("MAC-Update Modify to dynamic FDB %s in %s on from-%s:to-%s from-%s:to-%s origin-%d-to-%d",
-                entry.mac.to_string().c_str(), vlan.m_alias.c_str(), oldPort.m_alias.c_str(),
+                entry.mac.to_string().c_str(), vlan->m_alias.c_str(), ctx.old_port_name.c_str(),
                 port_name.c_str(), oldType.c_str(), fdbData.type.c_str(), 
                 oldOrigin, fdbData.origin);
 
@@ -1563,9 +1775,9 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         storeFdbData.type = "dynamic";
     }
 
-    m_entries[entry] = storeFdbData;
+    m_entries.set(entry, storeFdbData);
 
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
+    string key = "Vlan" + to_string(vlan->m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
 
     if (((fdbData.origin != FDB_ORIGIN_MCLAG_ADVERTIZED) &&
          (fdbData.origin != FDB_ORIGIN_VXLAN_ADVERTIZED)) ||
@@ -1602,14 +1814,14 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
 
         SWSS_LOG_NOTICE("fdbEvent: AddFdbEntry: Add MCLAG MAC with state mclag remote fdb table "
               "Mac: %s Vlan: %d port:%s type:%s", entry.mac.to_string().c_str(),
-              vlan.m_vlan_info.vlan_id, port_name.c_str(), fdbData.type.c_str());
+              vlan->m_vlan_info.vlan_id, port_name.c_str(), fdbData.type.c_str());
     }
     else if (macUpdate && (oldOrigin == FDB_ORIGIN_MCLAG_ADVERTIZED) &&
             (fdbData.origin != FDB_ORIGIN_MCLAG_ADVERTIZED))
     {
         SWSS_LOG_NOTICE("fdbEvent: AddFdbEntry: del MCLAG MAC from state MCLAG remote fdb table "
                     "Mac: %s Vlan: %d port:%s type:%s", entry.mac.to_string().c_str(),
-                    vlan.m_vlan_info.vlan_id, port_name.c_str(), fdbData.type.c_str());
+                    vlan->m_vlan_info.vlan_id, port_name.c_str(), fdbData.type.c_str());
         m_mclagFdbStateTable.del(key);
     }
 
@@ -1620,29 +1832,50 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
 
     FdbUpdate update;
     update.entry = entry;
-    update.port = port;
+    update.port = *port;
     update.type = fdbData.type;
     update.add = true;
 
-    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+    notify<SUBJECT_TYPE_FDB_CHANGE>(update, SubjectKey(update.entry.bv_id, update.entry.mac));
 
     return true;
 }
 
 bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
 {
-    Port vlan;
-    Port port;
+    FdbBulkContext ctx(entry, false);
+    ctx.origin = origin;
 
+    if (!removeFdbEntry(ctx, false))
+    {
+        return false;
+    }
+
+    /* Entry not programmed by this origin */
+    if (ctx.object_statuses.empty())
+    {
+        return true;
+    }
+
+    return removeFdbEntryPost(ctx);
+}
+
+bool FdbOrch::removeFdbEntry(FdbBulkContext& ctx, bool bulk)
+{
     SWSS_LOG_ENTER();
 
+    const FdbEntry& entry = ctx.entry;
+    FdbOrigin origin = ctx.origin;
+
     SWSS_LOG_INFO("FdbOrch RemoveFDBEntry: mac=%s bv_id=0x%" PRIx64 "origin %d", entry.mac.to_string().c_str(), entry.bv_id, origin);
 
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+    if (!vlan)
     {
         SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate vlan port from bv_id 0x%" PRIx64, entry.bv_id);
         return false;
     }
+    ctx.vlan_id = vlan->m_vlan_info.vlan_id;
 
     auto it= m_entries.find(entry);
     if (it == m_entries.end())
@@ -1650,12 +1883,13 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
         SWSS_LOG_INFO("FdbOrch RemoveFDBEntry: FDB entry isn't found. mac=%s bv_id=0x%" PRIx64, entry.mac.to_string().c_str(), entry.bv_id);
 
         /* check whether the entry is in the saved fdb, if so delete it from there. */
-        deleteFdbEntryFromSavedFDB(entry.mac, vlan.m_vlan_info.vlan_id, origin);
+        deleteFdbEntryFromSavedFDB(entry.mac, vlan->m_vlan_info.vlan_id, origin);
         return true;
     }
 
-    FdbData fdbData = it->second;
-    if (!m_portsOrch->getPortByBridgePortId(fdbData.bridge_port_id, port))
+    const FdbData& fdbData = it->second;
+    const Port *port = m_portsOrch->findPortByBridgePortId(fdbData.bridge_port_id);
+    if (!port)
     {
         SWSS_LOG_NOTICE("FdbOrch RemoveFDBEntry: Failed to locate port from bridge_port_id 0x%" PRIx64, fdbData.bridge_port_id);
         return false;
@@ -1664,12 +1898,12 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
     if (fdbData.origin != origin)
     {
         if ((origin == FDB_ORIGIN_MCLAG_ADVERTIZED) && (fdbData.origin == FDB_ORIGIN_LEARN) &&
-                        (port.m_oper_status == SAI_PORT_OPER_STATUS_DOWN) && (gMlagOrch->isMlagInterface(port.m_alias)))
+                        (port->m_oper_status == SAI_PORT_OPER_STATUS_DOWN) && (gMlagOrch->isMlagInterface(port->m_alias)))
         {
             //check if the local MCLAG port is down, if yes then continue delete the local MAC
             origin = FDB_ORIGIN_LEARN;
             SWSS_LOG_INFO("FdbOrch RemoveFDBEntry: mac=%s fdb del origin is MCLAG; delete local mac as port %s is down",
-                entry.mac.to_string().c_str(), port.m_alias.c_str());
+                entry.mac.to_string().c_str(), port->m_alias.c_str());
         }
         else
         {
@@ -1685,21 +1919,42 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
             /* We may still have the mac in saved-fdb probably due to unavailability
              * of bridge-port. check whether the entry is in the saved fdb,
              * if so delete it from there. */
-            deleteFdbEntryFromSavedFDB(entry.mac, vlan.m_vlan_info.vlan_id, origin);
+            deleteFdbEntryFromSavedFDB(entry.mac, vlan->m_vlan_info.vlan_id, origin);
 
             return true;
         }
     }
 
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
+    ctx.fdbData = fdbData;
+    ctx.old_port_name = port->m_alias;
+    ctx.old_bridge_port_id = port->m_bridge_port_id;
 
-    sai_status_t status;
     sai_fdb_entry_t fdb_entry;
     fdb_entry.switch_id = gSwitchId;
     memcpy(fdb_entry.mac_address, entry.mac.getMac(), sizeof(sai_mac_t));
     fdb_entry.bv_id = entry.bv_id;
 
-    status = sai_fdb_api->remove_fdb_entry(&fdb_entry);
+    ctx.object_statuses.emplace_back();
+    if (bulk)
+    {
+        gFdbBulker.remove_entry(&ctx.object_statuses.back(), &fdb_entry);
+    }
+    else
+    {
+        ctx.object_statuses.back() = sai_fdb_api->remove_fdb_entry(&fdb_entry);
+    }
+
+    return true;
+}
+
+bool FdbOrch::removeFdbEntryPost(const FdbBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    const FdbEntry& entry = ctx.entry;
+    const FdbData& fdbData = ctx.fdbData;
+
+    sai_status_t status = ctx.object_statuses.front();
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("FdbOrch RemoveFDBEntry: Failed to remove FDB entry. mac=%s, bv_id=0x%" PRIx64,
@@ -1711,18 +1966,26 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
         }
     }
 
+    const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+    const Port *port = m_portsOrch->findPort(ctx.old_port_name);
+    if (!vlan || !port)
+    {
+        SWSS_LOG_ERROR("Failed to locate vlan 0x%" PRIx64 " or port %s of FDB %s",
+                entry.bv_id, ctx.old_port_name.c_str(), entry.mac.to_string().c_str());
+        return false;
+    }
+
     SWSS_LOG_INFO("Removed mac=%s bv_id=0x%" PRIx64 " port:%s",
-            entry.mac.to_string().c_str(), entry.bv_id, port.m_alias.c_str());
+            entry.mac.to_string().c_str(), entry.bv_id, port->m_alias.c_str());
 
-    port.m_fdb_count--;
-    m_portsOrch->setPort(port.m_alias, port);
-    vlan.m_fdb_count--;
-    m_portsOrch->setPort(vlan.m_alias, vlan);
+    m_portsOrch->decrFdbCount(port->m_alias, 1);
+    m_portsOrch->decrFdbCount(vlan->m_alias, 1);
     (void)m_entries.erase(entry);
 
     // Remove in StateDb
     if ((fdbData.origin != FDB_ORIGIN_VXLAN_ADVERTIZED) && (fdbData.origin != FDB_ORIGIN_MCLAG_ADVERTIZED))
     {
+        string key = "Vlan" + to_string(vlan->m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
         m_fdbStateTable.del(key);
     }
 
@@ -1730,11 +1993,11 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
 
     FdbUpdate update;
     update.entry = entry;
-    update.port = port;
+    update.port = *port;
     update.type = fdbData.type;
     update.add = false;
 
-    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+    notify<SUBJECT_TYPE_FDB_CHANGE>(update, SubjectKey(update.entry.bv_id, update.entry.mac));
 
     notifyTunnelOrch(update.port);
 
@@ -1756,8 +2019,15 @@ void FdbOrch::deleteFdbEntryFromSavedFDB(const MacAddress &mac,
     {
         if (portName.empty() || (portName == itr.first))
         {
-            auto iter = saved_fdb_entries[itr.first].begin();
-            while(iter != saved_fdb_entries[itr.first].end())
+            auto vlan_itr = itr.second.find(vlanId);
+            if (vlan_itr == itr.second.end())
+            {
+                continue;
+            }
+
+            auto& saved = vlan_itr->second;
+            auto iter = saved.begin();
+            while(iter != saved.end())
             {
                 if (*iter == entry)
                 {
@@ -1767,7 +2037,11 @@ void FdbOrch::deleteFdbEntryFromSavedFDB(const MacAddress &mac,
                                 "mac=%s vlan_id=0x%x origin:%d port:%s",
                                 mac.to_string().c_str(), vlanId, origin,
                                 itr.first.c_str());
-                        saved_fdb_entries[itr.first].erase(iter);
+                        saved.erase(iter);
+                        if (saved.empty())
+                        {
+                            itr.second.erase(vlan_itr);
+                        }
 
                         found=true;
                         break;
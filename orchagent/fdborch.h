@@ -1,9 +1,12 @@
 #ifndef SWSS_FDBORCH_H
 #define SWSS_FDBORCH_H
 
+#include <cstring>
+
 #include "orch.h"
 #include "observer.h"
 #include "portsorch.h"
+#include "bulker.h"
 
 enum FdbOrigin
 {
@@ -39,12 +42,25 @@ struct FdbUpdate
     sai_fdb_entry_type_t sai_fdb_type;
 };
 
+/* Keyed by the bv_id and the MAC address of the entry */
+template <>
+struct SubjectPayload<SUBJECT_TYPE_FDB_CHANGE>
+{
+    typedef FdbUpdate type;
+};
+
 struct FdbFlushUpdate
 {
     vector<FdbEntry> entries;
     Port port;
 };
 
+template <>
+struct SubjectPayload<SUBJECT_TYPE_FDB_FLUSH_CHANGE>
+{
+    typedef FdbFlushUpdate type;
+};
+
 struct FdbData
 {
     sai_object_id_t bridge_port_id;
@@ -79,7 +95,215 @@ struct SavedFdbEntry
     }
 };
 
-typedef unordered_map<string, vector<SavedFdbEntry>> fdb_entries_by_port_t;
+/* Entries waiting for their port, by port name and VLAN id */
+typedef unordered_map<string, map<unsigned short, vector<SavedFdbEntry>>> fdb_entries_by_port_t;
+
+/*
+ * FDB entries keyed by MAC and bv_id, with the subset of the std::map
+ * interface used by FdbOrch.
+ *
+ * The entries are also indexed by VLAN and by bridge port, so the flushes by
+ * VLAN, by port or by both only visit the entries they match. The indices
+ * refer to the map nodes: the bridge port of an entry must only be changed
+ * through set().
+ */
+class FdbEntryMap
+{
+public:
+    typedef map<FdbEntry, FdbData>::iterator iterator;
+    typedef map<FdbEntry, FdbData>::const_iterator const_iterator;
+    typedef map<FdbEntry, FdbData>::size_type size_type;
+
+    iterator begin() { return m_entries.begin(); }
+    iterator end() { return m_entries.end(); }
+    const_iterator begin() const { return m_entries.begin(); }
+    const_iterator end() const { return m_entries.end(); }
+
+    bool empty() const { return m_entries.empty(); }
+    size_type size() const { return m_entries.size(); }
+
+    iterator find(const FdbEntry &entry) { return m_entries.find(entry); }
+    const_iterator find(const FdbEntry &entry) const { return m_entries.find(entry); }
+
+    /* Insert the entry or overwrite its data */
+    iterator set(const FdbEntry &entry, const FdbData &data)
+    {
+        auto rc = m_entries.emplace(entry, data);
+        auto it = rc.first;
+
+        if (rc.second)
+        {
+            m_byVlan[entry.bv_id].insert(it);
+            m_byPort[data.bridge_port_id][entry.bv_id].insert(it);
+        }
+        else if (it->second.bridge_port_id != data.bridge_port_id)
+        {
+            unindexPort(it);
+            it->second = data;
+            m_byPort[data.bridge_port_id][entry.bv_id].insert(it);
+        }
+        else
+        {
+            it->second = data;
+        }
+
+        return it;
+    }
+
+    iterator erase(iterator it)
+    {
+        unindexPort(it);
+
+        auto vlan = m_byVlan.find(it->first.bv_id);
+        vlan->second.erase(it);
+        if (vlan->second.empty())
+        {
+            m_byVlan.erase(vlan);
+        }
+
+        return m_entries.erase(it);
+    }
+
+    size_type erase(const FdbEntry &entry)
+    {
+        auto it = m_entries.find(entry);
+        if (it == m_entries.end())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    /*
+     * Call f on the entries of the bridge port and of the VLAN, any of them
+     * is a wildcard if null. f may erase the entry it is called on.
+     */
+    template <typename F>
+    void forEach(sai_object_id_t bridge_port_id, sai_object_id_t bv_id, F f)
+    {
+        vector<iterator> matched;
+
+        if (bridge_port_id == SAI_NULL_OBJECT_ID && bv_id == SAI_NULL_OBJECT_ID)
+        {
+            for (auto it = m_entries.begin(); it != m_entries.end(); it++)
+            {
+                matched.push_back(it);
+            }
+        }
+        else if (bridge_port_id == SAI_NULL_OBJECT_ID)
+        {
+            auto vlan = m_byVlan.find(bv_id);
+            if (vlan != m_byVlan.end())
+            {
+                matched.assign(vlan->second.begin(), vlan->second.end());
+            }
+        }
+        else
+        {
+            auto port = m_byPort.find(bridge_port_id);
+            if (port != m_byPort.end())
+            {
+                for (const auto &vlan : port->second)
+                {
+                    if (bv_id == SAI_NULL_OBJECT_ID || vlan.first == bv_id)
+                    {
+                        matched.insert(matched.end(), vlan.second.begin(), vlan.second.end());
+                    }
+                }
+            }
+        }
+
+        for (auto it : matched)
+        {
+            f(it);
+        }
+    }
+
+private:
+    struct IteratorHash
+    {
+        size_t operator()(const iterator &it) const
+        {
+            return std::hash<const void *>()(&*it);
+        }
+    };
+
+    typedef unordered_set<iterator, IteratorHash> EntrySet;
+
+    void unindexPort(iterator it)
+    {
+        auto port = m_byPort.find(it->second.bridge_port_id);
+        auto vlan = port->second.find(it->first.bv_id);
+
+        vlan->second.erase(it);
+        if (vlan->second.empty())
+        {
+            port->second.erase(vlan);
+            if (port->second.empty())
+            {
+                m_byPort.erase(port);
+            }
+        }
+    }
+
+    map<FdbEntry, FdbData> m_entries;
+    unordered_map<sai_object_id_t, EntrySet> m_byVlan;
+    /* bridge port -> bv_id -> entries */
+    unordered_map<sai_object_id_t, unordered_map<sai_object_id_t, EntrySet>> m_byPort;
+};
+
+/* An FDB event of a SAI notification, as passed to FdbOrch::update() */
+struct FdbEvent
+{
+    sai_fdb_event_t                     type;
+    sai_fdb_entry_t                     entry;
+    sai_object_id_t                     bridge_port_id;
+    sai_fdb_entry_type_t                sai_fdb_type;
+    bool                                coalesced;          // dropped, no effect on the state after the batch
+};
+
+struct FdbEventKeyHash
+{
+    size_t operator()(const sai_fdb_entry_t &entry) const
+    {
+        uint64_t mac = 0;
+        memcpy(&mac, entry.mac_address, sizeof(sai_mac_t));
+        return std::hash<uint64_t>()(mac) ^ std::hash<sai_object_id_t>()(entry.bv_id);
+    }
+};
+
+/*
+ * Keeps track of an FDB entry add or remove between the SAI calls, possibly
+ * queued in the FDB bulker, and the processing of their statuses
+ */
+struct FdbBulkContext
+{
+    FdbEntry                            entry;
+    std::string                         port_name;          // port of an added entry
+    FdbData                             fdbData;            // requested data on add, stored data on remove
+    FdbOrigin                           origin;             // origin of the remove request
+    bool                                is_set;             // True if add operation
+    unsigned short                      vlan_id;
+
+    std::deque<sai_status_t>            object_statuses;    // SAI statuses, empty if nothing was programmed
+    bool                                mac_update;         // existing entry is updated
+    std::string                         old_port_name;      // port of the existing entry
+    sai_object_id_t                     old_bridge_port_id;
+    FdbOrigin                           old_origin;
+    std::string                         old_type;
+
+    FdbBulkContext(const FdbEntry& entry, bool is_set)
+        : entry(entry), origin(FDB_ORIGIN_INVALID), is_set(is_set), vlan_id(0), mac_update(false),
+          old_bridge_port_id(SAI_NULL_OBJECT_ID), old_origin(FDB_ORIGIN_INVALID)
+    {
+    }
+
+    // The bulker keeps pointers to the statuses
+    FdbBulkContext(const FdbBulkContext&) = delete;
+    FdbBulkContext& operator=(const FdbBulkContext&) = delete;
+};
 
 class FdbOrch: public Orch, public Subject, public Observer
 {
@@ -108,7 +332,7 @@ public:
 
 private:
     PortsOrch *m_portsOrch;
-    map<FdbEntry, FdbData> m_entries;
+    FdbEntryMap m_entries;
     fdb_entries_by_port_t saved_fdb_entries;
     vector<Table*> m_appTables;
     Table m_fdbStateTable;
@@ -117,13 +341,28 @@ private:
     NotificationConsumer* m_fdbNotificationConsumer;
     shared_ptr<DBConnector> m_notificationsDb;
 
+    EntityBulker<sai_fdb_api_t> gFdbBulker;
+    bool m_fdbBulkSupported;
+
+    /* Events of the notifications drained in one wakeup, reused between batches */
+    vector<FdbEvent> m_fdbEvents;
+    /* MAC and bv_id -> index in m_fdbEvents of the last event the next one may supersede */
+    unordered_map<sai_fdb_entry_t, size_t, FdbEventKeyHash> m_fdbEventIndex;
+
     void doTask(Consumer& consumer);
     void doTask(NotificationConsumer& consumer);
+    void handleFlushRequest(const string& op, const string& data);
+    void handleFdbNotifications(const std::deque<KeyOpFieldsValuesTuple>& notifications);
+    void coalesceFdbEvents(vector<FdbEvent>& events);
 
     void updateVlanMember(const VlanMemberUpdate&);
     void updatePortOperState(const PortOperStateUpdate&);
 
     bool addFdbEntry(const FdbEntry&, const string&, FdbData fdbData);
+    bool addFdbEntry(FdbBulkContext& ctx, bool bulk);
+    bool addFdbEntryPost(const FdbBulkContext& ctx);
+    bool removeFdbEntry(FdbBulkContext& ctx, bool bulk);
+    bool removeFdbEntryPost(const FdbBulkContext& ctx);
     void deleteFdbEntryFromSavedFDB(const MacAddress &mac, const unsigned short &vlanId, FdbOrigin origin, const string portName="");
 
     bool storeFdbEntryState(const FdbUpdate& update);
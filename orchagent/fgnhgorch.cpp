@@ -33,7 +33,7 @@ FgNhgOrch::FgNhgOrch(DBConnector *db, DBConnector *appDb, DBConnector *stateDb,
 {
     SWSS_LOG_ENTER();
     isFineGrainedConfigured = false;
-    gPortsOrch->attach(this);
+    gPortsOrch->attach(this, SUBJECT_TYPE_PORT_OPER_STATE_CHANGE);
 }
 
 
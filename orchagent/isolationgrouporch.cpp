@@ -30,7 +30,7 @@ extern IsoGrpOrch *gIsoGrpOrch;
 IsoGrpOrch::IsoGrpOrch(vector<TableConnector> &connectors) : Orch(connectors)
 {
     SWSS_LOG_ENTER();
-    gPortsOrch->attach(this);
+    gPortsOrch->attach(this, SUBJECT_TYPE_BRIDGE_PORT_CHANGE);
 }
 
 IsoGrpOrch::~IsoGrpOrch()
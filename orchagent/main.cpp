@@ -59,6 +59,7 @@ extern size_t gMaxBulkSize;
 extern int gBatchSize;
 
 bool gRingMode = false;
+bool gDirtySchedMode = false;
 bool gSyncMode = false;
 sai_redis_communication_mode_t gRedisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 string gAsicInstance;
@@ -69,6 +70,7 @@ extern bool gIsNatSupported;
 #define SWSS_RECORD_ENABLE (0x1 << 1)
 #define RESPONSE_PUBLISHER_RECORD_ENABLE (0x1 << 2)
 #define RETRY_RECORD_ENABLE (0x1 << 3)
+#define BINARY_RECORD_ENABLE (0x1 << 4)
 
 /* orchagent heart beat message interval */
 #define HEART_BEAT_INTERVAL_MSECS_DEFAULT 10 * 1000
@@ -91,7 +93,7 @@ bool isChassisDbInUse()
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF] [-I heart_beat_interval] [-R] [-M]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF] [-I heart_beat_interval] [-R] [-S] [-M]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -100,6 +102,7 @@ void usage()
     cout << "                    2: record SwSS task sequence as swss.rec" << endl;
     cout << "                    3: enable both above two records" << endl;
     cout << "                    7: enable sairedis.rec, swss.rec and responsepublisher.rec" << endl;
+    cout << "                    Bit 3: retry.rec, Bit 4: write swss.rec, responsepublisher.rec and retry.rec in binary format" << endl;
     cout << "    -d record_location: set record logs folder location (default .)" << endl;
     cout << "    -b batch_size: set consumer table pop operation batch size (default 128)" << endl;
     cout << "    -m MAC: set switch MAC address" << endl;
@@ -115,6 +118,7 @@ void usage()
     cout << "    -v vrf: VRF name (default empty)" << endl;
     cout << "    -I heart_beat_interval: Heart beat interval in millisecond (default 10)" << endl;
     cout << "    -R enable the ring thread feature" << endl;
+    cout << "    -S only drain orchs with dirty consumers after each event" << endl;
     cout << "    -M enable SAI MACSec POST" << endl;
     cout << "    -D Delay in seconds before flex counter processing begins after orchagent startup (default 0)" << endl;
 }
@@ -400,7 +404,7 @@ int main(int argc, char **argv)
     // Disable SAI MACSec POST by default. Use option -M to enable it.
     bool macsec_post_enabled = false;
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:t:v:I:R:D:M")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:t:v:I:R:SD:M")) != -1)
     {
         switch (opt)
         {
@@ -427,7 +431,7 @@ int main(int argc, char **argv)
             // Disable all recordings if atoi() fails i.e. returns 0 due to
             // invalid command line argument.
             record_type = atoi(optarg);
-            if (record_type < 0 || record_type > 15) 
+            if (record_type < 0 || record_type > 31) 
             {
                 usage();
                 exit(EXIT_FAILURE);
@@ -518,6 +522,9 @@ int main(int argc, char **argv)
         case 'R':
             gRingMode = true;
             break;
+        case 'S':
+            gDirtySchedMode = true;
+            break;
          case 'M':
             macsec_post_enabled = true;
             break;
@@ -545,6 +552,9 @@ int main(int argc, char **argv)
     Recorder::Instance().swss.setRecord(
         (record_type & SWSS_RECORD_ENABLE) == SWSS_RECORD_ENABLE
     );
+    Recorder::Instance().swss.setBinary(
+        (record_type & BINARY_RECORD_ENABLE) == BINARY_RECORD_ENABLE
+    );
     Recorder::Instance().swss.setLocation(record_location);
     Recorder::Instance().swss.setFileName(swss_rec_filename);
     Recorder::Instance().swss.startRec(true);
@@ -553,6 +563,9 @@ int main(int argc, char **argv)
         (record_type & RESPONSE_PUBLISHER_RECORD_ENABLE) ==
         RESPONSE_PUBLISHER_RECORD_ENABLE
     );
+    Recorder::Instance().respub.setBinary(
+        (record_type & BINARY_RECORD_ENABLE) == BINARY_RECORD_ENABLE
+    );
     Recorder::Instance().respub.setLocation(record_location);
     Recorder::Instance().respub.setFileName(responsepublisher_rec_filename);
     Recorder::Instance().respub.startRec(false);
@@ -560,6 +573,9 @@ int main(int argc, char **argv)
     Recorder::Instance().retry.setRecord(
         (record_type & RETRY_RECORD_ENABLE) == RETRY_RECORD_ENABLE
     );
+    Recorder::Instance().retry.setBinary(
+        (record_type & BINARY_RECORD_ENABLE) == BINARY_RECORD_ENABLE
+    );
     Recorder::Instance().retry.setLocation(record_location);
     Recorder::Instance().retry.setFileName(retry_rec_filename);
     Recorder::Instance().retry.startRec(true);
@@ -941,6 +957,11 @@ int main(int argc, char **argv)
         orchDaemon->enableRingBuffer();
     }
 
+    if (gDirtySchedMode)
+    {
+        orchDaemon->enableDirtyScheduling();
+    }
+
     if (!orchDaemon->init())
     {
         SWSS_LOG_ERROR("Failed to initialize orchestration daemon");
@@ -74,6 +74,8 @@ MirrorEntry::MirrorEntry(const string& platform) :
     string alias = "";
     nexthopInfo.prefix = IpPrefix("0.0.0.0/0");
     nexthopInfo.nexthop = NextHopKey("0.0.0.0", alias);
+
+    keys.fdbAttached = false;
 }
 
 MirrorOrch::MirrorOrch(TableConnector stateDbConnector, TableConnector confDbConnector,
@@ -90,9 +92,9 @@ MirrorOrch::MirrorOrch(TableConnector stateDbConnector, TableConnector confDbCon
     sai_status_t status;
     sai_attribute_t attr;
 
-    m_portsOrch->attach(this);
-    m_neighOrch->attach(this);
-    m_fdbOrch->attach(this);
+    // The neighbor and FDB changes are attached per session, see updateSessionKeys()
+    m_portsOrch->attach(this, SUBJECT_TYPE_LAG_MEMBER_CHANGE);
+    m_portsOrch->attach(this, SUBJECT_TYPE_VLAN_MEMBER_CHANGE);
 
     // Retrieve the number of valid values for queue, starting at 0
     attr.id = SAI_SWITCH_ATTR_QOS_MAX_NUMBER_OF_TRAFFIC_CLASSES;
@@ -171,29 +173,17 @@ void MirrorOrch::update(SubjectType type, void *cntx)
         break;
     }
     case SUBJECT_TYPE_NEIGH_CHANGE:
-    {
-        NeighborUpdate *update = static_cast<NeighborUpdate *>(cntx);
-        updateNeighbor(*update);
+        updateNeighbor(payload<SUBJECT_TYPE_NEIGH_CHANGE>(cntx));
         break;
-    }
     case SUBJECT_TYPE_FDB_CHANGE:
-    {
-        FdbUpdate *update = static_cast<FdbUpdate *>(cntx);
-        updateFdb(*update);
+        updateFdb(payload<SUBJECT_TYPE_FDB_CHANGE>(cntx));
         break;
-    }
     case SUBJECT_TYPE_LAG_MEMBER_CHANGE:
-    {
-        LagMemberUpdate *update = static_cast<LagMemberUpdate *>(cntx);
-        updateLagMember(*update);
+        updateLagMember(payload<SUBJECT_TYPE_LAG_MEMBER_CHANGE>(cntx));
         break;
-    }
     case SUBJECT_TYPE_VLAN_MEMBER_CHANGE:
-    {
-        VlanMemberUpdate *update = static_cast<VlanMemberUpdate *>(cntx);
-        updateVlanMember(*update);
+        updateVlanMember(payload<SUBJECT_TYPE_VLAN_MEMBER_CHANGE>(cntx));
         break;
-    }
     default:
         // Received update in which we are not interested
         // Ignore it
@@ -273,13 +263,13 @@ bool MirrorOrch::decreaseRefCount(const string& name)
 
 bool MirrorOrch::validateDstPort(const string& dstPort)
 {
-    Port port;
-    if (!m_portsOrch->getPort(dstPort, port))
+    const Port *port = m_portsOrch->findPort(dstPort);
+    if (!port)
     {
-        SWSS_LOG_ERROR("Not supported port %s type %d", dstPort.c_str(), port.m_type);
+        SWSS_LOG_ERROR("Not supported port %s", dstPort.c_str());
         return false;
     }
-    if (port.m_type != Port::PHY)
+    if (port->m_type != Port::PHY)
     {
         SWSS_LOG_ERROR("Not supported port %s", dstPort.c_str());
         return false;
@@ -505,6 +495,7 @@ task_process_status MirrorOrch::createEntry(const string& key, const vector<Fiel
 
     m_syncdMirrors.emplace(key, entry);
     setSessionState(key, entry);
+    attachSession(m_syncdMirrors.find(key)->second);
 
     if (entry.type == MIRROR_SESSION_SPAN && !entry.dst_port.empty())
     {
@@ -564,6 +555,7 @@ task_process_status MirrorOrch::deleteEntry(const string& name)
 
     removeSessionState(name);
 
+    detachSession(session);
     m_syncdMirrors.erase(sessionIter);
 
     SWSS_LOG_NOTICE("Removed mirror session %s", name.c_str());
@@ -689,21 +681,19 @@ bool MirrorOrch::getNeighborInfo(const string& name, MirrorEntry& session)
             {
                 string alias = tokenize(m_recoverySessionMap[name],
                         state_db_key_delimiter, 1)[0];
-                Port member;
-                m_portsOrch->getPort(alias, member);
+                const Port *member = m_portsOrch->findPort(alias);
 
                 SWSS_LOG_NOTICE("Recover mirror session %s with LAG member port %s",
                         name.c_str(), alias.c_str());
-                session.neighborInfo.portId = member.m_port_id;
+                session.neighborInfo.portId = member ? member->m_port_id : SAI_NULL_OBJECT_ID;
             }
             else
             {
                 // Get the first member of the LAG
-                Port member;
                 string first_member_alias = *session.neighborInfo.port.m_members.begin();
-                m_portsOrch->getPort(first_member_alias, member);
+                const Port *member = m_portsOrch->findPort(first_member_alias);
 
-                session.neighborInfo.portId = member.m_port_id;
+                session.neighborInfo.portId = member ? member->m_port_id : SAI_NULL_OBJECT_ID;
             }
 
             return true;
@@ -719,12 +709,11 @@ bool MirrorOrch::getNeighborInfo(const string& name, MirrorEntry& session)
             {
                 string alias = tokenize(m_recoverySessionMap[name],
                         state_db_key_delimiter, 1)[0];
-                Port member;
-                m_portsOrch->getPort(alias, member);
+                const Port *member = m_portsOrch->findPort(alias);
 
                 SWSS_LOG_NOTICE("Recover mirror session %s with VLAN member port %s",
                         name.c_str(), alias.c_str());
-                session.neighborInfo.portId = member.m_port_id;
+                session.neighborInfo.portId = member ? member->m_port_id : SAI_NULL_OBJECT_ID;
             }
             else
             {
@@ -757,6 +746,59 @@ bool MirrorOrch::getNeighborInfo(const string& name, MirrorEntry& session)
     }
 }
 
+/*
+ * The sessions are attached to the changes of the neighbors of their
+ * destination and next hop IPs, and to the FDB changes of their neighbor MAC
+ * when the neighbor is on a VLAN
+ */
+void MirrorOrch::attachSession(MirrorEntry& session)
+{
+    session.keys.nexthop = SubjectKey(session.nexthopInfo.nexthop.ip_address);
+    m_neighOrch->attach(this, SUBJECT_TYPE_NEIGH_CHANGE, SubjectKey(session.dstIp));
+    m_neighOrch->attach(this, SUBJECT_TYPE_NEIGH_CHANGE, session.keys.nexthop);
+}
+
+void MirrorOrch::detachSession(MirrorEntry& session)
+{
+    m_neighOrch->detach(this, SUBJECT_TYPE_NEIGH_CHANGE, SubjectKey(session.dstIp));
+    m_neighOrch->detach(this, SUBJECT_TYPE_NEIGH_CHANGE, session.keys.nexthop);
+    if (session.keys.fdbAttached)
+    {
+        m_fdbOrch->detach(this, SUBJECT_TYPE_FDB_CHANGE, session.keys.fdb);
+        session.keys.fdbAttached = false;
+    }
+}
+
+/* Follow the next hop and neighbor changes of the session */
+void MirrorOrch::updateSessionKeys(MirrorEntry& session)
+{
+    SubjectKey nexthop(session.nexthopInfo.nexthop.ip_address);
+    if (!(nexthop == session.keys.nexthop))
+    {
+        m_neighOrch->detach(this, SUBJECT_TYPE_NEIGH_CHANGE, session.keys.nexthop);
+        m_neighOrch->attach(this, SUBJECT_TYPE_NEIGH_CHANGE, nexthop);
+        session.keys.nexthop = nexthop;
+    }
+
+    bool vlan = session.neighborInfo.port.m_type == Port::VLAN;
+    SubjectKey fdb = vlan ? SubjectKey(session.neighborInfo.port.m_vlan_info.vlan_oid, session.neighborInfo.mac) : SubjectKey();
+    if (vlan == session.keys.fdbAttached && fdb == session.keys.fdb)
+    {
+        return;
+    }
+
+    if (session.keys.fdbAttached)
+    {
+        m_fdbOrch->detach(this, SUBJECT_TYPE_FDB_CHANGE, session.keys.fdb);
+    }
+    if (vlan)
+    {
+        m_fdbOrch->attach(this, SUBJECT_TYPE_FDB_CHANGE, fdb);
+    }
+    session.keys.fdb = fdb;
+    session.keys.fdbAttached = vlan;
+}
+
 bool MirrorOrch::updateSession(const string& name, MirrorEntry& session)
 {
     SWSS_LOG_ENTER();
@@ -765,7 +807,10 @@ bool MirrorOrch::updateSession(const string& name, MirrorEntry& session)
     MirrorEntry old_session(session);
 
     // Get neighbor information
-    if (getNeighborInfo(name, session))
+    bool resolved = getNeighborInfo(name, session);
+    updateSessionKeys(session);
+
+    if (resolved)
     {
         // Update corresponding attributes
         if (session.status)
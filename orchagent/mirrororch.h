@@ -61,6 +61,14 @@ struct MirrorEntry
 
     int64_t refCount;
 
+    // Keys of the neighbor and FDB changes the session is attached to
+    struct
+    {
+        SubjectKey nexthop;
+        SubjectKey fdb;
+        bool fdbAttached;
+    } keys;
+
     MirrorEntry(const string& platform);
 };
 
@@ -112,6 +120,9 @@ private:
 
     bool activateSession(const string&, MirrorEntry&);
     bool deactivateSession(const string&, MirrorEntry&);
+    void attachSession(MirrorEntry&);
+    void detachSession(MirrorEntry&);
+    void updateSessionKeys(MirrorEntry&);
     bool updateSession(const string&, MirrorEntry&);
     bool updateSessionDstMac(const string&, MirrorEntry&);
     bool updateSessionDstPort(const string&, MirrorEntry&);
@@ -1714,8 +1714,8 @@ MuxOrch::MuxOrch(DBConnector *db, const std::vector<std::string> &tables,
     handler_map_.insert(handler_pair(CFG_MUX_CABLE_TABLE_NAME, &MuxOrch::handleMuxCfg));
     handler_map_.insert(handler_pair(CFG_PEER_SWITCH_TABLE_NAME, &MuxOrch::handlePeerSwitch));
 
-    neigh_orch_->attach(this);
-    fdb_orch_->attach(this);
+    neigh_orch_->attach(this, SUBJECT_TYPE_NEIGH_CHANGE);
+    fdb_orch_->attach(this, SUBJECT_TYPE_FDB_CHANGE);
 }
 
 bool MuxOrch::handleMuxCfg(const Request& request)
@@ -2569,7 +2569,7 @@ void NatOrch::enableNatFeature(void)
     if (gNhTrackingSupported == true)
     {
         SWSS_LOG_INFO("Attach to Neighbor Orch ");
-        m_neighOrch->attach(this);
+        m_neighOrch->attach(this, SUBJECT_TYPE_NEIGH_CHANGE);
     }
 
     SWSS_LOG_INFO("Adding DNAT Pool Entries ");
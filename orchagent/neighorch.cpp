@@ -40,12 +40,12 @@ NeighOrch::NeighOrch(DBConnector *appDb, string tableName, IntfsOrch *intfsOrch,
 {
     SWSS_LOG_ENTER();
 
-    m_fdbOrch->attach(this);
+    m_fdbOrch->attach(this, SUBJECT_TYPE_FDB_FLUSH_CHANGE);
 
     // Some UTs instantiate NeighOrch but gBfdOrch is null, it is not null in orchagent
     if (gBfdOrch)
     {
-        gBfdOrch->attach(this);
+        gBfdOrch->attach(this, SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE);
     }
 
     if(isChassisDbInUse())
@@ -126,22 +126,22 @@ void NeighOrch::processFDBFlushUpdate(const FdbFlushUpdate& update)
     for (auto entry : update.entries)
     {
         // Get Vlan object
-        Port vlan;
-        if (!m_portsOrch->getPort(entry.bv_id, vlan))
+        const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+        if (!vlan)
         {
             SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate vlan port \
                              from bv_id 0x%" PRIx64 ".", entry.bv_id);
             continue;
         }
         SWSS_LOG_INFO("Flushing ARP for port: %s, VLAN: %s",
-                      vlan.m_alias.c_str(), update.port.m_alias.c_str());
+                      vlan->m_alias.c_str(), update.port.m_alias.c_str());
 
         // If the FDB entry MAC matches with neighbor/ARP entry MAC,
         // and ARP entry incoming interface matches with VLAN name,
         // flush neighbor/arp entry.
         for (const auto &neighborEntry : m_syncdNeighbors)
         {
-            if (neighborEntry.first.alias == vlan.m_alias &&
+            if (neighborEntry.first.alias == vlan->m_alias &&
                 neighborEntry.second.mac == entry.mac)
             {
                 resolveNeighborEntry(neighborEntry.first, neighborEntry.second.mac);
@@ -205,16 +205,17 @@ bool NeighOrch::addNextHop(NeighborContext& ctx)
     SWSS_LOG_ENTER();
     const NextHopKey nh = ctx.neighborEntry;
 
-    Port p;
-    if (!gPortsOrch->getPort(nh.alias, p))
+    const Port *p = gPortsOrch->findPort(nh.alias);
+    if (!p)
     {
         SWSS_LOG_ERROR("Neighbor %s seen on port %s which doesn't exist",
                         nh.ip_address.to_string().c_str(), nh.alias.c_str());
         return false;
     }
-    if (p.m_type == Port::SUBPORT)
+    if (p->m_type == Port::SUBPORT)
     {
-        if (!gPortsOrch->getPort(p.m_parent_port_id, p))
+        p = gPortsOrch->findPort(p->m_parent_port_id);
+        if (!p)
         {
             SWSS_LOG_ERROR("Neighbor %s seen on sub interface %s whose parent port doesn't exist",
                             nh.ip_address.to_string().c_str(), nh.alias.c_str());
@@ -336,7 +337,7 @@ bool NeighOrch::addNextHop(NeighborContext& ctx)
     // flag should be set on it.
     // This scenario may happen under race condition where buffered neighbor event
     // is processed after incoming port is down.
-    if (p.m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
+    if (p->m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
     {
         if (setNextHopFlag(nexthop, NHFLAGS_IFDOWN) == false)
         {
@@ -353,16 +354,17 @@ bool NeighOrch::processBulkAddNextHop(NeighborContext& ctx)
 
     const NextHopKey nh = ctx.neighborEntry;
 
-    Port p;
-    if (!gPortsOrch->getPort(nh.alias, p))
+    const Port *p = gPortsOrch->findPort(nh.alias);
+    if (!p)
     {
         SWSS_LOG_ERROR("Neighbor %s seen on port %s which doesn't exist",
                         nh.ip_address.to_string().c_str(), nh.alias.c_str());
         return false;
     }
-    if (p.m_type == Port::SUBPORT)
+    if (p->m_type == Port::SUBPORT)
     {
-        if (!gPortsOrch->getPort(p.m_parent_port_id, p))
+        p = gPortsOrch->findPort(p->m_parent_port_id);
+        if (!p)
         {
             SWSS_LOG_ERROR("Neighbor %s seen on sub interface %s whose parent port doesn't exist",
                             nh.ip_address.to_string().c_str(), nh.alias.c_str());
@@ -428,7 +430,7 @@ bool NeighOrch::processBulkAddNextHop(NeighborContext& ctx)
     // flag should be set on it.
     // This scenario may happen under race condition where buffered neighbor event
     // is processed after incoming port is down.
-    if (p.m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
+    if (p->m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
     {
         if (setNextHopFlag(nexthop, NHFLAGS_IFDOWN) == false)
         {
@@ -903,15 +905,15 @@ void NeighOrch::doTask(Consumer &consumer)
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            const Port *p = gPortsOrch->findPort(alias);
+            if (!p)
             {
                 SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
                 it++;
                 continue;
             }
 
-            if (!p.m_rif_id)
+            if (!p->m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
@@ -1089,20 +1091,21 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
         if (m_syncdNeighbors.find(temp_entry) != m_syncdNeighbors.end())
         {
             // Neighbor already exists on another VLAN. If they belong to the same VRF, delete the old neighbor
-            Port existing_vlan, new_vlan;
-            if (!gPortsOrch->getPort(vlan_port, new_vlan))
+            const Port *new_vlan = gPortsOrch->findPort(vlan_port);
+            if (!new_vlan)
             {
                 SWSS_LOG_ERROR("Failed to get port for %s", vlan_port.c_str());
                 return false;
             }
-            if (!gPortsOrch->getPort(alias, existing_vlan))
+            const Port *existing_vlan = gPortsOrch->findPort(alias);
+            if (!existing_vlan)
             {
                 SWSS_LOG_ERROR("Failed to get port for %s", alias.c_str());
                 return false;
             }
-            if (existing_vlan.m_vr_id == new_vlan.m_vr_id)
+            if (existing_vlan->m_vr_id == new_vlan->m_vr_id)
             {
-                std::string vrf_name = gDirectory.get<VRFOrch*>()->getVRFname(existing_vlan.m_vr_id);
+                std::string vrf_name = gDirectory.get<VRFOrch*>()->getVRFname(existing_vlan->m_vr_id);
                 if (vrf_name.empty())
                 {
                     SWSS_LOG_NOTICE("Neighbor %s already learned on %s, removing before adding new neighbor", ip_address.to_string().c_str(), vlan_port.c_str());
@@ -1230,7 +1233,7 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
     m_syncdNeighbors[neighborEntry] = { macAddress, hw_config };
 
     NeighborUpdate update = { neighborEntry, macAddress, true };
-    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_NEIGH_CHANGE>(update, SubjectKey(update.entry.ip_address));
 
     if(isChassisDbInUse())
     {
@@ -1379,7 +1382,7 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
     m_syncdNeighbors.erase(neighborEntry);
 
     NeighborUpdate update = { neighborEntry, MacAddress(), false };
-    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_NEIGH_CHANGE>(update, SubjectKey(update.entry.ip_address));
 
     if(isChassisDbInUse())
     {
@@ -1493,7 +1496,7 @@ bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
     m_syncdNeighbors[neighborEntry] = { macAddress, true };
 
     NeighborUpdate update = { neighborEntry, macAddress, true };
-    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_NEIGH_CHANGE>(update, SubjectKey(update.entry.ip_address));
 
     return true;
 }
@@ -1883,15 +1886,15 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            const Port *p = gPortsOrch->findPort(alias);
+            if (!p)
             {
                 SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
                 it++;
                 continue;
             }
 
-            if (!p.m_rif_id)
+            if (!p->m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
@@ -2259,24 +2262,24 @@ void NeighOrch::voqSyncAddNeigh(string &alias, IpAddress &ip_address, const MacA
 
     //Sync only local neigh. Confirm for the local neigh and
     //get the system port alias for key for syncing to CHASSIS_APP_DB
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->findPort(alias);
+    if (port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            if (port.m_system_lag_info.switch_id != gVoqMySwitchId)
+            if (port->m_system_lag_info.switch_id != gVoqMySwitchId)
             {
                 return;
             }
-            alias = port.m_system_lag_info.alias;
+            alias = port->m_system_lag_info.alias;
         }
         else
         {
-            if(port.m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
+            if(port->m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
             {
                 return;
             }
-            alias = port.m_system_port_info.alias;
+            alias = port->m_system_port_info.alias;
         }
     }
     else
@@ -2301,24 +2304,24 @@ void NeighOrch::voqSyncDelNeigh(string &alias, IpAddress &ip_address)
 {
     //Sync only local neigh. Confirm for the local neigh and
     //get the system port alias for key for syncing to CHASSIS_APP_DB
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->findPort(alias);
+    if (port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            if (port.m_system_lag_info.switch_id != gVoqMySwitchId)
+            if (port->m_system_lag_info.switch_id != gVoqMySwitchId)
             {
                 return;
             }
-            alias = port.m_system_lag_info.alias;
+            alias = port->m_system_lag_info.alias;
         }
         else
         {
-            if(port.m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
+            if(port->m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
             {
                 return;
             }
-            alias = port.m_system_port_info.alias;
+            alias = port->m_system_port_info.alias;
         }
     }
     else
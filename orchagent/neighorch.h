@@ -44,6 +44,13 @@ struct NeighborUpdate
     bool add;
 };
 
+/* Keyed by the neighbor IP address */
+template <>
+struct SubjectPayload<SUBJECT_TYPE_NEIGH_CHANGE>
+{
+    typedef NeighborUpdate type;
+};
+
 /*
  * Keeps track of neighbor entry information primarily for bulk operations
  */
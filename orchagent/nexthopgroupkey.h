@@ -3,6 +3,8 @@
 
 #include "nexthopkey.h"
 #include <boost/functional/hash.hpp>
+#include <algorithm>
+#include <memory>
 
 class NextHopGroupKey
 {
@@ -18,7 +20,7 @@ public:
         auto nhv = tokenize(nexthops, NHG_DELIMITER);
         for (const auto &nh : nhv)
         {
-            m_nexthops.insert(nh);
+            insertNextHop(NextHopKey(nh));
         }
     }
 
@@ -34,7 +36,7 @@ public:
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                insertNextHop(nh);
             }
         }
         else if (srv6_nh)
@@ -46,7 +48,7 @@ public:
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                insertNextHop(nh);
                 if (nh.isSrv6Vpn())
                 {
                     m_srv6_vpn = true;
@@ -67,7 +69,7 @@ public:
         {
             NextHopKey nh(nhv[i]);
             nh.weight = set_weight? (uint32_t)std::stoi(wtv[i]) : 0;
-            m_nexthops.insert(nh);
+            insertNextHop(nh);
         }
     }
 
@@ -108,20 +110,12 @@ public:
 
     inline bool operator==(const NextHopGroupKey &o) const
     {
-        if (m_nexthops != o.m_nexthops)
+        if (!m_index || !o.m_index)
         {
-            return false;
+            return getSize() == 0 && o.getSize() == 0;
         }
-        auto it1 = m_nexthops.begin();
-        for (auto& it2 : o.m_nexthops)
-        {
-            if (it2.weight != it1->weight)
-            {
-                return false;
-            }
-            it1++;
-        }
-        return true;
+        return m_index == o.m_index ||
+               (m_index->m_hash == o.m_index->m_hash && m_index->m_ids == o.m_index->m_ids);
     }
 
     inline bool operator!=(const NextHopGroupKey &o) const
@@ -131,17 +125,17 @@ public:
 
     void add(const std::string &ip, const std::string &alias)
     {
-        m_nexthops.emplace(ip, alias);
+        insertNextHop(NextHopKey(ip, alias));
     }
 
     void add(const std::string &nh)
     {
-        m_nexthops.insert(nh);
+        insertNextHop(NextHopKey(nh));
     }
 
     void add(const NextHopKey &nh)
     {
-        m_nexthops.insert(nh);
+        insertNextHop(nh);
     }
 
     bool contains(const std::string &ip, const std::string &alias) const
@@ -186,18 +180,17 @@ public:
 
     void remove(const std::string &ip, const std::string &alias)
     {
-        NextHopKey nh(ip, alias);
-        m_nexthops.erase(nh);
+        eraseNextHop(NextHopKey(ip, alias));
     }
 
     void remove(const std::string &nh)
     {
-        m_nexthops.erase(nh);
+        eraseNextHop(NextHopKey(nh));
     }
 
     void remove(const NextHopKey &nh)
     {
-        m_nexthops.erase(nh);
+        eraseNextHop(nh);
     }
 
     const std::string to_string() const
@@ -238,10 +231,112 @@ public:
     void clear()
     {
         m_nexthops.clear();
+        m_index.reset();
     }
 
 private:
+    /*
+     * Interned form of the group: the next hop ids and weights, sorted, and
+     * an order independent sum of their hashes, so the group is hashed and
+     * compared without touching the strings. Both are updated in place when
+     * a next hop is added or removed. The index holds a reference on each
+     * of its ids and is shared by the copies of the group until one of them
+     * changes.
+     */
+    struct Index
+    {
+        Index() = default;
+
+        Index(const Index &o) : m_ids(o.m_ids), m_hash(o.m_hash)
+        {
+            for (auto entry : m_ids)
+            {
+                NextHopKeyTable::acquire(static_cast<uint32_t>(entry >> 32));
+            }
+        }
+
+        Index &operator=(const Index &) = delete;
+
+        ~Index()
+        {
+            for (auto entry : m_ids)
+            {
+                NextHopKeyTable::release(static_cast<uint32_t>(entry >> 32));
+            }
+        }
+
+        static size_t hashEntry(uint64_t entry)
+        {
+            // splitmix64 finalizer, so that the sum of the entries spreads well
+            entry = (entry ^ (entry >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            entry = (entry ^ (entry >> 27)) * 0x94d049bb133111ebULL;
+            return static_cast<size_t>(entry ^ (entry >> 31));
+        }
+
+        /* Takes over the reference of the caller on id */
+        void insert(uint32_t id, uint32_t weight)
+        {
+            uint64_t entry = (static_cast<uint64_t>(id) << 32) | weight;
+            m_ids.insert(std::lower_bound(m_ids.begin(), m_ids.end(), entry), entry);
+            m_hash += hashEntry(entry);
+        }
+
+        void erase(uint32_t id)
+        {
+            auto it = std::lower_bound(m_ids.begin(), m_ids.end(), static_cast<uint64_t>(id) << 32);
+            if (it == m_ids.end() || (*it >> 32) != id)
+            {
+                return;
+            }
+            m_hash -= hashEntry(*it);
+            m_ids.erase(it);
+            NextHopKeyTable::release(id);
+        }
+
+        std::vector<uint64_t> m_ids;
+        size_t m_hash = 0;
+    };
+
+    /* Index of the group, copied first if another group shares it */
+    Index &index()
+    {
+        if (!m_index)
+        {
+            m_index = std::make_shared<Index>();
+        }
+        else if (m_index.use_count() > 1)
+        {
+            m_index = std::make_shared<Index>(*m_index);
+        }
+        return *m_index;
+    }
+
+    void insertNextHop(const NextHopKey &nh)
+    {
+        if (m_nexthops.insert(nh).second)
+        {
+            index().insert(NextHopKeyTable::acquire(nh), nh.weight);
+        }
+    }
+
+    void eraseNextHop(const NextHopKey &nh)
+    {
+        auto it = m_nexthops.find(nh);
+        if (it == m_nexthops.end())
+        {
+            return;
+        }
+
+        uint32_t id;
+        if (NextHopKeyTable::find(*it, id))
+        {
+            index().erase(id);
+        }
+        m_nexthops.erase(it);
+    }
+
     std::set<NextHopKey> m_nexthops;
+    std::shared_ptr<Index> m_index;
     bool m_overlay_nexthops = false;
     bool m_srv6_nexthops = false;
     bool m_srv6_vpn = false;
@@ -255,7 +350,7 @@ namespace std {
     template <>
     struct hash<NextHopGroupKey> {
         size_t operator()(const NextHopGroupKey& obj) const {
-            return boost::hash_range(obj.m_nexthops.begin(), obj.m_nexthops.end());
+            return obj.m_index ? obj.m_index->m_hash : 0;
         }
     };
 }
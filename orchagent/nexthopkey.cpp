@@ -1,5 +1,10 @@
 #include "nexthopkey.h"
 
+#include <mutex>
+#include <net/ethernet.h>
+#include <unordered_map>
+#include <vector>
+
 std::size_t hash_value(const NextHopKey& obj) {
     std::size_t nh_hash = 0;
 
@@ -15,3 +20,117 @@ std::size_t hash_value(const NextHopKey& obj) {
 
     return nh_hash;
 }
+
+std::size_t NextHopKeyTable::Hash::operator()(const NextHopKey& nh) const
+{
+    std::size_t nh_hash = 0;
+
+    if (nh.ip_address.isV4())
+    {
+        boost::hash_combine(nh_hash, nh.ip_address.getV4Addr());
+    }
+    else
+    {
+        const uint8_t *v6 = nh.ip_address.getV6Addr();
+        boost::hash_range(nh_hash, v6, v6 + 16);
+    }
+    boost::hash_combine(nh_hash, nh.alias);
+    boost::hash_combine(nh_hash, nh.vni);
+    const uint8_t *mac = nh.mac_address.getMac();
+    boost::hash_range(nh_hash, mac, mac + ETHER_ADDR_LEN);
+    if (!nh.label_stack.empty())
+    {
+        boost::hash_combine(nh_hash, nh.label_stack.to_string());
+    }
+    boost::hash_combine(nh_hash, nh.srv6_segment);
+    boost::hash_combine(nh_hash, nh.srv6_source);
+    boost::hash_combine(nh_hash, nh.srv6_vpn_sid);
+
+    return nh_hash;
+}
+
+namespace
+{
+    struct NextHopKeyIds
+    {
+        std::unordered_map<NextHopKey, uint32_t, NextHopKeyTable::Hash> ids;
+        /* Next hop and reference count of each id, nullptr for a free id */
+        std::vector<std::pair<const NextHopKey *, uint32_t>> slots;
+        std::vector<uint32_t> freeIds;
+        std::mutex mutex;
+    };
+
+    NextHopKeyIds& nextHopKeyIds()
+    {
+        // Never destroyed: static next hop groups may release their ids at exit
+        static auto *ids = new NextHopKeyIds();
+        return *ids;
+    }
+}
+
+uint32_t NextHopKeyTable::acquire(const NextHopKey& nh)
+{
+    auto& table = nextHopKeyIds();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.ids.find(nh);
+    if (it == table.ids.end())
+    {
+        uint32_t id;
+        if (table.freeIds.empty())
+        {
+            id = static_cast<uint32_t>(table.slots.size());
+            table.slots.emplace_back(nullptr, 0);
+        }
+        else
+        {
+            id = table.freeIds.back();
+            table.freeIds.pop_back();
+        }
+        it = table.ids.emplace(nh, id).first;
+        table.slots[id].first = &it->first;
+    }
+
+    table.slots[it->second].second++;
+    return it->second;
+}
+
+void NextHopKeyTable::acquire(uint32_t id)
+{
+    auto& table = nextHopKeyIds();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    table.slots[id].second++;
+}
+
+void NextHopKeyTable::release(uint32_t id)
+{
+    auto& table = nextHopKeyIds();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto& slot = table.slots[id];
+    if (--slot.second == 0)
+    {
+        table.ids.erase(table.ids.find(*slot.first));
+        slot.first = nullptr;
+        table.freeIds.push_back(id);
+    }
+}
+
+bool NextHopKeyTable::find(const NextHopKey& nh, uint32_t& id)
+{
+    auto& table = nextHopKeyIds();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.ids.find(nh);
+    if (it == table.ids.end())
+    {
+        return false;
+    }
+
+    id = it->second;
+    return true;
+}
+
+size_t NextHopKeyTable::size()
+{
+    auto& table = nextHopKeyIds();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.ids.size();
+}
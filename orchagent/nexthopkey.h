@@ -221,4 +221,31 @@ struct NextHopKey
 
 std::size_t hash_value(const NextHopKey& obj);
 
+/*
+ * Interning table of the next hops: each distinct next hop (ignoring its
+ * weight, like NextHopKey::operator==) gets a 32-bit id, so next hop groups
+ * can be hashed and compared as integer vectors. The ids are reference
+ * counted by the groups holding them, released at zero and then reused.
+ * The table is locked: next hop groups are built, copied and destroyed by
+ * the route ring and by the timers and notifications of the main thread.
+ */
+class NextHopKeyTable
+{
+public:
+    /* Id of the next hop, interned if needed, with a new reference */
+    static uint32_t acquire(const NextHopKey& nh);
+    /* New reference to an id already held by the caller */
+    static void acquire(uint32_t id);
+    static void release(uint32_t id);
+    /* Id of an interned next hop, without taking a reference */
+    static bool find(const NextHopKey& nh, uint32_t& id);
+    static size_t size();
+
+    /* Hash of the fields compared by NextHopKey::operator== */
+    struct Hash
+    {
+        std::size_t operator()(const NextHopKey& nh) const;
+    };
+};
+
 #endif /* SWSS_NEXTHOPKEY_H */
@@ -20,6 +20,8 @@ public:
         /* Check before triggering doTask because pop() can throw an exception if there is no data */
         if (notificationConsumer->hasData())
         {
+            // Notifications run on the main thread, next to the orchs of the rings
+            waitForRingsIdle();
             m_orch->doTask(*notificationConsumer);
         }
     }
@@ -1,7 +1,20 @@
 #ifndef SWSS_OBSERVER_H
 #define SWSS_OBSERVER_H
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <list>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <sys/socket.h>
+
+#include <sai.h>
+
+#include "ipaddress.h"
+#include "macaddress.h"
 
 using namespace std;
 using namespace swss;
@@ -27,13 +40,84 @@ enum SubjectType
     SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE
 };
 
+/*
+ * Payload of the changes of a subject type, specialized next to the payload
+ * struct. The typed notify() and Observer::payload() only compile for the
+ * payload of the type.
+ */
+template <SubjectType type>
+struct SubjectPayload;
+
+/*
+ * Object a change is about, for the observers only interested in some
+ * objects: an object ID, an IP address, or a MAC address in a VLAN or
+ * bridge. A subject type always uses the same kind of key. Keys only filter
+ * the changes: the observers still check the payload.
+ */
+struct SubjectKey
+{
+    uint64_t high;
+    uint64_t low;
+
+    SubjectKey() : high(0), low(0) {}
+
+    explicit SubjectKey(sai_object_id_t oid) : high(0), low(oid) {}
+
+    explicit SubjectKey(const IpAddress &ip) : high(0), low(0)
+    {
+        const ip_addr_t &addr = ip.getIpAddr();
+
+        if (addr.family == AF_INET)
+        {
+            low = addr.ip_addr.ipv4_addr;
+        }
+        else
+        {
+            memcpy(&high, addr.ip_addr.ipv6_addr, sizeof(high));
+            memcpy(&low, addr.ip_addr.ipv6_addr + sizeof(high), sizeof(low));
+        }
+    }
+
+    SubjectKey(sai_object_id_t bv_id, const MacAddress &mac) : high(bv_id), low(0)
+    {
+        memcpy(&low, mac.getMac(), sizeof(sai_mac_t));
+    }
+
+    bool operator==(const SubjectKey &other) const
+    {
+        return high == other.high && low == other.low;
+    }
+};
+
+struct SubjectKeyHash
+{
+    size_t operator()(const SubjectKey &key) const
+    {
+        return std::hash<uint64_t>()(key.high * 31 + key.low);
+    }
+};
+
 class Observer
 {
 public:
     virtual void update(SubjectType, void *) = 0;
     virtual ~Observer() {}
+
+protected:
+    template <SubjectType type>
+    static typename SubjectPayload<type>::type &payload(void *cntx)
+    {
+        return *static_cast<typename SubjectPayload<type>::type *>(cntx);
+    }
 };
 
+/*
+ * An observer is either attached to all the changes of the subject, to all
+ * the changes of a type, or to the changes of a type about some keys. It
+ * must only use one of them for a given type, or it is called more than
+ * once per change. Keyed attachments are counted, so several users of the
+ * same key in an observer attach and detach it independently.
+ */
 class Subject
 {
 public:
@@ -42,9 +126,75 @@ public:
         m_observers.push_back(observer);
     }
 
+    void attach(Observer *observer, SubjectType type)
+    {
+        m_typeObservers[type].push_back(observer);
+    }
+
+    void attach(Observer *observer, SubjectType type, const SubjectKey &key)
+    {
+        auto &observers = m_keyObservers[type][key];
+
+        for (auto &it : observers)
+        {
+            if (it.first == observer)
+            {
+                it.second++;
+                return;
+            }
+        }
+
+        observers.emplace_back(observer, 1);
+    }
+
+    /* Detach the observer from all the changes it is attached to */
     virtual void detach(Observer *observer)
     {
         m_observers.remove(observer);
+
+        for (auto &it : m_typeObservers)
+        {
+            it.second.remove(observer);
+        }
+
+        for (auto &type : m_keyObservers)
+        {
+            for (auto it = type.second.begin(); it != type.second.end();)
+            {
+                removeKeyObserver(it->second, observer, true);
+                it = it->second.empty() ? type.second.erase(it) : next(it);
+            }
+        }
+    }
+
+    void detach(Observer *observer, SubjectType type)
+    {
+        auto it = m_typeObservers.find(type);
+        if (it != m_typeObservers.end())
+        {
+            it->second.remove(observer);
+        }
+    }
+
+    void detach(Observer *observer, SubjectType type, const SubjectKey &key)
+    {
+        auto keys = m_keyObservers.find(type);
+        if (keys == m_keyObservers.end())
+        {
+            return;
+        }
+
+        auto it = keys->second.find(key);
+        if (it == keys->second.end())
+        {
+            return;
+        }
+
+        removeKeyObserver(it->second, observer, false);
+        if (it->second.empty())
+        {
+            keys->second.erase(it);
+        }
     }
 
     virtual ~Subject() {}
@@ -52,12 +202,125 @@ public:
 protected:
     list<Observer *> m_observers;
 
+    /*
+     * Notify the observers of all the changes and of the changes of the type.
+     * The observers of some keys of the type are notified too, use the keyed
+     * notify() for the types they may attach to.
+     */
     virtual void notify(SubjectType type, void *cntx)
     {
         for (auto iter: m_observers)
         {
             iter->update(type, cntx);
         }
+
+        notifyType(type, cntx);
+
+        auto keys = m_keyObservers.find(type);
+        if (keys == m_keyObservers.end() || keys->second.empty())
+        {
+            return;
+        }
+
+        // Observers may change their keyed attachments while handling the change
+        vector<Observer *> observers;
+        for (const auto &key : keys->second)
+        {
+            for (const auto &it : key.second)
+            {
+                if (find(observers.begin(), observers.end(), it.first) == observers.end())
+                {
+                    observers.push_back(it.first);
+                }
+            }
+        }
+
+        for (auto observer : observers)
+        {
+            observer->update(type, cntx);
+        }
+    }
+
+    /* Notify the observers of all the changes, of the type, and of the key */
+    void notify(SubjectType type, void *cntx, const SubjectKey &key)
+    {
+        for (auto iter: m_observers)
+        {
+            iter->update(type, cntx);
+        }
+
+        notifyType(type, cntx);
+
+        auto keys = m_keyObservers.find(type);
+        if (keys == m_keyObservers.end())
+        {
+            return;
+        }
+
+        auto it = keys->second.find(key);
+        if (it == keys->second.end())
+        {
+            return;
+        }
+
+        vector<Observer *> observers;
+        observers.reserve(it->second.size());
+        for (const auto &observer : it->second)
+        {
+            observers.push_back(observer.first);
+        }
+
+        for (auto observer : observers)
+        {
+            observer->update(type, cntx);
+        }
+    }
+
+    template <SubjectType type>
+    void notify(typename SubjectPayload<type>::type &update)
+    {
+        notify(type, static_cast<void *>(&update));
+    }
+
+    template <SubjectType type>
+    void notify(typename SubjectPayload<type>::type &update, const SubjectKey &key)
+    {
+        notify(type, static_cast<void *>(&update), key);
+    }
+
+private:
+    typedef vector<pair<Observer *, unsigned>> KeyObservers;
+
+    map<SubjectType, list<Observer *>> m_typeObservers;
+    map<SubjectType, unordered_map<SubjectKey, KeyObservers, SubjectKeyHash>> m_keyObservers;
+
+    void notifyType(SubjectType type, void *cntx)
+    {
+        auto it = m_typeObservers.find(type);
+        if (it == m_typeObservers.end())
+        {
+            return;
+        }
+
+        for (auto iter: it->second)
+        {
+            iter->update(type, cntx);
+        }
+    }
+
+    static void removeKeyObserver(KeyObservers &observers, Observer *observer, bool all)
+    {
+        for (auto it = observers.begin(); it != observers.end(); it++)
+        {
+            if (it->first == observer)
+            {
+                if (all || --it->second == 0)
+                {
+                    observers.erase(it);
+                }
+                return;
+            }
+        }
     }
 };
 
@@ -1,5 +1,6 @@
 #include <inttypes.h>
 #include <stdexcept>
+#include <algorithm>
 #include <sys/time.h>
 #include "timestamp.h"
 #include "orch.h"
@@ -19,12 +20,29 @@ int gBatchSize = 0;
 
 std::shared_ptr<RingBuffer> Orch::gRingBuffer = nullptr;
 std::shared_ptr<RingBuffer> Executor::gRingBuffer = nullptr;
+std::shared_ptr<RingPool> Executor::gRingPool = nullptr;
+bool Orch::gDirtyScheduling = false;
 
-RingBuffer::RingBuffer(int size): buffer(size)
+RingBuffer::RingBuffer(int size)
 {
     if (size <= 1) {
         throw std::invalid_argument("Buffer size must be greater than 1");
     }
+
+    m_capacity = static_cast<size_t>(size - 1);
+
+    size_t slots = 1;
+    while (slots < m_capacity)
+    {
+        slots <<= 1;
+    }
+
+    m_mask = slots - 1;
+    m_slots.reset(new Slot[slots]);
+    for (size_t i = 0; i < slots; i++)
+    {
+        m_slots[i].seq.store(i, std::memory_order_relaxed);
+    }
 }
 
 void RingBuffer::pauseThread()
@@ -39,7 +57,20 @@ void RingBuffer::notify()
     bool task_pending = !IsEmpty() && IsIdle();
 
     if (thread_exited || task_pending)
+    {
+        // take the lock so the wakeup can't slip in before the ring thread waits
+        std::lock_guard<std::mutex> lock(mtx);
         cv.notify_all();
+    }
+}
+
+void RingBuffer::wakeProducers()
+{
+    if (m_waitingProducers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        m_notFullCv.notify_all();
+    }
 }
 
 void RingBuffer::setIdle(bool idle)
@@ -54,32 +85,115 @@ bool RingBuffer::IsIdle() const
 
 bool RingBuffer::IsFull() const
 {
-    return (tail + 1) % static_cast<int>(buffer.size()) == head;
+    // load the consumer position first, it can't overtake the producer position read after it
+    size_t head = m_dequeuePos.load(std::memory_order_acquire);
+    return m_enqueuePos.load(std::memory_order_acquire) - head >= m_capacity;
 }
 
 bool RingBuffer::IsEmpty() const
 {
-    return tail == head;
+    return m_enqueuePos.load(std::memory_order_acquire) == m_dequeuePos.load(std::memory_order_acquire);
+}
+
+bool RingBuffer::push(AnyTask&& ringEntry)
+{
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto used = static_cast<intptr_t>(pos - m_dequeuePos.load(std::memory_order_acquire));
+        if (used < 0)
+        {
+            // stale position, the ring thread already went past it
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (static_cast<size_t>(used) >= m_capacity)
+            return false;
+
+        Slot &slot = m_slots[pos & m_mask];
+        auto diff = static_cast<intptr_t>(slot.seq.load(std::memory_order_acquire) - pos);
+
+        if (diff == 0)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot.task = std::move(ringEntry);
+                slot.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+            // pos is reloaded by the failed CAS
+        }
+        else if (diff < 0)
+        {
+            // the slot hasn't been released by the ring thread yet
+            return false;
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void RingBuffer::pushWait(AnyTask&& ringEntry)
+{
+    while (!push(std::move(ringEntry)))
+    {
+        notify();
+
+        // apply backpressure to the producer instead of spinning on a full ring
+        std::unique_lock<std::mutex> lock(mtx);
+        m_waitingProducers++;
+        m_notFullCv.wait_for(lock, std::chrono::milliseconds(1), [&](){ return !IsFull() || thread_exited; });
+        m_waitingProducers--;
+    }
 }
 
-bool RingBuffer::push(AnyTask ringEntry)
+bool RingBuffer::dequeue(AnyTask& ringEntry)
 {
-    if (IsFull())
+    size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    Slot &slot = m_slots[pos & m_mask];
+
+    // the slot is either empty or still being written by a producer
+    if (slot.seq.load(std::memory_order_acquire) != pos + 1)
         return false;
-    buffer[tail] = std::move(ringEntry);
-    tail = (tail + 1) % static_cast<int>(buffer.size());
+
+    ringEntry = std::move(slot.task);
+    slot.seq.store(pos + m_mask + 1, std::memory_order_release);
+    m_dequeuePos.store(pos + 1, std::memory_order_release);
     return true;
 }
 
 bool RingBuffer::pop(AnyTask& ringEntry)
 {
-    if (IsEmpty())
+    if (!dequeue(ringEntry))
         return false;
-    ringEntry = std::move(buffer[head]);
-    head = (head + 1) % static_cast<int>(buffer.size());
+
+    wakeProducers();
     return true;
 }
 
+size_t RingBuffer::popBatch(std::vector<AnyTask>& batch, size_t maxBatch)
+{
+    size_t count = 0;
+    AnyTask ringEntry;
+
+    while (count < maxBatch && dequeue(ringEntry))
+    {
+        batch.push_back(std::move(ringEntry));
+        count++;
+    }
+
+    if (count > 0)
+    {
+        wakeProducers();
+    }
+
+    return count;
+}
+
 void RingBuffer::addExecutor(Executor* executor)
 {
     m_consumerSet.insert(executor->getName());
@@ -90,6 +204,143 @@ bool RingBuffer::serves(const std::string& tableName)
     return m_consumerSet.find(tableName) != m_consumerSet.end();  
 }
 
+void RingPool::addGroup(const std::vector<std::string> &tables)
+{
+    m_groups.push_back(tables);
+}
+
+void RingPool::addDependency(const std::string &table, const std::string &dependsOn)
+{
+    m_dependencies.emplace_back(table, dependsOn);
+}
+
+void RingPool::build(int size)
+{
+    // union-find over the declared groups
+    std::vector<size_t> parent(m_groups.size());
+    for (size_t i = 0; i < parent.size(); i++)
+    {
+        parent[i] = i;
+    }
+
+    auto root = [&parent](size_t i) {
+        while (parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    std::map<std::string, size_t> tableToGroup;
+    for (size_t i = 0; i < m_groups.size(); i++)
+    {
+        for (const auto &table : m_groups[i])
+        {
+            auto it = tableToGroup.find(table);
+            if (it != tableToGroup.end())
+            {
+                // a table listed in two groups ties them together
+                parent[root(i)] = root(it->second);
+            }
+            else
+            {
+                tableToGroup[table] = i;
+            }
+        }
+    }
+
+    for (const auto &dep : m_dependencies)
+    {
+        auto from = tableToGroup.find(dep.first);
+        auto to = tableToGroup.find(dep.second);
+
+        // Tables served by the main thread run while every ring is idle, like
+        // the timers and notifications, see Executor::waitForRingsIdle()
+        if (from == tableToGroup.end() || to == tableToGroup.end())
+        {
+            continue;
+        }
+
+        parent[root(from->second)] = root(to->second);
+    }
+
+    m_rings.clear();
+    m_tableToRing.clear();
+
+    std::map<size_t, std::shared_ptr<RingBuffer>> rootToRing;
+    for (size_t i = 0; i < m_groups.size(); i++)
+    {
+        auto &ring = rootToRing[root(i)];
+        if (!ring)
+        {
+            ring = std::make_shared<RingBuffer>(size);
+            m_rings.push_back(ring);
+        }
+
+        for (const auto &table : m_groups[i])
+        {
+            m_tableToRing[table] = ring;
+        }
+    }
+
+    SWSS_LOG_NOTICE("RingPool built %zu rings from %zu groups", m_rings.size(), m_groups.size());
+}
+
+std::shared_ptr<RingBuffer> RingPool::getRing(const std::string &tableName) const
+{
+    auto it = m_tableToRing.find(tableName);
+    if (it == m_tableToRing.end())
+    {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+void RingPool::addExecutor(Executor* executor)
+{
+    auto ring = getRing(executor->getName());
+    if (ring)
+    {
+        ring->addExecutor(executor);
+    }
+}
+
+bool RingPool::threadCreated() const
+{
+    for (const auto &ring : m_rings)
+    {
+        if (ring->thread_created)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool RingPool::IsIdle() const
+{
+    for (const auto &ring : m_rings)
+    {
+        if (!ring->IsEmpty() || !ring->IsIdle())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void RingPool::notify()
+{
+    for (const auto &ring : m_rings)
+    {
+        ring->notify();
+    }
+}
+
 Orch::Orch(DBConnector *db, const string tableName, int pri)
 {
     addConsumer(db, tableName, pri);
@@ -171,7 +422,7 @@ bool ConsumerBase::addToRetry(const Task &task, const Constraint &cst) {
     auto retryCache = getOrch() ? getOrch()->getRetryCache(getName()) : nullptr;
     if (retryCache)
     {
-        Recorder::Instance().retry.record(dumpTuple(task).append(CACHE));
+        Recorder::Instance().retry.record([&]() { return dumpTuple(task).append(CACHE); });
         retryCache->insert(task, cst);
         return true;
     }
@@ -182,7 +433,7 @@ bool Orch::addToRetry(const std::string &executorName, const Task &task, const C
     auto retryCache = getRetryCache(executorName);
     if (retryCache)
     {
-        Recorder::Instance().retry.record(getConsumerBase(executorName)->dumpTuple(task).append(CACHE));
+        Recorder::Instance().retry.record([&]() { return getConsumerBase(executorName)->dumpTuple(task).append(CACHE); });
         retryCache->insert(task, cst);
         return true;
     }
@@ -233,6 +484,12 @@ void Orch::notifyRetry(Orch *retryOrch, const std::string &executorName, const C
     else
     {
         retryCache->mark_resolved(cst);
+
+        auto consumer = retryOrch->getConsumerBase(executorName);
+        if (consumer)
+        {
+            consumer->markDirty();
+        }
     }
 }
 
@@ -249,9 +506,9 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry, bool onRetry)
 
     if (!onRetry)
         /* Record incoming tasks */
-        Recorder::Instance().swss.record(dumpTuple(entry));
+        Recorder::Instance().swss.record([&]() { return dumpTuple(entry); });
     else
-        Recorder::Instance().retry.record(dumpTuple(entry).append(DECACHE));
+        Recorder::Instance().retry.record([&]() { return dumpTuple(entry).append(DECACHE); });
 
     auto retryCache = getOrch() ? getOrch()->getRetryCache(getName()) : nullptr;
 
@@ -280,7 +537,7 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry, bool onRetry)
                 if (kfvOp(it->second.second) == SET_COMMAND)
                 {
                     auto old_task = retryCache->evict(key);
-                    Recorder::Instance().retry.record(dumpTuple(*old_task).append(DECACHE));
+                    Recorder::Instance().retry.record([&]() { return dumpTuple(*old_task).append(DECACHE); });
                 }
             }
             else if (op == SET_COMMAND)
@@ -290,7 +547,7 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry, bool onRetry)
                     // move the old SET back to m_toSync for later merge
                     auto old_task = retryCache->evict(key);
                     m_toSync.emplace(key, *old_task);
-                    Recorder::Instance().retry.record(dumpTuple(*old_task).append(DECACHE));
+                    Recorder::Instance().retry.record([&]() { return dumpTuple(*old_task).append(DECACHE); });
                 }
             }
             break;
@@ -302,14 +559,14 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry, bool onRetry)
             {
                 // remove the SET task from the cache, reuse the DEL task
                 auto old_task = retryCache->evict(key);
-                Recorder::Instance().retry.record(dumpTuple(*old_task).append(DECACHE));
+                Recorder::Instance().retry.record([&]() { return dumpTuple(*old_task).append(DECACHE); });
                 return;
             }
             else if (op == SET_COMMAND)
             {
                 // Keep the DEL task, move the old SET back to m_toSync for later merge
                 auto old_task = retryCache->evict(key);
-                Recorder::Instance().retry.record(dumpTuple(*old_task).append(DECACHE));
+                Recorder::Instance().retry.record([&]() { return dumpTuple(*old_task).append(DECACHE); });
                 m_toSync.emplace(key, *old_task);
             }
             break;
@@ -320,13 +577,13 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry, bool onRetry)
     }
 
     /*
-    * m_toSync is a multimap which will allow one key with multiple values,
-    * Also, the order of the key-value pairs whose keys compare equivalent
-    * is the order of insertion and does not change. (since C++11)
+    * m_toSync allows one key with multiple values, the values of the same key
+    * are kept in the order of insertion.
     */
+    auto ret = m_toSync.equal_range(key);
 
     /* If a new task comes we directly put it into getConsumerTable().m_toSync map */
-    if (m_toSync.find(key) == m_toSync.end())
+    if (ret.first == ret.second)
     {
         m_toSync.emplace(key, entry);
     }
@@ -348,14 +605,13 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry, bool onRetry)
         * We iterate the values with the key, we skip the value with DEL and then
         * check if that was the only one (I,E, the iter pointer now points to end or next key),
         * in such case, we insert the key-value with SET.
-        * If there was a SET already (I,E, the pointer still points to the same key), we combine the kfv.
+        * If there was a SET already (I,E, the pointer still points to the same key), we combine
+        * the kfv in place.
         */
-        auto ret = m_toSync.equal_range(key);
         auto iter = ret.first;
         for (; iter != ret.second; ++iter)
         {
-            auto old_op = kfvOp(iter->second);
-            if (old_op == SET_COMMAND)
+            if (kfvOp(iter->second) == SET_COMMAND)
                 break;
         }
         if (iter == ret.second)
@@ -364,32 +620,21 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry, bool onRetry)
         }
         else
         {
-            KeyOpFieldsValuesTuple existing_data = iter->second;
+            auto &existing_values = kfvFieldsValues(iter->second);
 
-            auto new_values = kfvFieldsValues(entry);
-            auto existing_values = kfvFieldsValues(existing_data);
-
-
-            for (auto it : new_values)
+            for (const auto &it : kfvFieldsValues(entry))
             {
-                string field = fvField(it);
-                string value = fvValue(it);
+                const string &field = fvField(it);
 
-                auto iu = existing_values.begin();
-                while (iu != existing_values.end())
-                {
-                    string ofield = fvField(*iu);
-                    if (field == ofield)
-                        iu = existing_values.erase(iu);
-                    else
-                        iu++;
-                }
-                existing_values.push_back(FieldValueTuple(field, value));
+                existing_values.erase(std::remove_if(existing_values.begin(), existing_values.end(),
+                                                     [&field](const FieldValueTuple &fv) { return fvField(fv) == field; }),
+                                      existing_values.end());
+                existing_values.push_back(it);
             }
-            iter->second = KeyOpFieldsValuesTuple(key, op, existing_values);
         }
     }
 
+    markDirty();
 }
 
 size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries, bool onRetry)
@@ -462,6 +707,26 @@ size_t ConsumerBase::refillToSync()
     return 0;
 }
 
+void ConsumerBase::markDirty()
+{
+    m_dirty = true;
+
+    if (m_orch)
+    {
+        m_orch->markDirty();
+    }
+}
+
+bool ConsumerBase::refreshDirty()
+{
+    auto retryCache = getOrch() ? getOrch()->getRetryCache(getName()) : nullptr;
+
+    bool dirty = !m_toSync.empty() || (retryCache && !retryCache->getResolvedConstraints().empty());
+    m_dirty = dirty;
+
+    return dirty;
+}
+
 string ConsumerBase::dumpTuple(const KeyOpFieldsValuesTuple &tuple)
 {
     string s = getTableName() + getConsumerTable()->getTableNameSeparator() + kfvKey(tuple)
@@ -519,37 +784,48 @@ void Consumer::execute()
 
 void Executor::processAnyTask(AnyTask&& task)
 {
-    // if either gRingBuffer isn't initialized or the ring thread isn't created
-    if (!gRingBuffer || !gRingBuffer->thread_created) 
+    // if either gRingPool isn't initialized or no ring thread is created
+    if (!gRingPool || !gRingPool->threadCreated())
     {
         // execute the input task immediately
         task();
+        return;
     }
 
     // Ring Buffer Logic
 
-    // if this executor isn't served by ring buffer
-    else if (!gRingBuffer->serves(getName()))
+    auto ring = gRingPool->getRing(getName());
+
+    // if this executor isn't served by any ring
+    if (!ring)
     {
         // this executor should execute the input task in the main thread
-        // but to avoid thread issue, it should wait when the ring buffer is actively working
-        while (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle()) {
-            gRingBuffer->notify();
-            std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MSECONDS));
-        }
+        // but to avoid thread issue, it should wait when any ring is actively working
+        waitForRingsIdle();
         // execute task()
         task();
     }
     else
     {
-        // if this executor is served by ring buffer, 
-        // push the task to gRingBuffer
+        // if this executor is served by a ring,
+        // push the task to the ring of its affinity group
         // this task would be executed in the ring thread, not here
-        while (!gRingBuffer->push(task)) {
-            gRingBuffer->notify();
-            SWSS_LOG_WARN("ring is full...push again");
-        }
-        gRingBuffer->notify();
+        // blocks while the ring is full until the ring thread makes room
+        ring->pushWait(std::move(task));
+        ring->notify();
+    }
+}
+
+void Executor::waitForRingsIdle()
+{
+    if (!gRingPool || !gRingPool->threadCreated())
+    {
+        return;
+    }
+
+    while (!gRingPool->IsIdle()) {
+        gRingPool->notify();
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MSECONDS));
     }
 }
 
@@ -843,11 +1119,33 @@ void Orch::doTask()
 
     for (auto &it : m_consumerMap)
     {
+        if (gDirtyScheduling && !it.second->isDirty())
+        {
+            continue;
+        }
+
         count += retryToSync(it.first, threshold - count);
         it.second->drain();
     }
 }
 
+void Orch::doDirtyTask()
+{
+    m_dirty = false;
+
+    doTask();
+
+    // Consumers left with pending tasks stay scheduled for the next pass
+    for (auto &it : m_consumerMap)
+    {
+        auto consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer && consumer->refreshDirty())
+        {
+            m_dirty = true;
+        }
+    }
+}
+
 void Orch::dumpPendingTasks(vector<string> &ts)
 {
     for (auto &it : m_consumerMap)
@@ -1111,8 +1409,8 @@ void Orch::addExecutor(Executor* executor)
         SWSS_LOG_THROW("Duplicated executorName in m_consumerMap: %s", executor->getName().c_str());
     }
 
-    if (gRingBuffer && executor->getName() == APP_ROUTE_TABLE_NAME) {
-        gRingBuffer->addExecutor(executor);
+    if (Executor::gRingPool) {
+        Executor::gRingPool->addExecutor(executor);
     }
 }
 
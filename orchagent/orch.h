@@ -7,6 +7,7 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <atomic>
 #include <condition_variable>
 
 extern "C" {
@@ -27,6 +28,8 @@ extern "C" {
 #include "recorder.h"
 #include "schema.h"
 #include "retrycache.h"
+#include "ringtask.h"
+#include "syncmap.h"
 
 const char delimiter           = ':';
 const char list_item_delimiter = ',';
@@ -86,18 +89,17 @@ typedef std::map<std::string, std::shared_ptr<object_reference_map>> type_map;
 typedef std::map<std::string, sai_object_id_t> object_map;
 typedef std::pair<std::string, sai_object_id_t> object_map_pair;
 
-// Use multimap to support multiple OpFieldsValues for the same key (e,g, DEL and SET)
-// The order of the key-value pairs whose keys compare equivalent is the order of
-// insertion and does not change. (since C++11)
-typedef std::multimap<std::string, swss::KeyOpFieldsValuesTuple> SyncMap;
+// SyncMap supports multiple OpFieldsValues for the same key (e,g, DEL and SET),
+// see syncmap.h
 
 typedef std::pair<std::string, int> table_name_with_pri_t;
 
 class Orch;
 
-using AnyTask = std::function<void()>; // represents a function with no argument and returns void
+using AnyTask = RingTask; // represents a move-only function with no argument and returns void
 
 class RingBuffer;
+class RingPool;
 
 // Design assumption
 // 1. one Orch can have one or more Executor
@@ -130,6 +132,10 @@ public:
     virtual void execute() { }
     virtual void drain() { }
 
+    // Whether the executor has work for the next scheduling pass, see OrchDaemon::start.
+    // Executors other than consumers are always serviced.
+    virtual bool isDirty() const { return true; }
+
     virtual std::string getName() const
     {
         return m_name;
@@ -137,8 +143,14 @@ public:
 
     Orch *getOrch() const { return m_orch; }
     static std::shared_ptr<RingBuffer> gRingBuffer;
+    static std::shared_ptr<RingPool> gRingPool;
     void processAnyTask(AnyTask&& func);
 
+    // Waits until every ring is idle. The executors run on the main thread
+    // call it before touching the state of the orchs, which the ring
+    // threads may be using.
+    static void waitForRingsIdle();
+
 protected:
     swss::Selectable *m_selectable;
     Orch *m_orch;
@@ -191,23 +203,64 @@ public:
 
     size_t refillToSync();
     size_t refillToSync(swss::Table* table);
+
+    /*
+     * Dirty-consumer scheduling: a consumer is dirty when m_toSync gained tasks
+     * or a constraint in its RetryCache has been resolved.
+     */
+    bool isDirty() const override { return m_dirty; }
+    void markDirty();
+
+    // Re-evaluate the dirty flag after draining, returns true if work is still pending
+    bool refreshDirty();
+
+private:
+    std::atomic<bool> m_dirty{false};
 };
 
+/*
+ * Bounded multi-producer single-consumer ring of tasks.
+ *
+ * Producers claim a slot with a CAS on m_enqueuePos and publish it through
+ * the slot sequence number, the ring thread pops without taking any lock.
+ * The mutex and condition variables are only used to park the ring thread
+ * while the ring is empty and the producers while it is full.
+ */
 class RingBuffer
 {
 private:
-    std::vector<AnyTask> buffer;
-    int head = 0;
-    int tail = 0;
+    struct Slot
+    {
+        std::atomic<size_t> seq;
+        AnyTask task;
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    size_t m_mask;
+    // maximum number of queued tasks, size - 1
+    size_t m_capacity;
+
+    // keep producer and consumer positions on separate cache lines
+    char m_pad0[64];
+    std::atomic<size_t> m_enqueuePos{0};
+    char m_pad1[64];
+    std::atomic<size_t> m_dequeuePos{0};
+    char m_pad2[64];
+
     std::set<std::string> m_consumerSet;
 
     std::condition_variable cv;
+    std::condition_variable m_notFullCv;
     std::mutex mtx;
-    bool idle_status = true;
+    std::atomic<bool> idle_status{true};
+    std::atomic<int> m_waitingProducers{0};
+
+    bool dequeue(AnyTask& entry);
+    void wakeProducers();
 
 public:
     RingBuffer(int size=RING_SIZE);
-    bool thread_created = false;
+    std::atomic<bool> thread_created{false};
     std::atomic<bool> thread_exited{false};
 
     // pause the ring thread if the buffer is empty
@@ -219,14 +272,55 @@ public:
     bool IsEmpty() const;
     bool IsIdle() const;
 
-    bool push(AnyTask entry);
+    // the entry is only consumed when it is queued, returns false if the ring is full
+    bool push(AnyTask&& entry);
+    // queue the entry, waiting for the ring thread to make room while the ring is full
+    void pushWait(AnyTask&& entry);
     bool pop(AnyTask& entry);
+    // move up to maxBatch tasks to the end of batch, returns the number of tasks popped
+    size_t popBatch(std::vector<AnyTask>& batch, size_t maxBatch);
 
     void addExecutor(Executor* executor);
     bool serves(const std::string& tableName);
     void setIdle(bool idle);
 };
 
+/*
+ * Pool of ring threads. Each ring serves one affinity group of tables and is
+ * drained by its own thread: tasks of a group keep their order while
+ * independent groups run in parallel. Groups that depend on each other are
+ * merged into one ring. Executors not served by any ring run in the main
+ * thread once every ring is idle.
+ */
+class RingPool
+{
+private:
+    std::vector<std::vector<std::string>> m_groups;
+    std::vector<std::pair<std::string, std::string>> m_dependencies;
+
+    std::vector<std::shared_ptr<RingBuffer>> m_rings;
+    std::map<std::string, std::shared_ptr<RingBuffer>> m_tableToRing;
+
+public:
+    // Tables of a group are always served by the same ring
+    void addGroup(const std::vector<std::string> &tables);
+    // The orch of 'table' must observe the tasks of 'dependsOn' in order
+    void addDependency(const std::string &table, const std::string &dependsOn);
+    // Merge dependent groups and create one ring per resulting group
+    void build(int size=RING_SIZE);
+
+    const std::vector<std::shared_ptr<RingBuffer>>& getRings() const { return m_rings; }
+    std::shared_ptr<RingBuffer> getRing(const std::string &tableName) const;
+
+    void addExecutor(Executor* executor);
+
+    // true once any ring thread is running
+    bool threadCreated() const;
+    // all rings are empty and idle
+    bool IsIdle() const;
+    void notify();
+};
+
 class Consumer : public ConsumerBase {
 public:
     Consumer(swss::ConsumerTableBase *select, Orch *orch, const std::string &name)
@@ -288,6 +382,9 @@ public:
 
     static std::shared_ptr<RingBuffer> gRingBuffer;
 
+    // Only service dirty consumers, see OrchDaemon::start
+    static bool gDirtyScheduling;
+
     std::vector<swss::Selectable*> getSelectables();
 
     // add the existing table data (left by warm reboot) to the consumer todo task list.
@@ -301,6 +398,12 @@ public:
     /* Iterate all consumers in m_consumerMap and run doTask(Consumer) */
     virtual void doTask();
 
+    /* Run doTask() and re-evaluate which consumers still have pending work */
+    void doDirtyTask();
+
+    void markDirty() { m_dirty = true; }
+    bool isDirty() const { return m_dirty; }
+
     /* Run doTask against a specific executor */
     virtual void doTask(Consumer &consumer) { };
     virtual void doTask(swss::NotificationConsumer &consumer) { }
@@ -356,6 +459,9 @@ protected:
     ConsumerMap m_consumerMap;
     RetryCacheMap m_retryCaches;
 
+    // Set when any consumer of this orch is dirty
+    std::atomic<bool> m_dirty{false};
+
     Orch();
     ref_resolve_status resolveFieldRefValue(type_map&, const std::string&, const std::string&, swss::KeyOpFieldsValuesTuple&, sai_object_id_t&, std::string&);
     std::set<std::string> generateIdListFromMap(unsigned long idsMap, sai_uint32_t maxId);
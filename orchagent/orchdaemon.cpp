@@ -2,6 +2,7 @@
 #include <unordered_map>
 #include <chrono>
 #include <limits.h>
+#include <inttypes.h>
 #include "orchdaemon.h"
 #include "logger.h"
 #include <sairedis.h>
@@ -94,15 +95,8 @@ OrchDaemon::~OrchDaemon()
 {
     SWSS_LOG_ENTER();
 
-    // Stop the ring thread before delete orch pointers
-    if (ring_thread.joinable()) {
-        // notify the ring_thread to exit
-        gRingBuffer->thread_exited = true;
-        gRingBuffer->notify();
-        // wait for the ring_thread to exit
-        ring_thread.join();
-        disableRingBuffer();
-    }
+    // Stop the ring threads before delete orch pointers
+    stopRingThreads();
 
     /*
      * Some orchagents call other agents in their destructor.
@@ -122,48 +116,177 @@ OrchDaemon::~OrchDaemon()
     events_deinit_publisher(g_events_handle);
 }
 
+void OrchDaemon::stopRingThreads()
+{
+    if (!ring_thread.joinable())
+    {
+        return;
+    }
+
+    // notify every ring thread to exit
+    for (auto &ring : gRingPool->getRings())
+    {
+        ring->thread_exited = true;
+        ring->notify();
+    }
+
+    // wait for the ring threads to exit
+    ring_thread.join();
+    for (auto &worker : m_ringWorkers)
+    {
+        worker.join();
+    }
+    m_ringWorkers.clear();
+
+    disableRingBuffer();
+}
+
 void OrchDaemon::popRingBuffer()
+{
+    popRing(gRingBuffer);
+}
+
+void OrchDaemon::popRing(std::shared_ptr<RingBuffer> ring)
 {
     SWSS_LOG_ENTER();
 
-    // make sure there is only one thread created to run popRingBuffer()
-    if (!gRingBuffer || gRingBuffer->thread_created)
+    // make sure there is only one thread created to run each ring
+    if (!ring || ring->thread_created)
         return;
 
-    gRingBuffer->thread_created = true;
-    SWSS_LOG_NOTICE("OrchDaemon starts the popRingBuffer thread!");
+    ring->thread_created = true;
+    SWSS_LOG_NOTICE("OrchDaemon starts the ring thread for ring %p!", (void *)ring.get());
 
-    while (!gRingBuffer->thread_exited)
+    // tasks are popped in batches to release ring slots to the producers early
+    std::vector<AnyTask> batch;
+    batch.reserve(RING_SIZE);
+
+    while (!ring->thread_exited)
     {
-        gRingBuffer->pauseThread();
+        ring->pauseThread();
 
-        gRingBuffer->setIdle(false);
+        ring->setIdle(false);
 
-        AnyTask func;
-        while (gRingBuffer->pop(func)) {
-            func();
+        while (ring->popBatch(batch, RING_SIZE)) {
+            for (auto &func : batch) {
+                func();
+            }
+            batch.clear();
         }
 
-        gRingBuffer->setIdle(true);
+        ring->setIdle(true);
     }
 }
 
+/*
+ * Affinity groups of the ring threads. The tables of one group are served in
+ * order by the same ring thread, different groups are processed in parallel.
+ * The orchs of different groups may only share state that is either owned
+ * by the main thread orchs or locked. The consumers, timers and notifications
+ * of the main thread wait for every ring to be idle before they run, see
+ * Executor::waitForRingsIdle(). The route and DASH rings both update the
+ * CrmOrch "used" counters, which CrmOrch locks, and the next hop ids of
+ * NextHopKeyTable, which are locked too.
+ *
+ * FdbOrch and PfcWdOrch stay on the main thread: they update the ports of
+ * PortsOrch (FDB counts, bridge ports, PFC watchdog queue state) that every
+ * other orch reads, so they can't run next to the main thread orchs.
+ */
+static const vector<vector<string>> ring_affinity_groups = {
+    { APP_ROUTE_TABLE_NAME },
+    { APP_DASH_ROUTE_TABLE_NAME, APP_DASH_ROUTE_RULE_TABLE_NAME, APP_DASH_ROUTE_GROUP_TABLE_NAME },
+    { APP_DASH_VNET_TABLE_NAME, APP_DASH_VNET_MAPPING_TABLE_NAME },
+};
+
+/*
+ * Dependency graph between orch tables, as { table, depends on }. Groups
+ * connected by a dependency are merged into a single ring so that their
+ * relative ordering holds. Tables not listed in any group are processed by
+ * the main thread, which always waits for every ring to become idle.
+ */
+static const vector<pair<string, string>> ring_dependencies = {
+    { APP_ROUTE_TABLE_NAME, APP_NEIGH_TABLE_NAME },
+    { APP_NEIGH_TABLE_NAME, APP_INTF_TABLE_NAME },
+    { APP_INTF_TABLE_NAME, APP_PORT_TABLE_NAME },
+    { APP_LABEL_ROUTE_TABLE_NAME, APP_ROUTE_TABLE_NAME },
+    { APP_DASH_ROUTE_TABLE_NAME, APP_DASH_ENI_TABLE_NAME },
+    { APP_DASH_ROUTE_RULE_TABLE_NAME, APP_DASH_ENI_TABLE_NAME },
+    { APP_DASH_ROUTE_GROUP_TABLE_NAME, APP_DASH_VNET_TABLE_NAME },
+};
+
 /**
- * This function initializes gRingBuffer, otherwise it's nullptr.
+ * This function initializes the ring pool and gRingBuffer, otherwise they're nullptr.
+ * gRingBuffer is the ring serving the route table.
  */
 void OrchDaemon::enableRingBuffer() {
-    gRingBuffer = std::make_shared<RingBuffer>();
+    gRingPool = std::make_shared<RingPool>();
+    for (const auto &group : ring_affinity_groups)
+    {
+        gRingPool->addGroup(group);
+    }
+    for (const auto &dep : ring_dependencies)
+    {
+        gRingPool->addDependency(dep.first, dep.second);
+    }
+    gRingPool->build();
+
+    gRingBuffer = gRingPool->getRing(APP_ROUTE_TABLE_NAME);
+    Executor::gRingPool = gRingPool;
     Executor::gRingBuffer = gRingBuffer;
     Orch::gRingBuffer = gRingBuffer;
-    SWSS_LOG_NOTICE("RingBuffer created at %p!", (void *)gRingBuffer.get());
+    SWSS_LOG_NOTICE("RingBuffer created at %p, %zu rings in pool!", (void *)gRingBuffer.get(), gRingPool->getRings().size());
 }
 
 void OrchDaemon::disableRingBuffer() {
+    gRingPool = nullptr;
     gRingBuffer = nullptr;
+    Executor::gRingPool = nullptr;
     Executor::gRingBuffer = nullptr;
     Orch::gRingBuffer = nullptr;
 }
 
+void OrchDaemon::enableDirtyScheduling()
+{
+    Orch::gDirtyScheduling = true;
+    SWSS_LOG_NOTICE("Dirty-consumer scheduling enabled");
+}
+
+/*
+ * Run the pending tasks of the orchs. With dirty scheduling enabled only the
+ * orchs holding a dirty consumer are serviced, the others are skipped.
+ */
+void OrchDaemon::doOrchTasks()
+{
+    m_schedCounters.serviced = 0;
+    m_schedCounters.skipped = 0;
+
+    for (Orch *o : m_orchList)
+    {
+        if (!Orch::gDirtyScheduling)
+        {
+            o->doTask();
+        }
+        else if (o->isDirty())
+        {
+            o->doDirtyTask();
+        }
+        else
+        {
+            m_schedCounters.skipped++;
+            continue;
+        }
+
+        m_schedCounters.serviced++;
+    }
+
+    m_schedCounters.iterations++;
+    m_schedCounters.totalServiced += m_schedCounters.serviced;
+    m_schedCounters.totalSkipped += m_schedCounters.skipped;
+
+    SWSS_LOG_DEBUG("Scheduler iteration %" PRIu64 ": serviced %zu, skipped %zu orchs",
+            m_schedCounters.iterations, m_schedCounters.serviced, m_schedCounters.skipped);
+}
+
 bool OrchDaemon::init()
 {
     SWSS_LOG_ENTER();
@@ -880,9 +1003,9 @@ void OrchDaemon::flush()
      * Flush would be triggered later after SELECT_TIMEOUT in main thread again
      * for avoiding race condition.
      */
-    if (gRingBuffer &&(!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle()))
+    if (gRingPool && !gRingPool->IsIdle())
     {
-        gRingBuffer->notify();
+        gRingPool->notify();
         SWSS_LOG_WARN("Skip Flush waiting for RingBuffer empty");
     }
     else
@@ -915,6 +1038,16 @@ void OrchDaemon::start(long heartBeatInterval)
     Recorder::Instance().sairedis.setRotate(false);
 
     ring_thread = std::thread(&OrchDaemon::popRingBuffer, this);
+    if (gRingPool)
+    {
+        for (auto &ring : gRingPool->getRings())
+        {
+            if (ring != gRingBuffer)
+            {
+                m_ringWorkers.emplace_back(&OrchDaemon::popRing, this, ring);
+            }
+        }
+    }
 
     for (Orch *o : m_orchList)
     {
@@ -966,16 +1099,15 @@ void OrchDaemon::start(long heartBeatInterval)
              * is a good chance to flush the pipeline  */
             flush();
 
-            if (gRingBuffer)
+            if (gRingPool)
             {
-                if (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle())
+                if (!gRingPool->IsIdle())
                 {
-                    gRingBuffer->notify();
+                    gRingPool->notify();
                 }
                 else
                 {
-                    for (Orch *o : m_orchList)
-                        o->doTask();
+                    doOrchTasks();
                 }
             }
 
@@ -996,10 +1128,9 @@ void OrchDaemon::start(long heartBeatInterval)
         /* After each iteration, periodically check all m_toSync map to
          * execute all the remaining tasks that need to be retried. */
 
-        if (!gRingBuffer || (gRingBuffer->IsEmpty() && gRingBuffer->IsIdle()))
+        if (!gRingPool || gRingPool->IsIdle())
         {
-            for (Orch *o : m_orchList)
-                o->doTask();
+            doOrchTasks();
         }
         /*
          * Asked to check warm restart readiness.
@@ -1013,11 +1144,11 @@ void OrchDaemon::start(long heartBeatInterval)
             {
                 // Orchagent is ready to perform warm restart, stop processing any new db data.
                 // but should finish data that already in the ring
-                if (gRingBuffer)
+                if (gRingPool)
                 {
-                    while (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle())
+                    while (!gRingPool->IsIdle())
                     {
-                        gRingBuffer->notify();
+                        gRingPool->notify();
                         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MSECONDS));
                     }
                 }
@@ -63,6 +63,18 @@
 
 using namespace swss;
 
+/* Per-iteration counters of the main loop orch scheduler */
+struct OrchSchedCounters
+{
+    uint64_t iterations = 0;
+    // Orchs serviced and skipped as clean in the last iteration
+    size_t serviced = 0;
+    size_t skipped = 0;
+    // Totals since start
+    uint64_t totalServiced = 0;
+    uint64_t totalSkipped = 0;
+};
+
 class OrchDaemon
 {
 public:
@@ -92,6 +104,17 @@ public:
     }
     void logRotate();
 
+    /**
+     * Only run doTask() on orchs with dirty consumers after each event,
+     * instead of draining every orch in m_orchList.
+     */
+    void enableDirtyScheduling();
+
+    const OrchSchedCounters& getSchedCounters() const
+    {
+        return m_schedCounters;
+    }
+
     // Two required API to support ring buffer feature
     /**
      * This method is used by a ring buffer consumer [Orchdaemon] to initialzie its ring,
@@ -104,10 +127,15 @@ public:
      * This method describes how the ring consumer consumes this ring.
      */
     void popRingBuffer();
+    void popRing(std::shared_ptr<RingBuffer> ring);
 
+    // Ring serving the route table, also the first ring of gRingPool
     std::shared_ptr<RingBuffer> gRingBuffer = nullptr;
+    std::shared_ptr<RingPool> gRingPool = nullptr;
 
     std::thread ring_thread;
+    // Threads of the other rings in gRingPool
+    std::vector<std::thread> m_ringWorkers;
 
 protected:
     DBConnector *m_applDb;
@@ -122,10 +150,15 @@ protected:
 
     std::vector<Orch *> m_orchList;
     Select *m_select;
+    OrchSchedCounters m_schedCounters;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHeartBeat;
 
     void flush();
 
+    void doOrchTasks();
+
+    void stopRingThreads();
+
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent, long interval);
 
     void freezeAndHeartBeat(unsigned int duration, long interval);
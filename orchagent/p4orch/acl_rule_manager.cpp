@@ -3,6 +3,7 @@
 #include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "SaiAttributeList.h"
@@ -14,6 +15,7 @@
 #include "orch.h"
 #include "p4orch.h"
 #include "p4orch/p4orch_util.h"
+#include "p4orch/p4preparepool.h"
 #include "portsorch.h"
 #include "sai_serialize.h"
 #include "table.h"
@@ -163,6 +165,55 @@ std::vector<sai_attribute_t> getMeterSaiAttrs(const P4AclMeter &p4_acl_meter)
     return meter_attrs;
 }
 
+// Creates the objects of one type in a single SAI call, the objects after the
+// first failure are not created.
+std::vector<sai_status_t> createObjects(sai_object_type_t object_type,
+                                        const std::vector<std::vector<sai_attribute_t>> &attrs,
+                                        std::vector<sai_object_id_t> &oids)
+{
+    std::vector<sai_status_t> object_statuses(attrs.size(), SAI_STATUS_NOT_EXECUTED);
+    oids.assign(attrs.size(), SAI_NULL_OBJECT_ID);
+    if (attrs.empty())
+    {
+        return object_statuses;
+    }
+    std::vector<uint32_t> attrs_cnt;
+    std::vector<const sai_attribute_t *> attrs_ptr;
+    for (const auto &object_attrs : attrs)
+    {
+        attrs_cnt.push_back(static_cast<uint32_t>(object_attrs.size()));
+        attrs_ptr.push_back(object_attrs.data());
+    }
+    sai_bulk_object_create(gSwitchId, object_type, static_cast<uint32_t>(attrs.size()), attrs_cnt.data(),
+                           attrs_ptr.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, oids.data(),
+                           object_statuses.data());
+    return object_statuses;
+}
+
+// Removes the objects of one type in a single SAI call.
+std::vector<sai_status_t> removeObjects(sai_object_type_t object_type, const std::vector<sai_object_id_t> &oids,
+                                        sai_bulk_op_error_mode_t mode)
+{
+    std::vector<sai_status_t> object_statuses(oids.size(), SAI_STATUS_NOT_EXECUTED);
+    if (oids.empty())
+    {
+        return object_statuses;
+    }
+    sai_bulk_object_remove(object_type, static_cast<uint32_t>(oids.size()), oids.data(), mode,
+                           object_statuses.data());
+    return object_statuses;
+}
+
+// ACL rule of a drain parsed by the prepare phase.
+struct PreparedAclRule
+{
+    std::string table_name;
+    std::string db_key;
+    ReturnCode status;
+    P4AclRuleAppDbEntry app_db_entry;
+    P4Key acl_rule_key;
+};
+
 } // namespace
 
 ReturnCode AclRuleManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
@@ -183,24 +234,47 @@ void AclRuleManager::drainWithNotExecuted() {
 ReturnCode AclRuleManager::drain() {
   SWSS_LOG_ENTER();
 
+  std::vector<P4AclRuleAppDbEntry> entry_list;
+  std::vector<P4Key> rule_key_list;
+  std::vector<swss::KeyOpFieldsValuesTuple> tuple_list;
+  std::unordered_set<P4Key> rule_list;
+
+  // The rules are parsed in parallel, the ACL tables they use are not changed
+  // during the drain. Their validation depends on the previous rules of the
+  // drain and runs in order with the SAI calls.
+  std::vector<PreparedAclRule> prepared_rules(m_entries.size());
+  P4PreparePool::instance().run(m_entries.size(), [&](size_t i) {
+    auto& prepared_rule = prepared_rules[i];
+    parseP4RTKey(kfvKey(m_entries[i]), &prepared_rule.table_name,
+                 &prepared_rule.db_key);
+    auto app_db_entry_or = deserializeAclRuleAppDbEntry(
+        prepared_rule.table_name, prepared_rule.db_key,
+        kfvFieldsValues(m_entries[i]));
+    if (!app_db_entry_or.ok()) {
+      prepared_rule.status = app_db_entry_or.status();
+      return;
+    }
+    prepared_rule.app_db_entry = std::move(*app_db_entry_or);
+    prepared_rule.acl_rule_key = KeyGenerator::generateAclRuleKey(
+        prepared_rule.app_db_entry.match_fvs,
+        prepared_rule.app_db_entry.priority);
+  });
+
   ReturnCode status;
-  while (!m_entries.empty()) {
-    auto key_op_fvs_tuple = m_entries.front();
+  std::string prev_op;
+  bool prev_update = false;
+  for (size_t i = 0; !m_entries.empty(); i++) {
+    auto key_op_fvs_tuple = std::move(m_entries.front());
     m_entries.pop_front();
-    std::string table_name;
-    std::string db_key;
-    parseP4RTKey(kfvKey(key_op_fvs_tuple), &table_name, &db_key);
+    const auto& table_name = prepared_rules[i].table_name;
+    const auto& db_key = prepared_rules[i].db_key;
     const auto& op = kfvOp(key_op_fvs_tuple);
-    const std::vector<swss::FieldValueTuple>& attributes =
-        kfvFieldsValues(key_op_fvs_tuple);
 
     SWSS_LOG_NOTICE("OP: %s, RULE_KEY: %s", op.c_str(),
                     QuotedVar(db_key).c_str());
 
-    auto app_db_entry_or =
-        deserializeAclRuleAppDbEntry(table_name, db_key, attributes);
-    if (!app_db_entry_or.ok()) {
-      status = app_db_entry_or.status();
+    if (!prepared_rules[i].status.ok()) {
+      status = prepared_rules[i].status;
       SWSS_LOG_ERROR("Unable to deserialize APP DB entry with key %s: %s",
                      QuotedVar(table_name + ":" + db_key).c_str(),
                      status.message().c_str());
@@ -209,7 +283,7 @@ ReturnCode AclRuleManager::drain() {
                            /*replace=*/true);
       break;
     }
-    auto& app_db_entry = *app_db_entry_or;
+    auto& app_db_entry = prepared_rules[i].app_db_entry;
 
     status = validateAclRuleAppDbEntry(app_db_entry);
     if (!status.ok()) {
@@ -223,36 +297,437 @@ ReturnCode AclRuleManager::drain() {
       break;
     }
 
-    const auto& acl_table_name = app_db_entry.acl_table_name;
-    const auto& acl_rule_key = KeyGenerator::generateAclRuleKey(
-        app_db_entry.match_fvs, std::to_string(app_db_entry.priority));
-
     const auto& operation = kfvOp(key_op_fvs_tuple);
-    if (operation == SET_COMMAND) {
-      auto* acl_rule = getAclRule(acl_table_name, acl_rule_key);
-      if (acl_rule == nullptr) {
-        status = processAddRuleRequest(acl_rule_key, app_db_entry);
-      } else {
-        status = processUpdateRuleRequest(app_db_entry, *acl_rule);
-      }
-    } else if (operation == DEL_COMMAND) {
-      status = processDeleteRuleRequest(acl_table_name, acl_rule_key);
-    } else {
+    if (operation != SET_COMMAND && operation != DEL_COMMAND) {
       status = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
                << "Unknown operation type " << operation;
       SWSS_LOG_ERROR("%s", status.message().c_str());
+      m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
+                           kfvFieldsValues(key_op_fvs_tuple), status,
+                           /*replace=*/true);
+      break;
     }
-    m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
-                         kfvFieldsValues(key_op_fvs_tuple), status,
-                         /*replace=*/true);
+
+    const auto& acl_table_name = app_db_entry.acl_table_name;
+    auto& acl_rule_key = prepared_rules[i].acl_rule_key;
+
+    // The operation on a rule depends on the previous operations on the same
+    // rule, process them before.
+    const auto& table_name_and_rule_key =
+        KeyGenerator::generateAclTableRuleKey(acl_table_name, acl_rule_key);
+    if (rule_list.count(table_name_and_rule_key) != 0) {
+      status = processRuleEntries(entry_list, rule_key_list, tuple_list,
+                                  prev_op, prev_update);
+      entry_list.clear();
+      rule_key_list.clear();
+      tuple_list.clear();
+      rule_list.clear();
+      prev_op = "";
+    }
+
+    bool update = (operation == SET_COMMAND) &&
+                  (getAclRule(acl_table_name, acl_rule_key) != nullptr);
+    if (prev_op == "") {
+      prev_op = operation;
+      prev_update = update;
+    }
+    // Process the entries if the operation type changes.
+    if (operation != prev_op || update != prev_update) {
+      status = processRuleEntries(entry_list, rule_key_list, tuple_list,
+                                  prev_op, prev_update);
+      entry_list.clear();
+      rule_key_list.clear();
+      tuple_list.clear();
+      rule_list.clear();
+      prev_op = operation;
+      prev_update = update;
+    }
+
     if (!status.ok()) {
+      // Return SWSS_RC_NOT_EXECUTED if failure has occured.
+      m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
+                           kfvFieldsValues(key_op_fvs_tuple),
+                           ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED),
+                           /*replace=*/true);
       break;
     }
+
+    rule_list.insert(table_name_and_rule_key);
+    entry_list.push_back(std::move(app_db_entry));
+    rule_key_list.push_back(std::move(acl_rule_key));
+    tuple_list.push_back(std::move(key_op_fvs_tuple));
   }
+
+  if (!entry_list.empty()) {
+    auto rc = processRuleEntries(entry_list, rule_key_list, tuple_list,
+                                 prev_op, prev_update);
+    if (!rc.ok()) {
+      status = rc;
+    }
+  }
+  // Removes the counters of the deleted rules.
+  m_countersTable->flush();
   drainWithNotExecuted();
   return status;
 }
 
+ReturnCode AclRuleManager::processRuleEntries(
+    const std::vector<P4AclRuleAppDbEntry>& entries,
+    const std::vector<P4Key>& rule_keys,
+    const std::vector<swss::KeyOpFieldsValuesTuple>& tuple_list,
+    const std::string& op, bool update) {
+  SWSS_LOG_ENTER();
+
+  // Same as the bulk SAI calls of the other managers, in mode
+  // SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR: the entries after the first failure
+  // are not executed.
+  std::vector<ReturnCode> statuses;
+  if (op == SET_COMMAND && !update) {
+    statuses = addAclRules(entries, rule_keys);
+  } else if (op == SET_COMMAND) {
+    ReturnCode rc;
+    for (size_t i = 0; i < entries.size(); ++i) {
+      if (rc.ok()) {
+        rc = processUpdateRuleRequest(
+            entries[i], *getAclRule(entries[i].acl_table_name, rule_keys[i]));
+        statuses.push_back(rc);
+      } else {
+        statuses.push_back(ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+      }
+    }
+  } else {
+    statuses = removeAclRules(entries, rule_keys);
+  }
+
+  ReturnCode status;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(tuple_list[i]),
+                         kfvFieldsValues(tuple_list[i]), statuses[i],
+                         /*replace=*/true);
+    if (status.ok() && !statuses[i].ok()) {
+      status = statuses[i];
+    }
+  }
+
+  return status;
+}
+
+std::vector<ReturnCode> AclRuleManager::addAclRules(const std::vector<P4AclRuleAppDbEntry> &entries,
+                                                    const std::vector<P4Key> &rule_keys)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<P4AclRule> acl_rules;
+    ReturnCode status;
+    for (size_t i = 0; i < entries.size() && status.ok(); ++i)
+    {
+        P4AclRule acl_rule{};
+        status = prepareAclRule(rule_keys[i], entries[i], acl_rule);
+        if (status.ok())
+        {
+            acl_rules.push_back(std::move(acl_rule));
+        }
+    }
+
+    auto statuses = createAclRules(acl_rules);
+    statuses.resize(entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+    for (size_t i = 0; i < acl_rules.size(); ++i)
+    {
+        if (!statuses[i].ok())
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule with key %s in table %s",
+                           QuotedVar(acl_rules[i].acl_rule_key).c_str(),
+                           QuotedVar(acl_rules[i].acl_table_name).c_str());
+            return statuses;
+        }
+        insertAclRule(std::move(acl_rules[i]));
+    }
+    if (!status.ok())
+    {
+        statuses[acl_rules.size()] = status;
+    }
+    return statuses;
+}
+
+std::vector<ReturnCode> AclRuleManager::createAclRules(std::vector<P4AclRule> &acl_rules)
+{
+    SWSS_LOG_ENTER();
+
+    // The rules before the first failure are created.
+    size_t num_created = acl_rules.size();
+    ReturnCode failure;
+
+    // The meters and the counters are created first, the entries refer to them.
+    std::vector<size_t> meter_rules;
+    std::vector<std::vector<sai_attribute_t>> meter_attrs;
+    for (size_t i = 0; i < acl_rules.size(); ++i)
+    {
+        if (acl_rules[i].meter.enabled)
+        {
+            meter_rules.push_back(i);
+            meter_attrs.push_back(getMeterSaiAttrs(acl_rules[i].meter));
+        }
+    }
+    std::vector<sai_object_id_t> meter_oids;
+    auto meter_statuses = createObjects(SAI_OBJECT_TYPE_POLICER, meter_attrs, meter_oids);
+    for (size_t j = 0; j < meter_rules.size(); ++j)
+    {
+        if (meter_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            num_created = meter_rules[j];
+            failure = ReturnCode(meter_statuses[j])
+                      << "Failed to create ACL meter for rule " << QuotedVar(acl_rules[num_created].acl_rule_key);
+            SWSS_LOG_ERROR("%s SAI_STATUS: %s", failure.message().c_str(),
+                           sai_serialize_status(meter_statuses[j]).c_str());
+            break;
+        }
+        acl_rules[meter_rules[j]].meter.meter_oid = meter_oids[j];
+    }
+
+    std::vector<size_t> counter_rules;
+    std::vector<std::vector<sai_attribute_t>> counter_attrs;
+    for (size_t i = 0; i < num_created; ++i)
+    {
+        if (acl_rules[i].counter.packets_enabled || acl_rules[i].counter.bytes_enabled)
+        {
+            counter_rules.push_back(i);
+            counter_attrs.push_back(getCounterSaiAttrs(acl_rules[i]));
+        }
+    }
+    std::vector<sai_object_id_t> counter_oids;
+    auto counter_statuses = createObjects(SAI_OBJECT_TYPE_ACL_COUNTER, counter_attrs, counter_oids);
+    for (size_t j = 0; j < counter_rules.size(); ++j)
+    {
+        if (counter_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            num_created = counter_rules[j];
+            failure = ReturnCode(counter_statuses[j])
+                      << "Faied to create counter for the rule in table "
+                      << QuotedVar(acl_rules[num_created].acl_table_name);
+            SWSS_LOG_ERROR("%s SAI_STATUS: %s", failure.message().c_str(),
+                           sai_serialize_status(counter_statuses[j]).c_str());
+            break;
+        }
+        acl_rules[counter_rules[j]].counter.counter_oid = counter_oids[j];
+    }
+
+    std::vector<std::vector<sai_attribute_t>> entry_attrs;
+    for (size_t i = 0; i < num_created; ++i)
+    {
+        entry_attrs.push_back(getRuleSaiAttrs(acl_rules[i]));
+    }
+    std::vector<sai_object_id_t> entry_oids;
+    auto entry_statuses = createObjects(SAI_OBJECT_TYPE_ACL_ENTRY, entry_attrs, entry_oids);
+    for (size_t i = 0; i < entry_statuses.size(); ++i)
+    {
+        if (entry_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            num_created = i;
+            failure = ReturnCode(entry_statuses[i])
+                      << "Failed to create ACL entry in table " << QuotedVar(acl_rules[i].acl_table_name);
+            SWSS_LOG_ERROR("%s SAI_STATUS: %s", failure.message().c_str(),
+                           sai_serialize_status(entry_statuses[i]).c_str());
+            break;
+        }
+        acl_rules[i].acl_entry_oid = entry_oids[i];
+    }
+
+    // Removes the meters and the counters of the rules which are not created.
+    std::vector<sai_object_id_t> rollback_oids;
+    for (size_t j = 0; j < meter_rules.size(); ++j)
+    {
+        if (meter_rules[j] >= num_created && meter_statuses[j] == SAI_STATUS_SUCCESS)
+        {
+            rollback_oids.push_back(meter_oids[j]);
+        }
+    }
+    for (auto object_status :
+         removeObjects(SAI_OBJECT_TYPE_POLICER, rollback_oids, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR))
+    {
+        if (object_status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_RAISE_CRITICAL_STATE("Failed to remove ACL meter in recovery.");
+        }
+    }
+    rollback_oids.clear();
+    for (size_t j = 0; j < counter_rules.size(); ++j)
+    {
+        if (counter_rules[j] >= num_created && counter_statuses[j] == SAI_STATUS_SUCCESS)
+        {
+            rollback_oids.push_back(counter_oids[j]);
+        }
+    }
+    for (auto object_status :
+         removeObjects(SAI_OBJECT_TYPE_ACL_COUNTER, rollback_oids, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR))
+    {
+        if (object_status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_RAISE_CRITICAL_STATE("Failed to remove ACL counter in recovery.");
+        }
+    }
+
+    std::vector<ReturnCode> statuses(acl_rules.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+    for (size_t i = 0; i < num_created; ++i)
+    {
+        const auto &acl_rule = acl_rules[i];
+        const auto &table_name_and_rule_key =
+            KeyGenerator::generateAclTableRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
+        if (acl_rule.meter.enabled)
+        {
+            m_p4OidMapper->setOID(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_key, acl_rule.meter.meter_oid);
+        }
+        if (acl_rule.counter.packets_enabled || acl_rule.counter.bytes_enabled)
+        {
+            m_p4OidMapper->setOID(SAI_OBJECT_TYPE_ACL_COUNTER, table_name_and_rule_key, acl_rule.counter.counter_oid);
+            gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, acl_rule.acl_table_oid);
+            m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ACL_TABLE, acl_rule.acl_table_name);
+        }
+        statuses[i] = ReturnCode();
+    }
+    if (num_created < acl_rules.size())
+    {
+        statuses[num_created] = failure;
+    }
+    return statuses;
+}
+
+std::vector<ReturnCode> AclRuleManager::removeAclRules(const std::vector<P4AclRuleAppDbEntry> &entries,
+                                                       const std::vector<P4Key> &rule_keys)
+{
+    SWSS_LOG_ENTER();
+
+    ReturnCode failure;
+    std::vector<P4AclRule *> acl_rules;
+    std::vector<P4Key> table_name_and_rule_keys;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        failure = validateAclRuleRemoval(entries[i].acl_table_name, rule_keys[i]);
+        if (!failure.ok())
+        {
+            break;
+        }
+        acl_rules.push_back(getAclRule(entries[i].acl_table_name, rule_keys[i]));
+        table_name_and_rule_keys.push_back(
+            KeyGenerator::generateAclTableRuleKey(entries[i].acl_table_name, rule_keys[i]));
+    }
+    // The rules before the first failure are removed.
+    size_t num_removed = acl_rules.size();
+
+    std::vector<sai_object_id_t> entry_oids;
+    for (const auto *acl_rule : acl_rules)
+    {
+        entry_oids.push_back(acl_rule->acl_entry_oid);
+    }
+    auto entry_statuses = removeObjects(SAI_OBJECT_TYPE_ACL_ENTRY, entry_oids, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR);
+    for (size_t i = 0; i < entry_statuses.size(); ++i)
+    {
+        if (entry_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            num_removed = i;
+            failure = ReturnCode(entry_statuses[i])
+                      << "Failed to remove ACL rule with key " << sai_serialize_object_id(entry_oids[i])
+                      << " in table " << QuotedVar(entries[i].acl_table_name);
+            SWSS_LOG_ERROR("%s SAI_STATUS: %s", failure.message().c_str(),
+                           sai_serialize_status(entry_statuses[i]).c_str());
+            break;
+        }
+    }
+    const size_t num_entries_removed = num_removed;
+
+    std::vector<size_t> meter_rules;
+    std::vector<sai_object_id_t> meter_oids;
+    for (size_t i = 0; i < num_entries_removed; ++i)
+    {
+        if (acl_rules[i]->meter.enabled)
+        {
+            m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_keys[i]);
+            meter_rules.push_back(i);
+            meter_oids.push_back(acl_rules[i]->meter.meter_oid);
+        }
+    }
+    auto meter_statuses = removeObjects(SAI_OBJECT_TYPE_POLICER, meter_oids, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR);
+    for (size_t j = 0; j < meter_rules.size(); ++j)
+    {
+        if (meter_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            num_removed = meter_rules[j];
+            failure = ReturnCode(meter_statuses[j])
+                      << "Failed to remove ACL meter for ACL rule " << QuotedVar(table_name_and_rule_keys[num_removed]);
+            SWSS_LOG_ERROR("%s SAI_STATUS: %s", failure.message().c_str(),
+                           sai_serialize_status(meter_statuses[j]).c_str());
+            break;
+        }
+        m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_keys[meter_rules[j]]);
+        acl_rules[meter_rules[j]]->meter.meter_oid = SAI_NULL_OBJECT_ID;
+    }
+    const size_t num_meters_removed = num_removed;
+
+    std::vector<size_t> counter_rules;
+    std::vector<sai_object_id_t> counter_oids;
+    for (size_t i = 0; i < num_meters_removed; ++i)
+    {
+        if (acl_rules[i]->counter.packets_enabled || acl_rules[i]->counter.bytes_enabled)
+        {
+            m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ACL_COUNTER, table_name_and_rule_keys[i]);
+            counter_rules.push_back(i);
+            counter_oids.push_back(acl_rules[i]->counter.counter_oid);
+        }
+    }
+    auto counter_statuses =
+        removeObjects(SAI_OBJECT_TYPE_ACL_COUNTER, counter_oids, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR);
+    for (size_t j = 0; j < counter_rules.size(); ++j)
+    {
+        auto *acl_rule = acl_rules[counter_rules[j]];
+        if (counter_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            num_removed = counter_rules[j];
+            failure = ReturnCode(counter_statuses[j])
+                      << "Failed to remove ACL counter " << sai_serialize_object_id(counter_oids[j]) << " in table "
+                      << QuotedVar(acl_rule->acl_table_name);
+            SWSS_LOG_ERROR("%s SAI_STATUS: %s", failure.message().c_str(),
+                           sai_serialize_status(counter_statuses[j]).c_str());
+            break;
+        }
+        gCrmOrch->decCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, acl_rule->acl_table_oid);
+        m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_ACL_COUNTER, table_name_and_rule_keys[counter_rules[j]]);
+        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ACL_TABLE, acl_rule->acl_table_name);
+        acl_rule->counter.counter_oid = SAI_NULL_OBJECT_ID;
+    }
+
+    // The rules from the failure on lost their entry, and maybe their meter and
+    // counter: create them back.
+    for (size_t i = num_removed; i < num_entries_removed; ++i)
+    {
+        auto *acl_rule = acl_rules[i];
+        if (!createAclRule(*acl_rule).ok())
+        {
+            SWSS_RAISE_CRITICAL_STATE("Failed to create ACL rule in recovery.");
+        }
+        if (acl_rule->meter.enabled)
+        {
+            m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_keys[i]);
+        }
+        if ((acl_rule->counter.packets_enabled || acl_rule->counter.bytes_enabled) && i < num_meters_removed)
+        {
+            m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ACL_COUNTER, table_name_and_rule_keys[i]);
+        }
+    }
+
+    std::vector<ReturnCode> statuses(entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+    for (size_t i = 0; i < num_removed; ++i)
+    {
+        eraseAclRule(entries[i].acl_table_name, rule_keys[i]);
+        statuses[i] = ReturnCode();
+    }
+    if (num_removed < entries.size())
+    {
+        SWSS_LOG_ERROR("Failed to remove ACL rule with key %s in table %s", QuotedVar(rule_keys[num_removed]).c_str(),
+                       QuotedVar(entries[num_removed].acl_table_name).c_str());
+        statuses[num_removed] = failure;
+    }
+    return statuses;
+}
+
 ReturnCode AclRuleManager::setUpUserDefinedTraps()
 {
     SWSS_LOG_ENTER();
@@ -367,9 +842,11 @@ void AclRuleManager::doAclCounterStatsTask()
             }
         }
     }
+    // Write the changed counters of all rules in a single round trip.
+    m_countersTable->flush();
 }
 
-ReturnCode AclRuleManager::createAclCounter(const std::string &acl_table_name, const std::string &counter_key,
+ReturnCode AclRuleManager::createAclCounter(const std::string &acl_table_name, const P4Key &counter_key,
                                             const P4AclRule &acl_rule, sai_object_id_t *counter_oid)
 {
     SWSS_LOG_ENTER();
@@ -386,7 +863,7 @@ ReturnCode AclRuleManager::createAclCounter(const std::string &acl_table_name, c
     return ReturnCode();
 }
 
-ReturnCode AclRuleManager::removeAclCounter(const std::string &acl_table_name, const std::string &counter_key)
+ReturnCode AclRuleManager::removeAclCounter(const std::string &acl_table_name, const P4Key &counter_key)
 {
     SWSS_LOG_ENTER();
     sai_object_id_t counter_oid;
@@ -413,7 +890,7 @@ ReturnCode AclRuleManager::removeAclCounter(const std::string &acl_table_name, c
     return ReturnCode();
 }
 
-ReturnCode AclRuleManager::createAclMeter(const P4AclMeter &p4_acl_meter, const std::string &meter_key,
+ReturnCode AclRuleManager::createAclMeter(const P4AclMeter &p4_acl_meter, const P4Key &meter_key,
                                           sai_object_id_t *meter_oid)
 {
     SWSS_LOG_ENTER();
@@ -532,7 +1009,7 @@ ReturnCode AclRuleManager::updateAclMeter(const P4AclMeter &new_acl_meter, const
     return ReturnCode();
 }
 
-ReturnCode AclRuleManager::removeAclMeter(const std::string &meter_key)
+ReturnCode AclRuleManager::removeAclMeter(const P4Key &meter_key)
 {
     SWSS_LOG_ENTER();
     sai_object_id_t meter_oid;
@@ -668,13 +1145,15 @@ ReturnCode AclRuleManager::validateAclRuleAppDbEntry(const P4AclRuleAppDbEntry &
     return ReturnCode();
 }
 
-P4AclRule *AclRuleManager::getAclRule(const std::string &acl_table_name, const std::string &acl_rule_key)
+P4AclRule *AclRuleManager::getAclRule(const std::string &acl_table_name, const P4Key &acl_rule_key)
 {
-    if (m_aclRuleTables[acl_table_name].find(acl_rule_key) == m_aclRuleTables[acl_table_name].end())
+    auto &acl_rules = m_aclRuleTables[acl_table_name];
+    auto it = acl_rules.find(acl_rule_key);
+    if (it == acl_rules.end())
     {
         return nullptr;
     }
-    return &m_aclRuleTables[acl_table_name][acl_rule_key];
+    return &it->second;
 }
 
 ReturnCode AclRuleManager::setAclRuleCounterStats(const P4AclRule &acl_rule)
@@ -755,8 +1234,13 @@ ReturnCode AclRuleManager::setAclRuleCounterStats(const P4AclRule &acl_rule)
         }
     }
 
-    // Set field value tuples for counters stats in COUNTERS_DB
-    m_countersTable->set(acl_rule.db_key, counter_stats_values);
+    // Set field value tuples for counters stats in COUNTERS_DB, if they changed
+    auto &last_stats_values = m_countersStats[acl_rule.db_key];
+    if (last_stats_values != counter_stats_values)
+    {
+        m_countersTable->set(acl_rule.db_key, counter_stats_values);
+        last_stats_values = std::move(counter_stats_values);
+    }
     return ReturnCode();
 }
 
@@ -1519,7 +2003,8 @@ ReturnCode AclRuleManager::createAclRule(P4AclRule &acl_rule)
     // Track if the entry creates a new counter or meter
     bool created_meter = false;
     bool created_counter = false;
-    const auto &table_name_and_rule_key = concatTableNameAndRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
+    const auto &table_name_and_rule_key =
+        KeyGenerator::generateAclTableRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
 
     // Add meter
     if (acl_rule.meter.enabled)
@@ -1708,7 +2193,7 @@ ReturnCode AclRuleManager::updateAclRule(const P4AclRule &acl_rule, const P4AclR
     return ReturnCode();
 }
 
-ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, const std::string &acl_rule_key)
+ReturnCode AclRuleManager::validateAclRuleRemoval(const std::string &acl_table_name, const P4Key &acl_rule_key)
 {
     auto *acl_rule = getAclRule(acl_table_name, acl_rule_key);
     if (acl_rule == nullptr)
@@ -1717,7 +2202,7 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
                              << "ACL rule with key " << QuotedVar(acl_rule_key) << " in table "
                              << QuotedVar(acl_table_name) << " does not exist");
     }
-    const auto &table_name_and_rule_key = concatTableNameAndRuleKey(acl_table_name, acl_rule_key);
+    const auto &table_name_and_rule_key = KeyGenerator::generateAclTableRuleKey(acl_table_name, acl_rule_key);
     // Check if there is anything referring to the next hop before deletion.
     uint32_t ref_count;
     if (!m_p4OidMapper->getRefCount(SAI_OBJECT_TYPE_ACL_ENTRY, table_name_and_rule_key, &ref_count))
@@ -1731,6 +2216,57 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
                              << "ACL rule " << QuotedVar(acl_rule_key)
                              << " referenced by other objects (ref_count = " << ref_count << ")");
     }
+    return ReturnCode();
+}
+
+void AclRuleManager::eraseAclRule(const std::string &acl_table_name, const P4Key &acl_rule_key)
+{
+    auto *acl_rule = getAclRule(acl_table_name, acl_rule_key);
+    if (acl_rule->counter.packets_enabled || acl_rule->counter.bytes_enabled)
+    {
+        // Remove counter stats
+        m_countersTable->del(acl_rule->db_key);
+        m_countersStats.erase(acl_rule->db_key);
+    }
+    gCrmOrch->decCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, acl_rule->acl_table_oid);
+    if (!acl_rule->action_redirect_nexthop_key.empty())
+    {
+        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, acl_rule->action_redirect_nexthop_key);
+    }
+    for (const auto &mirror_session : acl_rule->action_mirror_sessions)
+    {
+        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_MIRROR_SESSION, fvValue(mirror_session).key);
+    }
+    auto set_vrf_action_it = acl_rule->action_fvs.find(SAI_ACL_ENTRY_ATTR_ACTION_SET_VRF);
+    if (set_vrf_action_it != acl_rule->action_fvs.end())
+    {
+        m_vrfOrch->decreaseVrfRefCount(set_vrf_action_it->second.aclaction.parameter.oid);
+    }
+    auto set_user_trap_it = acl_rule->action_fvs.find(SAI_ACL_ENTRY_ATTR_ACTION_SET_USER_TRAP_ID);
+    if (set_user_trap_it != acl_rule->action_fvs.end())
+    {
+        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_HOSTIF_USER_DEFINED_TRAP,
+                                        std::to_string(acl_rule->action_qos_queue_num));
+    }
+    for (const auto &port_alias : acl_rule->in_ports)
+    {
+        gPortsOrch->decreasePortRefCount(port_alias);
+    }
+    for (const auto &port_alias : acl_rule->out_ports)
+    {
+        gPortsOrch->decreasePortRefCount(port_alias);
+    }
+    m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ACL_TABLE, acl_table_name);
+    m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_ACL_ENTRY,
+                            KeyGenerator::generateAclTableRuleKey(acl_table_name, acl_rule_key));
+    m_aclRuleTables[acl_table_name].erase(acl_rule_key);
+}
+
+ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, const P4Key &acl_rule_key)
+{
+    RETURN_IF_ERROR(validateAclRuleRemoval(acl_table_name, acl_rule_key));
+    auto *acl_rule = getAclRule(acl_table_name, acl_rule_key);
+    const auto &table_name_and_rule_key = KeyGenerator::generateAclTableRuleKey(acl_table_name, acl_rule_key);
 
     CHECK_ERROR_AND_LOG_AND_RETURN(sai_acl_api->remove_acl_entry(acl_rule->acl_entry_oid),
                                    "Failed to remove ACL rule with key "
@@ -1782,47 +2318,14 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
             }
             return status;
         }
-        // Remove counter stats
-        m_countersTable->del(acl_rule->db_key);
     }
-    gCrmOrch->decCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, acl_rule->acl_table_oid);
-    if (!acl_rule->action_redirect_nexthop_key.empty())
-    {
-        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, acl_rule->action_redirect_nexthop_key);
-    }
-    for (const auto &mirror_session : acl_rule->action_mirror_sessions)
-    {
-        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_MIRROR_SESSION, fvValue(mirror_session).key);
-    }
-    auto set_vrf_action_it = acl_rule->action_fvs.find(SAI_ACL_ENTRY_ATTR_ACTION_SET_VRF);
-    if (set_vrf_action_it != acl_rule->action_fvs.end())
-    {
-        m_vrfOrch->decreaseVrfRefCount(set_vrf_action_it->second.aclaction.parameter.oid);
-    }
-    auto set_user_trap_it = acl_rule->action_fvs.find(SAI_ACL_ENTRY_ATTR_ACTION_SET_USER_TRAP_ID);
-    if (set_user_trap_it != acl_rule->action_fvs.end())
-    {
-        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_HOSTIF_USER_DEFINED_TRAP,
-                                        std::to_string(acl_rule->action_qos_queue_num));
-    }
-    for (const auto &port_alias : acl_rule->in_ports)
-    {
-        gPortsOrch->decreasePortRefCount(port_alias);
-    }
-    for (const auto &port_alias : acl_rule->out_ports)
-    {
-        gPortsOrch->decreasePortRefCount(port_alias);
-    }
-    m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ACL_TABLE, acl_table_name);
-    m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_ACL_ENTRY, table_name_and_rule_key);
-    m_aclRuleTables[acl_table_name].erase(acl_rule_key);
+    eraseAclRule(acl_table_name, acl_rule_key);
     return ReturnCode();
 }
 
-ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key,
-                                                 const P4AclRuleAppDbEntry &app_db_entry)
+ReturnCode AclRuleManager::prepareAclRule(const P4Key &acl_rule_key, const P4AclRuleAppDbEntry &app_db_entry,
+                                          P4AclRule &acl_rule)
 {
-    P4AclRule acl_rule{};
     acl_rule.priority = app_db_entry.priority;
     acl_rule.acl_rule_key = acl_rule_key;
     acl_rule.p4_action = app_db_entry.action;
@@ -1868,13 +2371,11 @@ ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key
                                  << "Invalid ACL counter type " << QuotedVar(acl_table->counter_unit));
         }
     }
-    status = createAclRule(acl_rule);
-    if (!status.ok())
-    {
-        SWSS_LOG_ERROR("Failed to create ACL rule with key %s in table %s", QuotedVar(acl_rule.acl_rule_key).c_str(),
-                       QuotedVar(app_db_entry.acl_table_name).c_str());
-        return status;
-    }
+    return ReturnCode();
+}
+
+void AclRuleManager::insertAclRule(P4AclRule &&acl_rule)
+{
     // ACL entry created in HW, update refcount
     if (!acl_rule.action_redirect_nexthop_key.empty())
     {
@@ -1905,7 +2406,8 @@ ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key
     }
     gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, acl_rule.acl_table_oid);
     m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ACL_TABLE, acl_rule.acl_table_name);
-    const auto &table_name_and_rule_key = concatTableNameAndRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
+    const auto &table_name_and_rule_key =
+        KeyGenerator::generateAclTableRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
     m_p4OidMapper->setOID(SAI_OBJECT_TYPE_ACL_ENTRY, table_name_and_rule_key, acl_rule.acl_entry_oid);
     if (acl_rule.counter.packets_enabled || acl_rule.counter.bytes_enabled)
     {
@@ -1917,14 +2419,30 @@ ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key
         // Meter was created, increase ACL rule ref count
         m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_key);
     }
-    m_aclRuleTables[acl_table->acl_table_name][acl_rule_key] = std::move(acl_rule);
-    SWSS_LOG_NOTICE(
-        "Suceeded to create ACL rule %s : %s", QuotedVar(acl_rule_key).c_str(),
-        sai_serialize_object_id(m_aclRuleTables[acl_table->acl_table_name][acl_rule_key].acl_entry_oid).c_str());
+    SWSS_LOG_NOTICE("Suceeded to create ACL rule %s : %s", QuotedVar(acl_rule.acl_rule_key).c_str(),
+                    sai_serialize_object_id(acl_rule.acl_entry_oid).c_str());
+    auto &acl_rule_table = m_aclRuleTables[acl_rule.acl_table_name];
+    auto acl_rule_key = acl_rule.acl_rule_key;
+    acl_rule_table[std::move(acl_rule_key)] = std::move(acl_rule);
+}
+
+ReturnCode AclRuleManager::processAddRuleRequest(const P4Key &acl_rule_key,
+                                                 const P4AclRuleAppDbEntry &app_db_entry)
+{
+    P4AclRule acl_rule{};
+    RETURN_IF_ERROR(prepareAclRule(acl_rule_key, app_db_entry, acl_rule));
+    auto status = createAclRule(acl_rule);
+    if (!status.ok())
+    {
+        SWSS_LOG_ERROR("Failed to create ACL rule with key %s in table %s", QuotedVar(acl_rule.acl_rule_key).c_str(),
+                       QuotedVar(app_db_entry.acl_table_name).c_str());
+        return status;
+    }
+    insertAclRule(std::move(acl_rule));
     return status;
 }
 
-ReturnCode AclRuleManager::processDeleteRuleRequest(const std::string &acl_table_name, const std::string &acl_rule_key)
+ReturnCode AclRuleManager::processDeleteRuleRequest(const std::string &acl_table_name, const P4Key &acl_rule_key)
 {
     SWSS_LOG_ENTER();
     auto status = removeAclRule(acl_table_name, acl_rule_key);
@@ -1958,7 +2476,8 @@ ReturnCode AclRuleManager::processUpdateRuleRequest(const P4AclRuleAppDbEntry &a
     std::vector<sai_attribute_t> acl_entry_attrs;
     std::vector<sai_attribute_t> rollback_attrs;
     sai_attribute_t acl_entry_attr;
-    const auto &table_name_and_rule_key = concatTableNameAndRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
+    const auto &table_name_and_rule_key =
+        KeyGenerator::generateAclTableRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
 
     // Update action field
     acl_rule.p4_action = app_db_entry.action;
@@ -2111,8 +2630,7 @@ std::string AclRuleManager::verifyState(const std::string &key, const std::vecto
     auto &app_db_entry = *app_db_entry_or;
 
     const auto &acl_table_name = app_db_entry.acl_table_name;
-    const auto &acl_rule_key =
-        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, std::to_string(app_db_entry.priority));
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, app_db_entry.priority);
     auto *acl_rule = getAclRule(acl_table_name, acl_rule_key);
     if (acl_rule == nullptr)
     {
@@ -2145,8 +2663,7 @@ std::string AclRuleManager::verifyStateCache(const P4AclRuleAppDbEntry &app_db_e
         return msg.str();
     }
 
-    const auto &acl_rule_key =
-        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, std::to_string(app_db_entry.priority));
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, app_db_entry.priority);
     if (acl_rule->acl_rule_key != acl_rule_key)
     {
         std::stringstream msg;
@@ -2433,7 +2950,8 @@ std::string AclRuleManager::verifyStateCache(const P4AclRuleAppDbEntry &app_db_e
         return msg.str();
     }
 
-    const auto &table_name_and_rule_key = concatTableNameAndRuleKey(acl_rule->acl_table_name, acl_rule->acl_rule_key);
+    const auto &table_name_and_rule_key =
+        KeyGenerator::generateAclTableRuleKey(acl_rule->acl_table_name, acl_rule->acl_rule_key);
     std::string err_msg =
         m_p4OidMapper->verifyOIDMapping(SAI_OBJECT_TYPE_ACL_ENTRY, table_name_and_rule_key, acl_rule->acl_entry_oid);
     if (!err_msg.empty())
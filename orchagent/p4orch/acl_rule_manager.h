@@ -2,6 +2,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "copporch.h"
@@ -33,8 +34,10 @@ class AclRuleManager : public ObjectManagerInterface
                             ResponsePublisherInterface *publisher)
         : m_p4OidMapper(p4oidMapper), m_vrfOrch(vrfOrch), m_publisher(publisher), m_coppOrch(coppOrch),
           m_countersDb(std::make_unique<swss::DBConnector>("COUNTERS_DB", 0)),
+          m_countersPipe(std::make_unique<swss::RedisPipeline>(m_countersDb.get())),
           m_countersTable(std::make_unique<swss::Table>(
-              m_countersDb.get(), std::string(COUNTERS_TABLE) + DEFAULT_KEY_SEPARATOR + APP_P4RT_TABLE_NAME))
+              m_countersPipe.get(), std::string(COUNTERS_TABLE) + DEFAULT_KEY_SEPARATOR + APP_P4RT_TABLE_NAME,
+              /*buffered=*/true))
     {
         SWSS_LOG_ENTER();
         assert(m_p4OidMapper != nullptr);
@@ -62,13 +65,28 @@ class AclRuleManager : public ObjectManagerInterface
     ReturnCode validateAclRuleAppDbEntry(const P4AclRuleAppDbEntry &app_db_entry);
 
     // Get ACL rule by table name and rule key. Return nullptr if not found.
-    P4AclRule *getAclRule(const std::string &acl_table_name, const std::string &acl_rule_key);
+    P4AclRule *getAclRule(const std::string &acl_table_name, const P4Key &acl_rule_key);
+
+    // Processes a batch of operations of the same type, stops at the first
+    // failure and publishes the status of every entry.
+    ReturnCode processRuleEntries(const std::vector<P4AclRuleAppDbEntry> &entries,
+                                  const std::vector<P4Key> &rule_keys,
+                                  const std::vector<swss::KeyOpFieldsValuesTuple> &tuple_list, const std::string &op,
+                                  bool update);
+
+    // Adds a batch of ACL rules, with one bulk SAI call per object type.
+    std::vector<ReturnCode> addAclRules(const std::vector<P4AclRuleAppDbEntry> &entries,
+                                        const std::vector<P4Key> &rule_keys);
+
+    // Removes a batch of ACL rules, with one bulk SAI call per object type.
+    std::vector<ReturnCode> removeAclRules(const std::vector<P4AclRuleAppDbEntry> &entries,
+                                           const std::vector<P4Key> &rule_keys);
 
     // Processes add operation for an ACL rule.
-    ReturnCode processAddRuleRequest(const std::string &acl_rule_key, const P4AclRuleAppDbEntry &app_db_entry);
+    ReturnCode processAddRuleRequest(const P4Key &acl_rule_key, const P4AclRuleAppDbEntry &app_db_entry);
 
     // Processes delete operation for an ACL rule.
-    ReturnCode processDeleteRuleRequest(const std::string &acl_table_name, const std::string &acl_rule_key);
+    ReturnCode processDeleteRuleRequest(const std::string &acl_table_name, const P4Key &acl_rule_key);
 
     // Processes update operation for an ACL rule.
     ReturnCode processUpdateRuleRequest(const P4AclRuleAppDbEntry &app_db_entry, const P4AclRule &old_acl_rule);
@@ -76,18 +94,29 @@ class AclRuleManager : public ObjectManagerInterface
     // Set counters stats for an ACL rule in COUNTERS_DB.
     ReturnCode setAclRuleCounterStats(const P4AclRule &acl_rule);
 
+    // Builds an ACL rule from its APP_DB entry.
+    ReturnCode prepareAclRule(const P4Key &acl_rule_key, const P4AclRuleAppDbEntry &app_db_entry,
+                              P4AclRule &acl_rule);
+
+    // Records an ACL rule created in SAI and the references it holds.
+    void insertAclRule(P4AclRule &&acl_rule);
+
     // Create an ACL rule.
     ReturnCode createAclRule(P4AclRule &acl_rule);
 
+    // Create the meters, counters and entries of ACL rules in bulk. The rules
+    // after the first failure are not created.
+    std::vector<ReturnCode> createAclRules(std::vector<P4AclRule> &acl_rules);
+
     // Create an ACL counter.
-    ReturnCode createAclCounter(const std::string &acl_table_name, const std::string &counter_key,
+    ReturnCode createAclCounter(const std::string &acl_table_name, const P4Key &counter_key,
                                 const P4AclRule &acl_rule, sai_object_id_t *counter_oid);
 
     // Create an ACL meter.
-    ReturnCode createAclMeter(const P4AclMeter &p4_acl_meter, const std::string &meter_key, sai_object_id_t *meter_oid);
+    ReturnCode createAclMeter(const P4AclMeter &p4_acl_meter, const P4Key &meter_key, sai_object_id_t *meter_oid);
 
     // Remove an ACL counter.
-    ReturnCode removeAclCounter(const std::string &acl_table_name, const std::string &counter_key);
+    ReturnCode removeAclCounter(const std::string &acl_table_name, const P4Key &counter_key);
 
     // Update ACL meter.
     ReturnCode updateAclMeter(const P4AclMeter &new_acl_meter, const P4AclMeter &old_acl_meter);
@@ -98,10 +127,16 @@ class AclRuleManager : public ObjectManagerInterface
                              std::vector<sai_attribute_t> &rollback_attrs);
 
     // Remove an ACL meter.
-    ReturnCode removeAclMeter(const std::string &meter_key);
+    ReturnCode removeAclMeter(const P4Key &meter_key);
 
     // Remove the ACL rule by key in the given ACL table.
-    ReturnCode removeAclRule(const std::string &acl_table_name, const std::string &acl_rule_key);
+    ReturnCode removeAclRule(const std::string &acl_table_name, const P4Key &acl_rule_key);
+
+    // Checks that the ACL rule exists and is not referenced.
+    ReturnCode validateAclRuleRemoval(const std::string &acl_table_name, const P4Key &acl_rule_key);
+
+    // Forgets an ACL rule removed from SAI and releases the references it held.
+    void eraseAclRule(const std::string &acl_table_name, const P4Key &acl_rule_key);
 
     // Set Meter value in ACL rule.
     ReturnCode setMeterValue(const P4AclTableDefinition *acl_table, const P4AclRuleAppDbEntry &app_db_entry,
@@ -156,7 +191,11 @@ class AclRuleManager : public ObjectManagerInterface
     CoppOrch *m_coppOrch;
     std::deque<swss::KeyOpFieldsValuesTuple> m_entries;
     std::unique_ptr<swss::DBConnector> m_countersDb;
+    std::unique_ptr<swss::RedisPipeline> m_countersPipe;
+    // Buffered in m_countersPipe, flushed once per poll and once per drain.
     std::unique_ptr<swss::Table> m_countersTable;
+    // Counters stats last written in COUNTERS_DB by rule DB key
+    std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> m_countersStats;
     std::vector<P4UserDefinedTrapHostifTableEntry> m_userDefinedTraps;
 
     friend class AclTableManager;
@@ -4,6 +4,7 @@
 #include <nlohmann/json.hpp>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "acltable.h"
@@ -129,7 +130,7 @@ struct P4AclRule
     sai_object_id_t acl_table_oid;
     sai_object_id_t acl_entry_oid;
     std::string acl_table_name;
-    std::string acl_rule_key;
+    P4Key acl_rule_key;
     std::string db_key;
 
     sai_uint32_t priority;
@@ -261,7 +262,7 @@ using acl_ip_frag_lookup_t = std::map<std::string, sai_acl_ip_frag_t>;
 using udf_base_lookup_t = std::map<std::string, sai_udf_base_t>;
 using acl_packet_vlan_lookup_t = std::map<std::string, sai_packet_vlan_t>;
 using P4AclTableDefinitions = std::map<std::string, P4AclTableDefinition>;
-using P4AclRuleTables = std::map<std::string, std::map<std::string, P4AclRule>>;
+using P4AclRuleTables = std::map<std::string, std::unordered_map<P4Key, P4AclRule>>;
 
 #define P4_FORMAT_HEX_STRING "HEX_STRING"
 #define P4_FORMAT_MAC "MAC"
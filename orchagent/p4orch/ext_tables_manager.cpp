@@ -623,6 +623,7 @@ ReturnCode ExtTablesManager::removeP4ExtTableEntry(const std::string &table_name
     if (ext_table_entry->sai_counter_oid != SAI_NULL_OBJECT_ID)
     {
         m_countersTable->del(ext_table_entry->db_key);
+        m_countersStats.erase(ext_table_entry->db_key);
         removeGenericCounter(ext_table_entry->sai_counter_oid);
     }
 
@@ -793,6 +794,8 @@ ReturnCode ExtTablesManager::drain() {
     }
   }
 
+  // Removes the counters of the deleted entries.
+  m_countersTable->flush();
   drainWithNotExecuted();
   return ret;
 }
@@ -808,7 +811,6 @@ void ExtTablesManager::doExtCounterStatsTask()
 
     sai_stat_id_t stat_ids[] = {SAI_COUNTER_STAT_PACKETS, SAI_COUNTER_STAT_BYTES};
     uint64_t stats[2];
-    std::vector<swss::FieldValueTuple> counter_stats_values;
 
     for (auto table_it = gP4Orch->tablesinfo->m_tableInfoMap.begin();
          table_it != gP4Orch->tablesinfo->m_tableInfoMap.end(); ++table_it)
@@ -844,13 +846,21 @@ void ExtTablesManager::doExtCounterStatsTask()
                 continue;
             }
 
-            counter_stats_values.push_back(swss::FieldValueTuple{P4_COUNTER_STATS_PACKETS, std::to_string(stats[0])});
-            counter_stats_values.push_back(swss::FieldValueTuple{P4_COUNTER_STATS_BYTES, std::to_string(stats[1])});
+            std::vector<swss::FieldValueTuple> counter_stats_values = {
+                {P4_COUNTER_STATS_PACKETS, std::to_string(stats[0])},
+                {P4_COUNTER_STATS_BYTES, std::to_string(stats[1])}};
 
-            // Set field value tuples for counters stats in COUNTERS_DB
-            m_countersTable->set(ext_table_entry->db_key, counter_stats_values);
+            // Set field value tuples for counters stats in COUNTERS_DB, if they changed
+            auto &last_stats_values = m_countersStats[ext_table_entry->db_key];
+            if (last_stats_values != counter_stats_values)
+            {
+                m_countersTable->set(ext_table_entry->db_key, counter_stats_values);
+                last_stats_values = std::move(counter_stats_values);
+            }
         }
     }
+    // Write the changed counters of all entries in a single round trip.
+    m_countersTable->flush();
 }
 
 std::string ExtTablesManager::verifyState(const std::string &key, const std::vector<swss::FieldValueTuple> &tuple)
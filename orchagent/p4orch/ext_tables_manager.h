@@ -45,8 +45,10 @@ class ExtTablesManager : public ObjectManagerInterface
   public:
     ExtTablesManager(P4OidMapper *p4oidMapper, VRFOrch *vrfOrch, ResponsePublisherInterface *publisher)
         : m_vrfOrch(vrfOrch), m_countersDb(std::make_unique<swss::DBConnector>("COUNTERS_DB", 0)),
+          m_countersPipe(std::make_unique<swss::RedisPipeline>(m_countersDb.get())),
           m_countersTable(std::make_unique<swss::Table>(
-              m_countersDb.get(), std::string(COUNTERS_TABLE) + DEFAULT_KEY_SEPARATOR + APP_P4RT_TABLE_NAME))
+              m_countersPipe.get(), std::string(COUNTERS_TABLE) + DEFAULT_KEY_SEPARATOR + APP_P4RT_TABLE_NAME,
+              /*buffered=*/true))
     {
         SWSS_LOG_ENTER();
 
@@ -91,5 +93,11 @@ class ExtTablesManager : public ObjectManagerInterface
     m_entriesTableMap m_entriesTables;
 
     std::unique_ptr<swss::DBConnector> m_countersDb;
+    std::unique_ptr<swss::RedisPipeline> m_countersPipe;
+    // Buffered in m_countersPipe, flushed once per poll and once per drain.
     std::unique_ptr<swss::Table> m_countersTable;
+    // Counters stats last written in COUNTERS_DB by entry DB key
+    std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> m_countersStats;
+
+    friend class ExtTablesManagerTest;
 };
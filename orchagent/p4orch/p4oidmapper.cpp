@@ -15,167 +15,155 @@ extern "C"
 
 using ::nlohmann::json;
 
-P4OidMapper::P4OidMapper() : m_db("APPL_STATE_DB", 0) {}
+namespace
+{
 
-bool P4OidMapper::setOID(_In_ sai_object_type_t object_type, _In_ const std::string &key, _In_ sai_object_id_t oid,
-                         _In_ uint32_t ref_count)
+std::string keyString(const P4Key &key)
 {
-    SWSS_LOG_ENTER();
+    return key.to_string();
+}
+
+const std::string &keyString(const std::string &key)
+{
+    return key;
+}
 
-    if (m_oidTables[object_type].find(key) != m_oidTables[object_type].end())
+// The operations of the mapper on the table of either key type.
+template <typename Table, typename Key>
+bool setOIDInTable(Table &table, sai_object_type_t object_type, const Key &key, sai_object_id_t oid,
+                   uint32_t ref_count)
+{
+    if (!table.emplace(key, typename Table::mapped_type{oid, ref_count}).second)
     {
-        SWSS_LOG_ERROR("Key %s with SAI object type %d already exists in centralized mapper", key.c_str(), object_type);
+        SWSS_LOG_ERROR("Key %s with SAI object type %d already exists in centralized mapper",
+                       keyString(key).c_str(), object_type);
         return false;
     }
 
-    m_oidTables[object_type][key] = {oid, ref_count};
     return true;
 }
 
-bool P4OidMapper::getOID(_In_ sai_object_type_t object_type, _In_ const std::string &key,
-                         _Out_ sai_object_id_t *oid) const
+template <typename Table, typename Key>
+bool getOIDInTable(const Table &table, sai_object_type_t object_type, const Key &key, sai_object_id_t *oid)
 {
-    SWSS_LOG_ENTER();
-
     if (oid == nullptr)
     {
         SWSS_LOG_ERROR("nullptr input in centralized mapper");
         return false;
     }
 
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = table.find(key);
+    if (it == table.end())
     {
-        SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in centralized mapper", key.c_str(), object_type);
+        SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in centralized mapper",
+                       keyString(key).c_str(), object_type);
         return false;
     }
 
-    *oid = m_oidTables[object_type].at(key).sai_oid;
+    *oid = it->second.sai_oid;
     return true;
 }
 
-bool P4OidMapper::getRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key,
-                              _Out_ uint32_t *ref_count) const
+template <typename Table, typename Key>
+bool getRefCountInTable(const Table &table, sai_object_type_t object_type, const Key &key, uint32_t *ref_count)
 {
-    SWSS_LOG_ENTER();
-
     if (ref_count == nullptr)
     {
         SWSS_LOG_ERROR("nullptr input in centralized mapper");
         return false;
     }
 
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = table.find(key);
+    if (it == table.end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in "
                        "centralized mapper",
-                       key.c_str(), object_type);
+                       keyString(key).c_str(), object_type);
         return false;
     }
 
-    *ref_count = m_oidTables[object_type].at(key).ref_count;
+    *ref_count = it->second.ref_count;
     return true;
 }
 
-bool P4OidMapper::eraseOID(_In_ sai_object_type_t object_type, _In_ const std::string &key)
+template <typename Table, typename Key>
+bool eraseOIDInTable(Table &table, sai_object_type_t object_type, const Key &key)
 {
-    SWSS_LOG_ENTER();
-
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = table.find(key);
+    if (it == table.end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in "
                        "centralized mapper",
-                       key.c_str(), object_type);
+                       keyString(key).c_str(), object_type);
         return false;
     }
 
-    if (m_oidTables[object_type][key].ref_count != 0)
+    if (it->second.ref_count != 0)
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d has non-zero reference count in "
                        "centralized mapper",
-                       key.c_str(), object_type);
+                       keyString(key).c_str(), object_type);
         return false;
     }
 
-    m_oidTables[object_type].erase(key);
+    table.erase(it);
     return true;
 }
 
-void P4OidMapper::eraseAllOIDs(_In_ sai_object_type_t object_type)
+template <typename Table, typename Key>
+bool increaseRefCountInTable(Table &table, sai_object_type_t object_type, const Key &key)
 {
-    SWSS_LOG_ENTER();
-
-    m_oidTables[object_type].clear();
-}
-
-size_t P4OidMapper::getNumEntries(_In_ sai_object_type_t object_type) const
-{
-    SWSS_LOG_ENTER();
-
-    return (m_oidTables[object_type].size());
-}
-
-bool P4OidMapper::existsOID(_In_ sai_object_type_t object_type, _In_ const std::string &key) const
-{
-    SWSS_LOG_ENTER();
-
-    return m_oidTables[object_type].find(key) != m_oidTables[object_type].end();
-}
-
-bool P4OidMapper::increaseRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key)
-{
-    SWSS_LOG_ENTER();
-
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = table.find(key);
+    if (it == table.end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in "
                        "centralized mapper",
-                       key.c_str(), object_type);
+                       keyString(key).c_str(), object_type);
         return false;
     }
 
-    if (m_oidTables[object_type][key].ref_count == std::numeric_limits<uint32_t>::max())
+    if (it->second.ref_count == std::numeric_limits<uint32_t>::max())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d reached maximum ref_count %u in "
                        "centralized mapper",
-                       key.c_str(), object_type, m_oidTables[object_type][key].ref_count);
+                       keyString(key).c_str(), object_type, it->second.ref_count);
         return false;
     }
 
-    m_oidTables[object_type][key].ref_count++;
+    it->second.ref_count++;
     return true;
 }
 
-bool P4OidMapper::decreaseRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key)
+template <typename Table, typename Key>
+bool decreaseRefCountInTable(Table &table, sai_object_type_t object_type, const Key &key)
 {
-    SWSS_LOG_ENTER();
-
-    if (m_oidTables[object_type].find(key) == m_oidTables[object_type].end())
+    auto it = table.find(key);
+    if (it == table.end())
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d does not exist in "
                        "centralized mapper",
-                       key.c_str(), object_type);
+                       keyString(key).c_str(), object_type);
         return false;
     }
 
-    if (m_oidTables[object_type][key].ref_count == 0)
+    if (it->second.ref_count == 0)
     {
         SWSS_LOG_ERROR("Key %s with SAI object type %d reached zero ref_count in "
                        "centralized mapper",
-                       key.c_str(), object_type);
+                       keyString(key).c_str(), object_type);
         return false;
     }
 
-    m_oidTables[object_type][key].ref_count--;
+    it->second.ref_count--;
     return true;
 }
 
-std::string P4OidMapper::verifyOIDMapping(_In_ sai_object_type_t object_type, _In_ const std::string &key,
-                                          _In_ sai_object_id_t oid)
+template <typename Table, typename Key>
+std::string verifyOIDMappingInTable(const Table &table, sai_object_type_t object_type, const Key &key,
+                                    sai_object_id_t oid)
 {
-    SWSS_LOG_ENTER();
-
     sai_object_id_t mapper_oid;
-    if (!getOID(object_type, key, &mapper_oid))
+    if (!getOIDInTable(table, object_type, key, &mapper_oid))
     {
         std::stringstream msg;
         msg << "OID not found in mapper for key " << key;
@@ -192,15 +180,191 @@ std::string P4OidMapper::verifyOIDMapping(_In_ sai_object_type_t object_type, _I
     return "";
 }
 
+} // namespace
+
+P4OidMapper::P4OidMapper() : m_db("APPL_STATE_DB", 0) {}
+
+bool P4OidMapper::setOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key, _In_ sai_object_id_t oid,
+                         _In_ uint32_t ref_count)
+{
+    SWSS_LOG_ENTER();
+
+    if (key.type() == P4Key::Type::kString)
+    {
+        return setOIDInTable(m_stringOidTables[object_type], object_type, key.m_packed, oid, ref_count);
+    }
+    return setOIDInTable(m_oidTables[object_type], object_type, key, oid, ref_count);
+}
+
+bool P4OidMapper::setOID(_In_ sai_object_type_t object_type, _In_ const std::string &key,
+                         _In_ sai_object_id_t oid, _In_ uint32_t ref_count)
+{
+    SWSS_LOG_ENTER();
+
+    return setOIDInTable(m_stringOidTables[object_type], object_type, key, oid, ref_count);
+}
+
+bool P4OidMapper::getOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key,
+                         _Out_ sai_object_id_t *oid) const
+{
+    SWSS_LOG_ENTER();
+
+    if (key.type() == P4Key::Type::kString)
+    {
+        return getOIDInTable(m_stringOidTables[object_type], object_type, key.m_packed, oid);
+    }
+    return getOIDInTable(m_oidTables[object_type], object_type, key, oid);
+}
+
+bool P4OidMapper::getOID(_In_ sai_object_type_t object_type, _In_ const std::string &key,
+                         _Out_ sai_object_id_t *oid) const
+{
+    SWSS_LOG_ENTER();
+
+    return getOIDInTable(m_stringOidTables[object_type], object_type, key, oid);
+}
+
+bool P4OidMapper::getRefCount(_In_ sai_object_type_t object_type, _In_ const P4Key &key,
+                              _Out_ uint32_t *ref_count) const
+{
+    SWSS_LOG_ENTER();
+
+    if (key.type() == P4Key::Type::kString)
+    {
+        return getRefCountInTable(m_stringOidTables[object_type], object_type, key.m_packed, ref_count);
+    }
+    return getRefCountInTable(m_oidTables[object_type], object_type, key, ref_count);
+}
+
+bool P4OidMapper::getRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key,
+                              _Out_ uint32_t *ref_count) const
+{
+    SWSS_LOG_ENTER();
+
+    return getRefCountInTable(m_stringOidTables[object_type], object_type, key, ref_count);
+}
+
+bool P4OidMapper::eraseOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key)
+{
+    SWSS_LOG_ENTER();
+
+    if (key.type() == P4Key::Type::kString)
+    {
+        return eraseOIDInTable(m_stringOidTables[object_type], object_type, key.m_packed);
+    }
+    return eraseOIDInTable(m_oidTables[object_type], object_type, key);
+}
+
+bool P4OidMapper::eraseOID(_In_ sai_object_type_t object_type, _In_ const std::string &key)
+{
+    SWSS_LOG_ENTER();
+
+    return eraseOIDInTable(m_stringOidTables[object_type], object_type, key);
+}
+
+void P4OidMapper::eraseAllOIDs(_In_ sai_object_type_t object_type)
+{
+    SWSS_LOG_ENTER();
+
+    m_oidTables[object_type].clear();
+    m_stringOidTables[object_type].clear();
+}
+
+size_t P4OidMapper::getNumEntries(_In_ sai_object_type_t object_type) const
+{
+    SWSS_LOG_ENTER();
+
+    return (m_oidTables[object_type].size() + m_stringOidTables[object_type].size());
+}
+
+bool P4OidMapper::existsOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key) const
+{
+    SWSS_LOG_ENTER();
+
+    if (key.type() == P4Key::Type::kString)
+    {
+        return existsOID(object_type, key.m_packed);
+    }
+    return m_oidTables[object_type].find(key) != m_oidTables[object_type].end();
+}
+
+bool P4OidMapper::existsOID(_In_ sai_object_type_t object_type, _In_ const std::string &key) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_stringOidTables[object_type].find(key) != m_stringOidTables[object_type].end();
+}
+
+bool P4OidMapper::increaseRefCount(_In_ sai_object_type_t object_type, _In_ const P4Key &key)
+{
+    SWSS_LOG_ENTER();
+
+    if (key.type() == P4Key::Type::kString)
+    {
+        return increaseRefCountInTable(m_stringOidTables[object_type], object_type, key.m_packed);
+    }
+    return increaseRefCountInTable(m_oidTables[object_type], object_type, key);
+}
+
+bool P4OidMapper::increaseRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key)
+{
+    SWSS_LOG_ENTER();
+
+    return increaseRefCountInTable(m_stringOidTables[object_type], object_type, key);
+}
+
+bool P4OidMapper::decreaseRefCount(_In_ sai_object_type_t object_type, _In_ const P4Key &key)
+{
+    SWSS_LOG_ENTER();
+
+    if (key.type() == P4Key::Type::kString)
+    {
+        return decreaseRefCountInTable(m_stringOidTables[object_type], object_type, key.m_packed);
+    }
+    return decreaseRefCountInTable(m_oidTables[object_type], object_type, key);
+}
+
+bool P4OidMapper::decreaseRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key)
+{
+    SWSS_LOG_ENTER();
+
+    return decreaseRefCountInTable(m_stringOidTables[object_type], object_type, key);
+}
+
+std::string P4OidMapper::verifyOIDMapping(_In_ sai_object_type_t object_type, _In_ const P4Key &key,
+                                          _In_ sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    if (key.type() == P4Key::Type::kString)
+    {
+        return verifyOIDMappingInTable(m_stringOidTables[object_type], object_type, key.m_packed, oid);
+    }
+    return verifyOIDMappingInTable(m_oidTables[object_type], object_type, key, oid);
+}
+
+std::string P4OidMapper::verifyOIDMapping(_In_ sai_object_type_t object_type, _In_ const std::string &key,
+                                          _In_ sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    return verifyOIDMappingInTable(m_stringOidTables[object_type], object_type, key, oid);
+}
+
 std::string P4OidMapper::dumpStateCache() {
   json cache = json({});
   for (int i = 0; i < SAI_OBJECT_TYPE_MAX; i++) {
-    if (m_oidTables[i].empty()) {
+    if (m_oidTables[i].empty() && m_stringOidTables[i].empty()) {
       continue;
     }
 
     json oid_mapper_j = json({});
     for (const auto& kv_pair : m_oidTables[i]) {
+      MapperEntry m = kv_pair.second;
+      json mapper_entry_j = {{"sai_oid", sai_serialize_object_id(m.sai_oid)}, {"ref_count", m.ref_count}};
+      oid_mapper_j[kv_pair.first.to_string()] = mapper_entry_j;
+    }
+    for (const auto& kv_pair : m_stringOidTables[i]) {
       MapperEntry m = kv_pair.second;
       json mapper_entry_j = {{"sai_oid", sai_serialize_object_id(m.sai_oid)}, {"ref_count", m.ref_count}};
       oid_mapper_j[kv_pair.first] = mapper_entry_j;
@@ -2,8 +2,10 @@
 
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "dbconnector.h"
+#include "p4orch/p4orch_util.h"
 #include "table.h"
 
 extern "C"
@@ -12,6 +14,9 @@ extern "C"
 }
 
 // Interface for mapping P4 ID to SAI OID.
+// The objects are keyed by P4Key. The std::string overloads take the
+// KeyGenerator strings of the managers without typed keys, a string key and
+// the P4Key built from it refer to the same object.
 // This class is not thread safe.
 class P4OidMapper
 {
@@ -24,30 +29,30 @@ class P4OidMapper
 
     // Sets oid for the given key for the specific object_type. Returns false if
     // the key already exists.
-    bool setOID(_In_ sai_object_type_t object_type, _In_ const std::string &key, _In_ sai_object_id_t oid,
+    bool setOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key, _In_ sai_object_id_t oid,
                 _In_ uint32_t ref_count = 0);
 
     // Sets dummy oid for the given key for the specific object_type. Should only
     // be used for non-oid based object type. Returns false if the key
     // already exists.
-    bool setDummyOID(_In_ sai_object_type_t object_type, _In_ const std::string &key, _In_ uint32_t ref_count = 0)
+    bool setDummyOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key, _In_ uint32_t ref_count = 0)
     {
         return setOID(object_type, key, /*oid=*/kDummyOid, ref_count);
     }
 
     // Gets oid for the given key for the SAI object_type.
     // Returns true on success.
-    bool getOID(_In_ sai_object_type_t object_type, _In_ const std::string &key, _Out_ sai_object_id_t *oid) const;
+    bool getOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key, _Out_ sai_object_id_t *oid) const;
 
     // Gets the reference count for the given key for the SAI object_type.
     // Returns true on success.
-    bool getRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key, _Out_ uint32_t *ref_count) const;
+    bool getRefCount(_In_ sai_object_type_t object_type, _In_ const P4Key &key, _Out_ uint32_t *ref_count) const;
 
     // Erases oid for the given key for the SAI object_type.
     // This function checks if the reference count is zero or not before the
     // operation.
     // Returns true on success.
-    bool eraseOID(_In_ sai_object_type_t object_type, _In_ const std::string &key);
+    bool eraseOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key);
 
     // Erases all oids for the SAI object_type.
     // This function will erase all oids regardless of the reference counts.
@@ -58,19 +63,43 @@ class P4OidMapper
 
     // Checks whether OID mapping exists for the given key for the specific
     // object type.
-    bool existsOID(_In_ sai_object_type_t object_type, _In_ const std::string &key) const;
+    bool existsOID(_In_ sai_object_type_t object_type, _In_ const P4Key &key) const;
 
     // Increases the reference count for the given object.
     // Returns true on success.
-    bool increaseRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key);
+    bool increaseRefCount(_In_ sai_object_type_t object_type, _In_ const P4Key &key);
 
     // Decreases the reference count for the given object.
     // Returns true on success.
-    bool decreaseRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key);
+    bool decreaseRefCount(_In_ sai_object_type_t object_type, _In_ const P4Key &key);
 
     // Verifies the OID mapping.
     // Returns an empty string if the input has the correct mapping. Returns a
     // non-empty error string otherwise.
+    std::string verifyOIDMapping(_In_ sai_object_type_t object_type, _In_ const P4Key &key,
+                                 _In_ sai_object_id_t oid);
+
+    bool setOID(_In_ sai_object_type_t object_type, _In_ const std::string &key, _In_ sai_object_id_t oid,
+                _In_ uint32_t ref_count = 0);
+
+    bool setDummyOID(_In_ sai_object_type_t object_type, _In_ const std::string &key, _In_ uint32_t ref_count = 0)
+    {
+        return setOID(object_type, key, /*oid=*/kDummyOid, ref_count);
+    }
+
+    bool getOID(_In_ sai_object_type_t object_type, _In_ const std::string &key, _Out_ sai_object_id_t *oid) const;
+
+    bool getRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key,
+                     _Out_ uint32_t *ref_count) const;
+
+    bool eraseOID(_In_ sai_object_type_t object_type, _In_ const std::string &key);
+
+    bool existsOID(_In_ sai_object_type_t object_type, _In_ const std::string &key) const;
+
+    bool increaseRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key);
+
+    bool decreaseRefCount(_In_ sai_object_type_t object_type, _In_ const std::string &key);
+
     std::string verifyOIDMapping(_In_ sai_object_type_t object_type, _In_ const std::string &key,
                                  _In_ sai_object_id_t oid);
 
@@ -84,8 +113,11 @@ class P4OidMapper
         uint32_t ref_count;
     };
 
-    // Buckets of map tables, one for every SAI object type.
-    std::unordered_map<std::string, MapperEntry> m_oidTables[SAI_OBJECT_TYPE_MAX];
+    // Buckets of map tables, one for every SAI object type. The string keys,
+    // and the P4Keys of type kString, are in their own tables, so that a
+    // string lookup does not copy the string into a P4Key.
+    std::unordered_map<P4Key, MapperEntry> m_oidTables[SAI_OBJECT_TYPE_MAX];
+    std::unordered_map<std::string, MapperEntry> m_stringOidTables[SAI_OBJECT_TYPE_MAX];
 
     swss::DBConnector m_db;
 };
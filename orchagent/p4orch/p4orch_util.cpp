@@ -1,11 +1,162 @@
 #include "p4orch/p4orch_util.h"
 
+#include <cstring>
+
 #include "p4orch/p4orch.h"
 #include "schema.h"
 
 using ::p4orch::kTableKeyDelimiter;
 extern P4Orch *gP4Orch;
 
+namespace
+{
+
+// Appends id=value to a key of KeyGenerator::generateKey() form. The ids must
+// be appended in the order of generateKey(), which sorts them.
+void appendKeyField(std::string *key, const char *id, const std::string &value)
+{
+    if (!key->empty())
+    {
+        key->push_back(':');
+    }
+    key->append(id);
+    key->push_back('=');
+    key->append(value);
+}
+
+// Packs the fields of a P4Key. A string is packed as its length followed by
+// its bytes.
+void packUint32(std::string *packed, uint32_t value)
+{
+    packed->append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void packString(std::string *packed, const std::string &value)
+{
+    packUint32(packed, static_cast<uint32_t>(value.size()));
+    packed->append(value);
+}
+
+// Reads the fields of a packed P4Key, in the order they were packed.
+class P4KeyReader
+{
+  public:
+    explicit P4KeyReader(const std::string &packed) : m_packed(packed)
+    {
+    }
+
+    uint8_t readUint8()
+    {
+        return static_cast<uint8_t>(m_packed[m_pos++]);
+    }
+
+    uint32_t readUint32()
+    {
+        uint32_t value;
+        memcpy(&value, m_packed.data() + m_pos, sizeof(value));
+        m_pos += sizeof(value);
+        return value;
+    }
+
+    std::string readString()
+    {
+        auto size = readUint32();
+        auto value = m_packed.substr(m_pos, size);
+        m_pos += size;
+        return value;
+    }
+
+    void readBytes(void *value, size_t size)
+    {
+        memcpy(value, m_packed.data() + m_pos, size);
+        m_pos += size;
+    }
+
+    bool done() const
+    {
+        return m_pos >= m_packed.size();
+    }
+
+  private:
+    const std::string &m_packed;
+    size_t m_pos = 0;
+};
+
+// Appends the id=value form of a packed ACL rule key.
+void appendAclRuleKeyString(std::string *key, P4KeyReader *reader)
+{
+    auto priority = reader->readUint32();
+    while (!reader->done())
+    {
+        auto id = prependMatchField(reader->readString());
+        appendKeyField(key, id.c_str(), reader->readString());
+    }
+    appendKeyField(key, p4orch::kPriority, std::to_string(priority));
+}
+
+} // namespace
+
+P4Key::P4Key() : P4Key(Type::kString, std::string())
+{
+}
+
+P4Key::P4Key(std::string key) : P4Key(Type::kString, std::move(key))
+{
+}
+
+P4Key::P4Key(Type type, std::string packed)
+    : m_type(type), m_packed(std::move(packed)),
+      m_hash(std::hash<std::string>()(m_packed) * 31 + static_cast<size_t>(type))
+{
+}
+
+std::string P4Key::to_string() const
+{
+    P4KeyReader reader(m_packed);
+    std::string key;
+    switch (m_type)
+    {
+    case Type::kRoute: {
+        auto vrf_id = reader.readString();
+        swss::ip_addr_t ip = {};
+        ip.family = reader.readUint8();
+        auto mask = reader.readUint8();
+        if (ip.family == AF_INET)
+        {
+            reader.readBytes(&ip.ip_addr.ipv4_addr, sizeof(ip.ip_addr.ipv4_addr));
+        }
+        else
+        {
+            reader.readBytes(ip.ip_addr.ipv6_addr, sizeof(ip.ip_addr.ipv6_addr));
+        }
+        appendKeyField(&key, ip.family == AF_INET ? p4orch::kIpv4Dst : p4orch::kIpv6Dst,
+                       swss::IpPrefix(ip, mask).to_string());
+        appendKeyField(&key, p4orch::kVrfId, vrf_id);
+        break;
+    }
+    case Type::kAclRule:
+        appendAclRuleKeyString(&key, &reader);
+        break;
+    case Type::kAclTableRule: {
+        key = reader.readString();
+        key.push_back(kTableKeyDelimiter);
+        std::string acl_rule_key;
+        appendAclRuleKeyString(&acl_rule_key, &reader);
+        key.append(acl_rule_key);
+        break;
+    }
+    default:
+        key = m_packed;
+        break;
+    }
+    return key;
+}
+
+std::ostream &operator<<(std::ostream &out, const P4Key &key)
+{
+    return out << key.to_string();
+}
+
 // Prepends "match/" to the input string str to construct a new string.
 std::string prependMatchField(const std::string &str)
 {
@@ -132,30 +283,46 @@ void drainMgmtWithNotExecuted(std::deque<swss::KeyOpFieldsValuesTuple>& entries,
   return;
 }
 
-std::string KeyGenerator::generateRouteKey(const std::string &vrf_id, const swss::IpPrefix &ip_prefix)
+P4Key KeyGenerator::generateRouteKey(const std::string &vrf_id, const swss::IpPrefix &ip_prefix)
 {
-    std::map<std::string, std::string> fv_map = {
-        {p4orch::kVrfId, vrf_id}, {ip_prefix.isV4() ? p4orch::kIpv4Dst : p4orch::kIpv6Dst, ip_prefix.to_string()}};
-    return generateKey(fv_map);
+    // <vrf_id> <family> <mask length> <address>
+    const auto &ip = ip_prefix.getIp().getIp();
+    std::string packed;
+    packed.reserve(sizeof(uint32_t) + vrf_id.size() + 2 + sizeof(ip.ip_addr.ipv6_addr));
+    packString(&packed, vrf_id);
+    packed.push_back(static_cast<char>(ip.family));
+    packed.push_back(static_cast<char>(ip_prefix.getMaskLength()));
+    if (ip.family == AF_INET)
+    {
+        packed.append(reinterpret_cast<const char *>(&ip.ip_addr.ipv4_addr), sizeof(ip.ip_addr.ipv4_addr));
+    }
+    else
+    {
+        packed.append(reinterpret_cast<const char *>(ip.ip_addr.ipv6_addr), sizeof(ip.ip_addr.ipv6_addr));
+    }
+    return P4Key(P4Key::Type::kRoute, std::move(packed));
 }
 
 std::string KeyGenerator::generateRouterInterfaceKey(const std::string &router_intf_id)
 {
-    std::map<std::string, std::string> fv_map = {{p4orch::kRouterInterfaceId, router_intf_id}};
-    return generateKey(fv_map);
+    std::string key;
+    appendKeyField(&key, p4orch::kRouterInterfaceId, router_intf_id);
+    return key;
 }
 
 std::string KeyGenerator::generateNeighborKey(const std::string &router_intf_id, const swss::IpAddress &neighbor_id)
 {
-    std::map<std::string, std::string> fv_map = {{p4orch::kRouterInterfaceId, router_intf_id},
-                                                 {p4orch::kNeighborId, neighbor_id.to_string()}};
-    return generateKey(fv_map);
+    std::string key;
+    appendKeyField(&key, p4orch::kNeighborId, neighbor_id.to_string());
+    appendKeyField(&key, p4orch::kRouterInterfaceId, router_intf_id);
+    return key;
 }
 
 std::string KeyGenerator::generateNextHopKey(const std::string &next_hop_id)
 {
-    std::map<std::string, std::string> fv_map = {{p4orch::kNexthopId, next_hop_id}};
-    return generateKey(fv_map);
+    std::string key;
+    appendKeyField(&key, p4orch::kNexthopId, next_hop_id);
+    return key;
 }
 
 std::string KeyGenerator::generateMirrorSessionKey(const std::string &mirror_session_id)
@@ -212,21 +379,38 @@ std::string KeyGenerator::generateMulticastRouterInterfaceRifKey(
 
 std::string KeyGenerator::generateWcmpGroupKey(const std::string &wcmp_group_id)
 {
-    std::map<std::string, std::string> fv_map = {{p4orch::kWcmpGroupId, wcmp_group_id}};
-    return generateKey(fv_map);
+    std::string key;
+    appendKeyField(&key, p4orch::kWcmpGroupId, wcmp_group_id);
+    return key;
 }
 
-std::string KeyGenerator::generateAclRuleKey(const std::map<std::string, std::string> &match_fields,
-                                             const std::string &priority)
+P4Key KeyGenerator::generateAclRuleKey(const std::map<std::string, std::string> &match_fields, uint32_t priority)
 {
-    std::map<std::string, std::string> fv_map = {};
+    // <priority> (<field> <value>)..., the fields in the order of their names.
+    size_t size = sizeof(priority);
     for (const auto &match_field : match_fields)
     {
-        fv_map.emplace(std::string(p4orch::kMatchPrefix) + p4orch::kFieldDelimiter + match_field.first,
-                       match_field.second);
+        size += 2 * sizeof(uint32_t) + match_field.first.size() + match_field.second.size();
     }
-    fv_map.emplace(p4orch::kPriority, priority);
-    return generateKey(fv_map);
+    std::string packed;
+    packed.reserve(size);
+    packUint32(&packed, priority);
+    for (const auto &match_field : match_fields)
+    {
+        packString(&packed, match_field.first);
+        packString(&packed, match_field.second);
+    }
+    return P4Key(P4Key::Type::kAclRule, std::move(packed));
+}
+
+P4Key KeyGenerator::generateAclTableRuleKey(const std::string &acl_table_name, const P4Key &acl_rule_key)
+{
+    // <table name> <ACL rule key>
+    std::string packed;
+    packed.reserve(sizeof(uint32_t) + acl_table_name.size() + acl_rule_key.m_packed.size());
+    packString(&packed, acl_table_name);
+    packed.append(acl_rule_key.m_packed);
+    return P4Key(P4Key::Type::kAclTableRule, std::move(packed));
 }
 
 std::string KeyGenerator::generateL3AdmitKey(const swss::MacAddress &mac_address_data,
@@ -263,7 +447,14 @@ std::string KeyGenerator::generateExtTableKey(const std::string &table_name, con
 
 std::string KeyGenerator::generateKey(const std::map<std::string, std::string> &fv_map)
 {
+    size_t size = 0;
+    for (const auto &it : fv_map)
+    {
+        size += it.first.size() + it.second.size() + 2;
+    }
+
     std::string key;
+    key.reserve(size);
     bool append_delimiter = false;
     for (const auto &it : fv_map)
     {
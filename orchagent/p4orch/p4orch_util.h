@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <deque>
+#include <functional>
 #include <iomanip>
 #include <map>
+#include <ostream>
 #include <set>
 #include <sstream>
 #include <string>
@@ -343,6 +346,72 @@ std::string verifyAttrs(const std::vector<swss::FieldValueTuple> &targets,
 void drainMgmtWithNotExecuted(std::deque<swss::KeyOpFieldsValuesTuple>& entries,
                               ResponsePublisherInterface* publisher);
 
+// Key of an object in the P4 Orch managers and in P4OidMapper.
+// The fields of a typed key are packed in a single buffer when the key is
+// built, and the key is hashed once, so lookups never rebuild or rehash it.
+// A string key wraps a string of KeyGenerator::generateKey() form. Keys of
+// different types are never equal. to_string() returns the id=value form of
+// the key on demand, for logs and state verification.
+class P4Key
+{
+  public:
+    enum class Type : uint8_t
+    {
+        kString,
+        kRoute,
+        kAclRule,
+        kAclTableRule,
+    };
+
+    P4Key();
+    explicit P4Key(std::string key);
+
+    Type type() const
+    {
+        return m_type;
+    }
+
+    size_t hash() const
+    {
+        return m_hash;
+    }
+
+    std::string to_string() const;
+
+    bool operator==(const P4Key &key) const
+    {
+        return m_hash == key.m_hash && m_type == key.m_type && m_packed == key.m_packed;
+    }
+
+    bool operator!=(const P4Key &key) const
+    {
+        return !(*this == key);
+    }
+
+  private:
+    P4Key(Type type, std::string packed);
+
+    Type m_type;
+    std::string m_packed;
+    size_t m_hash;
+
+    friend class KeyGenerator;
+    friend class P4OidMapper;
+};
+
+namespace std
+{
+template <> struct hash<P4Key>
+{
+    size_t operator()(const P4Key &key) const
+    {
+        return key.hash();
+    }
+};
+} // namespace std
+
+std::ostream &operator<<(std::ostream &out, const P4Key &key);
+
 // class KeyGenerator includes member functions to generate keys for entries
 // stored in P4 Orch managers.
 class KeyGenerator
@@ -350,7 +419,9 @@ class KeyGenerator
   public:
     static std::string generateTablesInfoKey(const std::string &context);
 
-    static std::string generateRouteKey(const std::string &vrf_id, const swss::IpPrefix &ip_prefix);
+    // Route key of the VRF and prefix, with the to_string() form
+    // ipv4_dst=<prefix>:vrf_id=<vrf> or ipv6_dst=<prefix>:vrf_id=<vrf>.
+    static P4Key generateRouteKey(const std::string &vrf_id, const swss::IpPrefix &ip_prefix);
 
     static std::string generateRouterInterfaceKey(const std::string &router_intf_id);
 
@@ -375,8 +446,13 @@ class KeyGenerator
 
     static std::string generateWcmpGroupKey(const std::string &wcmp_group_id);
 
-    static std::string generateAclRuleKey(const std::map<std::string, std::string> &match_fields,
-                                          const std::string &priority);
+    // ACL rule key of the match fields and priority, with the to_string()
+    // form match/<field>=<value>:...:priority=<priority>.
+    static P4Key generateAclRuleKey(const std::map<std::string, std::string> &match_fields, uint32_t priority);
+
+    // Key of an ACL rule in the given ACL table, with the to_string() form
+    // <table>:<rule key>. Keys the rule objects in P4OidMapper.
+    static P4Key generateAclTableRuleKey(const std::string &acl_table_name, const P4Key &acl_rule_key);
 
     static std::string generateL3AdmitKey(const swss::MacAddress &mac_address_data,
                                           const swss::MacAddress &mac_address_mask, const std::string &port_name,
@@ -401,5 +477,10 @@ template <typename T> std::string QuotedVar(T name)
     return ss.str();
 }
 
+inline std::string QuotedVar(const P4Key &key)
+{
+    return QuotedVar(key.to_string());
+}
+
 // Trim tailing and leading whitespace
 std::string trim(const std::string &s);
@@ -0,0 +1,123 @@
+#include "p4orch/p4preparepool.h"
+
+#include <algorithm>
+
+constexpr size_t P4PreparePool::kChunkSize;
+
+P4PreparePool::P4PreparePool(size_t threads)
+{
+    for (size_t i = 1; i < threads; i++)
+    {
+        m_threads.emplace_back(&P4PreparePool::work, this);
+    }
+}
+
+P4PreparePool::~P4PreparePool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_startCv.notify_all();
+    for (auto &thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+P4PreparePool &P4PreparePool::instance()
+{
+    static P4PreparePool pool(std::max(1u, std::thread::hardware_concurrency()));
+    return pool;
+}
+
+void P4PreparePool::run(size_t count, const std::function<void(size_t)> &prepare)
+{
+    if (count <= kChunkSize || m_threads.empty())
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            prepare(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(m_runMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_prepare = &prepare;
+        m_count = count;
+        m_next = 0;
+        m_exception = nullptr;
+        m_busy = m_threads.size();
+        m_generation++;
+    }
+    m_startCv.notify_all();
+
+    prepareChunks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCv.wait(lock, [this] { return m_busy == 0; });
+    m_prepare = nullptr;
+    if (m_exception)
+    {
+        std::rethrow_exception(m_exception);
+    }
+}
+
+void P4PreparePool::prepareChunks()
+{
+    while (true)
+    {
+        size_t begin = m_next.fetch_add(kChunkSize);
+        if (begin >= m_count)
+        {
+            return;
+        }
+        size_t end = std::min(begin + kChunkSize, m_count);
+        try
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                (*m_prepare)(i);
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception)
+            {
+                m_exception = std::current_exception();
+            }
+        }
+    }
+}
+
+void P4PreparePool::work()
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_startCv.wait(lock, [&] { return m_stop || m_generation != generation; });
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        prepareChunks();
+
+        bool done;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            done = (--m_busy == 0);
+        }
+        if (done)
+        {
+            m_doneCv.notify_one();
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool of threads for the prepare phase of the P4 managers drain: the work of
+// a drain that depends on its entry only (parsing, key generation) is done for
+// the whole drain in parallel, then the validation and the SAI calls run in
+// order on the calling thread.
+// The prepare function must only read the state shared with the other entries.
+class P4PreparePool
+{
+  public:
+    // Number of entries prepared at once by a thread.
+    static constexpr size_t kChunkSize = 64;
+
+    // Uses the calling thread and threads - 1 worker threads.
+    explicit P4PreparePool(size_t threads);
+    ~P4PreparePool();
+
+    P4PreparePool(const P4PreparePool &) = delete;
+    P4PreparePool &operator=(const P4PreparePool &) = delete;
+
+    // Calls prepare(i) for every i in [0, count) and returns once they are all
+    // done. Drains of at most kChunkSize entries are prepared inline. The first
+    // exception thrown by prepare is rethrown once the others are done.
+    void run(size_t count, const std::function<void(size_t)> &prepare);
+
+    size_t size() const
+    {
+        return m_threads.size() + 1;
+    }
+
+    // Pool shared by the P4 managers, with one thread per core.
+    static P4PreparePool &instance();
+
+  private:
+    void work();
+    void prepareChunks();
+
+    std::vector<std::thread> m_threads;
+
+    // Serializes the runs.
+    std::mutex m_runMutex;
+
+    std::mutex m_mutex;
+    std::condition_variable m_startCv;
+    std::condition_variable m_doneCv;
+    uint64_t m_generation = 0;
+    size_t m_busy = 0;
+    bool m_stop = false;
+
+    const std::function<void(size_t)> *m_prepare = nullptr;
+    size_t m_count = 0;
+    std::atomic<size_t> m_next{0};
+    std::exception_ptr m_exception;
+};
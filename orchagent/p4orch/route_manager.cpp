@@ -14,6 +14,7 @@
 #include "dbconnector.h"
 #include "logger.h"
 #include "p4orch/p4orch_util.h"
+#include "p4orch/p4preparepool.h"
 #include "sai_serialize.h"
 #include "swssnet.h"
 #include "table.h"
@@ -164,6 +165,14 @@ std::vector<sai_route_entry_attr_t> prepareSaiActions(
   return kRouteActionToSaiActions->at(action);
 }
 
+// Route entry of a drain parsed by the prepare phase.
+struct PreparedRouteEntry {
+  std::string table_name;
+  std::string key;
+  ReturnCode status;
+  P4RouteEntry route_entry;
+};
+
 } // namespace
 
 RouteUpdater::RouteUpdater(const P4RouteEntry& old_route,
@@ -408,14 +417,15 @@ ReturnCodeOr<P4RouteEntry> RouteManager::deserializeRouteEntry(const std::string
     return route_entry;
 }
 
-P4RouteEntry *RouteManager::getRouteEntry(const std::string &route_entry_key)
+P4RouteEntry *RouteManager::getRouteEntry(const P4Key &route_entry_key)
 {
     SWSS_LOG_ENTER();
 
-    if (m_routeTable.find(route_entry_key) == m_routeTable.end())
+    auto it = m_routeTable.find(route_entry_key);
+    if (it == m_routeTable.end())
         return nullptr;
 
-    return &m_routeTable[route_entry_key];
+    return &it->second;
 }
 
 ReturnCode RouteManager::validateRouteEntry(const P4RouteEntry &route_entry, const std::string &operation)
@@ -906,23 +916,36 @@ ReturnCode RouteManager::drain() {
 
   std::vector<P4RouteEntry> route_list;
   std::vector<swss::KeyOpFieldsValuesTuple> tuple_list;
-  std::unordered_set<std::string> route_entry_list;
+  std::unordered_set<P4Key> route_entry_list;
+
+  // The entries are parsed in parallel. Their validation depends on the
+  // previous entries of the drain and runs in order with the SAI calls.
+  std::vector<PreparedRouteEntry> prepared_entries(m_entries.size());
+  P4PreparePool::instance().run(m_entries.size(), [&](size_t i) {
+    auto& prepared_entry = prepared_entries[i];
+    parseP4RTKey(kfvKey(m_entries[i]), &prepared_entry.table_name,
+                 &prepared_entry.key);
+    auto route_entry_or =
+        deserializeRouteEntry(prepared_entry.key, kfvFieldsValues(m_entries[i]),
+                              prepared_entry.table_name);
+    if (route_entry_or.ok()) {
+      prepared_entry.route_entry = std::move(*route_entry_or);
+    } else {
+      prepared_entry.status = route_entry_or.status();
+    }
+  });
 
   ReturnCode status;
   std::string prev_op;
   bool prev_update = false;
-  while (!m_entries.empty()) {
-    auto key_op_fvs_tuple = m_entries.front();
+  for (size_t i = 0; !m_entries.empty(); i++) {
+    auto key_op_fvs_tuple = std::move(m_entries.front());
     m_entries.pop_front();
-    std::string table_name;
-    std::string key;
-    parseP4RTKey(kfvKey(key_op_fvs_tuple), &table_name, &key);
-    const std::vector<swss::FieldValueTuple>& attributes =
-        kfvFieldsValues(key_op_fvs_tuple);
-
-    auto route_entry_or = deserializeRouteEntry(key, attributes, table_name);
-    if (!route_entry_or.ok()) {
-      status = route_entry_or.status();
+    const auto& table_name = prepared_entries[i].table_name;
+    const auto& key = prepared_entries[i].key;
+
+    if (!prepared_entries[i].status.ok()) {
+      status = prepared_entries[i].status;
       SWSS_LOG_ERROR("Unable to deserialize APP DB entry with key %s: %s",
                      QuotedVar(table_name + ":" + key).c_str(),
                      status.message().c_str());
@@ -931,7 +954,7 @@ ReturnCode RouteManager::drain() {
                            /*replace=*/true);
       break;
     }
-    auto& route_entry = *route_entry_or;
+    auto& route_entry = prepared_entries[i].route_entry;
 
     // A single batch should not modify the same route more than once.
     if (route_entry_list.count(route_entry.route_entry_key) != 0) {
@@ -981,8 +1004,8 @@ ReturnCode RouteManager::drain() {
                            /*replace=*/true);
       break;
     } else {
-      route_list.push_back(route_entry);
-      tuple_list.push_back(key_op_fvs_tuple);
+      route_list.push_back(std::move(route_entry));
+      tuple_list.push_back(std::move(key_op_fvs_tuple));
     }
   }
 
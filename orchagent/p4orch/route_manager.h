@@ -23,7 +23,7 @@ extern "C"
 
 struct P4RouteEntry
 {
-    std::string route_entry_key; // Unique key of a route entry.
+    P4Key route_entry_key; // Unique key of a route entry.
     std::string vrf_id;
     swss::IpPrefix route_prefix;
     std::string action;
@@ -34,7 +34,7 @@ struct P4RouteEntry
 };
 
 // P4RouteTable: Route ID, P4RouteEntry
-typedef std::unordered_map<std::string, P4RouteEntry> P4RouteTable;
+typedef std::unordered_map<P4Key, P4RouteEntry> P4RouteTable;
 
 // RouteUpdater is a helper class in performing route update.
 // It keeps track of the state of the route update. It provides the next SAI
@@ -111,7 +111,7 @@ class RouteManager : public ObjectManagerInterface
 
     // Gets the internal cached route entry by its key.
     // Return nullptr if corresponding route entry is not cached.
-    P4RouteEntry *getRouteEntry(const std::string &route_entry_key);
+    P4RouteEntry *getRouteEntry(const P4Key &route_entry_key);
 
     // Performs route entry validation.
     ReturnCode validateRouteEntry(const P4RouteEntry &route_entry, const std::string &operation);
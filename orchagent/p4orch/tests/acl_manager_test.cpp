@@ -1,6 +1,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
 #include <map>
 #include <memory>
 #include <nlohmann/json.hpp>
@@ -65,6 +67,7 @@ using ::testing::_;
 using ::testing::DoAll;
 using ::testing::Eq;
 using ::testing::Gt;
+using ::testing::InSequence;
 using ::testing::Invoke;
 using ::testing::NotNull;
 using ::testing::Return;
@@ -809,9 +812,78 @@ P4AclRuleAppDbEntry getDefaultAclRuleAppDbEntryWithoutAction()
     return app_db_entry;
 }
 
-const std::string concatTableNameAndRuleKey(const std::string &table_name, const std::string &rule_key)
+P4Key concatTableNameAndRuleKey(const std::string &table_name, const P4Key &rule_key)
 {
-    return table_name + kTableKeyDelimiter + rule_key;
+    return KeyGenerator::generateAclTableRuleKey(table_name, rule_key);
+}
+
+// Runs a bulk create of ACL entries, counters or policers as calls to the mocks
+// of the single objects.
+sai_status_t CreateObjectsOneByOne(sai_object_id_t switch_id, sai_object_type_t object_type, uint32_t object_count,
+                                   const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                                   sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id,
+                                   sai_status_t *object_statuses)
+{
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; ++i)
+    {
+        if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        switch (object_type)
+        {
+        case SAI_OBJECT_TYPE_POLICER:
+            object_statuses[i] = create_policer(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            break;
+        case SAI_OBJECT_TYPE_ACL_COUNTER:
+            object_statuses[i] = create_acl_counter(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            break;
+        default:
+            object_statuses[i] = create_acl_entry(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            break;
+        }
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            status = object_statuses[i];
+        }
+    }
+    return status;
+}
+
+// Runs a bulk remove of ACL entries, counters or policers as calls to the mocks
+// of the single objects.
+sai_status_t RemoveObjectsOneByOne(sai_object_type_t object_type, uint32_t object_count,
+                                   const sai_object_id_t *object_id, sai_bulk_op_error_mode_t mode,
+                                   sai_status_t *object_statuses)
+{
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; ++i)
+    {
+        if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        switch (object_type)
+        {
+        case SAI_OBJECT_TYPE_POLICER:
+            object_statuses[i] = remove_policer(object_id[i]);
+            break;
+        case SAI_OBJECT_TYPE_ACL_COUNTER:
+            object_statuses[i] = remove_acl_counter(object_id[i]);
+            break;
+        default:
+            object_statuses[i] = remove_acl_entry(object_id[i]);
+            break;
+        }
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            status = object_statuses[i];
+        }
+    }
+    return status;
 }
 
 } // namespace
@@ -876,6 +948,9 @@ class AclManagerTest : public ::testing::Test
         sai_acl_api->set_acl_entry_attribute = set_acl_entry_attribute;
         sai_acl_api->create_acl_counter = create_acl_counter;
         sai_acl_api->remove_acl_counter = remove_acl_counter;
+        EXPECT_CALL(mock_sai_acl_, bulk_object_create(_, _, _, _, _, _, _, _))
+            .WillRepeatedly(Invoke(CreateObjectsOneByOne));
+        EXPECT_CALL(mock_sai_acl_, bulk_object_remove(_, _, _, _, _)).WillRepeatedly(Invoke(RemoveObjectsOneByOne));
         sai_policer_api->create_policer = create_policer;
         sai_policer_api->remove_policer = remove_policer;
         sai_policer_api->get_policer_stats = get_policer_stats;
@@ -1069,7 +1144,7 @@ class AclManagerTest : public ::testing::Test
         return acl_table_manager_->getAclTable(acl_table_name);
     }
 
-    P4AclRule *GetAclRule(const std::string &acl_table_name, const std::string &acl_rule_key)
+    P4AclRule *GetAclRule(const std::string &acl_table_name, const P4Key &acl_rule_key)
     {
         return acl_rule_manager_->getAclRule(acl_table_name, acl_rule_key);
     }
@@ -1084,7 +1159,7 @@ class AclManagerTest : public ::testing::Test
         return acl_table_manager_->processDeleteTableRequest(acl_table_name);
     }
 
-    ReturnCode ProcessAddRuleRequest(const std::string &acl_rule_key, const P4AclRuleAppDbEntry &app_db_entry)
+    ReturnCode ProcessAddRuleRequest(const P4Key &acl_rule_key, const P4AclRuleAppDbEntry &app_db_entry)
     {
         return acl_rule_manager_->processAddRuleRequest(acl_rule_key, app_db_entry);
     }
@@ -1094,7 +1169,7 @@ class AclManagerTest : public ::testing::Test
         return acl_rule_manager_->processUpdateRuleRequest(app_db_entry, old_acl_rule);
     }
 
-    ReturnCode ProcessDeleteRuleRequest(const std::string &acl_table_name, const std::string &acl_rule_key)
+    ReturnCode ProcessDeleteRuleRequest(const std::string &acl_table_name, const P4Key &acl_rule_key)
     {
         return acl_rule_manager_->processDeleteRuleRequest(acl_table_name, acl_rule_key);
     }
@@ -2083,7 +2158,7 @@ TEST_F(AclManagerTest, RemoveIngressPuntRuleFails)
 
     // Insert the first ACL rule
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     app_db_entry.action = "set_dst_ipv6";
     app_db_entry.action_param_fvs["ip_address"] = "fdf8:f53b:82e4::53";
     EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
@@ -2187,7 +2262,7 @@ TEST_F(AclManagerTest, RemoveAclTableFailsWhenAclRuleExists)
 
     // Insert the first ACL rule
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     app_db_entry.action = "set_dst_ipv6";
     app_db_entry.action_param_fvs["ip_address"] = "fdf8:f53b:82e4::53";
     EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
@@ -2355,7 +2430,7 @@ TEST_F(AclManagerTest, RemoveAclGroupsSucceedsAfterCleanup)
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
     // Insert the first ACL rule
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    auto acl_rule_key1 = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    auto acl_rule_key1 = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     app_db_entry.action = "set_dst_ipv6";
     app_db_entry.action_param_fvs["ip_address"] = "fdf8:f53b:82e4::53";
     EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
@@ -2370,7 +2445,7 @@ TEST_F(AclManagerTest, RemoveAclGroupsSucceedsAfterCleanup)
         .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid2), Return(SAI_STATUS_SUCCESS)));
     EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
         .WillOnce(DoAll(SetArgPointee<0>(kAclMeterOid2), Return(SAI_STATUS_SUCCESS)));
-    auto acl_rule_key2 = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    auto acl_rule_key2 = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key2, app_db_entry));
     // There are 3 groups created, only group in INGRESS stage is nonempty.
     // Other groups can be deleted in below RemoveAllGroups()
@@ -2440,8 +2515,13 @@ TEST_F(AclManagerTest, DrainRuleTuplesToProcessSetRequestSucceeds)
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
               DrainRuleTuples(/*failure_before=*/false));
 
-    const auto &acl_rule_key = "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
-                               "fdf8:f53b:82e4::53:priority=15";
+    const auto acl_rule_key = KeyGenerator::generateAclRuleKey(
+        {{"ether_type", "0x0800"}, {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}}, 15);
+    EXPECT_EQ(KeyGenerator::generateAclRuleKey(
+                  {{"ether_type", "0x0800"},
+                   {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}},
+                  15),
+              acl_rule_key.to_string());
     const auto *acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
     ASSERT_NE(nullptr, acl_rule);
     EXPECT_EQ(kAclIngressRuleOid1, acl_rule->acl_entry_oid);
@@ -2489,8 +2569,8 @@ TEST_F(AclManagerTest, DrainRuleTuplesToProcessSetDelRequestSucceeds)
     std::vector<swss::FieldValueTuple> values;
     EXPECT_TRUE(counters_table->get(rule_tuple_key, values));
 
-    const auto &acl_rule_key = "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
-                               "fdf8:f53b:82e4::53:priority=15";
+    const auto acl_rule_key = KeyGenerator::generateAclRuleKey(
+        {{"ether_type", "0x0800"}, {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}}, 15);
     const auto *acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
     ASSERT_NE(nullptr, acl_rule);
     EXPECT_EQ(kAclIngressRuleOid1, acl_rule->acl_entry_oid);
@@ -2531,8 +2611,8 @@ TEST_F(AclManagerTest, DrainRuleTuplesToProcessSetRequestInvalidTableNameRuleKey
     EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND,
               DrainRuleTuples(/*failure_before=*/false));
 
-    auto acl_rule_key = "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
-                        "fdf8:f53b:82e4::53:priority=15";
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(
+        {{"ether_type", "0x0800"}, {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}}, 15);
     EXPECT_EQ(nullptr, GetAclRule("INVALID_TABLE_NAME", acl_rule_key));
 
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
@@ -2540,8 +2620,8 @@ TEST_F(AclManagerTest, DrainRuleTuplesToProcessSetRequestInvalidTableNameRuleKey
                         "ipv6_dst\":\"fdf8:f53b:82e4::53 & "
                         "fdf8:f53b:82e4::53\"}";
     rule_tuple_key = std::string(kAclIngressTableName) + kTableKeyDelimiter + acl_rule_json_key;
-    acl_rule_key = "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
-                   "fdf8:f53b:82e4::53";
+    acl_rule_key = KeyGenerator::generateAclRuleKey(
+        {{"ether_type", "0x0800"}, {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}}, 0);
     EnqueueRuleTuple(std::string(kAclIngressTableName),
                      swss::KeyOpFieldsValuesTuple({rule_tuple_key, SET_COMMAND, attributes}));
     // Drain rule tuple to process SET request without priority field in rule
@@ -2618,8 +2698,8 @@ TEST_F(AclManagerTest, DrainRuleTuplesWithInvalidCommand)
                 Eq(StatusCode::SWSS_RC_INVALID_PARAM), Eq(true)));
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM,
               DrainRuleTuples(/*failure_before=*/false));
-    const auto &acl_rule_key = "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
-                               "fdf8:f53b:82e4::53:priority=15";
+    const auto acl_rule_key = KeyGenerator::generateAclRuleKey(
+        {{"ether_type", "0x0800"}, {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}}, 15);
     EXPECT_EQ(nullptr, GetAclRule(kAclIngressTableName, acl_rule_key));
 }
 
@@ -2653,88 +2733,88 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidSaiMatchFails)
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
     app_db_entry.action = "punt_and_set_tc";
     app_db_entry.action_param_fvs["traffic_class"] = "0x20";
-    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     // ACL rule has invalid in/out port(s)
     app_db_entry.match_fvs["in_port"] = "Eth0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("in_port");
     app_db_entry.match_fvs["out_port"] = "Eth0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("out_port");
     app_db_entry.match_fvs["in_ports"] = "Eth0,Eth1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["in_ports"] = "";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("in_ports");
     app_db_entry.match_fvs["out_ports"] = "";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["out_ports"] = "Eth0,Eth1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("out_ports");
 
     // ACL rule has invalid ipv6_dst
     app_db_entry.match_fvs["ipv6_dst"] = "10.0.0.2";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ipv6_dst"] = "10.0.0.2 & 255.255.255.0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ipv6_dst"] = "fdf8:f53b:82e4::53 & 255.255.255.0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ipv6_dst"] = "null";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ipv6_dst"] = "fdf8:f53b:82e4::53";
 
     // ACL rule has invalid ip_src
     app_db_entry.match_fvs["ip_src"] = "fdf8:f53b:82e4::53";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ip_src"] = "fdf8:f53b:82e4::53 & ffff:ffff:ffff::";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ip_src"] = "10.0.0.2 & ffff:ffff:ffff::";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ip_src"] = "null";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ip_src"] = "10.0.0.2";
 
     // ACL rule has invalid ether_type
     app_db_entry.match_fvs["ether_type"] = "0x88800";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["ether_type"] = "0x0800";
 
     // ACL rule has invalid ip_frag
     app_db_entry.match_fvs["ip_frag"] = "invalid";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("ip_frag");
 
     // ACL rule has invalid packet_vlan
     app_db_entry.match_fvs["packet_vlan"] = "invalid";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("packet_vlan");
 
     // ACL rule has invalid UDF field: should be HEX_STRING
     app_db_entry.match_fvs["arp_tpa"] = "invalid";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
 
     // ACL rule has invalid UDF field: invalid HEX_STRING length
     app_db_entry.match_fvs["arp_tpa"] = "0xff";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
 
     // ACL table misses UDF group definition
@@ -2743,7 +2823,7 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidSaiMatchFails)
     std::map<std::string, uint16_t> saved_udf_group_attr_index_lookup = acl_table->udf_group_attr_index_lookup;
     acl_table->udf_group_attr_index_lookup.clear();
     app_db_entry.match_fvs["arp_tpa"] = "0xff112231";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     // TODO: Expect critical state.
     EXPECT_EQ(StatusCode::SWSS_RC_INTERNAL, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("arp_tpa");
@@ -2752,14 +2832,14 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidSaiMatchFails)
     // ACL rule has invalid VRF ID.
     app_db_entry.match_fvs["vrf_id"] = "invalid";
     acl_rule_key =
-        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND,
               ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("vrf_id");
 
     // ACL rule has undefined match field
     app_db_entry.match_fvs["undefined"] = "1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs.erase("undefined");
 }
@@ -2770,21 +2850,21 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidCompositeSaiMatchFails)
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
     app_db_entry.action = "punt_and_set_tc";
     app_db_entry.action_param_fvs["traffic_class"] = "0x20";
-    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     // ACL rule has invalid src_ipv6_64bit(composite SAI field) - should be ipv6
     // address
     app_db_entry.match_fvs["src_ipv6_64bit"] = "Eth0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["src_ipv6_64bit"] = "10.0.0.1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["src_ipv6_64bit"] = "10.0.0.1 & ffff:ffff::";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     app_db_entry.match_fvs["src_ipv6_64bit"] = "fdf8:f53b:82e4:: & 255.255.255.255";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
 }
 
@@ -2839,7 +2919,7 @@ TEST_F(AclManagerTest, AclRuleWithValidMatchFields)
     app_db_entry.match_fvs["vrf_id"] = gVrfName;
     app_db_entry.match_fvs["ipmc_table_hit"] = "0x1";
 
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
         .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1), Return(SAI_STATUS_SUCCESS)));
@@ -3078,7 +3158,7 @@ TEST_F(AclManagerTest, AclRuleWithColorPacketActionsButNoRateLimit)
                           "\"fdf8:f53b:82e4::\",\"match/arp_tpa\": \"0xff112231\",\"match/udf2\": "
                           "\"0x9876 & 0xAAAA\",\"priority\":100}";
 
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     // Set user defined trap for QOS_QUEUE, and color packet actions in meter
     int queue_num = 8;
@@ -3127,7 +3207,7 @@ TEST_F(AclManagerTest, AclRuleWithColorPacketActionsButWithRateLimit) {
       "\"0x9876 & 0xAAAA\",\"priority\":100}";
 
   const auto& acl_rule_key =
-      KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+      KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
   // Set user defined trap for QOS_QUEUE, and color packet actions in meter
   int queue_num = 8;
@@ -3166,7 +3246,7 @@ TEST_F(AclManagerTest, AclRuleWithMockedPacketAction) {
   ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
   auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
   const auto& acl_rule_key =
-      KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+      KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
   // set packet action
   app_db_entry.action = "set_packet_action";
@@ -3227,7 +3307,7 @@ TEST_F(AclManagerTest, AclRuleWithValidAction)
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
 
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     // Redirect action
     app_db_entry.action = "redirect";
@@ -3581,7 +3661,7 @@ TEST_F(AclManagerTest, AclRuleWithVrfAction)
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
 
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     // Set vrf
     app_db_entry.action = "set_vrf";
@@ -3616,7 +3696,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
 
     // Successful cases
     // Wildcard match on IP_TYPE: SAI_ACL_IP_TYPE_ANY
-    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
         .WillRepeatedly(DoAll(SetArgPointee<0>(kAclIngressRuleOid1), Return(SAI_STATUS_SUCCESS)));
@@ -3637,7 +3717,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
 
     // is_ip { value: 0x1 mask: 0x1 } = SAI_ACL_IP_TYPE_IP
     app_db_entry.match_fvs["is_ip"] = "0x1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3649,7 +3729,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
 
     // is_ip { value: 0x0 mask: 0x1 } = SAI_ACL_IP_TYPE_NON_IP
     app_db_entry.match_fvs["is_ip"] = "0x0 & 0x1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3662,7 +3742,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // is_ipv4 { value: 0x1 mask: 0x1 } = SAI_ACL_IP_TYPE_IPV4ANY
     app_db_entry.match_fvs.erase("is_ip");
     app_db_entry.match_fvs["is_ipv4"] = "0x1 & 0x1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3674,7 +3754,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
 
     // is_ipv4 { value: 0x0 mask: 0x1 } = SAI_ACL_IP_TYPE_NON_IPV4
     app_db_entry.match_fvs["is_ipv4"] = "0x0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3687,7 +3767,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // is_ipv6 { value: 0x1 mask: 0x1 } = SAI_ACL_IP_TYPE_IPV6ANY
     app_db_entry.match_fvs.erase("is_ipv4");
     app_db_entry.match_fvs["is_ipv6"] = "0x1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3699,7 +3779,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
 
     // is_ipv6 { value: 0x0 mask: 0x1 } = SAI_ACL_IP_TYPE_NON_IPV6
     app_db_entry.match_fvs["is_ipv6"] = "0x0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3712,7 +3792,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // is_arp { value: 0x1 mask: 0x1 } = SAI_ACL_IP_TYPE_ARP
     app_db_entry.match_fvs.erase("is_ipv6");
     app_db_entry.match_fvs["is_arp"] = "0x1 & 0x1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3725,7 +3805,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // is_arp_request { value: 0x1 mask: 0x1 } = SAI_ACL_IP_TYPE_ARP_REQUEST
     app_db_entry.match_fvs.erase("is_arp");
     app_db_entry.match_fvs["is_arp_request"] = "0x1 & 0x1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3738,7 +3818,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // is_arp_reply { value: 0x1 mask: 0x1 } = SAI_ACL_IP_TYPE_ARP_REPLY
     app_db_entry.match_fvs.erase("is_arp_request");
     app_db_entry.match_fvs["is_arp_reply"] = "0x1 & 0x1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3751,7 +3831,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // Failed cases
     // is_arp_reply { value: 0x0 mask: 0x1 } = N/A
     app_db_entry.match_fvs["is_arp_reply"] = "0x0 & 0x1";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3760,7 +3840,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // is_arp_request { value: 0x0 mask: 0x1 } = N/A
     app_db_entry.match_fvs.erase("is_arp_reply");
     app_db_entry.match_fvs["is_arp_request"] = "0x0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3769,7 +3849,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // is_arp { value: 0x0 mask: 0x1 } = N/A
     app_db_entry.match_fvs.erase("is_arp_request");
     app_db_entry.match_fvs["is_arp"] = "0x0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3778,7 +3858,7 @@ TEST_F(AclManagerTest, AclRuleWithIpTypeBitEncoding)
     // is_ip { value: 0x1 mask: 0x0 } = N/A
     app_db_entry.match_fvs.erase("is_arp");
     app_db_entry.match_fvs["is_ip"] = "0x1 & 0x0";
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
     acl_rule = GetAclRule(kAclIngressTableName, acl_rule_key);
@@ -3792,7 +3872,7 @@ TEST_F(AclManagerTest, UpdateAclRuleWithActionMeterChange)
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
 
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     sai_object_id_t meter_oid;
     uint32_t ref_cnt;
     const auto &table_name_and_rule_key = concatTableNameAndRuleKey(kAclIngressTableName, acl_rule_key);
@@ -4218,7 +4298,7 @@ TEST_F(AclManagerTest, UpdateAclRuleWithVrfActionChange)
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
 
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
     const auto &table_name_and_rule_key = concatTableNameAndRuleKey(kAclIngressTableName, acl_rule_key);
     app_db_entry.action = "punt_and_set_tc";
     app_db_entry.action_param_fvs["traffic_class"] = "1";
@@ -4261,7 +4341,7 @@ TEST_F(AclManagerTest, UpdateAclRuleFailsWhenSaiCallFails)
 {
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "15");
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 15);
 
     sai_object_id_t meter_oid;
     uint32_t ref_cnt;
@@ -4497,7 +4577,7 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidActionFails)
 {
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "15");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 15);
 
     // ACL rule has redirect action with invalid next_hop_id
     const std::string next_hop_id = "ju1u32m1.atl11:qe-3/7";
@@ -4573,7 +4653,7 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidVrfActionFails)
 {
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "15");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 15);
 
     // ACL rule with invalid VRF name
     app_db_entry.action = "set_vrf";
@@ -4588,7 +4668,7 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidUnitsInTableFails)
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
     app_db_entry.action = "punt_and_set_tc";
     app_db_entry.action_param_fvs["traffic_class"] = "0x20";
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "15");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 15);
 
     // Invalid meter unit
     acl_table->meter_unit = "INVALID";
@@ -4605,7 +4685,7 @@ TEST_F(AclManagerTest, CreateAclRuleFailsWhenSaiCallFails)
 {
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "15");
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 15);
 
     // Set up an next hop mapping
     const std::string next_hop_id = "ju1u32m1.atl11:qe-1/7";
@@ -4630,7 +4710,7 @@ TEST_F(AclManagerTest, CreateAclRuleFailsWhenSaiCallFails)
     // Set VRF action
     app_db_entry.action = "set_vrf";
     app_db_entry.action_param_fvs["vrf"] = gVrfName;
-    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "15");
+    acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 15);
 
     // Fails to create ACL rule when sai_acl_api->create_acl_entry() fails
     EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _)).WillOnce(Return(SAI_STATUS_SUCCESS));
@@ -4675,7 +4755,7 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidSetSrcIpActionFails)
 {
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     app_db_entry.action = "set_src_ip";
     app_db_entry.action_param_fvs["ip_address"] = "fdf8:f53b:82e4::53";
@@ -4689,7 +4769,7 @@ TEST_F(AclManagerTest, CreateAclRuleWithInvalidSetDstIpv6ActionFails)
 {
     ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "100");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 100);
 
     app_db_entry.action = "set_dst_ipv6";
     app_db_entry.action_param_fvs["ip_address"] = "10.0.0.2";
@@ -4705,7 +4785,7 @@ TEST_F(AclManagerTest, DeleteAclRuleWhenTableDoesNotExistFails)
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
     app_db_entry.action = "punt_and_set_tc";
     app_db_entry.action_param_fvs["traffic_class"] = "0x20";
-    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, "15");
+    const auto &acl_rule_key = KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, 15);
     EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
         .Times(2)
         .WillRepeatedly(DoAll(SetArgPointee<0>(kAclIngressRuleOid1), Return(SAI_STATUS_SUCCESS)));
@@ -4749,7 +4829,7 @@ TEST_F(AclManagerTest, DoAclCounterStatsTaskSucceeds)
     // Insert the first ACL rule
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
     const auto &acl_rule_key =
-        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, std::to_string(app_db_entry.priority));
+        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, app_db_entry.priority);
     const auto &counter_stats_key = app_db_entry.db_key;
     std::vector<swss::FieldValueTuple> values;
     std::string stats;
@@ -4880,7 +4960,7 @@ TEST_F(AclManagerTest, DoAclCounterStatsTaskFailsWhenSaiCallFails)
     // Insert the ACL rule
     auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
     const auto &acl_rule_key =
-        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, std::to_string(app_db_entry.priority));
+        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, app_db_entry.priority);
     const auto &counter_stats_key = app_db_entry.db_key;
     std::vector<swss::FieldValueTuple> values;
     std::string stats;
@@ -4920,6 +5000,54 @@ TEST_F(AclManagerTest, DoAclCounterStatsTaskFailsWhenSaiCallFails)
     EXPECT_EQ(nullptr, GetAclRule(kAclIngressTableName, acl_rule_key));
 }
 
+TEST_F(AclManagerTest, DoAclCounterStatsTaskWritesChangedStatsOnly)
+{
+    ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
+    auto counters_table = std::make_unique<swss::Table>(gCountersDb, std::string(COUNTERS_TABLE) +
+                                                                         DEFAULT_KEY_SEPARATOR + APP_P4RT_TABLE_NAME);
+
+    // Insert the ACL rule
+    auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
+    const auto &acl_rule_key =
+        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, app_db_entry.priority);
+    const auto &counter_stats_key = app_db_entry.db_key;
+    std::vector<swss::FieldValueTuple> values;
+    app_db_entry.action = "set_dst_ipv6";
+    app_db_entry.action_param_fvs["ip_address"] = "fdf8:f53b:82e4::53";
+    EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
+
+    uint64_t packets = 50;
+    EXPECT_CALL(mock_sai_acl_, get_acl_counter_attribute(Eq(kAclCounterOid1), _, _))
+        .Times(3)
+        .WillRepeatedly(DoAll(Invoke([&packets](sai_object_id_t acl_counter_id, uint32_t attr_count,
+                                                sai_attribute_t *counter_attr) {
+                                  for (uint32_t i = 0; i < attr_count; i++)
+                                  {
+                                      counter_attr[i].value.u64 = packets * (i + 1);
+                                  }
+                              }),
+                              Return(SAI_STATUS_SUCCESS)));
+    DoAclCounterStatsTask();
+    EXPECT_TRUE(counters_table->get(counter_stats_key, values));
+
+    // The stats didn't change, they are not written again
+    counters_table->del(counter_stats_key);
+    DoAclCounterStatsTask();
+    EXPECT_FALSE(counters_table->get(counter_stats_key, values));
+
+    packets = 60;
+    DoAclCounterStatsTask();
+    std::string stats;
+    EXPECT_TRUE(counters_table->hget(counter_stats_key, P4_COUNTER_STATS_PACKETS, stats));
+    EXPECT_EQ("60", stats);
+}
+
 TEST_F(AclManagerTest, DISABLED_InitCreateGroupFails)
 {
     // Failed to create ACL groups
@@ -5123,18 +5251,24 @@ TEST_F(AclManagerTest, DrainRuleNotExecuted) {
   EXPECT_EQ(
       nullptr,
       GetAclRule(kAclIngressTableName,
-                 "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
-                 "fdf8:f53b:82e4::53:priority=15"));
+                 KeyGenerator::generateAclRuleKey(
+                     {{"ether_type", "0x0800"},
+                      {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}},
+                     15)));
   EXPECT_EQ(
       nullptr,
       GetAclRule(kAclIngressTableName,
-                 "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::54 & "
-                 "fdf8:f53b:82e4::54:priority=15"));
+                 KeyGenerator::generateAclRuleKey(
+                     {{"ether_type", "0x0800"},
+                      {"ipv6_dst", "fdf8:f53b:82e4::54 & fdf8:f53b:82e4::54"}},
+                     15)));
   EXPECT_EQ(
       nullptr,
       GetAclRule(kAclIngressTableName,
-                 "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::55 & "
-                 "fdf8:f53b:82e4::55:priority=15"));
+                 KeyGenerator::generateAclRuleKey(
+                     {{"ether_type", "0x0800"},
+                      {"ipv6_dst", "fdf8:f53b:82e4::55 & fdf8:f53b:82e4::55"}},
+                     15)));
 }
 
 TEST_F(AclManagerTest, DrainRuleStopOnFirstFailure) {
@@ -5169,24 +5303,32 @@ TEST_F(AclManagerTest, DrainRuleStopOnFirstFailure) {
                    swss::KeyOpFieldsValuesTuple(
                        {rule_tuple_key_3, SET_COMMAND, attributes}));
 
+  // The meters and counters of the 3 rules are created, the entries are
+  // created in one bulk call which fails on the second one. The meters and
+  // counters of the rules 2 and 3 are removed.
+  EXPECT_CALL(mock_sai_acl_,
+              bulk_object_create(_, Eq(SAI_OBJECT_TYPE_ACL_ENTRY), Eq(3u), _,
+                                 _, Eq(SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR),
+                                 _, _))
+      .WillOnce(Invoke(CreateObjectsOneByOne));
   EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
       .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1),
                       Return(SAI_STATUS_SUCCESS)))
       .WillOnce(Return(SAI_STATUS_FAILURE));
   EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
-      .WillOnce(
-          DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(
+      .Times(3)
+      .WillRepeatedly(
           DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)));
   EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
-      .WillOnce(
-          DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(
+      .Times(3)
+      .WillRepeatedly(
           DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)));
   EXPECT_CALL(mock_sai_acl_, remove_acl_counter(_))
-      .WillOnce(Return(SAI_STATUS_SUCCESS));
+      .Times(2)
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
   EXPECT_CALL(mock_sai_policer_, remove_policer(_))
-      .WillOnce(Return(SAI_STATUS_SUCCESS));
+      .Times(2)
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
   EXPECT_CALL(
       *gMockResponsePublisher,
       publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_1), Eq(attributes),
@@ -5204,18 +5346,341 @@ TEST_F(AclManagerTest, DrainRuleStopOnFirstFailure) {
   EXPECT_NE(
       nullptr,
       GetAclRule(kAclIngressTableName,
-                 "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
-                 "fdf8:f53b:82e4::53:priority=15"));
+                 KeyGenerator::generateAclRuleKey(
+                     {{"ether_type", "0x0800"},
+                      {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}},
+                     15)));
   EXPECT_EQ(
       nullptr,
       GetAclRule(kAclIngressTableName,
-                 "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::54 & "
-                 "fdf8:f53b:82e4::54:priority=15"));
+                 KeyGenerator::generateAclRuleKey(
+                     {{"ether_type", "0x0800"},
+                      {"ipv6_dst", "fdf8:f53b:82e4::54 & fdf8:f53b:82e4::54"}},
+                     15)));
   EXPECT_EQ(
       nullptr,
       GetAclRule(kAclIngressTableName,
-                 "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::55 & "
-                 "fdf8:f53b:82e4::55:priority=15"));
+                 KeyGenerator::generateAclRuleKey(
+                     {{"ether_type", "0x0800"},
+                      {"ipv6_dst", "fdf8:f53b:82e4::55 & fdf8:f53b:82e4::55"}},
+                     15)));
+}
+
+TEST_F(AclManagerTest, DrainRuleTuplesChangingSameRuleSucceeds) {
+  ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
+  auto attributes = getDefaultRuleFieldValueTuples();
+  const auto& acl_rule_json_key_1 =
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::53 & "
+      "fdf8:f53b:82e4::53\",\"priority\":15}";
+  const auto& rule_tuple_key_1 = std::string(kAclIngressTableName) +
+                                 kTableKeyDelimiter + acl_rule_json_key_1;
+  const auto& acl_rule_json_key_2 =
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::54 & "
+      "fdf8:f53b:82e4::54\",\"priority\":15}";
+  const auto& rule_tuple_key_2 = std::string(kAclIngressTableName) +
+                                 kTableKeyDelimiter + acl_rule_json_key_2;
+
+  // The rule 1 is created, removed and created again in the same drain.
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, SET_COMMAND, attributes}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, SET_COMMAND, attributes}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, DEL_COMMAND, {}}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, SET_COMMAND, attributes}));
+
+  {
+    InSequence s;
+    EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclMeterOid1),
+                        Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclMeterOid2),
+                        Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclCounterOid1),
+                        Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclCounterOid1 + 1),
+                        Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1),
+                        Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid2),
+                        Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, remove_acl_entry(Eq(kAclIngressRuleOid1)))
+        .WillOnce(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_policer_, remove_policer(Eq(kAclMeterOid1)))
+        .WillOnce(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_acl_, remove_acl_counter(Eq(kAclCounterOid1)))
+        .WillOnce(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclMeterOid1),
+                        Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclCounterOid1),
+                        Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1),
+                        Return(SAI_STATUS_SUCCESS)));
+  }
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_1), _,
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)))
+      .Times(3);
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_2), Eq(attributes),
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
+            DrainRuleTuples(/*failure_before=*/false));
+  const auto* acl_rule = GetAclRule(
+      kAclIngressTableName,
+      KeyGenerator::generateAclRuleKey(
+          {{"ether_type", "0x0800"},
+           {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}},
+          15));
+  ASSERT_NE(nullptr, acl_rule);
+  EXPECT_EQ(kAclIngressRuleOid1, acl_rule->acl_entry_oid);
+  EXPECT_NE(
+      nullptr,
+      GetAclRule(kAclIngressTableName,
+                 KeyGenerator::generateAclRuleKey(
+                     {{"ether_type", "0x0800"},
+                      {"ipv6_dst", "fdf8:f53b:82e4::54 & fdf8:f53b:82e4::54"}},
+                     15)));
+}
+
+TEST_F(AclManagerTest, DrainRuleTuplesUsesOneBulkCallPerObjectType) {
+  ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
+  auto attributes = getDefaultRuleFieldValueTuples();
+  const auto& rule_tuple_key_1 =
+      std::string(kAclIngressTableName) + kTableKeyDelimiter +
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::53 & "
+      "fdf8:f53b:82e4::53\",\"priority\":15}";
+  const auto& rule_tuple_key_2 =
+      std::string(kAclIngressTableName) + kTableKeyDelimiter +
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::54 & "
+      "fdf8:f53b:82e4::54\",\"priority\":15}";
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, SET_COMMAND, attributes}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, SET_COMMAND, attributes}));
+
+  for (auto object_type : {SAI_OBJECT_TYPE_POLICER, SAI_OBJECT_TYPE_ACL_COUNTER,
+                           SAI_OBJECT_TYPE_ACL_ENTRY}) {
+    EXPECT_CALL(mock_sai_acl_,
+                bulk_object_create(Eq(gSwitchId), Eq(object_type), Eq(2u), _,
+                                   _, _, _, _))
+        .WillOnce(Invoke(CreateObjectsOneByOne));
+  }
+  EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+      .WillOnce(
+          DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(
+          DoAll(SetArgPointee<0>(kAclMeterOid2), Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+      .WillOnce(
+          DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclCounterOid1 + 1),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1),
+                      Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid2),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), _, Eq(attributes),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)))
+      .Times(2);
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
+            DrainRuleTuples(/*failure_before=*/false));
+  const auto acl_rule_key_1 = KeyGenerator::generateAclRuleKey(
+      {{"ether_type", "0x0800"},
+       {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}},
+      15);
+  const auto acl_rule_key_2 = KeyGenerator::generateAclRuleKey(
+      {{"ether_type", "0x0800"},
+       {"ipv6_dst", "fdf8:f53b:82e4::54 & fdf8:f53b:82e4::54"}},
+      15);
+  auto* acl_rule_1 = GetAclRule(kAclIngressTableName, acl_rule_key_1);
+  auto* acl_rule_2 = GetAclRule(kAclIngressTableName, acl_rule_key_2);
+  ASSERT_NE(nullptr, acl_rule_1);
+  ASSERT_NE(nullptr, acl_rule_2);
+  EXPECT_EQ(kAclIngressRuleOid1, acl_rule_1->acl_entry_oid);
+  EXPECT_EQ(kAclMeterOid1, acl_rule_1->meter.meter_oid);
+  EXPECT_EQ(kAclCounterOid1, acl_rule_1->counter.counter_oid);
+  EXPECT_EQ(kAclIngressRuleOid2, acl_rule_2->acl_entry_oid);
+  EXPECT_EQ(kAclMeterOid2, acl_rule_2->meter.meter_oid);
+  EXPECT_EQ(kAclCounterOid1 + 1, acl_rule_2->counter.counter_oid);
+  uint32_t ref_cnt;
+  EXPECT_TRUE(p4_oid_mapper_->getRefCount(
+      SAI_OBJECT_TYPE_POLICER,
+      concatTableNameAndRuleKey(kAclIngressTableName, acl_rule_key_2),
+      &ref_cnt));
+  EXPECT_EQ(1, ref_cnt);
+  EXPECT_TRUE(p4_oid_mapper_->getRefCount(
+      SAI_OBJECT_TYPE_ACL_COUNTER,
+      concatTableNameAndRuleKey(kAclIngressTableName, acl_rule_key_2),
+      &ref_cnt));
+  EXPECT_EQ(1, ref_cnt);
+
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, DEL_COMMAND, {}}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, DEL_COMMAND, {}}));
+  for (auto object_type : {SAI_OBJECT_TYPE_ACL_ENTRY, SAI_OBJECT_TYPE_POLICER,
+                           SAI_OBJECT_TYPE_ACL_COUNTER}) {
+    EXPECT_CALL(mock_sai_acl_,
+                bulk_object_remove(Eq(object_type), Eq(2u), _, _, _))
+        .WillOnce(Invoke(RemoveObjectsOneByOne));
+  }
+  EXPECT_CALL(mock_sai_acl_, remove_acl_entry(Eq(kAclIngressRuleOid1)))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_entry(Eq(kAclIngressRuleOid2)))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_policer_, remove_policer(Eq(kAclMeterOid1)))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_policer_, remove_policer(Eq(kAclMeterOid2)))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_counter(Eq(kAclCounterOid1)))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_counter(Eq(kAclCounterOid1 + 1)))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), _, _,
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)))
+      .Times(2);
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
+            DrainRuleTuples(/*failure_before=*/false));
+  EXPECT_EQ(nullptr, GetAclRule(kAclIngressTableName, acl_rule_key_1));
+  EXPECT_EQ(nullptr, GetAclRule(kAclIngressTableName, acl_rule_key_2));
+  EXPECT_FALSE(p4_oid_mapper_->existsOID(
+      SAI_OBJECT_TYPE_POLICER,
+      concatTableNameAndRuleKey(kAclIngressTableName, acl_rule_key_2)));
+  EXPECT_FALSE(p4_oid_mapper_->existsOID(
+      SAI_OBJECT_TYPE_ACL_COUNTER,
+      concatTableNameAndRuleKey(kAclIngressTableName, acl_rule_key_2)));
+}
+
+TEST_F(AclManagerTest, DrainRuleDeleteRestoresRulesOnCounterFailure) {
+  ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
+  auto attributes = getDefaultRuleFieldValueTuples();
+  const auto& rule_tuple_key_1 =
+      std::string(kAclIngressTableName) + kTableKeyDelimiter +
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::53 & "
+      "fdf8:f53b:82e4::53\",\"priority\":15}";
+  const auto& rule_tuple_key_2 =
+      std::string(kAclIngressTableName) + kTableKeyDelimiter +
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::54 & "
+      "fdf8:f53b:82e4::54\",\"priority\":15}";
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, SET_COMMAND, attributes}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, SET_COMMAND, attributes}));
+  EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+      .WillOnce(
+          DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(
+          DoAll(SetArgPointee<0>(kAclMeterOid2), Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+      .WillOnce(
+          DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclCounterOid1 + 1),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1),
+                      Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid2),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), _, Eq(attributes),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)))
+      .Times(2);
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
+            DrainRuleTuples(/*failure_before=*/false));
+
+  // The entries and the meters are removed, the first counter fails: both
+  // rules are created back with new meters and their remaining counters.
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, DEL_COMMAND, {}}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, DEL_COMMAND, {}}));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_entry(_))
+      .Times(2)
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_policer_, remove_policer(_))
+      .Times(2)
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_counter(Eq(kAclCounterOid1)))
+      .WillOnce(Return(SAI_STATUS_FAILURE));
+  EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclMeterOid1 + 10),
+                      Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclMeterOid2 + 10),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1),
+                      Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid2),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_1), _,
+                      Eq(StatusCode::SWSS_RC_UNKNOWN), Eq(true)));
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_2), _,
+                      Eq(StatusCode::SWSS_RC_NOT_EXECUTED), Eq(true)));
+  EXPECT_EQ(StatusCode::SWSS_RC_UNKNOWN,
+            DrainRuleTuples(/*failure_before=*/false));
+
+  const auto acl_rule_key_1 = KeyGenerator::generateAclRuleKey(
+      {{"ether_type", "0x0800"},
+       {"ipv6_dst", "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53"}},
+      15);
+  const auto acl_rule_key_2 = KeyGenerator::generateAclRuleKey(
+      {{"ether_type", "0x0800"},
+       {"ipv6_dst", "fdf8:f53b:82e4::54 & fdf8:f53b:82e4::54"}},
+      15);
+  const auto* acl_rule_1 = GetAclRule(kAclIngressTableName, acl_rule_key_1);
+  const auto* acl_rule_2 = GetAclRule(kAclIngressTableName, acl_rule_key_2);
+  ASSERT_NE(nullptr, acl_rule_1);
+  ASSERT_NE(nullptr, acl_rule_2);
+  EXPECT_EQ(kAclMeterOid1 + 10, acl_rule_1->meter.meter_oid);
+  EXPECT_EQ(kAclCounterOid1, acl_rule_1->counter.counter_oid);
+  EXPECT_EQ(kAclMeterOid2 + 10, acl_rule_2->meter.meter_oid);
+  EXPECT_EQ(kAclCounterOid1 + 1, acl_rule_2->counter.counter_oid);
+  for (const auto& acl_rule_key : {acl_rule_key_1, acl_rule_key_2}) {
+    const auto table_name_and_rule_key =
+        concatTableNameAndRuleKey(kAclIngressTableName, acl_rule_key);
+    uint32_t ref_cnt;
+    EXPECT_TRUE(p4_oid_mapper_->getRefCount(
+        SAI_OBJECT_TYPE_POLICER, table_name_and_rule_key, &ref_cnt));
+    EXPECT_EQ(1, ref_cnt);
+    EXPECT_TRUE(p4_oid_mapper_->getRefCount(
+        SAI_OBJECT_TYPE_ACL_COUNTER, table_name_and_rule_key, &ref_cnt));
+    EXPECT_EQ(1, ref_cnt);
+  }
 }
 
 TEST_F(AclManagerTest, AclTableVerifyStateTest)
@@ -5557,7 +6022,7 @@ TEST_F(AclManagerTest, AclRuleVerifyStateTest)
 
     // Verification should fail if ACL rule key mismatches.
     auto saved_acl_rule_key = acl_rule->acl_rule_key;
-    acl_rule->acl_rule_key = "invalid";
+    acl_rule->acl_rule_key = P4Key("invalid");
     EXPECT_FALSE(VerifyRuleState(db_key, attributes).empty());
     acl_rule->acl_rule_key = saved_acl_rule_key;
 
@@ -6073,5 +6538,77 @@ TEST_F(AclManagerTest, AclRuleVerifyStateAsicDbTest)
             swss::FieldValueTuple{"SAI_POLICER_ATTR_GREEN_PACKET_ACTION", "SAI_PACKET_ACTION_COPY"}});
 }
 
+// Programming rate of the ACL rules of a drain, from the APP DB entries to
+// the SAI calls and the responses.
+TEST_F(AclManagerTest, AclRuleProgrammingRate) {
+  constexpr uint32_t kNumRules = 1024;
+  ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
+  auto attributes = getDefaultRuleFieldValueTuples();
+  std::vector<std::string> rule_tuple_keys;
+  for (uint32_t i = 0; i < kNumRules; i++) {
+    nlohmann::json j;
+    j[prependMatchField("ether_type")] = "0x0800";
+    j[prependMatchField("ipv6_dst")] =
+        "fdf8:f53b:82e4::" + std::to_string(i) +
+        " & ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff";
+    j[kPriority] = 15;
+    rule_tuple_keys.push_back(std::string(kAclIngressTableName) +
+                              kTableKeyDelimiter + j.dump());
+  }
+
+  sai_object_id_t next_oid = kAclIngressRuleOid1;
+  auto create_oid = [&next_oid](sai_object_id_t* oid, sai_object_id_t,
+                                uint32_t, const sai_attribute_t*) {
+    *oid = next_oid++;
+    return SAI_STATUS_SUCCESS;
+  };
+  EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+      .WillRepeatedly(Invoke(create_oid));
+  EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+      .WillRepeatedly(Invoke(create_oid));
+  EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+      .WillRepeatedly(Invoke(create_oid));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_entry(_))
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_counter(_))
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_policer_, remove_policer(_))
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), _, _,
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)))
+      .Times(2 * kNumRules);
+
+  auto run = [&](const std::string& command) {
+    for (const auto& rule_tuple_key : rule_tuple_keys) {
+      EnqueueRuleTuple(std::string(kAclIngressTableName),
+                       swss::KeyOpFieldsValuesTuple(
+                           {rule_tuple_key, command,
+                            command == SET_COMMAND
+                                ? attributes
+                                : std::vector<swss::FieldValueTuple>{}}));
+    }
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
+              DrainRuleTuples(/*failure_before=*/false));
+    return static_cast<double>(kNumRules) /
+           std::chrono::duration_cast<std::chrono::duration<double>>(
+               std::chrono::steady_clock::now() - start)
+               .count();
+  };
+
+  auto num_rules = p4_oid_mapper_->getNumEntries(SAI_OBJECT_TYPE_ACL_ENTRY);
+  double create_rate = run(SET_COMMAND);
+  EXPECT_EQ(num_rules + kNumRules,
+            p4_oid_mapper_->getNumEntries(SAI_OBJECT_TYPE_ACL_ENTRY));
+  double delete_rate = run(DEL_COMMAND);
+  EXPECT_EQ(num_rules,
+            p4_oid_mapper_->getNumEntries(SAI_OBJECT_TYPE_ACL_ENTRY));
+
+  std::cout << "[ AclRuleManager ] " << kNumRules << " rules: create "
+            << static_cast<uint64_t>(create_rate) << " /sec, delete "
+            << static_cast<uint64_t>(delete_rate) << " /sec" << std::endl;
+}
+
 } // namespace test
 } // namespace p4orch
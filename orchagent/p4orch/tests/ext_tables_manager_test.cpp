@@ -0,0 +1,199 @@
+#include "ext_tables_manager.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "acl_util.h"
+#include "mock_response_publisher.h"
+#include "mock_sai_counter.h"
+#include "mock_sai_hostif.h"
+#include "mock_sai_switch.h"
+#include "p4oidmapper.h"
+#include "p4orch.h"
+#include "p4orch_util.h"
+#include "table.h"
+#include "tables_definition_manager.h"
+
+extern "C"
+{
+#include "sai.h"
+}
+
+using ::p4orch::kTableKeyDelimiter;
+
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Eq;
+using ::testing::Return;
+using ::testing::SetArrayArgument;
+using ::testing::StrictMock;
+using ::testing::UnorderedElementsAre;
+
+extern P4Orch *gP4Orch;
+extern VRFOrch *gVrfOrch;
+extern swss::DBConnector *gAppDb;
+extern swss::DBConnector *gCountersDb;
+extern sai_hostif_api_t *sai_hostif_api;
+extern sai_switch_api_t *sai_switch_api;
+extern sai_counter_api_t *sai_counter_api;
+
+namespace swss
+{
+namespace fake_db
+{
+
+extern std::map<std::string, std::vector<std::vector<KeyOpFieldsValuesTuple>>> gFlushedWrites;
+
+} // namespace fake_db
+} // namespace swss
+
+namespace
+{
+
+constexpr char *kExtTableName1 = "ext_table_1";
+constexpr char *kExtTableName2 = "ext_table_2";
+constexpr char *kExtTableKey1 = R"({"match/ipv4_dst":"10.0.0.1"})";
+constexpr char *kExtTableKey2 = R"({"match/ipv4_dst":"10.0.0.2"})";
+constexpr sai_object_id_t kExtTableEntryOid1 = 0x1001;
+constexpr sai_object_id_t kExtTableEntryOid2 = 0x1002;
+constexpr sai_object_id_t kCounterOid1 = 0x2001;
+constexpr sai_object_id_t kCounterOid2 = 0x2002;
+
+std::string CountersTableName()
+{
+    return std::string(COUNTERS_TABLE) + DEFAULT_KEY_SEPARATOR + APP_P4RT_TABLE_NAME;
+}
+
+std::string DbKey(const std::string &table_name, const std::string &table_key)
+{
+    return table_name + kTableKeyDelimiter + table_key;
+}
+
+} // namespace
+
+class ExtTablesManagerTest : public ::testing::Test
+{
+  protected:
+    ExtTablesManagerTest() : ext_tables_manager_(&p4_oid_mapper_, gVrfOrch, &publisher_)
+    {
+        mock_sai_hostif = &mock_sai_hostif_;
+        mock_sai_switch = &mock_sai_switch_;
+        sai_switch_api->get_switch_attribute = mock_get_switch_attribute;
+        sai_hostif_api->create_hostif_trap = mock_create_hostif_trap;
+        sai_hostif_api->create_hostif_table_entry = mock_create_hostif_table_entry;
+        EXPECT_CALL(mock_sai_hostif_, create_hostif_table_entry(_, _, _, _)).WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+        EXPECT_CALL(mock_sai_hostif_, create_hostif_trap(_, _, _, _)).WillOnce(Return(SAI_STATUS_SUCCESS));
+        EXPECT_CALL(mock_sai_switch_, get_switch_attribute(_, _, _)).WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+        copp_orch_ = new CoppOrch(gAppDb, APP_COPP_TABLE_NAME);
+        std::vector<std::string> p4_tables;
+        gP4Orch = new P4Orch(gAppDb, p4_tables, gVrfOrch, copp_orch_);
+        gP4Orch->tablesinfo = &tables_info_;
+    }
+
+    ~ExtTablesManagerTest()
+    {
+        gP4Orch->tablesinfo = nullptr;
+        delete gP4Orch;
+        delete copp_orch_;
+    }
+
+    void SetUp() override
+    {
+        mock_sai_counter = &mock_sai_counter_;
+        sai_counter_api->get_counter_stats = mock_get_counter_stats;
+        swss::fake_db::gFlushedWrites.clear();
+    }
+
+    // Adds an extension table with counters and an entry of the table.
+    void AddExtTableEntry(const std::string &table_name, const std::string &table_key, sai_object_id_t entry_oid,
+                          sai_object_id_t counter_oid)
+    {
+        TableInfo table_info;
+        table_info.name = table_name;
+        table_info.id = static_cast<int>(tables_info_.m_tableInfoMap.size());
+        table_info.precedence = table_info.id;
+        table_info.counter_bytes_enabled = true;
+        table_info.counter_packets_enabled = true;
+        tables_info_.m_tableInfoMap[table_name] = table_info;
+
+        P4ExtTableEntry entry(DbKey(table_name, table_key), table_name, table_key);
+        entry.sai_entry_oid = entry_oid;
+        entry.sai_counter_oid = counter_oid;
+        ext_tables_manager_.m_extTables[table_name][table_key] = entry;
+    }
+
+    void DoExtCounterStatsTask()
+    {
+        ext_tables_manager_.doExtCounterStatsTask();
+    }
+
+    StrictMock<MockSaiHostif> mock_sai_hostif_;
+    StrictMock<MockSaiSwitch> mock_sai_switch_;
+    StrictMock<MockSaiCounter> mock_sai_counter_;
+    MockResponsePublisher publisher_;
+    P4OidMapper p4_oid_mapper_;
+    TablesInfo tables_info_;
+    CoppOrch *copp_orch_;
+    ExtTablesManager ext_tables_manager_;
+};
+
+TEST_F(ExtTablesManagerTest, DoExtCounterStatsTaskWritesAllTablesInOneFlush)
+{
+    AddExtTableEntry(kExtTableName1, kExtTableKey1, kExtTableEntryOid1, kCounterOid1);
+    AddExtTableEntry(kExtTableName2, kExtTableKey2, kExtTableEntryOid2, kCounterOid2);
+
+    const uint64_t stats1[] = {10, 1000};
+    const uint64_t stats2[] = {20, 2000};
+    EXPECT_CALL(mock_sai_counter_, get_counter_stats(Eq(kCounterOid1), Eq(2u), _, _))
+        .WillOnce(DoAll(SetArrayArgument<3>(stats1, stats1 + 2), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_counter_, get_counter_stats(Eq(kCounterOid2), Eq(2u), _, _))
+        .WillOnce(DoAll(SetArrayArgument<3>(stats2, stats2 + 2), Return(SAI_STATUS_SUCCESS)));
+    DoExtCounterStatsTask();
+
+    // The counters of both tables are written once each, in a single flush.
+    const auto &flushes = swss::fake_db::gFlushedWrites[CountersTableName()];
+    ASSERT_EQ(1u, flushes.size());
+    EXPECT_THAT(flushes[0],
+                UnorderedElementsAre(
+                    swss::KeyOpFieldsValuesTuple{DbKey(kExtTableName1, kExtTableKey1), SET_COMMAND,
+                                                 {{P4_COUNTER_STATS_PACKETS, "10"}, {P4_COUNTER_STATS_BYTES, "1000"}}},
+                    swss::KeyOpFieldsValuesTuple{DbKey(kExtTableName2, kExtTableKey2), SET_COMMAND,
+                                                 {{P4_COUNTER_STATS_PACKETS, "20"}, {P4_COUNTER_STATS_BYTES, "2000"}}}));
+
+    swss::Table counters_table(gCountersDb, CountersTableName());
+    std::string stats;
+    EXPECT_TRUE(counters_table.hget(DbKey(kExtTableName1, kExtTableKey1), P4_COUNTER_STATS_BYTES, stats));
+    EXPECT_EQ("1000", stats);
+    EXPECT_TRUE(counters_table.hget(DbKey(kExtTableName2, kExtTableKey2), P4_COUNTER_STATS_BYTES, stats));
+    EXPECT_EQ("2000", stats);
+}
+
+TEST_F(ExtTablesManagerTest, DoExtCounterStatsTaskSkipsUnchangedCounters)
+{
+    AddExtTableEntry(kExtTableName1, kExtTableKey1, kExtTableEntryOid1, kCounterOid1);
+    AddExtTableEntry(kExtTableName2, kExtTableKey2, kExtTableEntryOid2, kCounterOid2);
+
+    const uint64_t stats1[] = {10, 1000};
+    const uint64_t stats2[] = {20, 2000};
+    const uint64_t new_stats2[] = {30, 3000};
+    EXPECT_CALL(mock_sai_counter_, get_counter_stats(Eq(kCounterOid1), Eq(2u), _, _))
+        .Times(2)
+        .WillRepeatedly(DoAll(SetArrayArgument<3>(stats1, stats1 + 2), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_counter_, get_counter_stats(Eq(kCounterOid2), Eq(2u), _, _))
+        .WillOnce(DoAll(SetArrayArgument<3>(stats2, stats2 + 2), Return(SAI_STATUS_SUCCESS)))
+        .WillOnce(DoAll(SetArrayArgument<3>(new_stats2, new_stats2 + 2), Return(SAI_STATUS_SUCCESS)));
+    DoExtCounterStatsTask();
+    DoExtCounterStatsTask();
+
+    // The second poll only writes the counters which changed.
+    const auto &flushes = swss::fake_db::gFlushedWrites[CountersTableName()];
+    ASSERT_EQ(2u, flushes.size());
+    EXPECT_THAT(flushes[1],
+                UnorderedElementsAre(
+                    swss::KeyOpFieldsValuesTuple{DbKey(kExtTableName2, kExtTableKey2), SET_COMMAND,
+                                                 {{P4_COUNTER_STATS_PACKETS, "30"}, {P4_COUNTER_STATS_BYTES, "3000"}}}));
+}
@@ -51,6 +51,11 @@ DBConnector::DBConnector(int dbId, const std::string &unixPath, unsigned int tim
 {
 }
 
+DBConnector *DBConnector::newConnector(unsigned int timeout) const
+{
+    return new DBConnector(m_dbId, /*unixPath=*/"", timeout);
+}
+
 int DBConnector::getDbId() const
 {
     return m_dbId;
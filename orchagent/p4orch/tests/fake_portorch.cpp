@@ -79,7 +79,7 @@ bool PortsOrch::setBridgePortLearningFDB(Port &port, sai_bridge_port_fdb_learnin
     return true;
 }
 
-bool PortsOrch::getPort(string alias, Port &port)
+bool PortsOrch::getPort(const string &alias, Port &port)
 {
     if (m_portList.find(alias) == m_portList.end())
     {
@@ -295,7 +295,7 @@ bool PortsOrch::removeVlanMember(Port &vlan, Port &port, string end_point_ip)
     return true;
 }
 
-bool PortsOrch::isVlanMember(Port &vlan, Port &port, string end_point_ip)
+bool PortsOrch::isVlanMember(const Port &vlan, const Port &port, const string &end_point_ip)
 {
     return true;
 }
@@ -1,4 +1,5 @@
 #include <map>
+#include <vector>
 
 #include "table.h"
 
@@ -13,6 +14,11 @@ namespace fake_db
 
 TablesT gTables;
 
+// The writes go to gTables right away. Each flush of a buffered table also
+// records the set and del since its previous flush as one batch, by table name.
+std::map<const Table *, std::vector<KeyOpFieldsValuesTuple>> gPendingWrites;
+std::map<std::string, std::vector<std::vector<KeyOpFieldsValuesTuple>>> gFlushedWrites;
+
 } // namespace fake_db
 
 using namespace fake_db;
@@ -21,8 +27,29 @@ Table::Table(const DBConnector *db, const std::string &tableName) : TableBase(ta
 {
 }
 
+Table::Table(RedisPipeline *pipeline, const std::string &tableName, bool buffered) : TableBase(tableName, ":")
+{
+    if (buffered)
+    {
+        gPendingWrites[this];
+    }
+}
+
 Table::~Table()
 {
+    gPendingWrites.erase(this);
+}
+
+void Table::flush()
+{
+    auto it = gPendingWrites.find(this);
+    if (it == gPendingWrites.end() || it->second.empty())
+    {
+        return;
+    }
+
+    gFlushedWrites[getTableName()].push_back(std::move(it->second));
+    it->second.clear();
 }
 
 void Table::hset(const std::string &key, const std::string &field, const std::string &value, const std::string & /*op*/,
@@ -39,6 +66,12 @@ void Table::set(const std::string &key, const std::vector<FieldValueTuple> &valu
     {
         fvs[fv.first] = fv.second;
     }
+
+    auto it = gPendingWrites.find(this);
+    if (it != gPendingWrites.end())
+    {
+        it->second.push_back(KeyOpFieldsValuesTuple{key, SET_COMMAND, values});
+    }
 }
 
 bool Table::hget(const std::string &key, const std::string &field, std::string &value)
@@ -76,6 +109,12 @@ bool Table::get(const std::string &key, std::vector<FieldValueTuple> &ovalues)
 void Table::del(const std::string &key, const std::string & /*op*/, const std::string & /*prefix*/)
 {
     gTables[getTableName()].erase(key);
+
+    auto it = gPendingWrites.find(this);
+    if (it != gPendingWrites.end())
+    {
+        it->second.push_back(KeyOpFieldsValuesTuple{key, DEL_COMMAND, {}});
+    }
 }
 
 void Table::hdel(const std::string &key, const std::string &field, const std::string & /*op*/,
@@ -66,3 +66,21 @@ sai_status_t set_acl_entry_attribute(sai_object_id_t acl_entry_id, const sai_att
 {
     return mock_sai_acl->set_acl_entry_attribute(acl_entry_id, attr);
 }
+
+// The ACL rules create and remove their entries, counters and policers with the
+// generic bulk SAI calls of sai.h, which are not in an API table.
+sai_status_t sai_bulk_object_create(sai_object_id_t switch_id, sai_object_type_t object_type, uint32_t object_count,
+                                    const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                                    sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id,
+                                    sai_status_t *object_statuses)
+{
+    return mock_sai_acl->bulk_object_create(switch_id, object_type, object_count, attr_count, attr_list, mode,
+                                            object_id, object_statuses);
+}
+
+sai_status_t sai_bulk_object_remove(sai_object_type_t object_type, uint32_t object_count,
+                                    const sai_object_id_t *object_id, sai_bulk_op_error_mode_t mode,
+                                    sai_status_t *object_statuses)
+{
+    return mock_sai_acl->bulk_object_remove(object_type, object_count, object_id, mode, object_statuses);
+}
@@ -29,6 +29,13 @@ class SaiAclInterface
     virtual sai_status_t get_acl_counter_attribute(sai_object_id_t acl_counter_id, uint32_t attr_count,
                                                    sai_attribute_t *attr_list) = 0;
     virtual sai_status_t set_acl_entry_attribute(sai_object_id_t acl_entry_id, const sai_attribute_t *attr) = 0;
+    virtual sai_status_t bulk_object_create(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                            uint32_t object_count, const uint32_t *attr_count,
+                                            const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+                                            sai_object_id_t *object_id, sai_status_t *object_statuses) = 0;
+    virtual sai_status_t bulk_object_remove(sai_object_type_t object_type, uint32_t object_count,
+                                            const sai_object_id_t *object_id, sai_bulk_op_error_mode_t mode,
+                                            sai_status_t *object_statuses) = 0;
 };
 
 class MockSaiAcl : public SaiAclInterface
@@ -53,6 +60,14 @@ class MockSaiAcl : public SaiAclInterface
     MOCK_METHOD3(get_acl_counter_attribute,
                  sai_status_t(sai_object_id_t acl_counter_id, uint32_t attr_count, sai_attribute_t *attr_list));
     MOCK_METHOD2(set_acl_entry_attribute, sai_status_t(sai_object_id_t acl_entry_id, const sai_attribute_t *attr));
+    MOCK_METHOD8(bulk_object_create,
+                 sai_status_t(sai_object_id_t switch_id, sai_object_type_t object_type, uint32_t object_count,
+                              const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                              sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id,
+                              sai_status_t *object_statuses));
+    MOCK_METHOD5(bulk_object_remove,
+                 sai_status_t(sai_object_type_t object_type, uint32_t object_count, const sai_object_id_t *object_id,
+                              sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses));
 };
 
 extern MockSaiAcl *mock_sai_acl;
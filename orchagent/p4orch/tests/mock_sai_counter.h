@@ -0,0 +1,24 @@
+#pragma once
+
+#include <gmock/gmock.h>
+
+extern "C"
+{
+#include "sai.h"
+}
+
+// Mock Class mapping methods to counter object SAI APIs.
+class MockSaiCounter
+{
+  public:
+    MOCK_METHOD4(get_counter_stats, sai_status_t(_In_ sai_object_id_t counter_id, _In_ uint32_t number_of_counters,
+                                                 _In_ const sai_stat_id_t *counter_ids, _Out_ uint64_t *counters));
+};
+
+MockSaiCounter *mock_sai_counter;
+
+sai_status_t mock_get_counter_stats(_In_ sai_object_id_t counter_id, _In_ uint32_t number_of_counters,
+                                    _In_ const sai_stat_id_t *counter_ids, _Out_ uint64_t *counters)
+{
+    return mock_sai_counter->get_counter_stats(counter_id, number_of_counters, counter_ids, counters);
+}
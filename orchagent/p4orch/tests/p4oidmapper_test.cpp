@@ -167,6 +167,26 @@ TEST(P4OidMapperTest, VerifyMapperTest)
 
 }
 
+TEST(P4OidMapperTest, StringAndP4KeyShareEntryTest)
+{
+    P4OidMapper mapper;
+    EXPECT_TRUE(mapper.setOID(SAI_OBJECT_TYPE_NEXT_HOP, kNextHopObject1, kOid1));
+    EXPECT_FALSE(mapper.setOID(SAI_OBJECT_TYPE_NEXT_HOP, P4Key(kNextHopObject1), kOid2));
+    EXPECT_TRUE(mapper.existsOID(SAI_OBJECT_TYPE_NEXT_HOP, P4Key(kNextHopObject1)));
+    EXPECT_TRUE(mapper.verifyOIDMapping(SAI_OBJECT_TYPE_NEXT_HOP, P4Key(kNextHopObject1), kOid1).empty());
+
+    EXPECT_TRUE(mapper.increaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, P4Key(kNextHopObject1)));
+    uint32_t ref_count;
+    EXPECT_TRUE(mapper.getRefCount(SAI_OBJECT_TYPE_NEXT_HOP, kNextHopObject1, &ref_count));
+    EXPECT_EQ(1, ref_count);
+    EXPECT_TRUE(mapper.decreaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, kNextHopObject1));
+    EXPECT_EQ(1, mapper.getNumEntries(SAI_OBJECT_TYPE_NEXT_HOP));
+
+    EXPECT_TRUE(mapper.eraseOID(SAI_OBJECT_TYPE_NEXT_HOP, P4Key(kNextHopObject1)));
+    EXPECT_FALSE(mapper.existsOID(SAI_OBJECT_TYPE_NEXT_HOP, kNextHopObject1));
+    EXPECT_EQ(0, mapper.getNumEntries(SAI_OBJECT_TYPE_NEXT_HOP));
+}
+
 TEST(P4OidMapperTest, DumpEmptyStateCacheTest) {
   P4OidMapper mapper;
   std::string msg = mapper.dumpStateCache();
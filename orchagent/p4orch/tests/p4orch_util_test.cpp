@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <unordered_map>
 
 #include "ipprefix.h"
 #include "swssnet.h"
@@ -20,14 +21,14 @@ TEST(P4OrchUtilTest, KeyGeneratorTest)
     EXPECT_EQ("nexthop_id=ju1u32m1.atl11:qe-3/7", nexthop_key);
     std::string wcmp_group_key = KeyGenerator::generateWcmpGroupKey("group-1");
     EXPECT_EQ("wcmp_group_id=group-1", wcmp_group_key);
-    std::string ipv4_route_key = KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("10.11.12.0/24"));
-    EXPECT_EQ("ipv4_dst=10.11.12.0/24:vrf_id=b4-traffic", ipv4_route_key);
+    P4Key ipv4_route_key = KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("10.11.12.0/24"));
+    EXPECT_EQ("ipv4_dst=10.11.12.0/24:vrf_id=b4-traffic", ipv4_route_key.to_string());
     ipv4_route_key = KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("0.0.0.0/0"));
-    EXPECT_EQ("ipv4_dst=0.0.0.0/0:vrf_id=b4-traffic", ipv4_route_key);
-    std::string ipv6_route_key = KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("2001:db8:1::/32"));
-    EXPECT_EQ("ipv6_dst=2001:db8:1::/32:vrf_id=b4-traffic", ipv6_route_key);
+    EXPECT_EQ("ipv4_dst=0.0.0.0/0:vrf_id=b4-traffic", ipv4_route_key.to_string());
+    P4Key ipv6_route_key = KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("2001:db8:1::/32"));
+    EXPECT_EQ("ipv6_dst=2001:db8:1::/32:vrf_id=b4-traffic", ipv6_route_key.to_string());
     ipv6_route_key = KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("::/0"));
-    EXPECT_EQ("ipv6_dst=::/0:vrf_id=b4-traffic", ipv6_route_key);
+    EXPECT_EQ("ipv6_dst=::/0:vrf_id=b4-traffic", ipv6_route_key.to_string());
 
     // Test with special characters.
     neighbor_key = KeyGenerator::generateNeighborKey("::===::", swss::IpAddress("::1"));
@@ -36,10 +37,48 @@ TEST(P4OrchUtilTest, KeyGeneratorTest)
     std::map<std::string, std::string> match_fvs;
     match_fvs["ether_type"] = "0x0800";
     match_fvs["ipv6_dst"] = "fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53";
-    auto acl_rule_key = KeyGenerator::generateAclRuleKey(match_fvs, "15");
+    auto acl_rule_key = KeyGenerator::generateAclRuleKey(match_fvs, 15);
     EXPECT_EQ("match/ether_type=0x0800:match/"
               "ipv6_dst=fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53:priority=15",
-              acl_rule_key);
+              acl_rule_key.to_string());
+    EXPECT_EQ("ACL_PUNT_TABLE:match/ether_type=0x0800:match/"
+              "ipv6_dst=fdf8:f53b:82e4::53 & fdf8:f53b:82e4::53:priority=15",
+              KeyGenerator::generateAclTableRuleKey("ACL_PUNT_TABLE", acl_rule_key).to_string());
+}
+
+TEST(P4OrchUtilTest, P4KeyTest)
+{
+    const auto route_key = KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("10.11.12.0/24"));
+    EXPECT_EQ(P4Key::Type::kRoute, route_key.type());
+    EXPECT_EQ(route_key, KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("10.11.12.0/24")));
+    EXPECT_EQ(route_key.hash(),
+              KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("10.11.12.0/24")).hash());
+    EXPECT_NE(route_key, KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("10.11.12.0/25")));
+    EXPECT_NE(route_key, KeyGenerator::generateRouteKey("b4-traffic2", swss::IpPrefix("10.11.12.0/24")));
+    EXPECT_NE(route_key, KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("::/0")));
+    // A typed key never matches the string key of its log form.
+    EXPECT_NE(route_key, P4Key(route_key.to_string()));
+    EXPECT_EQ(P4Key("key"), P4Key(std::string("key")));
+    EXPECT_EQ("key", P4Key("key").to_string());
+    EXPECT_EQ(P4Key(), P4Key(""));
+
+    // The packed fields are length prefixed, so moving a separator between
+    // the match value and the next match name gives a different key.
+    const auto acl_rule_key = KeyGenerator::generateAclRuleKey({{"a", "b:c"}, {"d", "e"}}, 10);
+    EXPECT_EQ(P4Key::Type::kAclRule, acl_rule_key.type());
+    EXPECT_NE(acl_rule_key, KeyGenerator::generateAclRuleKey({{"a", "b"}, {"c:d", "e"}}, 10));
+    EXPECT_NE(acl_rule_key, KeyGenerator::generateAclRuleKey({{"a", "b:c"}, {"d", "e"}}, 11));
+    EXPECT_NE(KeyGenerator::generateAclTableRuleKey("t1", acl_rule_key),
+              KeyGenerator::generateAclTableRuleKey("t2", acl_rule_key));
+    EXPECT_EQ("priority=7", KeyGenerator::generateAclRuleKey({}, 7).to_string());
+    EXPECT_EQ("'priority=7'", QuotedVar(KeyGenerator::generateAclRuleKey({}, 7)));
+
+    std::unordered_map<P4Key, int> keys;
+    keys[route_key] = 1;
+    keys[acl_rule_key] = 2;
+    EXPECT_EQ(1, keys[KeyGenerator::generateRouteKey("b4-traffic", swss::IpPrefix("10.11.12.0/24"))]);
+    EXPECT_EQ(2, keys[KeyGenerator::generateAclRuleKey({{"a", "b:c"}, {"d", "e"}}, 10)]);
+    EXPECT_EQ(0u, keys.count(P4Key(route_key.to_string())));
 }
 
 TEST(P4OrchUtilTest, ParseP4RTKeyTest)
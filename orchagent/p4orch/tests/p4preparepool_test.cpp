@@ -0,0 +1,66 @@
+#include "p4preparepool.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+TEST(P4PreparePoolTest, PreparesEveryEntryOnce)
+{
+    P4PreparePool pool(4);
+    EXPECT_EQ(4u, pool.size());
+
+    for (size_t count : {size_t{0}, size_t{1}, P4PreparePool::kChunkSize, 10 * P4PreparePool::kChunkSize + 3})
+    {
+        std::vector<int> prepared(count, 0);
+        pool.run(count, [&](size_t i) { prepared[i]++; });
+        EXPECT_EQ(std::vector<int>(count, 1), prepared);
+    }
+}
+
+TEST(P4PreparePoolTest, SmallDrainIsPreparedInline)
+{
+    P4PreparePool pool(4);
+    std::vector<std::thread::id> threads(P4PreparePool::kChunkSize);
+    pool.run(threads.size(), [&](size_t i) { threads[i] = std::this_thread::get_id(); });
+    EXPECT_EQ(std::vector<std::thread::id>(threads.size(), std::this_thread::get_id()), threads);
+}
+
+TEST(P4PreparePoolTest, SingleThreadPool)
+{
+    P4PreparePool pool(1);
+    EXPECT_EQ(1u, pool.size());
+    std::vector<int> prepared(1000, 0);
+    pool.run(prepared.size(), [&](size_t i) { prepared[i] = static_cast<int>(i); });
+    for (size_t i = 0; i < prepared.size(); i++)
+    {
+        EXPECT_EQ(static_cast<int>(i), prepared[i]);
+    }
+}
+
+TEST(P4PreparePoolTest, ExceptionIsRethrownAfterTheRun)
+{
+    P4PreparePool pool(4);
+    const size_t count = 10 * P4PreparePool::kChunkSize;
+    std::vector<int> prepared(count, 0);
+    EXPECT_THROW(pool.run(count,
+                          [&](size_t i) {
+                              if (i == 100)
+                              {
+                                  throw std::invalid_argument("bad entry");
+                              }
+                              prepared[i] = 1;
+                          }),
+                 std::invalid_argument);
+
+    // The pool is still usable.
+    pool.run(count, [&](size_t i) { prepared[i] = 2; });
+    EXPECT_EQ(std::vector<int>(count, 2), prepared);
+}
+
+} // namespace
@@ -3,7 +3,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
+#include <iostream>
 #include <map>
 #include <nlohmann/json.hpp>
 #include <string>
@@ -23,6 +26,7 @@ using ::p4orch::kTableKeyDelimiter;
 using ::testing::_;
 using ::testing::DoAll;
 using ::testing::Eq;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::SetArrayArgument;
 using ::testing::StrictMock;
@@ -218,7 +222,7 @@ class RouteManagerTest : public ::testing::Test
         return route_manager_.deserializeRouteEntry(key, attributes, table_name);
     }
 
-    P4RouteEntry *GetRouteEntry(const std::string &route_entry_key)
+    P4RouteEntry *GetRouteEntry(const P4Key &route_entry_key)
     {
         return route_manager_.getRouteEntry(route_entry_key);
     }
@@ -2575,7 +2579,7 @@ TEST_F(RouteManagerTest, RouteCreateAndDeleteInDrainSucceeds)
         .Times(1);
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, Drain(/*failure_before=*/false));
 
-    std::string key = KeyGenerator::generateRouteKey(gVrfName, swss_ipv4_route_prefix);
+    P4Key key = KeyGenerator::generateRouteKey(gVrfName, swss_ipv4_route_prefix);
     auto *route_entry_ptr = GetRouteEntry(key);
     EXPECT_EQ(nullptr, route_entry_ptr);
     EXPECT_FALSE(p4_oid_mapper_.existsOID(SAI_OBJECT_TYPE_ROUTE_ENTRY, key));
@@ -2690,7 +2694,7 @@ TEST_F(RouteManagerTest, RouteCreateInDrainSucceedsWhenVrfIsEmpty)
         .Times(1);
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, Drain(/*failure_before=*/false));
-    std::string key = KeyGenerator::generateRouteKey(kDefaultVrfName, swss::IpPrefix(kIpv4Prefix));
+    P4Key key = KeyGenerator::generateRouteKey(kDefaultVrfName, swss::IpPrefix(kIpv4Prefix));
     auto *route_entry_ptr = GetRouteEntry(key);
     EXPECT_NE(nullptr, route_entry_ptr);
     EXPECT_TRUE(p4_oid_mapper_.existsOID(SAI_OBJECT_TYPE_ROUTE_ENTRY, key));
@@ -3473,7 +3477,7 @@ TEST_F(RouteManagerTest, VerifyStateTest)
 
     // Verification should fail if route entry key mismatches.
     auto saved_route_entry_key = route_entry_ptr->route_entry_key;
-    route_entry_ptr->route_entry_key = "invalid";
+    route_entry_ptr->route_entry_key = P4Key("invalid");
     EXPECT_FALSE(VerifyState(db_key, attributes).empty());
     route_entry_ptr->route_entry_key = saved_route_entry_key;
 
@@ -3608,3 +3612,48 @@ TEST_F(RouteManagerTest, VerifyStateAsicDbTest)
               std::vector<swss::FieldValueTuple>{swss::FieldValueTuple{"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x1"},
                                                  swss::FieldValueTuple{"SAI_ROUTE_ENTRY_ATTR_META_DATA", "1"}});
 }
+
+// Programming rate of the routes of a drain, from the APP DB entries to the
+// SAI bulk calls and the responses.
+TEST_F(RouteManagerTest, RouteProgrammingRate)
+{
+    constexpr uint32_t kNumRoutes = 4096;
+    p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_NEXT_HOP, KeyGenerator::generateNextHopKey(kNexthopId1), kNexthopOid1);
+
+    EXPECT_CALL(mock_sai_route_, create_route_entries(_, _, _, _, _, _))
+        .WillRepeatedly(Invoke([](uint32_t object_count, const sai_route_entry_t *, const uint32_t *,
+                                  const sai_attribute_t **, sai_bulk_op_error_mode_t, sai_status_t *object_statuses) {
+            std::fill(object_statuses, object_statuses + object_count, SAI_STATUS_SUCCESS);
+            return SAI_STATUS_SUCCESS;
+        }));
+    EXPECT_CALL(mock_sai_route_, remove_route_entries(_, _, _, _))
+        .WillRepeatedly(Invoke([](uint32_t object_count, const sai_route_entry_t *, sai_bulk_op_error_mode_t,
+                                  sai_status_t *object_statuses) {
+            std::fill(object_statuses, object_statuses + object_count, SAI_STATUS_SUCCESS);
+            return SAI_STATUS_SUCCESS;
+        }));
+    EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), _, _, Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)))
+        .Times(2 * kNumRoutes);
+
+    auto run = [&](const std::string &command) {
+        for (uint32_t i = 0; i < kNumRoutes; i++)
+        {
+            auto prefix = swss::IpPrefix("10." + std::to_string(i >> 8) + "." + std::to_string(i & 0xff) + ".0/24");
+            Enqueue(APP_P4RT_IPV4_TABLE_NAME, GenerateKeyOpFieldsValuesTuple(gVrfName, prefix, command,
+                                                                              p4orch::kSetNexthopId, kNexthopId1));
+        }
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, Drain(/*failure_before=*/false));
+        return static_cast<double>(kNumRoutes) /
+               std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start)
+                   .count();
+    };
+
+    double create_rate = run(SET_COMMAND);
+    EXPECT_EQ(kNumRoutes, p4_oid_mapper_.getNumEntries(SAI_OBJECT_TYPE_ROUTE_ENTRY));
+    double delete_rate = run(DEL_COMMAND);
+    EXPECT_EQ(0, p4_oid_mapper_.getNumEntries(SAI_OBJECT_TYPE_ROUTE_ENTRY));
+
+    std::cout << "[ RouteManager ] " << kNumRoutes << " routes: create " << static_cast<uint64_t>(create_rate)
+              << " /sec, delete " << static_cast<uint64_t>(delete_rate) << " /sec" << std::endl;
+}
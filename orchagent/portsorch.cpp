@@ -1728,40 +1728,71 @@ unordered_set<string>& PortsOrch::getAllVlans()
     return m_vlanPorts;
 }
 
-bool PortsOrch::getPort(string alias, Port &p)
+bool PortsOrch::getPort(const string &alias, Port &p)
 {
     SWSS_LOG_ENTER();
 
-    if (m_portList.find(alias) == m_portList.end())
+    const Port *port = findPort(alias);
+    if (!port)
     {
         return false;
     }
-    else
-    {
-        p = m_portList[alias];
-        return true;
-    }
+
+    p = *port;
+    return true;
 }
 
 bool PortsOrch::getPort(sai_object_id_t id, Port &port)
 {
     SWSS_LOG_ENTER();
 
+    const Port *p = findPort(id);
+    if (!p)
+    {
+        return false;
+    }
+
+    port = *p;
+    return true;
+}
+
+const Port *PortsOrch::findPort(const string &alias) const
+{
+    auto itr = m_portList.find(alias);
+    if (itr == m_portList.end())
+    {
+        return nullptr;
+    }
+
+    return &itr->second;
+}
+
+const Port *PortsOrch::findPort(sai_object_id_t id) const
+{
     auto itr = saiOidToAlias.find(id);
     if (itr == saiOidToAlias.end())
     {
-        return false;
+        return nullptr;
     }
-    else
+
+    const Port *port = findPort(itr->second);
+    if (!port)
     {
-        if (!getPort(itr->second, port))
-        {
-            SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
-        }
-        return true;
+        SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
     }
 
-    return false;
+    return port;
+}
+
+const Port *PortsOrch::findPortByBridgePortId(sai_object_id_t bridge_port_id) const
+{
+    auto itr = saiOidToAlias.find(bridge_port_id);
+    if (itr == saiOidToAlias.end())
+    {
+        return nullptr;
+    }
+
+    return findPort(itr->second);
 }
 
 void PortsOrch::increasePortRefCount(const string &alias)
@@ -1932,18 +1963,14 @@ bool PortsOrch::getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port
 {
     SWSS_LOG_ENTER();
 
-    auto itr = saiOidToAlias.find(bridge_port_id);
-    if (itr == saiOidToAlias.end())
+    const Port *p = findPortByBridgePortId(bridge_port_id);
+    if (!p)
     {
         return false;
     }
-    else
-    {
-        getPort(itr->second, port);
-        return true;
-    }
 
-    return false;
+    port = *p;
+    return true;
 }
 
 bool PortsOrch::addSubPort(Port &port, const string &alias, const string &vlan, const bool &adminUp, const uint32_t &mtu)
@@ -4125,7 +4152,7 @@ void PortsOrch::registerPort(Port &p)
     }
 
     PortUpdate update = { p, true };
-    notify(SUBJECT_TYPE_PORT_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_PORT_CHANGE>(update);
 
     m_portList[alias].m_init = true;
 
@@ -5469,7 +5496,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
                 if (getPort(port_id, p))
                 {
                     PortUpdate update = {p, false};
-                    notify(SUBJECT_TYPE_PORT_CHANGE, static_cast<void *>(&update));
+                    notify<SUBJECT_TYPE_PORT_CHANGE>(update);
                 }
             }
 
@@ -7353,7 +7380,7 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
     m_portList[vlan.m_alias] = vlan;
 
     VlanMemberUpdate update = { vlan, port, true };
-    notify(SUBJECT_TYPE_VLAN_MEMBER_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_VLAN_MEMBER_CHANGE>(update);
 
     return true;
 }
@@ -7512,7 +7539,7 @@ bool PortsOrch::addVlanFloodGroups(Port &vlan, Port &port, string end_point_ip)
     increaseBridgePortRefCount(port);
 
     VlanMemberUpdate update = { vlan, port, true };
-    notify(SUBJECT_TYPE_VLAN_MEMBER_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_VLAN_MEMBER_CHANGE>(update);
     return true;
 }
 
@@ -7686,12 +7713,12 @@ bool PortsOrch::removeVlanMember(Port &vlan, Port &port, string end_point_ip)
     m_portList[vlan.m_alias] = vlan;
 
     VlanMemberUpdate update = { vlan, port, false };
-    notify(SUBJECT_TYPE_VLAN_MEMBER_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_VLAN_MEMBER_CHANGE>(update);
 
     return true;
 }
 
-bool PortsOrch::isVlanMember(Port &vlan, Port &port, string end_point_ip)
+bool PortsOrch::isVlanMember(const Port &vlan, const Port &port, const string &end_point_ip)
 {
     if (!end_point_ip.empty())
     {
@@ -7782,7 +7809,7 @@ bool PortsOrch::addLag(string lag_alias, uint32_t spa_id, int32_t switch_id)
     saiOidToAlias[lag_id] = lag_alias;
 
     PortUpdate update = { lag, true };
-    notify(SUBJECT_TYPE_PORT_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_PORT_CHANGE>(update);
 
     FieldValueTuple tuple(lag_alias, sai_serialize_object_id(lag_id));
     vector<FieldValueTuple> fields;
@@ -7857,7 +7884,7 @@ bool PortsOrch::removeLag(Port lag)
     m_port_ref_count.erase(lag.m_alias);
 
     PortUpdate update = { lag, false };
-    notify(SUBJECT_TYPE_PORT_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_PORT_CHANGE>(update);
 
     m_counterLagTable->hdel("", lag.m_alias);
 
@@ -7972,7 +7999,7 @@ bool PortsOrch::addLagMember(Port &lag, Port &port, string member_status)
     increasePortRefCount(port.m_alias);
 
     LagMemberUpdate update = { lag, port, true };
-    notify(SUBJECT_TYPE_LAG_MEMBER_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_LAG_MEMBER_CHANGE>(update);
 
     if (isChassisDbInUse())
     {
@@ -8020,7 +8047,7 @@ bool PortsOrch::removeLagMember(Port &lag, Port &port)
     decreasePortRefCount(port.m_alias);
 
     LagMemberUpdate update = { lag, port, false };
-    notify(SUBJECT_TYPE_LAG_MEMBER_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_LAG_MEMBER_CHANGE>(update);
 
     if (isChassisDbInUse())
     {
@@ -9085,9 +9112,8 @@ void PortsOrch::doTask(NotificationConsumer &consumer)
 
 void PortsOrch::handleNotification(NotificationConsumer &consumer, KeyOpFieldsValuesTuple& entry)
 {
-    auto op = kfvOp(entry);
-    auto data = kfvKey(entry);
-    auto values = kfvFieldsValues(entry);
+    const auto &op = kfvOp(entry);
+    const auto &data = kfvKey(entry);
 
     if (&consumer == m_portStatusNotificationConsumer && op == "port_state_change")
     {
@@ -9293,7 +9319,7 @@ void PortsOrch::updatePortOperStatus(Port &port, sai_port_oper_status_t status)
 
 
     PortOperStateUpdate update = {port, status};
-    notify(SUBJECT_TYPE_PORT_OPER_STATE_CHANGE, static_cast<void *>(&update));
+    notify<SUBJECT_TYPE_PORT_OPER_STATE_CHANGE>(update);
 }
 
 void PortsOrch::updateDbPortOperSpeed(Port &port, sai_uint32_t speed)
@@ -10655,6 +10681,18 @@ void PortsOrch::updateGearboxPortOperStatus(const Port& port)
     }
 }
 
+bool PortsOrch::incrFdbCount(const std::string& alias, int count)
+{
+    auto itr = m_portList.find(alias);
+    if (itr == m_portList.end())
+    {
+        return false;
+    }
+
+    itr->second.m_fdb_count += count;
+    return true;
+}
+
 bool PortsOrch::decrFdbCount(const std::string& alias, int count)
 {
     auto itr = m_portList.find(alias);
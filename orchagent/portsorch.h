@@ -109,6 +109,30 @@ struct VlanMemberUpdate
     bool add;
 };
 
+template <>
+struct SubjectPayload<SUBJECT_TYPE_PORT_CHANGE>
+{
+    typedef PortUpdate type;
+};
+
+template <>
+struct SubjectPayload<SUBJECT_TYPE_PORT_OPER_STATE_CHANGE>
+{
+    typedef PortOperStateUpdate type;
+};
+
+template <>
+struct SubjectPayload<SUBJECT_TYPE_LAG_MEMBER_CHANGE>
+{
+    typedef LagMemberUpdate type;
+};
+
+template <>
+struct SubjectPayload<SUBJECT_TYPE_VLAN_MEMBER_CHANGE>
+{
+    typedef VlanMemberUpdate type;
+};
+
 struct queueInfo
 {
     // SAI_QUEUE_ATTR_TYPE
@@ -149,11 +173,19 @@ public:
     void cleanPortTable(const vector<string>& keys);
     bool getBridgePort(sai_object_id_t id, Port &port);
     bool setBridgePortLearningFDB(Port &port, sai_bridge_port_fdb_learning_mode_t mode);
-    bool getPort(string alias, Port &port);
+    bool getPort(const string &alias, Port &port);
     bool getPort(sai_object_id_t id, Port &port);
     void increasePortRefCount(const string &alias);
     void decreasePortRefCount(const string &alias);
     bool getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port);
+
+    /*
+     * Lookups returning the stored port instead of a copy, nullptr if not found.
+     * The pointer stays valid until the port is removed, updates go through setPort().
+     */
+    const Port *findPort(const string &alias) const;
+    const Port *findPort(sai_object_id_t id) const;
+    const Port *findPortByBridgePortId(sai_object_id_t bridge_port_id) const;
     void setPort(string alias, Port port);
     void getCpuPort(Port &port);
     void initHostTxReadyState(Port &port);
@@ -237,7 +269,7 @@ public:
     bool removeBridgePort(Port &port);
     bool addVlanMember(Port &vlan, Port &port, string& tagging_mode, string end_point_ip = "");
     bool removeVlanMember(Port &vlan, Port &port, string end_point_ip = "");
-    bool isVlanMember(Port &vlan, Port &port, string end_point_ip = "");
+    bool isVlanMember(const Port &vlan, const Port &port, const string &end_point_ip = "");
     bool addVlanFloodGroups(Port &vlan, Port &port, string end_point_ip);
     bool removeVlanEndPointIp(Port &vlan, Port &port, string end_point_ip);
     void increaseBridgePortRefCount(Port &port);
@@ -260,6 +292,7 @@ public:
 
     void updateGearboxPortOperStatus(const Port& port);
 
+    bool incrFdbCount(const string& alias, int count);
     bool decrFdbCount(const string& alias, int count);
 
     void setMACsecEnabledState(sai_object_id_t port_id, bool enabled);
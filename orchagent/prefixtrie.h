@@ -0,0 +1,353 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <sys/socket.h>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+
+/*
+ * Path-compressed binary radix trie of IP prefixes, with one tree per address
+ * family. Insert, erase, exact lookup, longest prefix match and the
+ * enumeration of the prefixes covering an address walk at most prefix length
+ * nodes; the prefixes inside a subnet are enumerated from the subtree of the
+ * subnet only.
+ */
+template <typename T>
+class PrefixTrie
+{
+public:
+    PrefixTrie() = default;
+    PrefixTrie(PrefixTrie &&) = default;
+    PrefixTrie& operator=(PrefixTrie &&) = default;
+
+    // The values usually refer to the owner's entries, the owner rebuilds the trie on copy
+    PrefixTrie(const PrefixTrie &) = delete;
+    PrefixTrie& operator=(const PrefixTrie &) = delete;
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    void clear()
+    {
+        m_root[0].reset();
+        m_root[1].reset();
+        m_size = 0;
+    }
+
+    /* Insert the prefix or overwrite its value */
+    void insert(const swss::IpPrefix &prefix, const T &value)
+    {
+        insert(makeKey(prefix), value);
+    }
+
+    /* Insert a host, i.e. a full length prefix */
+    void insert(const swss::IpAddress &ip, const T &value)
+    {
+        insert(makeKey(ip), value);
+    }
+
+    bool erase(const swss::IpPrefix &prefix)
+    {
+        return erase(makeKey(prefix));
+    }
+
+    bool erase(const swss::IpAddress &ip)
+    {
+        return erase(makeKey(ip));
+    }
+
+    T *find(const swss::IpPrefix &prefix)
+    {
+        return find(makeKey(prefix));
+    }
+
+    T *find(const swss::IpAddress &ip)
+    {
+        return find(makeKey(ip));
+    }
+
+    /* Value of the longest prefix matching ip, nullptr if none */
+    T *lpm(const swss::IpAddress &ip)
+    {
+        T *best = nullptr;
+        forEachCovering(ip, [&best](T &value) { best = &value; });
+        return best;
+    }
+
+    /* Call f on the values of the prefixes covering ip, shortest prefix first */
+    template <typename F>
+    void forEachCovering(const swss::IpAddress &ip, F f)
+    {
+        Key key = makeKey(ip);
+        Node *node = m_root[key.family].get();
+
+        while (node && commonLength(key, node->key) >= node->key.len)
+        {
+            if (node->has_value)
+            {
+                f(node->value);
+            }
+            if (node->key.len == key.len)
+            {
+                break;
+            }
+            node = node->child[bit(key, node->key.len)].get();
+        }
+    }
+
+    /* Call f on the values of the prefixes inside prefix, including prefix itself */
+    template <typename F>
+    void forEachCovered(const swss::IpPrefix &prefix, F f)
+    {
+        Key key = makeKey(prefix);
+        Node *node = m_root[key.family].get();
+
+        // Find the root of the subtree holding the prefixes inside key
+        while (node && node->key.len < key.len)
+        {
+            if (commonLength(key, node->key) < node->key.len)
+            {
+                return;
+            }
+            node = node->child[bit(key, node->key.len)].get();
+        }
+        if (!node || commonLength(key, node->key) < key.len)
+        {
+            return;
+        }
+
+        std::vector<Node *> stack(1, node);
+        while (!stack.empty())
+        {
+            node = stack.back();
+            stack.pop_back();
+
+            if (node->has_value)
+            {
+                f(node->value);
+            }
+            for (auto &child : node->child)
+            {
+                if (child)
+                {
+                    stack.push_back(child.get());
+                }
+            }
+        }
+    }
+
+private:
+    struct Key
+    {
+        uint8_t bytes[16];
+        uint8_t len;
+        uint8_t family;
+    };
+
+    struct Node
+    {
+        Key key;
+        std::unique_ptr<Node> child[2];
+        bool has_value = false;
+        T value;
+    };
+
+    static Key makeKey(const swss::ip_addr_t &ip, unsigned len)
+    {
+        Key key;
+
+        memset(key.bytes, 0, sizeof(key.bytes));
+        if (ip.family == AF_INET)
+        {
+            memcpy(key.bytes, &ip.ip_addr.ipv4_addr, 4);
+            key.family = 0;
+        }
+        else
+        {
+            memcpy(key.bytes, ip.ip_addr.ipv6_addr, 16);
+            key.family = 1;
+        }
+
+        truncate(key, len);
+        return key;
+    }
+
+    static Key makeKey(const swss::IpPrefix &prefix)
+    {
+        return makeKey(prefix.getIp().getIpAddr(), prefix.getMaskLength());
+    }
+
+    static Key makeKey(const swss::IpAddress &ip)
+    {
+        return makeKey(ip.getIpAddr(), ip.isV4() ? 32 : 128);
+    }
+
+    /* Shorten the key to len bits, clearing the host bits */
+    static void truncate(Key &key, unsigned len)
+    {
+        key.len = static_cast<uint8_t>(len);
+        if (len % 8)
+        {
+            key.bytes[len / 8] &= static_cast<uint8_t>(0xff << (8 - len % 8));
+            len += 8 - len % 8;
+        }
+        memset(key.bytes + len / 8, 0, sizeof(key.bytes) - len / 8);
+    }
+
+    static unsigned bit(const Key &key, unsigned pos)
+    {
+        return (key.bytes[pos / 8] >> (7 - pos % 8)) & 1;
+    }
+
+    /* Number of leading bits shared by both keys, at most the shortest length */
+    static unsigned commonLength(const Key &a, const Key &b)
+    {
+        unsigned max = a.len < b.len ? a.len : b.len;
+        unsigned len = 0;
+
+        for (unsigned i = 0; len < max; i++, len += 8)
+        {
+            uint8_t diff = a.bytes[i] ^ b.bytes[i];
+            if (diff)
+            {
+                len += __builtin_clz(diff) - 24;
+                break;
+            }
+        }
+
+        return len < max ? len : max;
+    }
+
+    static std::unique_ptr<Node> newNode(const Key &key, const T &value)
+    {
+        std::unique_ptr<Node> node(new Node());
+        node->key = key;
+        node->has_value = true;
+        node->value = value;
+        return node;
+    }
+
+    void insert(const Key &key, const T &value)
+    {
+        std::unique_ptr<Node> *slot = &m_root[key.family];
+
+        while (true)
+        {
+            Node *node = slot->get();
+            if (!node)
+            {
+                *slot = newNode(key, value);
+                m_size++;
+                return;
+            }
+
+            unsigned common = commonLength(key, node->key);
+            if (common == node->key.len)
+            {
+                if (key.len == node->key.len)
+                {
+                    if (!node->has_value)
+                    {
+                        node->has_value = true;
+                        m_size++;
+                    }
+                    node->value = value;
+                    return;
+                }
+                slot = &node->child[bit(key, node->key.len)];
+                continue;
+            }
+
+            // Split the path at the first differing bit
+            std::unique_ptr<Node> parent(new Node());
+            parent->key = key;
+            truncate(parent->key, common);
+            parent->child[bit(node->key, common)] = std::move(*slot);
+            if (common == key.len)
+            {
+                parent->has_value = true;
+                parent->value = value;
+            }
+            else
+            {
+                parent->child[bit(key, common)] = newNode(key, value);
+            }
+            *slot = std::move(parent);
+            m_size++;
+            return;
+        }
+    }
+
+    T *find(const Key &key)
+    {
+        Node *node = m_root[key.family].get();
+
+        while (node && node->key.len <= key.len && commonLength(key, node->key) == node->key.len)
+        {
+            if (node->key.len == key.len)
+            {
+                return node->has_value ? &node->value : nullptr;
+            }
+            node = node->child[bit(key, node->key.len)].get();
+        }
+
+        return nullptr;
+    }
+
+    bool erase(const Key &key)
+    {
+        std::unique_ptr<Node> *parent = nullptr;
+        std::unique_ptr<Node> *slot = &m_root[key.family];
+
+        while (*slot && (*slot)->key.len < key.len && commonLength(key, (*slot)->key) == (*slot)->key.len)
+        {
+            parent = slot;
+            slot = &(*slot)->child[bit(key, (*slot)->key.len)];
+        }
+
+        Node *node = slot->get();
+        if (!node || node->key.len != key.len || commonLength(key, node->key) != key.len || !node->has_value)
+        {
+            return false;
+        }
+
+        node->has_value = false;
+        node->value = T();
+        m_size--;
+
+        // Only keep the nodes with a value or branching in two
+        if (!compact(*slot) && parent)
+        {
+            compact(*parent);
+        }
+
+        return true;
+    }
+
+    /* Remove or bypass a node without value and with less than two children, false if it was removed */
+    static bool compact(std::unique_ptr<Node> &slot)
+    {
+        Node *node = slot.get();
+        if (node->has_value || (node->child[0] && node->child[1]))
+        {
+            return true;
+        }
+
+        if (!node->child[0] && !node->child[1])
+        {
+            slot.reset();
+            return false;
+        }
+
+        std::unique_ptr<Node> child = std::move(node->child[0] ? node->child[0] : node->child[1]);
+        slot = std::move(child);
+        return true;
+    }
+
+    std::unique_ptr<Node> m_root[2];
+    size_t m_size = 0;
+};
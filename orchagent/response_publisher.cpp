@@ -31,35 +31,27 @@ std::string PrependedComponent(const ReturnCode &status)
 void RecordDBWrite(const std::string &table, const std::string &key, const std::vector<swss::FieldValueTuple> &attrs,
                    const std::string &op)
 {
-    if (!swss::Recorder::Instance().respub.isRecord())
-    {
-        return;
-    }
-
-    std::string s = table + ":" + key + "|" + op;
-    for (const auto &attr : attrs)
-    {
-        s += "|" + fvField(attr) + ":" + fvValue(attr);
-    }
-
-    swss::Recorder::Instance().respub.record(s);
+    swss::Recorder::Instance().respub.record([&]() {
+        std::string s = table + ":" + key + "|" + op;
+        for (const auto &attr : attrs)
+        {
+            s += "|" + fvField(attr) + ":" + fvValue(attr);
+        }
+        return s;
+    });
 }
 
 void RecordResponse(const std::string &response_channel, const std::string &key,
                     const std::vector<swss::FieldValueTuple> &attrs, const std::string &status)
 {
-    if (!swss::Recorder::Instance().respub.isRecord())
-    {
-        return;
-    }
-
-    std::string s = response_channel + ":" + key + "|" + status;
-    for (const auto &attr : attrs)
-    {
-        s += "|" + fvField(attr) + ":" + fvValue(attr);
-    }
-
-    swss::Recorder::Instance().respub.record(s);
+    swss::Recorder::Instance().respub.record([&]() {
+        std::string s = response_channel + ":" + key + "|" + status;
+        for (const auto &attr : attrs)
+        {
+            s += "|" + fvField(attr) + ":" + fvValue(attr);
+        }
+        return s;
+    });
 }
 
 } // namespace
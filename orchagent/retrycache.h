@@ -85,9 +85,11 @@ public:
 
         m_resolvedConstraints.emplace(cst.first, cst.second);
 
-        std::stringstream ss;
-        ss << cst << " resolution notified -> " << m_retryKeys[cst].size() << " task(s)";
-        Recorder::Instance().retry.record(ss.str());
+        Recorder::Instance().retry.record([&]() {
+            std::stringstream ss;
+            ss << cst << " resolution notified -> " << m_retryKeys[cst].size() << " task(s)";
+            return ss.str();
+        });
     }
 
     /** Insert a failed task with its constraint to m_toRetry and m_retryKeys
@@ -179,17 +181,20 @@ public:
             it = keys.erase(it);
         }
 
-        std::stringstream ss;
-        ss << cst << " | " << m_executorName << " | " << tasks->size() << " retried";
-
+        size_t rest = keys.size();
         if (keys.empty()) {
             m_retryKeys.erase(cst);
             m_resolvedConstraints.erase(cst);
-        } else {
-            ss << " (rest:" << keys.size() << ")";
         }
 
-        Recorder::Instance().retry.record(ss.str());
+        Recorder::Instance().retry.record([&]() {
+            std::stringstream ss;
+            ss << cst << " | " << m_executorName << " | " << tasks->size() << " retried";
+            if (rest) {
+                ss << " (rest:" << rest << ")";
+            }
+            return ss.str();
+        });
 
         return tasks;
     }
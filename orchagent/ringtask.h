@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Move-only, type-erased void() callable queued on a RingBuffer.
+ *
+ * Unlike std::function, callables up to INLINE_SIZE bytes (e.g. the lambda
+ * built by Consumer::execute) are stored in place, so pushing and popping a
+ * task doesn't touch the heap. Larger callables fall back to a heap copy.
+ */
+class RingTask
+{
+public:
+    static constexpr size_t INLINE_SIZE = 64;
+
+    RingTask() = default;
+    RingTask(std::nullptr_t) { }
+
+    template <typename F,
+              typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, RingTask>::value>::type>
+    RingTask(F &&f)
+    {
+        emplace<typename std::decay<F>::type>(std::forward<F>(f));
+    }
+
+    RingTask(RingTask &&other) noexcept
+    {
+        moveFrom(other);
+    }
+
+    RingTask& operator=(RingTask &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    RingTask(const RingTask&) = delete;
+    RingTask& operator=(const RingTask&) = delete;
+
+    ~RingTask()
+    {
+        reset();
+    }
+
+    explicit operator bool() const
+    {
+        return m_invoke != nullptr;
+    }
+
+    void operator()()
+    {
+        m_invoke(m_storage);
+    }
+
+    void reset()
+    {
+        if (m_invoke)
+        {
+            m_manage(Destroy, m_storage, nullptr);
+            m_invoke = nullptr;
+            m_manage = nullptr;
+        }
+    }
+
+private:
+    enum Operation
+    {
+        Move,
+        Destroy
+    };
+
+    typedef void (*Invoker)(void *);
+    typedef void (*Manager)(Operation, void *, void *);
+
+    template <typename T>
+    struct Inline
+    {
+        static void invoke(void *storage)
+        {
+            (*static_cast<T *>(storage))();
+        }
+
+        static void manage(Operation op, void *dst, void *src)
+        {
+            if (op == Move)
+            {
+                new (dst) T(std::move(*static_cast<T *>(src)));
+                static_cast<T *>(src)->~T();
+            }
+            else
+            {
+                static_cast<T *>(dst)->~T();
+            }
+        }
+    };
+
+    template <typename T>
+    struct Heap
+    {
+        static void invoke(void *storage)
+        {
+            (**static_cast<T **>(storage))();
+        }
+
+        static void manage(Operation op, void *dst, void *src)
+        {
+            if (op == Move)
+            {
+                *static_cast<T **>(dst) = *static_cast<T **>(src);
+            }
+            else
+            {
+                delete *static_cast<T **>(dst);
+            }
+        }
+    };
+
+    template <typename T, typename F>
+    typename std::enable_if<(sizeof(T) <= INLINE_SIZE && alignof(T) <= alignof(std::max_align_t))>::type
+    emplace(F &&f)
+    {
+        new (m_storage) T(std::forward<F>(f));
+        m_invoke = &Inline<T>::invoke;
+        m_manage = &Inline<T>::manage;
+    }
+
+    template <typename T, typename F>
+    typename std::enable_if<!(sizeof(T) <= INLINE_SIZE && alignof(T) <= alignof(std::max_align_t))>::type
+    emplace(F &&f)
+    {
+        *reinterpret_cast<T **>(m_storage) = new T(std::forward<F>(f));
+        m_invoke = &Heap<T>::invoke;
+        m_manage = &Heap<T>::manage;
+    }
+
+    void moveFrom(RingTask &other)
+    {
+        if (other.m_invoke)
+        {
+            other.m_manage(Move, m_storage, other.m_storage);
+            m_invoke = other.m_invoke;
+            m_manage = other.m_manage;
+            other.m_invoke = nullptr;
+            other.m_manage = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_storage[INLINE_SIZE];
+    Invoker m_invoke = nullptr;
+    Manager m_manage = nullptr;
+};
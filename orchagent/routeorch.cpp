@@ -315,22 +315,19 @@ void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_
      * IP address */
     if (observerEntry == m_nextHopObservers.end())
     {
-        m_nextHopObservers.emplace(host, NextHopObserverEntry());
-        observerEntry = m_nextHopObservers.find(host);
+        observerEntry = m_nextHopObservers.emplace(host, NextHopObserverEntry()).first;
+        m_nextHopObserverIndex[vrf_id].insert(dstAddr, observerEntry);
 
         /* Find the prefixes that cover the destination IP */
-        if (m_syncdRoutes.find(vrf_id) != m_syncdRoutes.end())
+        auto routeTable = m_syncdRoutes.find(vrf_id);
+        if (routeTable != m_syncdRoutes.end())
         {
-            for (auto route : m_syncdRoutes.at(vrf_id))
-            {
-                if (route.first.isAddressInSubnet(dstAddr))
-                {
-                    SWSS_LOG_INFO("Prefix %s covers destination address",
-                            route.first.to_string().c_str());
-                    observerEntry->second.routeTable.emplace(
-                            route.first, route.second);
-                }
-            }
+            routeTable->second.forEachCovering(dstAddr, [&](const RouteTable::value_type &route) {
+                SWSS_LOG_INFO("Prefix %s covers destination address",
+                        route.first.to_string().c_str());
+                observerEntry->second.routeTable.emplace(
+                        route.first, route.second);
+            });
         }
     }
 
@@ -378,6 +375,12 @@ void RouteOrch::detach(Observer *observer, const IpAddress& dstAddr, sai_object_
             // destination IP.
             if (observerEntry->second.observers.empty())
             {
+                auto index = m_nextHopObserverIndex.find(vrf_id);
+                index->second.erase(dstAddr);
+                if (index->second.empty())
+                {
+                    m_nextHopObserverIndex.erase(index);
+                }
                 m_nextHopObservers.erase(observerEntry);
             }
             break;
@@ -664,7 +667,7 @@ void RouteOrch::doTask(ConsumerBase& consumer)
                 {
                     /* Mark all current routes as dirty (DEL) in consumer.m_toSync map */
                     SWSS_LOG_NOTICE("Start resync routes\n");
-                    for (auto j : m_syncdRoutes)
+                    for (const auto& j : m_syncdRoutes)
                     {
                         string vrf;
 
@@ -673,7 +676,7 @@ void RouteOrch::doTask(ConsumerBase& consumer)
                             vrf = m_vrfOrch->getVRFname(j.first) + ":";
                         }
 
-                        for (auto i : j.second)
+                        for (const auto& i : j.second)
                         {
                             vector<FieldValueTuple> v;
                             key = vrf + i.first.to_string();
@@ -1264,12 +1267,30 @@ void RouteOrch::notifyNextHopChangeObservers(sai_object_id_t vrf_id, const IpPre
 {
     SWSS_LOG_ENTER();
 
-    for (auto& entry : m_nextHopObservers)
+    auto index = m_nextHopObserverIndex.find(vrf_id);
+    if (index == m_nextHopObserverIndex.end())
+    {
+        return;
+    }
+
+    /*
+     * Only the observed hosts inside the prefix are affected. An observer may
+     * attach or detach hosts in update(), so the hosts are looked up again
+     * before they are notified and their observers are copied.
+     */
+    vector<Host> observed;
+    index->second.forEachCovered(prefix, [&observed](NextHopObserverTable::iterator it) {
+        observed.push_back(it->first);
+    });
+
+    for (const auto& host : observed)
     {
-        if (vrf_id != entry.first.first || !prefix.isAddressInSubnet(entry.first.second))
+        auto it = m_nextHopObservers.find(host);
+        if (it == m_nextHopObservers.end())
         {
             continue;
         }
+        auto& entry = *it;
 
         if (add)
         {
@@ -1305,7 +1326,8 @@ void RouteOrch::notifyNextHopChangeObservers(sai_object_id_t vrf_id, const IpPre
 
             if (update_required)
             {
-                for (auto observer : entry.second.observers)
+                auto observers = entry.second.observers;
+                for (auto observer : observers)
                 {
                     observer->update(SUBJECT_TYPE_NEXTHOP_CHANGE, static_cast<void *>(&update));
                 }
@@ -1327,7 +1349,8 @@ void RouteOrch::notifyNextHopChangeObservers(sai_object_id_t vrf_id, const IpPre
                     auto route = entry.second.routeTable.rbegin();
                     NextHopUpdate update = { vrf_id, entry.first.second, route->first, route->second.nhg_key };
 
-                    for (auto observer : entry.second.observers)
+                    auto observers = entry.second.observers;
+                    for (auto observer : observers)
                     {
                         observer->update(SUBJECT_TYPE_NEXTHOP_CHANGE, static_cast<void *>(&update));
                     }
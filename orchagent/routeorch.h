@@ -15,6 +15,7 @@
 #include "nexthopgroupkey.h"
 #include "bulker.h"
 #include "fgnhgorch.h"
+#include "prefixtrie.h"
 #include <map>
 #include "zmqorch.h"
 #include "zmqserver.h"
@@ -108,8 +109,120 @@ struct RouteKey
 
 /* NextHopGroupTable: NextHopGroupKey, NextHopGroupEntry */
 typedef std::unordered_map<NextHopGroupKey, NextHopGroupEntry> NextHopGroupTable;
-/* RouteTable: destination network, NextHopGroupKey */
-typedef std::map<IpPrefix, RouteNhg> RouteTable;
+/*
+ * RouteTable: destination network, NextHopGroupKey
+ * Ordered map of the routes, indexed by a prefix trie for the longest prefix
+ * match and covering prefix lookups.
+ */
+class RouteTable
+{
+public:
+    typedef std::map<IpPrefix, RouteNhg> Map;
+    typedef Map::value_type value_type;
+    typedef Map::size_type size_type;
+    typedef Map::iterator iterator;
+    typedef Map::const_iterator const_iterator;
+    typedef Map::reverse_iterator reverse_iterator;
+    typedef Map::const_reverse_iterator const_reverse_iterator;
+
+    RouteTable() = default;
+    RouteTable(const RouteTable &other) : m_routes(other.m_routes) { reindex(); }
+    RouteTable& operator=(const RouteTable &other)
+    {
+        if (this != &other)
+        {
+            m_routes = other.m_routes;
+            reindex();
+        }
+        return *this;
+    }
+    // Moving the map keeps its nodes, so the trie stays valid
+    RouteTable(RouteTable &&other) = default;
+    RouteTable& operator=(RouteTable &&other) = default;
+
+    iterator begin() { return m_routes.begin(); }
+    iterator end() { return m_routes.end(); }
+    const_iterator begin() const { return m_routes.begin(); }
+    const_iterator end() const { return m_routes.end(); }
+    reverse_iterator rbegin() { return m_routes.rbegin(); }
+    reverse_iterator rend() { return m_routes.rend(); }
+    const_reverse_iterator rbegin() const { return m_routes.rbegin(); }
+    const_reverse_iterator rend() const { return m_routes.rend(); }
+
+    bool empty() const { return m_routes.empty(); }
+    size_type size() const { return m_routes.size(); }
+    size_type count(const IpPrefix &prefix) const { return m_routes.count(prefix); }
+    iterator find(const IpPrefix &prefix) { return m_routes.find(prefix); }
+    const_iterator find(const IpPrefix &prefix) const { return m_routes.find(prefix); }
+    RouteNhg& at(const IpPrefix &prefix) { return m_routes.at(prefix); }
+    const RouteNhg& at(const IpPrefix &prefix) const { return m_routes.at(prefix); }
+
+    RouteNhg& operator[](const IpPrefix &prefix)
+    {
+        return emplace(prefix, RouteNhg()).first->second;
+    }
+
+    std::pair<iterator, bool> emplace(const IpPrefix &prefix, const RouteNhg &route)
+    {
+        auto ret = m_routes.emplace(prefix, route);
+        if (ret.second)
+        {
+            m_trie.insert(prefix, ret.first);
+        }
+        return ret;
+    }
+
+    iterator erase(iterator it)
+    {
+        m_trie.erase(it->first);
+        return m_routes.erase(it);
+    }
+
+    size_type erase(const IpPrefix &prefix)
+    {
+        auto it = m_routes.find(prefix);
+        if (it == m_routes.end())
+        {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    void clear()
+    {
+        m_trie.clear();
+        m_routes.clear();
+    }
+
+    /* Longest prefix match, end() if no route covers ip */
+    iterator lpm(const IpAddress &ip)
+    {
+        auto it = m_trie.lpm(ip);
+        return it ? *it : m_routes.end();
+    }
+
+    /* Call f on the routes covering ip, shortest prefix first */
+    template <typename F>
+    void forEachCovering(const IpAddress &ip, F f)
+    {
+        m_trie.forEachCovering(ip, [&f](iterator it) { f(*it); });
+    }
+
+private:
+    void reindex()
+    {
+        m_trie.clear();
+        for (auto it = m_routes.begin(); it != m_routes.end(); ++it)
+        {
+            m_trie.insert(it->first, it);
+        }
+    }
+
+    Map m_routes;
+    PrefixTrie<iterator> m_trie;
+};
+
 /* RouteTables: vrf_id, RouteTable */
 typedef std::map<sai_object_id_t, RouteTable> RouteTables;
 /* LabelRouteTable: destination label, next hop address(es) */
@@ -129,6 +242,9 @@ struct NextHopObserverEntry
     list<Observer *> observers;
 };
 
+/* NextHopObserverIndex: vrf_id, trie of the observed hosts */
+typedef std::map<sai_object_id_t, PrefixTrie<NextHopObserverTable::iterator>> NextHopObserverIndex;
+
 struct RouteBulkContext
 {
     std::deque<sai_status_t>            object_statuses;    // Bulk statuses
@@ -301,6 +417,7 @@ private:
     std::vector<NextHopGroupKey> m_bulkSrv6NhgReducedVec;
 
     NextHopObserverTable m_nextHopObservers;
+    NextHopObserverIndex m_nextHopObserverIndex;
 
     EntityBulker<sai_route_api_t>           gRouteBulker;
     EntityBulker<sai_mpls_api_t>            gLabelRouteBulker;
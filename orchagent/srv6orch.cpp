@@ -107,7 +107,7 @@ Srv6Orch::Srv6Orch(DBConnector *cfgDb, DBConnector *applDb, const vector<TableCo
     m_locatorCfgTable(cfgDb, CFG_SRV6_MY_LOCATOR_TABLE_NAME),
     m_counter_manager(SRV6_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, SRV6_STAT_COUNTER_POLLING_INTERVAL_MS, false)
 {
-    m_neighOrch->attach(this);
+    m_neighOrch->attach(this, SUBJECT_TYPE_NEIGH_CHANGE);
 
     initializeCounters();
 }
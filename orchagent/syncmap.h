@@ -0,0 +1,211 @@
+#pragma once
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <iterator>
+#include <functional>
+
+#include "table.h"
+
+/*
+ * Pending tasks of a consumer, keyed by the table key.
+ *
+ * Insertion-ordered hash container with the subset of the std::multimap
+ * interface used by the orchs. Tasks sharing a key (at most a DEL followed by
+ * a SET) are kept adjacent in insertion order so equal_range() still yields
+ * them in the order they were added. Lookups are O(1) and each key is stored
+ * once: the index refers to the key held by the first task of the group.
+ * Iterators stay valid until the element they point to is erased.
+ */
+class SyncMap
+{
+public:
+    typedef std::string key_type;
+    typedef swss::KeyOpFieldsValuesTuple mapped_type;
+    typedef std::pair<const std::string, swss::KeyOpFieldsValuesTuple> value_type;
+
+private:
+    typedef std::list<value_type> List;
+
+public:
+    typedef List::size_type size_type;
+    typedef List::iterator iterator;
+    typedef List::const_iterator const_iterator;
+    typedef List::reverse_iterator reverse_iterator;
+    typedef List::const_reverse_iterator const_reverse_iterator;
+
+    SyncMap() = default;
+
+    SyncMap(const SyncMap &other)
+    {
+        for (const auto &it : other.m_list)
+        {
+            emplace(it.first, it.second);
+        }
+    }
+
+    SyncMap& operator=(const SyncMap &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (const auto &it : other.m_list)
+            {
+                emplace(it.first, it.second);
+            }
+        }
+        return *this;
+    }
+
+    // Moving the list keeps its nodes, so the index stays valid
+    SyncMap(SyncMap &&other) = default;
+    SyncMap& operator=(SyncMap &&other) = default;
+
+    iterator begin() { return m_list.begin(); }
+    iterator end() { return m_list.end(); }
+    const_iterator begin() const { return m_list.begin(); }
+    const_iterator end() const { return m_list.end(); }
+    const_iterator cbegin() const { return m_list.cbegin(); }
+    const_iterator cend() const { return m_list.cend(); }
+    reverse_iterator rbegin() { return m_list.rbegin(); }
+    reverse_iterator rend() { return m_list.rend(); }
+    const_reverse_iterator rbegin() const { return m_list.rbegin(); }
+    const_reverse_iterator rend() const { return m_list.rend(); }
+
+    bool empty() const { return m_list.empty(); }
+    size_type size() const { return m_list.size(); }
+
+    void clear()
+    {
+        m_index.clear();
+        m_list.clear();
+    }
+
+    iterator find(const std::string &key)
+    {
+        auto idx = m_index.find(&key);
+        return idx == m_index.end() ? m_list.end() : idx->second.first;
+    }
+
+    const_iterator find(const std::string &key) const
+    {
+        auto idx = m_index.find(&key);
+        return idx == m_index.end() ? m_list.cend() : const_iterator(idx->second.first);
+    }
+
+    size_type count(const std::string &key) const
+    {
+        auto idx = m_index.find(&key);
+        return idx == m_index.end() ? 0 : idx->second.count;
+    }
+
+    std::pair<iterator, iterator> equal_range(const std::string &key)
+    {
+        auto idx = m_index.find(&key);
+        if (idx == m_index.end())
+        {
+            return std::make_pair(m_list.end(), m_list.end());
+        }
+
+        return std::make_pair(idx->second.first, std::next(idx->second.first, idx->second.count));
+    }
+
+    // Append the task after the tasks already queued for the same key
+    iterator emplace(const std::string &key, const mapped_type &value)
+    {
+        return emplaceImpl(key, value);
+    }
+
+    iterator emplace(const std::string &key, mapped_type &&value)
+    {
+        return emplaceImpl(key, std::move(value));
+    }
+
+    iterator insert(const value_type &value)
+    {
+        return emplaceImpl(value.first, value.second);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        auto idx = m_index.find(&pos->first);
+        auto &group = idx->second;
+
+        if (--group.count == 0)
+        {
+            m_index.erase(idx);
+        }
+        else if (group.first == pos)
+        {
+            // re-key the index on the next task of the group, the erased one owns the key string
+            Group next = { std::next(group.first), group.count };
+            m_index.erase(idx);
+            m_index.emplace(&next.first->first, next);
+        }
+
+        return m_list.erase(pos);
+    }
+
+    size_type erase(const std::string &key)
+    {
+        auto idx = m_index.find(&key);
+        if (idx == m_index.end())
+        {
+            return 0;
+        }
+
+        Group group = idx->second;
+        m_index.erase(idx);
+        m_list.erase(group.first, std::next(group.first, group.count));
+
+        return group.count;
+    }
+
+private:
+    struct Group
+    {
+        iterator first;
+        size_type count;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const std::string *key) const
+        {
+            return std::hash<std::string>()(*key);
+        }
+    };
+
+    struct KeyEqual
+    {
+        bool operator()(const std::string *lhs, const std::string *rhs) const
+        {
+            return *lhs == *rhs;
+        }
+    };
+
+    template <typename V>
+    iterator emplaceImpl(const std::string &key, V &&value)
+    {
+        auto idx = m_index.find(&key);
+        if (idx == m_index.end())
+        {
+            auto it = m_list.emplace(m_list.end(), std::piecewise_construct,
+                    std::forward_as_tuple(key), std::forward_as_tuple(std::forward<V>(value)));
+            m_index.emplace(&it->first, Group{ it, 1 });
+            return it;
+        }
+
+        auto &group = idx->second;
+        auto it = m_list.emplace(std::next(group.first, group.count), std::piecewise_construct,
+                std::forward_as_tuple(key), std::forward_as_tuple(std::forward<V>(value)));
+        group.count++;
+
+        return it;
+    }
+
+    List m_list;
+    std::unordered_map<const std::string *, Group, KeyHash, KeyEqual> m_index;
+};
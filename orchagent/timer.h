@@ -20,6 +20,8 @@ public:
 
     void execute()
     {
+        // Timers run on the main thread, next to the orchs of the rings
+        waitForRingsIdle();
         m_orch->doTask(*getSelectableTimer());
     }
 };
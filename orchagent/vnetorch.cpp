@@ -748,7 +748,7 @@ VNetRouteOrch::VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOr
 
     vnet_tunnel_term_acl_ = make_shared<VNetTunnelTermAcl>(config_db_.get(), app_db_.get());
 
-    gBfdOrch->attach(this);
+    gBfdOrch->attach(this, SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE);
 }
 
 bool VNetRouteOrch::hasNextHopGroup(const string& vnet, const NextHopGroupKey& nexthops)
@@ -11,11 +11,16 @@ void ZmqConsumer::execute()
 
     auto table = static_cast<swss::ZmqConsumerStateTable*>(getSelectable());
 
-    std::deque<KeyOpFieldsValuesTuple> entries;
-    table->pops(entries);
-    addToSync(entries);
+    auto entries = std::make_shared<std::deque<KeyOpFieldsValuesTuple>>();
+    table->pops(*entries);
 
-    drain();
+    // run in the ring thread when this table belongs to a ring affinity group
+    processAnyTask(
+        [=](){
+            addToSync(entries);
+            drain();
+        }
+    );
 }
 
 void ZmqConsumer::drain()
@@ -1,23 +1,31 @@
 #include <fstream>
 #include <iostream>
+#include <chrono>
+#include <unistd.h>
 
 #include <dbconnector.h>
 #include <producerstatetable.h>
+#include <redispipeline.h>
 #include "zmqclient.h"
 #include "zmqproducerstatetable.h"
 #include "orch_zmq_config.h"
 #include <schema.h>
 #include <tokenize.h>
+#include "recorder.h"
 
 using namespace std;
 using namespace swss;
 
 static int line_index = 0;
 static DBConnector db("APPL_DB", 0, true);
+static shared_ptr<RedisPipeline> pipeline = nullptr;
 
 void usage()
 {
-	cout << "Usage: swssplayer <file>" << endl;
+	cout << "Usage: swssplayer [-c] [-b batch_size] <file>" << endl;
+	cout << "    <file> is a swss.rec recording, in text or binary format" << endl;
+	cout << "    -c: convert a binary recording to text on stdout instead of replaying it" << endl;
+	cout << "    -b batch_size: replay through a redis pipeline flushed every batch_size records" << endl;
 	/* TODO: Add sample input file */
 }
 
@@ -46,6 +54,9 @@ shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<Produc
         if ((zmq_tables.find(table_name) != zmq_tables.end()) && (zmq_client != nullptr)) {
             p_table = make_shared<ZmqProducerStateTable>(&db, table_name, *zmq_client, true);
         }
+        else if (pipeline != nullptr) {
+            p_table = make_shared<ProducerStateTable>(pipeline.get(), table_name, true);
+        }
         else {
             p_table = make_shared<ProducerStateTable>(&db, table_name);
         }
@@ -60,22 +71,32 @@ shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<Produc
     return p_table;
 }
 
-void processTokens(vector<string> tokens, unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, set<string>  zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
+/* Replay a record without its timestamp, i.e. TABLE:key|op|field:value|... */
+void processRecord(const string &record, unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, set<string>  zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
 {
-	auto key = tokens[1];
+	auto tokens = tokenize(record, '|', 2);
+	if (tokens.size() < 2)
+	{
+		/* e.g. the "recording started" marker */
+		return;
+	}
 
 	/* Process the key */
-	auto v_key = tokenize(key, ':', 1);
+	auto v_key = tokenize(tokens[0], ':', 1);
+	if (v_key.size() < 2)
+	{
+		return;
+	}
 	auto table_name = v_key[0];
 	auto key_name = v_key[1];
 
 	auto p_producer= get_table(table_map, table_name, zmq_tables, zmq_client);
 
 	/* Process the operation */
-	auto op = tokens[2];
+	auto op = tokens[1];
 	if (op == SET_COMMAND)
 	{
-		auto tuples = processFieldsValuesTuple(tokens[3]);
+		auto tuples = tokens.size() > 2 ? processFieldsValuesTuple(tokens[2]) : vector<FieldValueTuple>();
 		p_producer->set(key_name, tuples, SET_COMMAND);
 	}
 	else if (op == DEL_COMMAND)
@@ -86,15 +107,55 @@ void processTokens(vector<string> tokens, unordered_map<string, shared_ptr<Produ
 
 int main(int argc, char **argv)
 {
-	if (argc != 2)
+	bool convert = false;
+	size_t batch_size = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "cb:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'c':
+			convert = true;
+			break;
+		case 'b':
+			batch_size = static_cast<size_t>(atoi(optarg));
+			break;
+		case 'h':
+			usage();
+			exit(EXIT_SUCCESS);
+		default:
+			usage();
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (optind != argc - 1)
 	{
 		usage();
 		exit(EXIT_FAILURE);
 	}
 
-	ifstream file(argv[1]);
+	ifstream file(argv[optind], ios::binary);
+	RecReader reader(file);
+	bool binary = reader.isBinary();
+	RecEntry entry;
 	string line;
 
+	if (convert)
+	{
+		if (!binary)
+		{
+			cerr << argv[optind] << " is not a binary recording" << endl;
+			exit(EXIT_FAILURE);
+		}
+		while (reader.next(entry))
+		{
+			cout << Recorder::formatTimestamp(entry.timestamp) << "|" << entry.value << "\n";
+		}
+		return 0;
+	}
+
     auto zmq_tables = load_zmq_tables();
     std::shared_ptr<ZmqClient> zmq_client = nullptr;
     if (zmq_tables.size() > 0)
@@ -102,12 +163,37 @@ int main(int argc, char **argv)
         zmq_client = create_zmq_client(ZMQ_LOCAL_ADDRESS);
     }
 
+    if (batch_size > 0)
+    {
+        pipeline = make_shared<RedisPipeline>(&db, batch_size);
+    }
+
     unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
-	while (getline(file, line))
+    auto start = chrono::steady_clock::now();
+	while (binary ? reader.next(entry) : static_cast<bool>(getline(file, line)))
 	{
-		auto tokens = tokenize(line, '|', 3);
-		processTokens(tokens, table_map, zmq_tables, zmq_client);
+		if (binary)
+		{
+			processRecord(entry.value, table_map, zmq_tables, zmq_client);
+		}
+		else
+		{
+			/* Skip the timestamp */
+			auto pos = line.find('|');
+			if (pos != string::npos)
+			{
+				processRecord(line.substr(pos + 1), table_map, zmq_tables, zmq_client);
+			}
+		}
 
 		line_index++;
 	}
+
+    if (pipeline != nullptr)
+    {
+        pipeline->flush();
+    }
+
+    auto elapsed = chrono::duration_cast<chrono::duration<double>>(chrono::steady_clock::now() - start).count();
+    cout << "Replayed " << line_index << " records in " << elapsed << " s" << endl;
 }
@@ -234,6 +234,55 @@ namespace aclorch_test
         }
     };
 
+    TEST_F(AclTest, Crm_Polls_Changed_Acl_Tables)
+    {
+        auto &resourceMap = Portal::CrmOrchInternal::getResourceMap(gCrmOrch);
+        for (auto &res : resourceMap)
+        {
+            if (res.first != CrmResourceType::CRM_ACL_ENTRY)
+            {
+                res.second.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
+            }
+        }
+
+        set<sai_object_id_t> queried;
+        auto spy = SpyOn<SAI_API_ACL, SAI_OBJECT_TYPE_ACL_TABLE>(&sai_acl_api->get_acl_table_attribute);
+        spy->callFake([&](sai_object_id_t oid, uint32_t, sai_attribute_t *attr_list) -> sai_status_t {
+            queried.insert(oid);
+            attr_list[0].value.u32 = 100;
+            return SAI_STATUS_SUCCESS;
+        });
+
+        for (sai_object_id_t oid = 1; oid <= 3; oid++)
+        {
+            gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, oid);
+        }
+
+        // The first poll queries all the tables
+        Portal::CrmOrchInternal::getResAvailableCounters(gCrmOrch);
+        ASSERT_EQ(queried, set<sai_object_id_t>({ 1, 2, 3 }));
+
+        // Only the tables whose usage changed are queried until the full refresh
+        queried.clear();
+        Portal::CrmOrchInternal::getResAvailableCounters(gCrmOrch);
+        ASSERT_TRUE(queried.empty());
+
+        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, 2);
+        Portal::CrmOrchInternal::getResAvailableCounters(gCrmOrch);
+        ASSERT_EQ(queried, set<sai_object_id_t>({ 2 }));
+
+        for (int i = 3; i < CRM_FULL_REFRESH_POLLS; i++)
+        {
+            Portal::CrmOrchInternal::getResAvailableCounters(gCrmOrch);
+        }
+        ASSERT_EQ(queried, set<sai_object_id_t>({ 2 }));
+
+        Portal::CrmOrchInternal::getResAvailableCounters(gCrmOrch);
+        ASSERT_EQ(queried, set<sai_object_id_t>({ 1, 2, 3 }));
+        ASSERT_EQ(resourceMap.at(CrmResourceType::CRM_ACL_ENTRY).countersMap.at(
+                      Portal::CrmOrchInternal::getCrmAclTableKey(gCrmOrch, 1)).availableCounter, 100u);
+    }
+
     struct AclOrchTest : public AclTest
     {
 
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <cerrno>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "netlinkprogrammer.h"
+
+/*
+ * Records the requests of the cfgmgr daemons as the equivalent ip and bridge
+ * commands, and keeps the links, bridge VLANs and addresses they create for
+ * the queries.
+ */
+namespace mock_netlink
+{
+    class MockNetlinkProgrammer : public swss::NetlinkProgrammer
+    {
+    public:
+        void addLink(const swss::NetlinkLink &link) override
+        {
+            std::string request = "ip link add " + link.name + " type " + link.kind;
+            if (!link.parent.empty())
+            {
+                request = "ip link add link " + link.parent + " name " + link.name + " type " + link.kind;
+            }
+            if (link.kind == "vlan")
+            {
+                request += " id " + std::to_string(link.vlan_id);
+            }
+            else if (link.kind == "vrf")
+            {
+                request += " table " + std::to_string(link.vrf_table);
+            }
+            else if (link.kind == "vxlan" || link.kind == "ipip")
+            {
+                if (link.kind == "vxlan")
+                {
+                    request += " id " + std::to_string(link.vni);
+                }
+                if (!link.local.isZero())
+                {
+                    request += " local " + link.local.to_string();
+                }
+                if (!link.remote.isZero())
+                {
+                    request += " remote " + link.remote.to_string();
+                }
+                if (link.kind == "vxlan" && !link.learning)
+                {
+                    request += " nolearning";
+                }
+                if (link.dst_port)
+                {
+                    request += " dstport " + std::to_string(link.dst_port);
+                }
+            }
+
+            std::string name = link.name;
+            std::string kind = link.kind;
+            uint32_t table = link.vrf_table;
+            queue(request, [this, name, kind, table]() {
+                links[name] = kind;
+                if (kind == "vrf")
+                {
+                    vrfTables[name] = table;
+                }
+            });
+        }
+
+        void delLink(const std::string &name) override
+        {
+            queue("ip link del " + name, [this, name]() {
+                links.erase(name);
+                vrfTables.erase(name);
+                vlans.erase(name);
+                addresses.erase(name);
+            });
+        }
+
+        void setLinkAdminState(const std::string &name, bool up) override
+        {
+            queue("ip link set " + name + (up ? " up" : " down"));
+        }
+
+        void setLinkMtu(const std::string &name, uint32_t mtu) override
+        {
+            queue("ip link set " + name + " mtu " + std::to_string(mtu));
+        }
+
+        void setLinkAddress(const std::string &name, const swss::MacAddress &mac) override
+        {
+            queue("ip link set " + name + " address " + mac.to_string());
+        }
+
+        void setLinkMaster(const std::string &name, const std::string &master) override
+        {
+            queue("ip link set " + name + (master.empty() ? " nomaster" : " master " + master));
+        }
+
+        void setBridgeVlanFiltering(const std::string &bridge, bool enable) override
+        {
+            queue("ip link set " + bridge + " type bridge vlan_filtering " + (enable ? "1" : "0"));
+        }
+
+        void setBridgeNoLinkLocalLearn(const std::string &bridge, bool enable) override
+        {
+            queue("ip link set " + bridge + " type bridge no_linklocal_learn " + (enable ? "1" : "0"));
+        }
+
+        void setBridgePortLearning(const std::string &dev, bool enable) override
+        {
+            queue("bridge link set dev " + dev + " learning " + (enable ? "on" : "off"));
+        }
+
+        void addBridgeVlanRange(const std::string &dev, uint16_t first, uint16_t last, uint16_t flags) override
+        {
+            queue("bridge vlan add vid " + vlanRange(first, last) + " dev " + dev + vlanFlags(flags),
+                  [this, dev, first, last]() {
+                      for (uint32_t vid = first; vid <= last; vid++)
+                      {
+                          vlans[dev].insert(static_cast<uint16_t>(vid));
+                      }
+                  });
+        }
+
+        void delBridgeVlanRange(const std::string &dev, uint16_t first, uint16_t last, uint16_t flags) override
+        {
+            queue("bridge vlan del vid " + vlanRange(first, last) + " dev " + dev + vlanFlags(flags),
+                  [this, dev, first, last]() {
+                      for (uint32_t vid = first; vid <= last; vid++)
+                      {
+                          vlans[dev].erase(static_cast<uint16_t>(vid));
+                      }
+                  });
+        }
+
+        void addAddress(const std::string &dev, const swss::IpPrefix &prefix, uint32_t metric) override
+        {
+            std::string request = "ip address add " + prefix.to_string();
+            if (prefix.isV4() && prefix.getMaskLength() < 31)
+            {
+                request += " broadcast " + prefix.getBroadcastIp().to_string();
+            }
+            request += " dev " + dev;
+            if (metric)
+            {
+                request += " metric " + std::to_string(metric);
+            }
+
+            queue(request, [this, dev, prefix]() { addresses[dev].insert(prefix.to_string()); });
+        }
+
+        void delAddress(const std::string &dev, const swss::IpPrefix &prefix) override
+        {
+            queue("ip address del " + prefix.to_string() + " dev " + dev,
+                  [this, dev, prefix]() { addresses[dev].erase(prefix.to_string()); });
+        }
+
+        void addNeighbor(const std::string &dev, const swss::IpAddress &ip, const swss::MacAddress &mac) override
+        {
+            queue("ip neigh replace " + ip.to_string() + " lladdr " + mac.to_string() + " dev " + dev);
+        }
+
+        void delNeighbor(const std::string &dev, const swss::IpAddress &ip) override
+        {
+            queue("ip neigh del " + ip.to_string() + " dev " + dev);
+        }
+
+        void replaceRoute(const std::string &dev, const swss::IpPrefix &prefix) override
+        {
+            queue("ip route replace " + prefix.to_string() + " dev " + dev);
+        }
+
+        void delRoute(const std::string &dev, const swss::IpPrefix &prefix) override
+        {
+            queue("ip route del " + prefix.to_string() + " dev " + dev);
+        }
+
+        size_t pending() const override
+        {
+            return m_queue.size();
+        }
+
+        std::vector<swss::NetlinkResult> commit() override
+        {
+            std::vector<swss::NetlinkResult> results;
+
+            for (auto &request : m_queue)
+            {
+                int error = failures.count(request.first) ? -EIO : 0;
+                if (!error && request.second)
+                {
+                    request.second();
+                }
+                requests.push_back(request.first);
+                results.push_back({ request.first, error });
+            }
+
+            m_queue.clear();
+            commits++;
+            return results;
+        }
+
+        bool linkExists(const std::string &name) override
+        {
+            return links.count(name) != 0;
+        }
+
+        bool getBridgeVlans(const std::string &dev, std::vector<uint16_t> &vids) override
+        {
+            vids.assign(vlans[dev].begin(), vlans[dev].end());
+            return true;
+        }
+
+        using swss::NetlinkProgrammer::getLinks;
+        bool getLinks(const std::string &kind, std::vector<swss::NetlinkLink> &result) override
+        {
+            result.clear();
+            for (const auto &link : links)
+            {
+                if (link.second == kind)
+                {
+                    swss::NetlinkLink found;
+                    found.name = link.first;
+                    found.kind = link.second;
+                    if (vrfTables.count(link.first))
+                    {
+                        found.vrf_table = vrfTables[link.first];
+                    }
+                    result.push_back(found);
+                }
+            }
+            return true;
+        }
+
+        bool getAddresses(const std::string &dev, std::vector<swss::IpPrefix> &prefixes) override
+        {
+            if (!links.count(dev))
+            {
+                return false;
+            }
+
+            prefixes.clear();
+            for (const auto &prefix : addresses[dev])
+            {
+                prefixes.emplace_back(prefix);
+            }
+            return true;
+        }
+
+        /* Committed requests, and the number of commits */
+        std::vector<std::string> requests;
+        size_t commits = 0;
+
+        /* Requests failing with EIO */
+        std::set<std::string> failures;
+
+        /* Links by name with their kind, VRF tables, bridge VLANs and addresses by link */
+        std::map<std::string, std::string> links;
+        std::map<std::string, uint32_t> vrfTables;
+        std::map<std::string, std::set<uint16_t>> vlans;
+        std::map<std::string, std::set<std::string>> addresses;
+
+    private:
+        void queue(const std::string &request, std::function<void()> apply = nullptr)
+        {
+            m_queue.emplace_back(request, apply);
+        }
+
+        static std::string vlanRange(uint16_t first, uint16_t last)
+        {
+            return first == last ? std::to_string(first) : std::to_string(first) + "-" + std::to_string(last);
+        }
+
+        static std::string vlanFlags(uint16_t flags)
+        {
+            std::string desc;
+
+            if (flags & NETLINK_VLAN_PVID)
+            {
+                desc += " pvid";
+            }
+            if (flags & NETLINK_VLAN_UNTAGGED)
+            {
+                desc += " untagged";
+            }
+            if (flags & NETLINK_VLAN_SELF)
+            {
+                desc += " self";
+            }
+            return desc;
+        }
+
+        std::vector<std::pair<std::string, std::function<void()>>> m_queue;
+    };
+}
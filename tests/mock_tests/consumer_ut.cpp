@@ -3,6 +3,8 @@
 #include "mock_table.h"
 
 #include <sstream>
+#include <chrono>
+#include <map>
 
 extern PortsOrch *gPortsOrch;
 
@@ -342,6 +344,179 @@ namespace consumer_test
 
     }
 
+    /*
+     * Previous std::multimap based m_toSync and its SET/DEL merge, kept as the
+     * baseline of the SyncMap benchmark below. The benchmark runs the same
+     * merge on both containers.
+     */
+    typedef std::multimap<std::string, KeyOpFieldsValuesTuple> LegacySyncMap;
+
+    template <typename Map>
+    void legacyAddToSync(Map &sync, const KeyOpFieldsValuesTuple &entry)
+    {
+        string key = kfvKey(entry);
+        string op  = kfvOp(entry);
+
+        if (sync.find(key) == sync.end())
+        {
+            sync.emplace(key, entry);
+        }
+        else if (op == DEL_COMMAND)
+        {
+            sync.erase(key);
+            sync.emplace(key, entry);
+        }
+        else
+        {
+            auto ret = sync.equal_range(key);
+            auto iter = ret.first;
+            for (; iter != ret.second; ++iter)
+            {
+                if (kfvOp(iter->second) == SET_COMMAND)
+                    break;
+            }
+            if (iter == ret.second)
+            {
+                sync.emplace(key, entry);
+            }
+            else
+            {
+                KeyOpFieldsValuesTuple existing_data = iter->second;
+                auto new_values = kfvFieldsValues(entry);
+                auto existing_values = kfvFieldsValues(existing_data);
+
+                for (auto it : new_values)
+                {
+                    string field = fvField(it);
+                    string value = fvValue(it);
+
+                    auto iu = existing_values.begin();
+                    while (iu != existing_values.end())
+                    {
+                        if (field == fvField(*iu))
+                            iu = existing_values.erase(iu);
+                        else
+                            iu++;
+                    }
+                    existing_values.push_back(FieldValueTuple(field, value));
+                }
+                iter->second = KeyOpFieldsValuesTuple(key, op, existing_values);
+            }
+        }
+    }
+
+    TEST_F(ConsumerTest, ConsumerAddToSync_Bench)
+    {
+        const int keys = 20000;
+
+        // Route-like churn: SET, partial SET update, DEL then re-SET of every key
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (int round = 0; round < 4; round++)
+        {
+            for (int i = 0; i < keys; i++)
+            {
+                string k = "Ethernet" + to_string(i % 512) + ":10." + to_string(i / 256) + "." + to_string(i % 256) + ".0/24";
+                switch (round)
+                {
+                case 0:
+                    entries.push_back(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f1, v1a }, { f2, v2a } } }));
+                    break;
+                case 1:
+                    entries.push_back(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f2, v2b }, { f3, v3a } } }));
+                    break;
+                case 2:
+                    if (i % 2)
+                        entries.push_back(KeyOpFieldsValuesTuple({ k, DEL_COMMAND, { } }));
+                    break;
+                default:
+                    if (i % 4 == 1)
+                        entries.push_back(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f1, v1b } } }));
+                    break;
+                }
+            }
+        }
+
+        using namespace std::chrono;
+
+        // Both sides time the same merge and erase, on their own container
+        LegacySyncMap legacy;
+        auto start = steady_clock::now();
+        for (const auto &entry : entries)
+        {
+            legacyAddToSync(legacy, entry);
+        }
+        for (auto it = legacy.begin(); it != legacy.end(); )
+        {
+            it = legacy.erase(it);
+        }
+        auto legacy_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+
+        SyncMap sync;
+        start = steady_clock::now();
+        for (const auto &entry : entries)
+        {
+            legacyAddToSync(sync, entry);
+        }
+        for (auto it = sync.begin(); it != sync.end(); )
+        {
+            it = sync.erase(it);
+        }
+        auto syncmap_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+
+        // The merge of the consumer gives the same tasks as the legacy merge
+        for (const auto &entry : entries)
+        {
+            legacyAddToSync(legacy, entry);
+        }
+        consumer->addToSync(entries);
+        SyncMap &merged = consumer->m_toSync;
+
+        ASSERT_EQ(merged.size(), legacy.size());
+        for (auto it = legacy.begin(); it != legacy.end(); )
+        {
+            auto expected = legacy.equal_range(it->first);
+            auto actual = merged.equal_range(it->first);
+            ASSERT_EQ(std::distance(actual.first, actual.second), std::distance(expected.first, expected.second));
+            for (auto e = expected.first, a = actual.first; e != expected.second; ++e, ++a)
+            {
+                ASSERT_EQ(a->second, e->second);
+            }
+            it = expected.second;
+        }
+
+        cout << "[ SyncMap ] " << entries.size() << " tasks, multimap " << legacy_ns / entries.size()
+             << " ns/task, SyncMap " << syncmap_ns / entries.size() << " ns/task" << endl;
+    }
+
+    TEST_F(ConsumerTest, ConsumerAddToSync_Insertion_Order)
+    {
+        auto set_b = KeyOpFieldsValuesTuple({ "b", SET_COMMAND, { { f1, v1a } } });
+        auto set_a = KeyOpFieldsValuesTuple({ "a", SET_COMMAND, { { f1, v1a } } });
+        auto del_b = KeyOpFieldsValuesTuple({ "b", DEL_COMMAND, { } });
+        auto set_b2 = KeyOpFieldsValuesTuple({ "b", SET_COMMAND, { { f2, v2a } } });
+
+        consumer->addToSync(set_b);
+        consumer->addToSync(set_a);
+        consumer->addToSync(del_b);
+        consumer->addToSync(set_b2);
+
+        // "b" was overwritten by the DEL, its DEL + SET stay together after "a"
+        auto &sync = consumer->m_toSync;
+        ASSERT_EQ(sync.size(), 3);
+        ASSERT_EQ(sync.count("b"), 2);
+
+        auto it = sync.begin();
+        ASSERT_EQ(it->second, set_a);
+        ASSERT_EQ((++it)->second, del_b);
+        ASSERT_EQ((++it)->second, set_b2);
+
+        // erasing the DEL leaves the SET reachable by key
+        it = sync.erase(sync.find("b"));
+        ASSERT_EQ(it->second, set_b2);
+        ASSERT_EQ(sync.find("b")->second, set_b2);
+        ASSERT_EQ(sync.count("b"), 1);
+    }
+
     TEST_F(ConsumerTest, ConsumerPops_notification_count)
     {
         int consumer_pops_batch_size = 10;
@@ -0,0 +1,465 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_sai_api.h"
+#include "mock_dash_orch_test.h"
+#include "dash_api/acl_group.pb.h"
+#include "dash_api/acl_rule.pb.h"
+#include "dash_api/acl_in.pb.h"
+#include "dash_api/prefix_tag.pb.h"
+#include "dash_api/eni.pb.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <set>
+
+EXTERN_MOCK_FNS
+
+/*
+ * DASH ACL rules created and removed in bulk, tag updates applied to the
+ * affected rules only, and a benchmark of the rule rate. The DASH ACL SAI is
+ * faked, the rules are kept in memory with the group they belong to.
+ */
+namespace dashaclorch_test
+{
+    DEFINE_SAI_GENERIC_APIS_MOCK(dash_acl, dash_acl_group, dash_acl_rule)
+    DEFINE_SAI_GENERIC_APIS_MOCK(dash_eni, eni)
+    using namespace mock_orch_test;
+    using namespace std::chrono;
+    using ::testing::Invoke;
+
+    const size_t BENCH_RULES = 10000;
+
+    struct FakeRule
+    {
+        sai_object_id_t group_id;
+        uint32_t sip_count;
+    };
+
+    class DashAclOrchTest : public MockDashOrchTest
+    {
+    protected:
+        sai_object_id_t m_next_oid = 0x1000;
+        std::map<sai_object_id_t, FakeRule> m_rules;
+        std::set<sai_object_id_t> m_groups;
+        sai_object_id_t m_bound_group = SAI_NULL_OBJECT_ID;
+        size_t m_created_rules = 0;
+        size_t m_removed_rules = 0;
+
+        void ApplySaiMock() override
+        {
+            INIT_SAI_API_MOCK(dash_acl);
+            INIT_SAI_API_MOCK(dash_eni);
+            MockSaiApis();
+        }
+
+        void PostSetUp() override
+        {
+            ON_CALL(*mock_sai_dash_acl_api, create_dash_acl_group)
+                .WillByDefault(Invoke([this](sai_object_id_t *oid, sai_object_id_t, uint32_t, const sai_attribute_t *) {
+                    *oid = ++m_next_oid;
+                    m_groups.insert(*oid);
+                    return SAI_STATUS_SUCCESS;
+                }));
+            ON_CALL(*mock_sai_dash_acl_api, remove_dash_acl_group)
+                .WillByDefault(Invoke([this](sai_object_id_t oid) {
+                    m_groups.erase(oid);
+                    return SAI_STATUS_SUCCESS;
+                }));
+            ON_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules)
+                .WillByDefault(Invoke([this](sai_object_id_t, uint32_t count, const uint32_t *attr_count,
+                                             const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t,
+                                             sai_object_id_t *oids, sai_status_t *statuses) {
+                    for (uint32_t i = 0; i < count; i++)
+                    {
+                        FakeRule rule = {};
+                        for (uint32_t j = 0; j < attr_count[i]; j++)
+                        {
+                            const auto &attr = attr_list[i][j];
+                            if (attr.id == SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID)
+                            {
+                                rule.group_id = attr.value.oid;
+                            }
+                            else if (attr.id == SAI_DASH_ACL_RULE_ATTR_SIP)
+                            {
+                                rule.sip_count = attr.value.ipprefixlist.count;
+                            }
+                        }
+                        oids[i] = ++m_next_oid;
+                        statuses[i] = SAI_STATUS_SUCCESS;
+                        m_rules[oids[i]] = rule;
+                    }
+                    m_created_rules += count;
+                    return SAI_STATUS_SUCCESS;
+                }));
+            ON_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules)
+                .WillByDefault(Invoke([this](uint32_t count, const sai_object_id_t *oids,
+                                             sai_bulk_op_error_mode_t, sai_status_t *statuses) {
+                    for (uint32_t i = 0; i < count; i++)
+                    {
+                        statuses[i] = m_rules.erase(oids[i]) ? SAI_STATUS_SUCCESS : SAI_STATUS_ITEM_NOT_FOUND;
+                    }
+                    m_removed_rules += count;
+                    return SAI_STATUS_SUCCESS;
+                }));
+            ON_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rule)
+                .WillByDefault(Invoke([this](sai_object_id_t oid) {
+                    return m_rules.erase(oid) ? SAI_STATUS_SUCCESS : SAI_STATUS_ITEM_NOT_FOUND;
+                }));
+            ON_CALL(*mock_sai_dash_eni_api, set_eni_attribute)
+                .WillByDefault(Invoke([this](sai_object_id_t, const sai_attribute_t *attr) {
+                    m_bound_group = attr->value.oid;
+                    return SAI_STATUS_SUCCESS;
+                }));
+        }
+
+        void PreTearDown() override
+        {
+            RestoreSaiApis();
+            DEINIT_SAI_API_MOCK(dash_eni);
+            DEINIT_SAI_API_MOCK(dash_acl);
+        }
+
+        dash::types::IpPrefix BuildPrefix(const std::string &ip, const std::string &mask)
+        {
+            dash::types::IpPrefix prefix;
+            prefix.mutable_ip()->set_ipv4(swss::IpAddress(ip).getV4Addr());
+            prefix.mutable_mask()->set_ipv4(swss::IpAddress(mask).getV4Addr());
+            return prefix;
+        }
+
+        void SetTag(const std::string &tag_id, size_t prefix_count, bool expect_empty = true)
+        {
+            dash::tag::PrefixTag tag;
+            tag.set_ip_version(dash::types::IP_VERSION_IPV4);
+            for (size_t i = 0; i < prefix_count; i++)
+            {
+                *tag.add_prefix_list() = BuildPrefix("10.0." + std::to_string(i) + ".0", "255.255.255.0");
+            }
+            SetDashTable(APP_DASH_PREFIX_TAG_TABLE_NAME, tag_id, tag, true, expect_empty);
+        }
+
+        void CreateGroup(const std::string &group_id)
+        {
+            dash::acl_group::AclGroup group;
+            group.set_ip_version(dash::types::IP_VERSION_IPV4);
+            SetDashTable(APP_DASH_ACL_GROUP_TABLE_NAME, group_id, group);
+        }
+
+        dash::acl_rule::AclRule BuildRule(uint32_t priority, const std::string &src_tag = "")
+        {
+            dash::acl_rule::AclRule rule;
+            rule.set_priority(priority);
+            rule.set_action(dash::acl_rule::ACTION_PERMIT);
+            rule.set_terminating(false);
+            if (src_tag.empty())
+            {
+                *rule.add_src_addr() = BuildPrefix("192.168.0.0", "255.255.0.0");
+            }
+            else
+            {
+                rule.add_src_tag(src_tag);
+            }
+            *rule.add_dst_addr() = BuildPrefix("192.168.1.0", "255.255.255.0");
+            return rule;
+        }
+
+        std::string RuleKey(const std::string &group_id, size_t index)
+        {
+            return group_id + ":rule" + std::to_string(index);
+        }
+
+        // Sends the rules through one drain of the rule table, like a burst of the APP DB
+        void SetRules(const std::string &group_id, size_t count, const std::string &src_tag = "", bool set = true, bool expect_empty = true)
+        {
+            auto consumer = std::make_unique<Consumer>(
+                new swss::ConsumerStateTable(m_app_db.get(), APP_DASH_ACL_RULE_TABLE_NAME),
+                m_dashAclOrch, APP_DASH_ACL_RULE_TABLE_NAME);
+
+            std::deque<swss::KeyOpFieldsValuesTuple> entries;
+            for (size_t i = 0; i < count; i++)
+            {
+                if (set)
+                {
+                    auto rule = BuildRule(static_cast<uint32_t>(i + 1), (i % 2) ? "" : src_tag);
+                    entries.emplace_back(RuleKey(group_id, i), SET_COMMAND,
+                                         std::vector<swss::FieldValueTuple>{ { "pb", rule.SerializeAsString() } });
+                }
+                else
+                {
+                    entries.emplace_back(RuleKey(group_id, i), DEL_COMMAND, std::vector<swss::FieldValueTuple>{});
+                }
+            }
+            consumer->addToSync(entries);
+            static_cast<Orch *>(m_dashAclOrch)->doTask(*consumer);
+
+            EXPECT_EQ(consumer->m_toSync.empty(), expect_empty);
+        }
+
+        void BindGroup(const std::string &group_id)
+        {
+            CreateApplianceEntry();
+            CreateVnet();
+            SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, BuildEniEntry());
+
+            dash::acl_in::AclIn acl_in;
+            acl_in.set_v4_acl_group_id(group_id);
+            SetDashTable(APP_DASH_ACL_IN_TABLE_NAME, eni1 + ":1", acl_in);
+        }
+
+        // The tests use one group at a time
+        sai_object_id_t GetGroupOid()
+        {
+            EXPECT_EQ(m_groups.size(), 1u);
+            return m_groups.empty() ? SAI_NULL_OBJECT_ID : *m_groups.begin();
+        }
+
+        size_t CountRules(sai_object_id_t group_oid, uint32_t sip_count)
+        {
+            size_t count = 0;
+            for (const auto &it : m_rules)
+            {
+                if (it.second.group_id == group_oid && it.second.sip_count == sip_count)
+                {
+                    count++;
+                }
+            }
+            return count;
+        }
+    };
+
+    TEST_F(DashAclOrchTest, RulesAreCreatedAndRemovedInBulk)
+    {
+        CreateGroup("group1");
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rule).Times(0);
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rule).Times(0);
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules).Times(1);
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules).Times(1);
+
+        SetRules("group1", 100);
+        EXPECT_EQ(m_rules.size(), 100u);
+        EXPECT_EQ(CountRules(GetGroupOid(), 1), 100u);
+
+        SetRules("group1", 100, "", false);
+        EXPECT_TRUE(m_rules.empty());
+    }
+
+    TEST_F(DashAclOrchTest, GroupWithRulesIsRemovedAfterItsRules)
+    {
+        CreateGroup("group1");
+        SetRules("group1", 2);
+        sai_object_id_t group_oid = GetGroupOid();
+
+        SetDashTable(APP_DASH_ACL_GROUP_TABLE_NAME, "group1", dash::acl_group::AclGroup(), false, false);
+        EXPECT_EQ(m_groups.count(group_oid), 1u);
+
+        SetRules("group1", 2, "", false);
+        SetDashTable(APP_DASH_ACL_GROUP_TABLE_NAME, "group1", dash::acl_group::AclGroup(), false);
+        EXPECT_EQ(m_groups.count(group_oid), 0u);
+    }
+
+    TEST_F(DashAclOrchTest, RuleUpdateReplacesTheRule)
+    {
+        CreateGroup("group1");
+        SetRules("group1", 1);
+        auto old_oid = m_rules.begin()->first;
+
+        SetRules("group1", 1);
+        ASSERT_EQ(m_rules.size(), 1u);
+        EXPECT_NE(m_rules.begin()->first, old_oid);
+        EXPECT_EQ(m_created_rules, 2u);
+        EXPECT_EQ(m_removed_rules, 1u);
+    }
+
+    TEST_F(DashAclOrchTest, RuleIsKeptWhenItsReplacementFails)
+    {
+        CreateGroup("group1");
+        SetRules("group1", 1);
+        auto old_oid = m_rules.begin()->first;
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules)
+            .WillOnce(Invoke([](uint32_t count, const sai_object_id_t *, sai_bulk_op_error_mode_t, sai_status_t *statuses) {
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    statuses[i] = SAI_STATUS_OBJECT_IN_USE;
+                }
+                return SAI_STATUS_OBJECT_IN_USE;
+            }));
+        SetRules("group1", 1, "", true, false);
+
+        // The old rule is still tracked, the new one is removed
+        ASSERT_EQ(m_rules.size(), 1u);
+        EXPECT_EQ(m_rules.begin()->first, old_oid);
+
+        SetRules("group1", 1, "", false);
+        EXPECT_TRUE(m_rules.empty());
+    }
+
+    TEST_F(DashAclOrchTest, RuleRemovalWaitsForTheGroupUnbind)
+    {
+        CreateGroup("group1");
+        SetRules("group1", 1);
+        BindGroup("group1");
+
+        SetRules("group1", 1, "", false, false);
+        EXPECT_EQ(m_rules.size(), 1u);
+
+        SetDashTable(APP_DASH_ACL_IN_TABLE_NAME, eni1 + ":1", dash::acl_in::AclIn(), false);
+        SetRules("group1", 1, "", false);
+        EXPECT_TRUE(m_rules.empty());
+    }
+
+    TEST_F(DashAclOrchTest, RuleSetWaitsForItsRetriedRemoval)
+    {
+        CreateGroup("group1");
+        SetRules("group1", 1);
+        auto old_oid = m_rules.begin()->first;
+        BindGroup("group1");
+
+        auto consumer = std::make_unique<Consumer>(
+            new swss::ConsumerStateTable(m_app_db.get(), APP_DASH_ACL_RULE_TABLE_NAME),
+            m_dashAclOrch, APP_DASH_ACL_RULE_TABLE_NAME);
+        std::deque<swss::KeyOpFieldsValuesTuple> entries;
+        entries.emplace_back(RuleKey("group1", 0), DEL_COMMAND, std::vector<swss::FieldValueTuple>{});
+        entries.emplace_back(RuleKey("group1", 0), SET_COMMAND,
+                             std::vector<swss::FieldValueTuple>{ { "pb", BuildRule(2).SerializeAsString() } });
+        consumer->addToSync(entries);
+
+        // Both operations wait for the unbind, in order
+        static_cast<Orch *>(m_dashAclOrch)->doTask(*consumer);
+        EXPECT_EQ(consumer->m_toSync.size(), 2u);
+        ASSERT_EQ(m_rules.size(), 1u);
+        EXPECT_EQ(m_rules.begin()->first, old_oid);
+
+        SetDashTable(APP_DASH_ACL_IN_TABLE_NAME, eni1 + ":1", dash::acl_in::AclIn(), false);
+        static_cast<Orch *>(m_dashAclOrch)->doTask(*consumer);
+        EXPECT_TRUE(consumer->m_toSync.empty());
+        ASSERT_EQ(m_rules.size(), 1u);
+        EXPECT_NE(m_rules.begin()->first, old_oid);
+    }
+
+    TEST_F(DashAclOrchTest, RuleSetWaitsForTheGroupUnbind)
+    {
+        CreateGroup("group1");
+        SetRules("group1", 1);
+        BindGroup("group1");
+
+        SetRules("group1", 2, "", true, false);
+        EXPECT_EQ(m_rules.size(), 1u);
+
+        SetDashTable(APP_DASH_ACL_IN_TABLE_NAME, eni1 + ":1", dash::acl_in::AclIn(), false);
+        SetRules("group1", 2);
+        EXPECT_EQ(m_rules.size(), 2u);
+    }
+
+    TEST_F(DashAclOrchTest, TagUpdateRecreatesTheRulesOfTheTagOnly)
+    {
+        SetTag("tag1", 2);
+        CreateGroup("group1");
+        // The even rules use the tag
+        SetRules("group1", 10, "tag1");
+        sai_object_id_t group_oid = GetGroupOid();
+        EXPECT_EQ(CountRules(group_oid, 2), 5u);
+
+        m_created_rules = 0;
+        m_removed_rules = 0;
+        SetTag("tag1", 3);
+        EXPECT_EQ(m_created_rules, 5u);
+        EXPECT_EQ(m_removed_rules, 5u);
+        EXPECT_EQ(CountRules(group_oid, 3), 5u);
+        EXPECT_EQ(CountRules(group_oid, 1), 5u);
+        EXPECT_EQ(GetGroupOid(), group_oid);
+
+        // Same prefixes, nothing to update
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules).Times(0);
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules).Times(0);
+        SetTag("tag1", 3);
+    }
+
+    TEST_F(DashAclOrchTest, TagUpdateOfBoundGroupSwapsTheGroup)
+    {
+        SetTag("tag1", 2);
+        CreateGroup("group1");
+        SetRules("group1", 10, "tag1");
+        sai_object_id_t old_group_oid = GetGroupOid();
+
+        BindGroup("group1");
+        EXPECT_EQ(m_bound_group, old_group_oid);
+
+        SetTag("tag1", 3);
+        sai_object_id_t new_group_oid = GetGroupOid();
+        EXPECT_NE(new_group_oid, old_group_oid);
+        EXPECT_EQ(m_bound_group, new_group_oid);
+
+        // All the rules are in the new group, the old group and its rules are removed
+        EXPECT_EQ(m_rules.size(), 10u);
+        EXPECT_EQ(CountRules(new_group_oid, 3), 5u);
+        EXPECT_EQ(CountRules(new_group_oid, 1), 5u);
+        EXPECT_EQ(m_groups.count(old_group_oid), 0u);
+        EXPECT_EQ(m_groups.count(new_group_oid), 1u);
+    }
+
+    TEST_F(DashAclOrchTest, BoundGroupIsKeptWhenTheUpdateFails)
+    {
+        SetTag("tag1", 2);
+        CreateGroup("group1");
+        SetRules("group1", 4, "tag1");
+        sai_object_id_t group_oid = GetGroupOid();
+        BindGroup("group1");
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules)
+            .WillOnce(Invoke([](sai_object_id_t, uint32_t count, const uint32_t *, const sai_attribute_t **,
+                                sai_bulk_op_error_mode_t, sai_object_id_t *oids, sai_status_t *statuses) {
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    oids[i] = SAI_NULL_OBJECT_ID;
+                    statuses[i] = SAI_STATUS_INSUFFICIENT_RESOURCES;
+                }
+                return SAI_STATUS_INSUFFICIENT_RESOURCES;
+            }));
+        SetTag("tag1", 3, false);
+
+        EXPECT_EQ(GetGroupOid(), group_oid);
+        EXPECT_EQ(m_bound_group, group_oid);
+        EXPECT_EQ(m_groups.size(), 1u);
+        EXPECT_EQ(CountRules(group_oid, 2), 2u);
+    }
+
+    TEST_F(DashAclOrchTest, RuleRate)
+    {
+        SetTag("tag1", 4);
+        CreateGroup("group1");
+
+        auto start = steady_clock::now();
+        SetRules("group1", BENCH_RULES, "tag1");
+        double createRate = static_cast<double>(BENCH_RULES) / duration_cast<duration<double>>(steady_clock::now() - start).count();
+        EXPECT_EQ(m_rules.size(), BENCH_RULES);
+
+        // Half of the rules use the tag
+        start = steady_clock::now();
+        SetTag("tag1", 8);
+        double tagRate = static_cast<double>(BENCH_RULES / 2) / duration_cast<duration<double>>(steady_clock::now() - start).count();
+        EXPECT_EQ(CountRules(GetGroupOid(), 8), BENCH_RULES / 2);
+
+        BindGroup("group1");
+        start = steady_clock::now();
+        SetTag("tag1", 4);
+        double boundTagRate = static_cast<double>(BENCH_RULES) / duration_cast<duration<double>>(steady_clock::now() - start).count();
+        EXPECT_EQ(CountRules(m_bound_group, 4), BENCH_RULES / 2);
+        EXPECT_EQ(m_rules.size(), BENCH_RULES);
+
+        std::cout << "[ DashAcl ] " << BENCH_RULES << " rules: create "
+                  << static_cast<uint64_t>(createRate) << " /sec, tag update "
+                  << static_cast<uint64_t>(tagRate) << " /sec, tag update of bound group "
+                  << static_cast<uint64_t>(boundTagRate) << " /sec" << std::endl;
+    }
+}
@@ -2,6 +2,7 @@
 #include "../mock_orchagent_main.h"
 #include "../mock_table.h"
 #include "port.h"
+#include "sai_serialize.h"
 #define private public // Need to modify internal cache
 #include "portsorch.h"
 #include "fdborch.h"
@@ -42,6 +43,73 @@ namespace fdb_syncd_flush_test
     {
         sai_fdb_api = pold_sai_fdb_api;
     }
+
+    uint32_t ut_fdb_single_calls;
+    uint32_t ut_fdb_bulk_calls;
+    uint32_t ut_fdb_bulk_entries;
+
+    sai_status_t _ut_stub_sai_count_create_fdb_entry (
+        _In_ const sai_fdb_entry_t *fdb_entry,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        ut_fdb_single_calls++;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_count_remove_fdb_entry (
+        _In_ const sai_fdb_entry_t *fdb_entry)
+    {
+        ut_fdb_single_calls++;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_create_fdb_entries (
+        _In_ uint32_t object_count,
+        _In_ const sai_fdb_entry_t *fdb_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        ut_fdb_bulk_calls++;
+        ut_fdb_bulk_entries += object_count;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_remove_fdb_entries (
+        _In_ uint32_t object_count,
+        _In_ const sai_fdb_entry_t *fdb_entry,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        ut_fdb_bulk_calls++;
+        ut_fdb_bulk_entries += object_count;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    void _hook_sai_fdb_count_api()
+    {
+        ut_fdb_single_calls = 0;
+        ut_fdb_bulk_calls = 0;
+        ut_fdb_bulk_entries = 0;
+
+        ut_sai_fdb_api = *sai_fdb_api;
+        pold_sai_fdb_api = sai_fdb_api;
+        ut_sai_fdb_api.create_fdb_entry = _ut_stub_sai_count_create_fdb_entry;
+        ut_sai_fdb_api.remove_fdb_entry = _ut_stub_sai_count_remove_fdb_entry;
+        ut_sai_fdb_api.create_fdb_entries = _ut_stub_sai_create_fdb_entries;
+        ut_sai_fdb_api.remove_fdb_entries = _ut_stub_sai_remove_fdb_entries;
+        sai_fdb_api = &ut_sai_fdb_api;
+    }
     struct FdbOrchTest : public ::testing::Test
     {   
         std::shared_ptr<swss::DBConnector> m_config_db;
@@ -548,4 +616,260 @@ namespace fdb_syncd_flush_test
         ASSERT_EQ(m_portsOrch->m_portList[VXLAN_REMOTE].m_fdb_count, 1);
         _unhook_sai_fdb_api();
     }
+
+    void doFdbTask(FdbOrch* m_fdborch, const deque<KeyOpFieldsValuesTuple>& entries)
+    {
+        auto consumer = dynamic_cast<Consumer *>(m_fdborch->getExecutor(APP_FDB_TABLE_NAME));
+        consumer->addToSync(entries);
+        m_fdborch->doTask(*consumer);
+    }
+
+    string staticMac(uint32_t i)
+    {
+        char mac[18];
+        snprintf(mac, sizeof(mac), "52:54:00:00:00:%02x", i);
+        return mac;
+    }
+
+    /* Test the static MACs of a doTask are programmed with one bulk call */
+    TEST_F(FdbOrchTest, BulkAddRemoveStaticMacs)
+    {
+        const uint32_t count = 32;
+
+        _hook_sai_fdb_count_api();
+        m_fdborch->gFdbBulker = EntityBulker<sai_fdb_api_t>(sai_fdb_api, 1000);
+        m_fdborch->m_fdbBulkSupported = true;
+
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+        m_portsOrch->m_initDone = true;
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entries.push_back({ string(VLAN40) + ":" + staticMac(i), SET_COMMAND, { { "port", ETH0 }, { "type", "static" } } });
+        }
+        doFdbTask(m_fdborch.get(), entries);
+
+        ASSERT_EQ(ut_fdb_bulk_calls, 1u);
+        ASSERT_EQ(ut_fdb_bulk_entries, count);
+        ASSERT_EQ(ut_fdb_single_calls, 0u);
+        ASSERT_EQ(m_fdborch->m_entries.size(), (size_t)count);
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, count);
+        ASSERT_EQ(m_portsOrch->m_portList[ETH0].m_fdb_count, count);
+
+        string port;
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget(string(VLAN40) + ":" + staticMac(count - 1), "port", port), true);
+        ASSERT_EQ(port, ETH0);
+
+        /* Make sure the tasks are consumed */
+        auto consumer = dynamic_cast<Consumer *>(m_fdborch->getExecutor(APP_FDB_TABLE_NAME));
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        /*
+         * The add of a removed MAC is queued right after its remove, so it
+         * starts a new bulk: remove(1), then remove(count - 1) and create(1)
+         */
+        ut_fdb_bulk_calls = 0;
+        ut_fdb_bulk_entries = 0;
+        entries.clear();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entries.push_back({ string(VLAN40) + ":" + staticMac(i), DEL_COMMAND, { } });
+        }
+        entries.push_back({ string(VLAN40) + ":" + staticMac(0), SET_COMMAND, { { "port", ETH0 }, { "type", "static" } } });
+        doFdbTask(m_fdborch.get(), entries);
+
+        ASSERT_EQ(ut_fdb_bulk_calls, 3u);
+        ASSERT_EQ(ut_fdb_bulk_entries, count + 1);
+        ASSERT_EQ(ut_fdb_single_calls, 0u);
+        ASSERT_EQ(m_fdborch->m_entries.size(), 1u);
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 1);
+        ASSERT_EQ(m_portsOrch->m_portList[ETH0].m_fdb_count, 1);
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget(string(VLAN40) + ":" + staticMac(count - 1), "port", port), false);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        _unhook_sai_fdb_api();
+    }
+
+    /* Test the MACs are programmed one at a time without the SAI bulk API */
+    TEST_F(FdbOrchTest, BulkFallbackToSingleCalls)
+    {
+        const uint32_t count = 8;
+
+        _hook_sai_fdb_count_api();
+        m_fdborch->m_fdbBulkSupported = false;
+
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+        m_portsOrch->m_initDone = true;
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entries.push_back({ string(VLAN40) + ":" + staticMac(i), SET_COMMAND, { { "port", ETH0 }, { "type", "static" } } });
+        }
+        doFdbTask(m_fdborch.get(), entries);
+
+        ASSERT_EQ(ut_fdb_single_calls, count);
+        ASSERT_EQ(ut_fdb_bulk_calls, 0u);
+        ASSERT_EQ(m_fdborch->m_entries.size(), (size_t)count);
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, count);
+
+        entries.clear();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entries.push_back({ string(VLAN40) + ":" + staticMac(i), DEL_COMMAND, { } });
+        }
+        doFdbTask(m_fdborch.get(), entries);
+
+        ASSERT_EQ(ut_fdb_single_calls, 2 * count);
+        ASSERT_EQ(ut_fdb_bulk_calls, 0u);
+        ASSERT_TRUE(m_fdborch->m_entries.empty());
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 0);
+
+        _unhook_sai_fdb_api();
+    }
+
+    /* Test a flush by port only clears the entries currently on the port */
+    TEST_F(FdbOrchTest, FlushByPortAfterMacMove)
+    {
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVxlanPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+        setUpVxlanMember(m_portsOrch.get());
+
+        sai_object_id_t eth0_bridge_port = m_portsOrch->m_portList[ETH0].m_bridge_port_id;
+        sai_object_id_t remote_bridge_port = m_portsOrch->m_portList[VXLAN_REMOTE].m_bridge_port_id;
+        sai_object_id_t vlan_oid = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
+
+        /* Learn two MACs on Ethernet0 and move the second one */
+        vector<uint8_t> mac1 = {124, 254, 144, 18, 34, 1};
+        vector<uint8_t> mac2 = {124, 254, 144, 18, 34, 2};
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_LEARNED, mac1, eth0_bridge_port, vlan_oid);
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_LEARNED, mac2, eth0_bridge_port, vlan_oid);
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_MOVE, mac2, remote_bridge_port, vlan_oid);
+        ASSERT_EQ(m_fdborch->m_entries.size(), 2u);
+
+        for (auto& it : m_fdborch->m_entries)
+        {
+            it.second.is_flush_pending = true;
+        }
+
+        /* Consolidated flush of Ethernet0 */
+        vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, flush_mac_addr, eth0_bridge_port, SAI_NULL_OBJECT_ID);
+
+        ASSERT_EQ(m_fdborch->m_entries.size(), 1u);
+        auto it = m_fdborch->m_entries.begin();
+        ASSERT_EQ(it->first.mac, MacAddress("7c:fe:90:12:22:02"));
+        ASSERT_EQ(it->second.bridge_port_id, remote_bridge_port);
+
+        /* Flush of the moved MAC alone */
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, mac2, eth0_bridge_port, vlan_oid);
+        ASSERT_EQ(m_fdborch->m_entries.size(), 1u);
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, mac2, remote_bridge_port, vlan_oid);
+        ASSERT_TRUE(m_fdborch->m_entries.empty());
+    }
+
+    sai_fdb_event_notification_data_t fdbEvent(sai_fdb_event_t type, const vector<uint8_t>& mac_addr,
+                                               sai_object_id_t bridge_port_id, sai_object_id_t bv_id,
+                                               vector<sai_attribute_t>& attrs)
+    {
+        sai_fdb_event_notification_data_t event;
+        memset(&event, 0, sizeof(event));
+        event.event_type = type;
+        memcpy(event.fdb_entry.mac_address, mac_addr.data(), sizeof(sai_mac_t));
+        event.fdb_entry.bv_id = bv_id;
+
+        attrs.resize(2);
+        attrs[0].id = SAI_FDB_ENTRY_ATTR_TYPE;
+        attrs[0].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+        attrs[1].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+        attrs[1].value.oid = bridge_port_id;
+        event.attr_count = (uint32_t)attrs.size();
+        event.attr = attrs.data();
+
+        return event;
+    }
+
+    /* Test the learn and move events of a batch of notifications are coalesced per MAC */
+    TEST_F(FdbOrchTest, CoalesceFdbEventBatch)
+    {
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVxlanPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+        setUpVxlanMember(m_portsOrch.get());
+
+        sai_object_id_t eth0_bridge_port = m_portsOrch->m_portList[ETH0].m_bridge_port_id;
+        sai_object_id_t remote_bridge_port = m_portsOrch->m_portList[VXLAN_REMOTE].m_bridge_port_id;
+        sai_object_id_t vlan_oid = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
+
+        vector<uint8_t> mac1 = {124, 254, 144, 18, 34, 1};
+        vector<uint8_t> mac2 = {124, 254, 144, 18, 34, 2};
+
+        /*
+         * mac1 is learnt three times, mac2 is learnt and moves back and forth
+         * four times, one notification per event
+         */
+        vector<pair<sai_fdb_event_t, pair<vector<uint8_t>, sai_object_id_t>>> storm = {
+            { SAI_FDB_EVENT_LEARNED, { mac1, eth0_bridge_port } },
+            { SAI_FDB_EVENT_LEARNED, { mac2, eth0_bridge_port } },
+            { SAI_FDB_EVENT_LEARNED, { mac1, eth0_bridge_port } },
+            { SAI_FDB_EVENT_MOVE, { mac2, remote_bridge_port } },
+            { SAI_FDB_EVENT_MOVE, { mac2, eth0_bridge_port } },
+            { SAI_FDB_EVENT_LEARNED, { mac1, eth0_bridge_port } },
+            { SAI_FDB_EVENT_MOVE, { mac2, remote_bridge_port } },
+            { SAI_FDB_EVENT_MOVE, { mac2, eth0_bridge_port } },
+        };
+
+        deque<KeyOpFieldsValuesTuple> notifications;
+        for (const auto& it : storm)
+        {
+            vector<sai_attribute_t> attrs;
+            auto event = fdbEvent(it.first, it.second.first, it.second.second, vlan_oid, attrs);
+            notifications.push_back({ sai_serialize_fdb_event_ntf(1, &event), "fdb_event", { } });
+        }
+        m_fdborch->handleFdbNotifications(notifications);
+
+        /* The repeated learns and all the moves but the last one are dropped */
+        ASSERT_EQ(m_fdborch->m_fdbEvents.size(), storm.size());
+        vector<bool> coalesced = { false, false, true, true, true, true, true, false };
+        for (size_t i = 0; i < storm.size(); i++)
+        {
+            ASSERT_EQ(m_fdborch->m_fdbEvents[i].coalesced, coalesced[i]);
+        }
+
+        ASSERT_EQ(m_fdborch->m_entries.size(), 2u);
+        FdbEntry entry;
+        entry.mac = MacAddress("7c:fe:90:12:22:02");
+        entry.bv_id = vlan_oid;
+        auto it = m_fdborch->m_entries.find(entry);
+        ASSERT_NE(it, m_fdborch->m_entries.end());
+        ASSERT_EQ(it->second.bridge_port_id, eth0_bridge_port);
+        ASSERT_EQ(m_portsOrch->m_portList[ETH0].m_fdb_count, 2);
+        ASSERT_EQ(m_portsOrch->m_portList[VXLAN_REMOTE].m_fdb_count, 0);
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 2);
+
+        /* An age event ends the sequence of its MAC, the learn after it is kept */
+        notifications.clear();
+        for (auto type : { SAI_FDB_EVENT_AGED, SAI_FDB_EVENT_LEARNED, SAI_FDB_EVENT_LEARNED })
+        {
+            vector<sai_attribute_t> attrs;
+            auto event = fdbEvent(type, mac1, eth0_bridge_port, vlan_oid, attrs);
+            notifications.push_back({ sai_serialize_fdb_event_ntf(1, &event), "fdb_event", { } });
+        }
+        m_fdborch->handleFdbNotifications(notifications);
+
+        ASSERT_EQ(m_fdborch->m_fdbEvents.size(), 3u);
+        ASSERT_FALSE(m_fdborch->m_fdbEvents[0].coalesced);
+        ASSERT_FALSE(m_fdborch->m_fdbEvents[1].coalesced);
+        ASSERT_TRUE(m_fdborch->m_fdbEvents[2].coalesced);
+        ASSERT_EQ(m_fdborch->m_entries.size(), 2u);
+        ASSERT_EQ(m_portsOrch->m_portList[ETH0].m_fdb_count, 2);
+    }
 }
@@ -1,4 +1,5 @@
 #include "fpmsyncd/fpmlink.h"
+#include "redisutility.h"
 
 #include <swss/netdispatcher.h>
 
@@ -69,3 +70,27 @@ TEST_F(FpmLinkTest, TwoNlMessagesInFpmMessage)
     m_fpm.processFpmMessage(reinterpret_cast<fpm_msg_hdr_t*>(static_cast<void*>(fpmMsgBuffer)));
 }
 
+
+TEST_F(FpmLinkTest, RawRouteParsing)
+{
+    // Single FPM message containing single RTM_NEWROUTE of the default VRF
+    alignas(fpm_msg_hdr_t) unsigned char fpmMsgBuffer[] = {
+        0x01, 0x01, 0x00, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0xE0,
+        0x12, 0x6F, 0xC4, 0x02, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+        0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x08, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x05,
+        0x00, 0xAC, 0x1E, 0x38, 0xA6, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00
+    };
+
+    m_routeSync.setSuppressionEnabled(true);
+    m_routeSync.setRawRouteParsingEnabled(true);
+
+    // The route is written by RouteSync directly, without going through the dispatcher
+    EXPECT_CALL(m_mock, onMsg(_, _)).Times(0);
+
+    m_fpm.processFpmMessage(reinterpret_cast<fpm_msg_hdr_t*>(static_cast<void*>(fpmMsgBuffer)));
+
+    Table routeTable(&m_db, APP_ROUTE_TABLE_NAME);
+    std::vector<FieldValueTuple> fvs;
+    ASSERT_TRUE(routeTable.get("1.1.1.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop", true).get(), "172.30.56.166");
+}
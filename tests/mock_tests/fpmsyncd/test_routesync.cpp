@@ -17,6 +17,7 @@
 #include <linux/seg6_iptunnel.h>
 
 #include <sstream>
+#include <unistd.h>
 
 using namespace swss;
 using namespace testing;
@@ -2236,4 +2237,417 @@ TEST_F(FpmSyncdResponseTest, TestPicContext_NHG)
     free(nlh_2);
     free(nlh_3);
     free(group_nlh);
-}
\ No newline at end of file
+}
+struct RawRouteNextHop
+{
+    const char *gateway;
+    int ifindex;
+    uint8_t hops;
+};
+
+/* Build a route message the way zebra encodes it for the FPM */
+static ut_fpmsyncd::nlmsg *createRouteNlMsg(uint16_t cmd, uint8_t family, const char *dst, uint8_t dst_len,
+                                            const vector<RawRouteNextHop> &nexthops, uint32_t table = 0,
+                                            uint8_t type = RTN_UNICAST, uint32_t nhg_id = 0)
+{
+    auto *msg = (ut_fpmsyncd::nlmsg *)calloc(1, sizeof(ut_fpmsyncd::nlmsg));
+    unsigned int addr_len = family == AF_INET ? 4 : 16;
+    unsigned char addr[16];
+
+    msg->n.nlmsg_type = cmd;
+    msg->n.nlmsg_flags = NLM_F_REQUEST | NLM_F_CREATE | NLM_F_REPLACE;
+    msg->n.nlmsg_len = NLMSG_LENGTH(sizeof(struct rtmsg));
+    msg->r.rtm_family = family;
+    msg->r.rtm_dst_len = dst_len;
+    msg->r.rtm_protocol = RTPROT_BGP;
+    msg->r.rtm_scope = RT_SCOPE_UNIVERSE;
+    msg->r.rtm_type = type;
+
+    inet_pton(family, dst, addr);
+    nl_attr_put(&msg->n, sizeof(*msg), RTA_DST, addr, addr_len);
+    if (table)
+    {
+        nl_attr_put32(&msg->n, sizeof(*msg), RTA_TABLE, table);
+    }
+    if (nhg_id)
+    {
+        nl_attr_put32(&msg->n, sizeof(*msg), RTA_NH_ID, nhg_id);
+    }
+
+    if (nexthops.size() == 1)
+    {
+        if (nexthops[0].gateway)
+        {
+            inet_pton(family, nexthops[0].gateway, addr);
+            nl_attr_put(&msg->n, sizeof(*msg), RTA_GATEWAY, addr, addr_len);
+        }
+        nl_attr_put32(&msg->n, sizeof(*msg), RTA_OIF, nexthops[0].ifindex);
+    }
+    else if (nexthops.size() > 1)
+    {
+        struct rtattr *multipath = NLMSG_TAIL(&msg->n);
+        nl_attr_put(&msg->n, sizeof(*msg), RTA_MULTIPATH, NULL, 0);
+        for (const auto &nh : nexthops)
+        {
+            struct rtnexthop *rtnh = (struct rtnexthop *)NLMSG_TAIL(&msg->n);
+            rtnh->rtnh_ifindex = nh.ifindex;
+            rtnh->rtnh_hops = nh.hops;
+            msg->n.nlmsg_len = NLMSG_ALIGN(msg->n.nlmsg_len) + (uint32_t)RTNH_ALIGN(sizeof(*rtnh));
+            if (nh.gateway)
+            {
+                inet_pton(family, nh.gateway, addr);
+                nl_attr_put(&msg->n, sizeof(*msg), RTA_GATEWAY, addr, addr_len);
+            }
+            rtnh->rtnh_len = (unsigned short)((uint8_t *)NLMSG_TAIL(&msg->n) - (uint8_t *)rtnh);
+        }
+        nl_attr_nest_end(&msg->n, multipath);
+    }
+
+    return msg;
+}
+
+static bool getRawTestIfName(int ifindex, char *ifname, size_t size)
+{
+    switch (ifindex)
+    {
+        case 1:
+            strncpy(ifname, "Ethernet1", size);
+            return true;
+        case 2:
+            strncpy(ifname, "Ethernet2", size);
+            return true;
+        case 10:
+            strncpy(ifname, "Vrf10", size);
+            return true;
+        case 11:
+            strncpy(ifname, "eth0", size);
+            return true;
+        default:
+            return false;
+    }
+}
+
+TEST_F(FpmSyncdResponseTest, TestRouteMsgRawMatchesLibnl)
+{
+    Table route_table(m_db.get(), APP_ROUTE_TABLE_NAME);
+
+    EXPECT_CALL(m_mockRouteSync, getIfName(_, _, _))
+        .WillRepeatedly(Invoke(getRawTestIfName));
+    m_mockRouteSync.setSuppressionEnabled(true);
+    m_mockRouteSync.setRawRouteParsingEnabled(true);
+
+    struct TestRoute
+    {
+        ut_fpmsyncd::nlmsg *msg;
+        string key;
+    };
+    vector<TestRoute> routes = {
+        { createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {{"192.168.1.1", 1, 0}}), "10.1.0.0/24" },
+        { createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.2.0.0", 24, {{"192.168.1.1", 1, 0}, {"192.168.1.2", 2, 2}}), "10.2.0.0/24" },
+        { createRouteNlMsg(RTM_NEWROUTE, AF_INET6, "2001:db8::", 64, {{"fe80::1", 1, 0}, {NULL, 2, 0}}), "2001:db8::/64" },
+        { createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.3.0.0", 16, {{"192.168.1.1", 1, 0}}, 10), "Vrf10:10.3.0.0/16" },
+        { createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.4.0.1", 32, {{NULL, 3, 0}}), "10.4.0.1" },
+        { createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.5.0.0", 24, {}, 0, RTN_BLACKHOLE), "10.5.0.0/24" },
+    };
+
+    for (auto &route : routes)
+    {
+        // Reference entry from the libnl path
+        rtnl_route *route_obj = NULL;
+        ASSERT_EQ(rtnl_route_parse(&route.msg->n, &route_obj), 0);
+        m_mockRouteSync.onMsg(RTM_NEWROUTE, (nl_object *)route_obj);
+        rtnl_route_put(route_obj);
+
+        vector<FieldValueTuple> expected;
+        ASSERT_TRUE(route_table.get(route.key, expected)) << route.key;
+        route_table.del(route.key);
+
+        EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&route.msg->n)) << route.key;
+
+        vector<FieldValueTuple> fvs;
+        ASSERT_TRUE(route_table.get(route.key, fvs)) << route.key;
+        EXPECT_EQ(fvs, expected) << route.key;
+    }
+
+    vector<FieldValueTuple> fvs;
+    ASSERT_TRUE(route_table.get("10.2.0.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop", true).get(), "192.168.1.1,192.168.1.2");
+    EXPECT_EQ(fvsGetValue(fvs, "ifname", true).get(), "Ethernet1,Ethernet2");
+    EXPECT_EQ(fvsGetValue(fvs, "weight", true).get(), "1,2");
+    ASSERT_TRUE(route_table.get("2001:db8::/64", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop", true).get(), "fe80::1,::");
+    ASSERT_TRUE(route_table.get("10.4.0.1", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "ifname", true).get(), "unknown");
+
+    // Delete
+    auto *del = createRouteNlMsg(RTM_DELROUTE, AF_INET, "10.3.0.0", 16, {}, 10);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&del->n));
+    EXPECT_FALSE(route_table.get("Vrf10:10.3.0.0/16", fvs));
+    free(del);
+
+    // Routes to the management interfaces are removed
+    auto *mgmt = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {{"192.168.1.1", 11, 0}});
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&mgmt->n));
+    EXPECT_FALSE(route_table.get("10.1.0.0/24", fvs));
+    free(mgmt);
+
+    for (auto &route : routes)
+    {
+        free(route.msg);
+    }
+}
+
+TEST_F(FpmSyncdResponseTest, TestRouteMsgRawWithNHG)
+{
+    Table route_table(m_db.get(), APP_ROUTE_TABLE_NAME);
+
+    EXPECT_CALL(m_mockRouteSync, getIfName(_, _, _))
+        .WillRepeatedly(Invoke(getRawTestIfName));
+    m_mockRouteSync.setSuppressionEnabled(true);
+    m_mockRouteSync.setRawRouteParsingEnabled(true);
+
+    struct nlmsghdr *nlh1 = createNewNextHopMsgHdr(1, test_gateway, 1);
+    struct nlmsghdr *nlh2 = createNewNextHopMsgHdr(2, test_gateway_, 2);
+    struct nlmsghdr *group_nlh = createNewNextHopMsgHdr({{1, 1}, {2, 2}}, 3);
+    m_mockRouteSync.onNextHopMsg(nlh1, (int)(nlh1->nlmsg_len - NLMSG_LENGTH(sizeof(struct nhmsg))));
+    m_mockRouteSync.onNextHopMsg(nlh2, (int)(nlh2->nlmsg_len - NLMSG_LENGTH(sizeof(struct nhmsg))));
+    m_mockRouteSync.onNextHopMsg(group_nlh, (int)(group_nlh->nlmsg_len - NLMSG_LENGTH(sizeof(struct nhmsg))));
+
+    vector<FieldValueTuple> fvs;
+
+    // Unknown group, the route is dropped
+    auto *msg = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {}, 0, RTN_UNICAST, 4);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msg->n));
+    EXPECT_FALSE(route_table.get("10.1.0.0/24", fvs));
+    free(msg);
+
+    // Single next hop
+    msg = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {}, 0, RTN_UNICAST, 1);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msg->n));
+    ASSERT_TRUE(route_table.get("10.1.0.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop", true).get(), test_gateway);
+    EXPECT_EQ(fvsGetValue(fvs, "ifname", true).get(), "Ethernet1");
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop_group", true).get(), "");
+    free(msg);
+
+    // Group
+    msg = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {}, 0, RTN_UNICAST, 3);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msg->n));
+    ASSERT_TRUE(route_table.get("10.1.0.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop_group", true).get(), "3");
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop", true).get(), "");
+    free(msg);
+
+    Table nexthop_group_table(m_db.get(), APP_NEXTHOP_GROUP_TABLE_NAME);
+    EXPECT_TRUE(nexthop_group_table.get("3", fvs));
+
+    free(nlh1);
+    free(nlh2);
+    free(group_nlh);
+}
+
+TEST_F(FpmSyncdResponseTest, TestRouteMsgRawFallback)
+{
+    Table route_table(m_db.get(), APP_ROUTE_TABLE_NAME);
+    vector<string> keys;
+
+    EXPECT_CALL(m_mockRouteSync, getIfName(_, _, _))
+        .WillRepeatedly(Invoke(getRawTestIfName));
+
+    auto *msg = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {{"192.168.1.1", 1, 0}});
+
+    m_mockRouteSync.setSuppressionEnabled(true);
+
+    // Disabled
+    EXPECT_FALSE(m_mockRouteSync.onRouteMsgRaw(&msg->n));
+    m_mockRouteSync.setRawRouteParsingEnabled(true);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msg->n));
+    route_table.del("10.1.0.0/24");
+    free(msg);
+
+    vector<ut_fpmsyncd::nlmsg *> fallbacks = {
+        // Table 20 isn't a known VRF
+        createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {{"192.168.1.1", 1, 0}}, 20),
+        // Multicast
+        createRouteNlMsg(RTM_NEWROUTE, AF_INET, "224.0.0.0", 4, {{"192.168.1.1", 1, 0}}, 0, RTN_MULTICAST),
+        // No next hop
+        createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {}),
+        // Label stack
+        createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {{"192.168.1.1", 1, 0}}),
+        // Next hop through an IPv4 gateway of an IPv6 route
+        createRouteNlMsg(RTM_NEWROUTE, AF_INET6, "2001:db8::", 64, {{"fe80::1", 1, 0}}),
+    };
+    nl_attr_put16(&fallbacks[3]->n, sizeof(ut_fpmsyncd::nlmsg), RTA_ENCAP_TYPE, LWTUNNEL_ENCAP_MPLS);
+    in_addr via = {};
+    nl_attr_put(&fallbacks[4]->n, sizeof(ut_fpmsyncd::nlmsg), RTA_VIA, &via, sizeof(via));
+
+    for (auto *fallback : fallbacks)
+    {
+        EXPECT_FALSE(m_mockRouteSync.onRouteMsgRaw(&fallback->n));
+        free(fallback);
+    }
+
+    route_table.getKeys(keys);
+    EXPECT_TRUE(keys.empty());
+}
+
+TEST_F(FpmSyncdResponseTest, TestRouteMsgRawIfNameCache)
+{
+    Table route_table(m_db.get(), APP_ROUTE_TABLE_NAME);
+    vector<FieldValueTuple> fvs;
+
+    m_mockRouteSync.setSuppressionEnabled(true);
+    m_mockRouteSync.setRawRouteParsingEnabled(true);
+
+    // The name is looked up once, then served from the cache
+    EXPECT_CALL(m_mockRouteSync, getIfName(5, _, _))
+        .WillOnce(DoAll(
+            [](int32_t, char* ifname, size_t size) {
+                strncpy(ifname, "Ethernet5", size);
+            },
+            Return(true)
+        ));
+
+    auto *msg1 = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {{"192.168.1.1", 5, 0}});
+    auto *msg2 = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.2.0.0", 24, {{"192.168.1.1", 5, 0}});
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msg1->n));
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msg2->n));
+    ASSERT_TRUE(route_table.get("10.2.0.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "ifname", true).get(), "Ethernet5");
+
+    // Renamed by RTM_NEWLINK
+    rtnl_link *link = rtnl_link_alloc();
+    rtnl_link_set_ifindex(link, 5);
+    rtnl_link_set_name(link, "Ethernet8");
+    m_mockRouteSync.updateIfNameCache(RTM_NEWLINK, link);
+
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msg2->n));
+    ASSERT_TRUE(route_table.get("10.2.0.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "ifname", true).get(), "Ethernet8");
+
+    m_mockRouteSync.updateIfNameCache(RTM_DELLINK, link);
+    EXPECT_EQ(m_mockRouteSync.m_ifNameCache.count(5), 0);
+    rtnl_link_put(link);
+
+    free(msg1);
+    free(msg2);
+}
+
+TEST_F(FpmSyncdResponseTest, TestRouteCoalescing)
+{
+    Table route_table(m_db.get(), APP_ROUTE_TABLE_NAME);
+    vector<FieldValueTuple> fvs;
+
+    EXPECT_CALL(m_mockRouteSync, getIfName(_, _, _))
+        .WillRepeatedly(Invoke(getRawTestIfName));
+    m_mockRouteSync.setSuppressionEnabled(true);
+    m_mockRouteSync.setRawRouteParsingEnabled(true);
+
+    EXPECT_FALSE(m_mockRouteSync.isRouteCoalescingEnabled());
+    m_mockRouteSync.setRouteCoalescing(1000, 3);
+    EXPECT_TRUE(m_mockRouteSync.isRouteCoalescingEnabled());
+    EXPECT_EQ(m_mockRouteSync.getRouteCoalescingTimeout(), -1);
+
+    auto *set1 = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {{"192.168.1.1", 1, 0}});
+    auto *set2 = createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.1.0.0", 24, {{"192.168.1.2", 2, 0}});
+    auto *del = createRouteNlMsg(RTM_DELROUTE, AF_INET, "10.1.0.0", 24, {});
+
+    // Only the last update of the prefix is written
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&set1->n));
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&set2->n));
+    EXPECT_FALSE(route_table.get("10.1.0.0/24", fvs));
+    int timeout = m_mockRouteSync.getRouteCoalescingTimeout();
+    EXPECT_GT(timeout, 0);
+    EXPECT_LE(timeout, 1000);
+
+    m_mockRouteSync.flushCoalescedRoutes();
+    ASSERT_TRUE(route_table.get("10.1.0.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop", true).get(), "192.168.1.2");
+    EXPECT_EQ(fvsGetValue(fvs, "ifname", true).get(), "Ethernet2");
+    EXPECT_EQ(m_mockRouteSync.getRouteCoalescingTimeout(), -1);
+
+    auto &counters = m_mockRouteSync.getRouteCoalescingCounters();
+    EXPECT_EQ(counters.received, 2u);
+    EXPECT_EQ(counters.suppressed, 1u);
+    EXPECT_EQ(counters.flushed, 1u);
+
+    // A SET followed by a DEL only removes the prefix
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&set1->n));
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&del->n));
+    ASSERT_TRUE(route_table.get("10.1.0.0/24", fvs));
+    m_mockRouteSync.flushCoalescedRoutes();
+    EXPECT_FALSE(route_table.get("10.1.0.0/24", fvs));
+    EXPECT_EQ(counters.received, 4u);
+    EXPECT_EQ(counters.suppressed, 2u);
+    EXPECT_EQ(counters.flushed, 2u);
+
+    // A DEL replaced by a SET isn't counted as suppressed
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&del->n));
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&set1->n));
+    m_mockRouteSync.flushCoalescedRoutes();
+    ASSERT_TRUE(route_table.get("10.1.0.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop", true).get(), "192.168.1.1");
+    EXPECT_EQ(counters.suppressed, 2u);
+    EXPECT_EQ(counters.flushed, 3u);
+
+    // Written as soon as max entries prefixes are held
+    vector<ut_fpmsyncd::nlmsg *> msgs = {
+        createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.2.0.0", 24, {{"192.168.1.1", 1, 0}}),
+        createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.3.0.0", 24, {{"192.168.1.1", 1, 0}}),
+        createRouteNlMsg(RTM_NEWROUTE, AF_INET, "10.4.0.0", 24, {{"192.168.1.1", 1, 0}}),
+    };
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msgs[0]->n));
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msgs[1]->n));
+    EXPECT_FALSE(route_table.get("10.2.0.0/24", fvs));
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&msgs[2]->n));
+    EXPECT_TRUE(route_table.get("10.2.0.0/24", fvs));
+    EXPECT_TRUE(route_table.get("10.4.0.0/24", fvs));
+    EXPECT_EQ(m_mockRouteSync.getRouteCoalescingTimeout(), -1);
+
+    // Due once the oldest update has been held max delay
+    m_mockRouteSync.setRouteCoalescing(1, 0);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgRaw(&set2->n));
+    usleep(2000);
+    EXPECT_EQ(m_mockRouteSync.getRouteCoalescingTimeout(), 0);
+
+    // Disabling writes the held updates
+    m_mockRouteSync.setRouteCoalescing(0, 0);
+    EXPECT_FALSE(m_mockRouteSync.isRouteCoalescingEnabled());
+    ASSERT_TRUE(route_table.get("10.1.0.0/24", fvs));
+    EXPECT_EQ(fvsGetValue(fvs, "nexthop", true).get(), "192.168.1.2");
+
+    for (auto *msg : msgs)
+    {
+        free(msg);
+    }
+    free(set1);
+    free(set2);
+    free(del);
+}
+
+TEST_F(WarmRestartRouteSyncTest, TestRouteCoalescingWarmRestartInProgress)
+{
+    m_testRouteSync.setRouteCoalescing(1000, 0);
+
+    auto route = create_route("192.168.13.0/24");
+    rtnl_route_set_type(route.get(), RTN_BLACKHOLE);
+    rtnl_route_set_protocol(route.get(), RTPROT_STATIC);
+
+    Table routeTable(m_db.get(), APP_ROUTE_TABLE_NAME);
+    vector<FieldValueTuple> result;
+
+    // Held until flushed
+    m_testRouteSync.onRouteMsg(RTM_NEWROUTE, (struct nl_object*)route.get(), nullptr);
+    EXPECT_FALSE(routeTable.get("192.168.13.0/24", result));
+    m_testRouteSync.flushCoalescedRoutes();
+    EXPECT_TRUE(routeTable.get("192.168.13.0/24", result));
+
+    // The refresh map is reconciled as a whole, it bypasses the coalescing
+    m_testRouteSync.getWarmStartHelper().setState(WarmStart::INITIALIZED);
+    EXPECT_TRUE(m_testRouteSync.getWarmStartHelper().inProgress());
+
+    m_testRouteSync.onRouteMsg(RTM_DELROUTE, (struct nl_object*)route.get(), nullptr);
+    EXPECT_EQ(m_testRouteSync.getRouteCoalescingTimeout(), -1);
+    EXPECT_EQ(m_testRouteSync.getRouteCoalescingCounters().received, 1u);
+    EXPECT_TRUE(routeTable.get("192.168.13.0/24", result));
+}
@@ -1,9 +1,11 @@
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <unistd.h>
 #include <sys/stat.h>
 #include "../mock_table.h"
+#include "../common/mock_netlink_programmer.h"
 #include "warm_restart.h"
 #define private public
 #include "intfmgr.h"
@@ -12,20 +14,12 @@
 extern int (*callback)(const std::string &cmd, std::string &stdout);
 extern std::vector<std::string> mockCallArgs;
 
-bool Ethernet0IPv6Set = false;
+const std::string Ethernet0IPv6Add = "ip address add 2001::8/64 dev Ethernet0";
+std::shared_ptr<mock_netlink::MockNetlinkProgrammer> mockNetlink;
 
 int cb(const std::string &cmd, std::string &stdout){
     mockCallArgs.push_back(cmd);
-    if (cmd == "sysctl -w net.ipv6.conf.\"Ethernet0\".disable_ipv6=0") Ethernet0IPv6Set = true;
-    else if (cmd.find("/sbin/ip -6 address \"add\"") == 0) {
-        return Ethernet0IPv6Set ? 0 : 2;
-    }
-    else if (cmd == "/sbin/ip link set \"Ethernet64.10\" \"up\""){
-        return 1;
-    }
-    else {
-        return 0;
-    }
+    if (cmd == "sysctl -w net.ipv6.conf.\"Ethernet0\".disable_ipv6=0") mockNetlink->failures.erase(Ethernet0IPv6Add);
     return 0;
 }
 
@@ -59,12 +53,19 @@ namespace intfmgr_ut
             cfg_intf_tables = tables;
             mockCallArgs.clear();
             callback = cb;
+            mockNetlink = std::make_shared<mock_netlink::MockNetlinkProgrammer>();
+            mockNetlink->failures.insert("ip link set Ethernet64.10 up");
+        }
+
+        int requestCount(const std::string &request)
+        {
+            return static_cast<int>(std::count(mockNetlink->requests.begin(), mockNetlink->requests.end(), request));
         }
     };
 
     TEST_F(IntfMgrTest, testSettingIpv6Flag){
-        Ethernet0IPv6Set = false;
-        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables);
+        mockNetlink->failures.insert(Ethernet0IPv6Add);
+        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables, mockNetlink);
         /* Set portStateTable */
         std::vector<swss::FieldValueTuple> values;
         values.emplace_back("state", "ok");
@@ -77,18 +78,12 @@ namespace intfmgr_ut
         const std::vector<std::string>& keys = {"Ethernet0", "2001::8/64"};
         const std::vector<swss::FieldValueTuple> data;
         intfmgr.doIntfAddrTask(keys, data, "SET");
-        int ip_cmd_called = 0;
-        for (auto cmd : mockCallArgs){
-            if (cmd.find("/sbin/ip -6 address \"add\"") == 0){
-                ip_cmd_called++;
-            }
-        }
-        ASSERT_EQ(ip_cmd_called, 2);
+        ASSERT_EQ(requestCount(Ethernet0IPv6Add), 2);
     }
 
     TEST_F(IntfMgrTest, testNoSettingIpv6Flag){
-        Ethernet0IPv6Set = true; // Assuming it is already set by SDK
-        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables);
+        // Assuming IPv6 is already enabled by SDK
+        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables, mockNetlink);
         /* Set portStateTable */
         std::vector<swss::FieldValueTuple> values;
         values.emplace_back("state", "ok");
@@ -101,26 +96,30 @@ namespace intfmgr_ut
         const std::vector<std::string>& keys = {"Ethernet0", "2001::8/64"};
         const std::vector<swss::FieldValueTuple> data;
         intfmgr.doIntfAddrTask(keys, data, "SET");
-        int ip_cmd_called = 0;
-        for (auto cmd : mockCallArgs){
-            if (cmd.find("/sbin/ip -6 address \"add\"") == 0){
-                ip_cmd_called++;
-            }
-        }
-        ASSERT_EQ(ip_cmd_called, 1);
+        ASSERT_EQ(requestCount(Ethernet0IPv6Add), 1);
+    }
+
+    TEST_F(IntfMgrTest, testFlushLoopbackIntfs){
+        mockNetlink->links = { { "Loopback0", "dummy" }, { "Loopback1", "dummy" }, { "dummy", "dummy" }, { "Bridge", "bridge" } };
+        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables, mockNetlink);
+        ASSERT_FALSE(mockNetlink->linkExists("Loopback0"));
+        ASSERT_FALSE(mockNetlink->linkExists("Loopback1"));
+        ASSERT_TRUE(mockNetlink->linkExists("dummy"));
+        ASSERT_TRUE(mockNetlink->linkExists("Bridge"));
+        ASSERT_EQ(mockNetlink->commits, 1u);
     }
 
     //This test except no runtime error when the set admin status command failed
     //and the subinterface has not ok status (for example not existing subinterface)
     TEST_F(IntfMgrTest, testSetAdminStatusFailToNotOkSubInt){
-        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables);
+        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables, mockNetlink);
         intfmgr.setHostSubIntfAdminStatus("Ethernet64.10", "up", "up");
     }
 
     //This test except runtime error when the set admin status command failed
     //and the subinterface has ok status
     TEST_F(IntfMgrTest, testSetAdminStatusFailToOkSubInt){
-        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables);
+        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables, mockNetlink);
         /* Set portStateTable */
         std::vector<swss::FieldValueTuple> values;
         values.emplace_back("state", "ok");
@@ -17,7 +17,12 @@ namespace mock_orch_test
                 {APP_DASH_TUNNEL_TABLE_NAME, (Orch**) &m_DashTunnelOrch},
                 {APP_DASH_ENI_TABLE_NAME, (Orch**) &m_DashOrch},
                 { APP_DASH_OUTBOUND_PORT_MAP_TABLE_NAME, (Orch **)&m_dashPortMapOrch },
-                { APP_DASH_OUTBOUND_PORT_MAP_RANGE_TABLE_NAME, (Orch **)&m_dashPortMapOrch }
+                { APP_DASH_OUTBOUND_PORT_MAP_RANGE_TABLE_NAME, (Orch **)&m_dashPortMapOrch },
+                {APP_DASH_PREFIX_TAG_TABLE_NAME, (Orch**) &m_dashAclOrch},
+                {APP_DASH_ACL_IN_TABLE_NAME, (Orch**) &m_dashAclOrch},
+                {APP_DASH_ACL_OUT_TABLE_NAME, (Orch**) &m_dashAclOrch},
+                {APP_DASH_ACL_GROUP_TABLE_NAME, (Orch**) &m_dashAclOrch},
+                {APP_DASH_ACL_RULE_TABLE_NAME, (Orch**) &m_dashAclOrch}
             };
             void SetDashTable(std::string table_name, std::string key, const google::protobuf::Message &message, bool set = true, bool expect_empty = true);
             dash::appliance::Appliance BuildApplianceEntry();
@@ -335,6 +335,17 @@ void MockOrchTest::SetUp()
     gDirectory.set(m_dashPortMapOrch);
     ut_orch_list.push_back((Orch **)&m_dashPortMapOrch);
 
+    vector<string> dash_acl_tables = {
+        APP_DASH_PREFIX_TAG_TABLE_NAME,
+        APP_DASH_ACL_IN_TABLE_NAME,
+        APP_DASH_ACL_OUT_TABLE_NAME,
+        APP_DASH_ACL_GROUP_TABLE_NAME,
+        APP_DASH_ACL_RULE_TABLE_NAME
+    };
+    m_dashAclOrch = new DashAclOrch(m_app_db.get(), dash_acl_tables, m_DashOrch, m_dpu_app_state_db.get(), nullptr);
+    gDirectory.set(m_dashAclOrch);
+    ut_orch_list.push_back((Orch **)&m_dashAclOrch);
+
     ApplyInitialConfigs();
     PostSetUp();
 }
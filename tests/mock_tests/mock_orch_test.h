@@ -61,6 +61,7 @@ namespace mock_orch_test
         DashTunnelOrch *m_DashTunnelOrch;
         DashPortMapOrch *m_dashPortMapOrch;
         DashMeterOrch *m_DashMeterOrch;
+        DashAclOrch *m_dashAclOrch;
 
         void PrepareSai();
         void SetUp();
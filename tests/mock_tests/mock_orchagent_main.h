@@ -42,6 +42,7 @@
 #include "dashhaorch.h"
 #include "dashtunnelorch.h"
 #include "dashportmaporch.h"
+#include "dashaclorch.h"
 
 extern int gBatchSize;
 
@@ -110,6 +111,7 @@ extern sai_tam_api_t* sai_tam_api;
 extern sai_dash_vip_api_t* sai_dash_vip_api;
 extern sai_dash_direction_lookup_api_t* sai_dash_direction_lookup_api;
 extern sai_dash_eni_api_t* sai_dash_eni_api;
+extern sai_dash_acl_api_t* sai_dash_acl_api;
 extern sai_dash_ha_api_t* sai_dash_ha_api;
 extern sai_stp_api_t* sai_stp_api;
 extern sai_dash_outbound_ca_to_pa_api_t* sai_dash_outbound_ca_to_pa_api;
@@ -0,0 +1,117 @@
+#include "gtest/gtest.h"
+#include "mock_table.h"
+#define private public
+#include "neighsync.h"
+#undef private
+
+namespace neighsync_ut
+{
+    using namespace std;
+    using namespace swss;
+
+    struct NeighSyncTest : public ::testing::Test
+    {
+        shared_ptr<DBConnector> m_app_db;
+        shared_ptr<DBConnector> m_state_db;
+        shared_ptr<DBConnector> m_config_db;
+        shared_ptr<RedisPipeline> m_pipeline;
+
+        virtual void SetUp() override
+        {
+            testing_db::reset();
+            m_app_db = make_shared<DBConnector>("APPL_DB", 0);
+            m_state_db = make_shared<DBConnector>("STATE_DB", 0);
+            m_config_db = make_shared<DBConnector>("CONFIG_DB", 0);
+            m_pipeline = make_shared<RedisPipeline>(m_app_db.get());
+        }
+    };
+
+    TEST_F(NeighSyncTest, LinkLocalFromCache)
+    {
+        Table cfg_intf_table(m_config_db.get(), CFG_INTF_TABLE_NAME);
+        Table cfg_vlan_intf_table(m_config_db.get(), CFG_VLAN_INTF_TABLE_NAME);
+        Table cfg_lag_intf_table(m_config_db.get(), CFG_LAG_INTF_TABLE_NAME);
+
+        // Loaded when neighsyncd starts
+        cfg_intf_table.set("Ethernet0", { { "ipv6_use_link_local_only", "enable" } });
+        cfg_intf_table.set("Ethernet4", { { "ipv6_use_link_local_only", "disable" } });
+        cfg_intf_table.set("Ethernet8|10.0.0.0/31", { { "NULL", "NULL" } });
+
+        NeighSync sync(m_pipeline.get(), m_state_db.get(), m_config_db.get());
+
+        EXPECT_TRUE(sync.isLinkLocalEnabled("Ethernet0"));
+        EXPECT_FALSE(sync.isLinkLocalEnabled("Ethernet4"));
+        EXPECT_FALSE(sync.isLinkLocalEnabled("Ethernet8"));
+        EXPECT_FALSE(sync.isLinkLocalEnabled("Vlan100"));
+        EXPECT_EQ(sync.m_cfgInterfaceTable.size(), 3u);
+
+        // Changed while running, seen once the table is updated
+        cfg_vlan_intf_table.set("Vlan100", { { "ipv6_use_link_local_only", "enable" } });
+        cfg_lag_intf_table.set("PortChannel1", { { "ipv6_use_link_local_only", "enable" } });
+        cfg_intf_table.set("Ethernet4", { { "ipv6_use_link_local_only", "enable" } });
+        EXPECT_FALSE(sync.isLinkLocalEnabled("Vlan100"));
+
+        for (auto table : sync.getCfgTables())
+        {
+            table->update();
+        }
+        EXPECT_TRUE(sync.isLinkLocalEnabled("Vlan100"));
+        EXPECT_TRUE(sync.isLinkLocalEnabled("PortChannel1"));
+        EXPECT_TRUE(sync.isLinkLocalEnabled("Ethernet4"));
+
+        // The interfaces are looked up in the table of their type only
+        EXPECT_FALSE(sync.isLinkLocalEnabled("Loopback0"));
+        EXPECT_EQ(sync.m_cfgVlanInterfaceTable.size(), 1u);
+        EXPECT_EQ(sync.m_cfgPeerSwitchTable.size(), 0u);
+    }
+
+    TEST_F(NeighSyncTest, BatchNeighbors)
+    {
+        NeighSync sync(m_pipeline.get(), m_state_db.get(), m_config_db.get());
+        Table app_neigh_table(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+        vector<FieldValueTuple> values;
+        string value;
+
+        auto neigh = [](const string &mac) {
+            return vector<FieldValueTuple>{ { "neigh", mac }, { "family", "IPv4" } };
+        };
+
+        app_neigh_table.set("Ethernet8:10.0.0.5", neigh("00:00:00:00:00:05"));
+        EXPECT_EQ(sync.getNeighFlushTimeout(), -1);
+
+        // Last update of each neighbor wins
+        sync.holdNeigh(KeyOpFieldsValuesTuple("Ethernet0:10.0.0.1", SET_COMMAND, neigh("00:00:00:00:00:01")));
+        sync.holdNeigh(KeyOpFieldsValuesTuple("Ethernet0:10.0.0.1", DEL_COMMAND, vector<FieldValueTuple>()));
+        sync.holdNeigh(KeyOpFieldsValuesTuple("Ethernet0:10.0.0.1", SET_COMMAND, neigh("00:00:00:00:00:11")));
+        sync.holdNeigh(KeyOpFieldsValuesTuple("Ethernet4:10.0.0.3", SET_COMMAND, neigh("00:00:00:00:00:03")));
+        sync.holdNeigh(KeyOpFieldsValuesTuple("Ethernet8:10.0.0.5", DEL_COMMAND, vector<FieldValueTuple>()));
+
+        // Nothing written until the batch is flushed
+        EXPECT_GE(sync.getNeighFlushTimeout(), 0);
+        EXPECT_LE(sync.getNeighFlushTimeout(), NEIGH_BATCH_MAX_DELAY);
+        EXPECT_FALSE(app_neigh_table.get("Ethernet0:10.0.0.1", values));
+        EXPECT_TRUE(app_neigh_table.get("Ethernet8:10.0.0.5", values));
+
+        sync.flushNeighbors();
+        EXPECT_EQ(sync.getNeighFlushTimeout(), -1);
+        EXPECT_TRUE(app_neigh_table.hget("Ethernet0:10.0.0.1", "neigh", value));
+        EXPECT_EQ(value, "00:00:00:00:00:11");
+        EXPECT_TRUE(app_neigh_table.get("Ethernet4:10.0.0.3", values));
+        EXPECT_FALSE(app_neigh_table.get("Ethernet8:10.0.0.5", values));
+
+        const auto &counters = sync.getNeighBatchCounters();
+        EXPECT_EQ(counters.received, 5u);
+        EXPECT_EQ(counters.suppressed, 2u);
+        EXPECT_EQ(counters.flushed, 3u);
+
+        // A full batch is written right away
+        for (int i = 0; i < NEIGH_BATCH_MAX_ENTRIES; i++)
+        {
+            sync.holdNeigh(KeyOpFieldsValuesTuple("Vlan1000:192.168." + to_string(i / 256) + "." + to_string(i % 256),
+                                                  SET_COMMAND, neigh("00:00:00:00:00:01")));
+        }
+        EXPECT_EQ(sync.getNeighFlushTimeout(), -1);
+        EXPECT_TRUE(app_neigh_table.get("Vlan1000:192.168.15.255", values));
+        EXPECT_EQ(counters.flushed, 3u + NEIGH_BATCH_MAX_ENTRIES);
+    }
+}
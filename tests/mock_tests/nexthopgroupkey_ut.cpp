@@ -0,0 +1,156 @@
+#include "nexthopgroupkey.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+
+namespace nexthopgroupkey_test
+{
+    using namespace std;
+
+    TEST(NextHopGroupKey, InternedIds)
+    {
+        NextHopKey nh1(IpAddress("10.0.0.1"), "Ethernet0");
+        NextHopKey nh2(IpAddress("10.0.0.2"), "Ethernet4");
+        NextHopKey nh1w = nh1;
+        nh1w.weight = 3;
+
+        // the weight isn't part of the next hop identity
+        uint32_t id1 = NextHopKeyTable::acquire(nh1);
+        uint32_t id2 = NextHopKeyTable::acquire(nh2);
+        EXPECT_EQ(NextHopKeyTable::acquire(nh1w), id1);
+        EXPECT_NE(id1, id2);
+
+        uint32_t id;
+        ASSERT_TRUE(NextHopKeyTable::find(NextHopKey(IpAddress("10.0.0.2"), "Ethernet4"), id));
+        EXPECT_EQ(id, id2);
+
+        // the id is erased with its last reference, then reused
+        size_t size = NextHopKeyTable::size();
+        NextHopKeyTable::release(id2);
+        EXPECT_FALSE(NextHopKeyTable::find(nh2, id));
+        EXPECT_EQ(NextHopKeyTable::size(), size - 1);
+        NextHopKeyTable::release(id1);
+        EXPECT_TRUE(NextHopKeyTable::find(nh1, id));
+        NextHopKeyTable::release(id1);
+        EXPECT_FALSE(NextHopKeyTable::find(nh1, id));
+
+        NextHopKey nh3(IpAddress("10.0.0.3"), "Ethernet8");
+        uint32_t id3 = NextHopKeyTable::acquire(nh3);
+        EXPECT_TRUE(id3 == id1 || id3 == id2);
+        NextHopKeyTable::release(id3);
+    }
+
+    TEST(NextHopGroupKey, IdsSharedByThreads)
+    {
+        size_t size = NextHopKeyTable::size();
+        {
+            // groups are copied and destroyed by a ring and by the main thread at once
+            NextHopGroupKey shared("198.51.100.1@Ethernet0,198.51.100.2@Ethernet4");
+            auto worker = [&shared](int t) {
+                for (int i = 0; i < 2000; i++)
+                {
+                    NextHopGroupKey copy = shared;
+                    NextHopGroupKey own("198.51.100." + to_string(10 + t) + "@Ethernet8");
+                    own.add("198.51.100.2@Ethernet4");
+                    EXPECT_EQ(copy, shared);
+                }
+            };
+            thread t1(worker, 1);
+            thread t2(worker, 2);
+            worker(0);
+            t1.join();
+            t2.join();
+            EXPECT_EQ(NextHopKeyTable::size(), size + 2);
+        }
+        EXPECT_EQ(NextHopKeyTable::size(), size);
+    }
+
+    TEST(NextHopGroupKey, IdsReleasedWithGroups)
+    {
+        size_t size = NextHopKeyTable::size();
+        {
+            NextHopGroupKey a("192.0.2.1@Ethernet0,192.0.2.2@Ethernet4");
+            NextHopGroupKey b = a;
+            EXPECT_EQ(NextHopKeyTable::size(), size + 2);
+
+            // b stops sharing the next hops of a when it changes
+            b.add("192.0.2.3@Ethernet8");
+            b.remove("192.0.2.1@Ethernet0");
+            EXPECT_EQ(NextHopKeyTable::size(), size + 3);
+            EXPECT_EQ(a, NextHopGroupKey("192.0.2.2@Ethernet4,192.0.2.1@Ethernet0"));
+            EXPECT_EQ(b, NextHopGroupKey("192.0.2.3@Ethernet8,192.0.2.2@Ethernet4"));
+
+            a.clear();
+            EXPECT_EQ(NextHopKeyTable::size(), size + 2);
+        }
+        EXPECT_EQ(NextHopKeyTable::size(), size);
+    }
+
+    TEST(NextHopGroupKey, EqualityAndHash)
+    {
+        NextHopGroupKey a("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4");
+        NextHopGroupKey b("10.0.0.2@Ethernet4,10.0.0.1@Ethernet0");
+        NextHopGroupKey c;
+        c.add("10.0.0.2@Ethernet4");
+        c.add(NextHopKey(IpAddress("10.0.0.1"), "Ethernet0"));
+
+        EXPECT_EQ(a, b);
+        EXPECT_EQ(a, c);
+        EXPECT_EQ(hash<NextHopGroupKey>()(a), hash<NextHopGroupKey>()(c));
+
+        c.remove("10.0.0.2@Ethernet4");
+        EXPECT_NE(a, c);
+        EXPECT_EQ(c, NextHopGroupKey("10.0.0.1@Ethernet0"));
+
+        c.clear();
+        EXPECT_EQ(c, NextHopGroupKey());
+        EXPECT_EQ(hash<NextHopGroupKey>()(c), hash<NextHopGroupKey>()(NextHopGroupKey()));
+
+        // weighted groups only match with the same weights
+        NextHopGroupKey w1("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4", string("1,2"));
+        NextHopGroupKey w2("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4", string("2,1"));
+        EXPECT_NE(w1, w2);
+        EXPECT_NE(w1, a);
+        EXPECT_EQ(w1, NextHopGroupKey("10.0.0.2@Ethernet4,10.0.0.1@Ethernet0", string("2,1")));
+        EXPECT_FALSE(w1 < w1);
+        EXPECT_TRUE((w1 < w2) != (w2 < w1));
+    }
+
+    TEST(NextHopGroupKey, LookupBench)
+    {
+        const int groups = 2000;
+        const int lookups = 200000;
+
+        unordered_map<NextHopGroupKey, int> table;
+        vector<NextHopGroupKey> keys;
+        for (int i = 0; i < groups; i++)
+        {
+            string nhs;
+            for (int j = 0; j < 8; j++)
+            {
+                nhs += (j ? "," : "") + string("10.") + to_string(i / 256) + "." + to_string(i % 256) + "." + to_string(j + 1)
+                       + "@Ethernet" + to_string(j * 4);
+            }
+            keys.emplace_back(nhs);
+            table.emplace(keys.back(), i);
+        }
+
+        using namespace std::chrono;
+
+        long found = 0;
+        auto start = steady_clock::now();
+        for (int i = 0; i < lookups; i++)
+        {
+            found += table.find(keys[i % groups])->second;
+        }
+        auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+
+        EXPECT_EQ(table.size(), (size_t)groups);
+        EXPECT_GT(found, 0);
+        cout << "[ NextHopGroupKey ] " << groups << " groups of 8 next hops: "
+             << elapsed / lookups << " ns per lookup" << endl;
+    }
+}
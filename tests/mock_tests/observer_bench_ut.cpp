@@ -0,0 +1,212 @@
+#include "observer.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+/*
+ * Subject dispatch by type and by key, and a benchmark of the FDB change
+ * rate with observers attached to all the changes against observers attached
+ * to the MAC they follow.
+ */
+namespace observer_bench_test
+{
+    using namespace std::chrono;
+
+    const size_t OBSERVERS = 64;
+    const size_t EVENTS = 204800;
+    const sai_object_id_t VLAN_OID = 0x26000000000001;
+
+    struct TestUpdate
+    {
+        SubjectKey key;
+    };
+
+    class TestSubject : public Subject
+    {
+    public:
+        using Subject::notify;
+    };
+
+    /* Counts the changes about its key, like a mirror session following its neighbor MAC */
+    class TestObserver : public Observer
+    {
+    public:
+        explicit TestObserver(const SubjectKey &key) : key(key) {}
+
+        void update(SubjectType type, void *cntx) override
+        {
+            calls++;
+            if (static_cast<TestUpdate *>(cntx)->key == key)
+            {
+                matched++;
+            }
+        }
+
+        SubjectKey key;
+        size_t calls = 0;
+        size_t matched = 0;
+    };
+
+    /* Detaches from its key on the first change */
+    class OneShotObserver : public TestObserver
+    {
+    public:
+        OneShotObserver(TestSubject &subject, const SubjectKey &key) : TestObserver(key), subject(subject) {}
+
+        void update(SubjectType type, void *cntx) override
+        {
+            TestObserver::update(type, cntx);
+            subject.detach(this, type, key);
+        }
+
+        TestSubject &subject;
+    };
+
+    SubjectKey macKey(size_t i)
+    {
+        uint8_t mac[6] = { 0x02, 0x00, 0x00, 0x00, static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i) };
+        return SubjectKey(VLAN_OID, MacAddress(mac));
+    }
+
+    TEST(Subject, AttachByType)
+    {
+        TestSubject subject;
+        TestObserver all(macKey(0)), fdb(macKey(0)), port(macKey(0));
+
+        subject.attach(&all);
+        subject.attach(&fdb, SUBJECT_TYPE_FDB_CHANGE);
+        subject.attach(&port, SUBJECT_TYPE_PORT_CHANGE);
+
+        TestUpdate update = { macKey(0) };
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update, macKey(1));
+
+        EXPECT_EQ(all.calls, 2u);
+        EXPECT_EQ(fdb.calls, 2u);
+        EXPECT_EQ(port.calls, 0u);
+
+        subject.detach(&fdb);
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        EXPECT_EQ(all.calls, 3u);
+        EXPECT_EQ(fdb.calls, 2u);
+    }
+
+    TEST(Subject, AttachByKey)
+    {
+        TestSubject subject;
+        TestObserver first(macKey(1)), second(macKey(2));
+
+        subject.attach(&first, SUBJECT_TYPE_FDB_CHANGE, macKey(1));
+        subject.attach(&second, SUBJECT_TYPE_FDB_CHANGE, macKey(2));
+        // Attached twice, by two users of the key
+        subject.attach(&second, SUBJECT_TYPE_FDB_CHANGE, macKey(2));
+
+        TestUpdate update = { macKey(2) };
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update, update.key);
+        EXPECT_EQ(first.calls, 0u);
+        EXPECT_EQ(second.calls, 1u);
+
+        // Other types and keys don't reach the observers
+        subject.notify(SUBJECT_TYPE_NEIGH_CHANGE, &update, update.key);
+        update.key = macKey(3);
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update, update.key);
+        EXPECT_EQ(first.calls, 0u);
+        EXPECT_EQ(second.calls, 1u);
+
+        // A change without key reaches every keyed observer of the type once
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        EXPECT_EQ(first.calls, 1u);
+        EXPECT_EQ(second.calls, 2u);
+
+        // The key stays attached until both users detach it
+        update.key = macKey(2);
+        subject.detach(&second, SUBJECT_TYPE_FDB_CHANGE, macKey(2));
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update, update.key);
+        EXPECT_EQ(second.calls, 3u);
+        subject.detach(&second, SUBJECT_TYPE_FDB_CHANGE, macKey(2));
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update, update.key);
+        EXPECT_EQ(second.calls, 3u);
+        EXPECT_EQ(second.matched, 2u);
+    }
+
+    TEST(Subject, DetachWhileNotified)
+    {
+        TestSubject subject;
+        OneShotObserver first(subject, macKey(1)), second(subject, macKey(1));
+
+        subject.attach(&first, SUBJECT_TYPE_FDB_CHANGE, macKey(1));
+        subject.attach(&second, SUBJECT_TYPE_FDB_CHANGE, macKey(1));
+
+        TestUpdate update = { macKey(1) };
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update, update.key);
+        subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update, update.key);
+
+        EXPECT_EQ(first.calls, 1u);
+        EXPECT_EQ(second.calls, 1u);
+    }
+
+    TEST(SubjectBench, FdbChangeRate)
+    {
+        std::vector<TestObserver> observers;
+        observers.reserve(OBSERVERS);
+        for (size_t i = 0; i < OBSERVERS; i++)
+        {
+            observers.emplace_back(macKey(i));
+        }
+
+        TestSubject broadcast, keyed;
+        for (auto &observer : observers)
+        {
+            broadcast.attach(&observer);
+        }
+
+        // Changes about 16 times more MACs than there are observers
+        auto run = [](TestSubject &subject, bool withKey) {
+            auto start = steady_clock::now();
+            for (size_t i = 0; i < EVENTS; i++)
+            {
+                TestUpdate update = { macKey(i % (16 * OBSERVERS)) };
+                if (withKey)
+                {
+                    subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update, update.key);
+                }
+                else
+                {
+                    subject.notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+                }
+            }
+            return static_cast<double>(EVENTS) / duration_cast<duration<double>>(steady_clock::now() - start).count();
+        };
+
+        double broadcastRate = run(broadcast, false);
+
+        size_t broadcastMatched = 0;
+        for (auto &observer : observers)
+        {
+            EXPECT_EQ(observer.calls, EVENTS);
+            broadcastMatched += observer.matched;
+            observer.calls = 0;
+            observer.matched = 0;
+            broadcast.detach(&observer);
+            keyed.attach(&observer, SUBJECT_TYPE_FDB_CHANGE, observer.key);
+        }
+
+        double keyedRate = run(keyed, true);
+
+        // Same changes handled, only the interested observers are called
+        size_t keyedMatched = 0;
+        for (auto &observer : observers)
+        {
+            EXPECT_EQ(observer.calls, observer.matched);
+            keyedMatched += observer.matched;
+        }
+        EXPECT_EQ(keyedMatched, broadcastMatched);
+        EXPECT_EQ(keyedMatched, EVENTS / 16);
+
+        std::cout << "[ Subject ] " << OBSERVERS << " observers: fdb changes broadcast "
+                  << static_cast<uint64_t>(broadcastRate) << " /sec, by key "
+                  << static_cast<uint64_t>(keyedRate) << " /sec" << std::endl;
+    }
+}
@@ -3,6 +3,7 @@
 #include "orchdaemon.h"
 #undef protected
 #include "dbconnector.h"
+#include "timer.h"
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "mock_sai_switch.h"
@@ -101,7 +102,7 @@ namespace orchdaemon_test
 
         bool task_executed = false;
         AnyTask task = [&task_executed]() { task_executed = true;};
-        gRingBuffer->push(task);
+        gRingBuffer->push(std::move(task));
 
         // verify ring thread is conditional locked
         EXPECT_TRUE(gRingBuffer->IsIdle());
@@ -167,6 +168,141 @@ namespace orchdaemon_test
         orchd->disableRingBuffer();
     }
 
+    TEST_F(OrchDaemonTest, RingPoolAffinity)
+    {
+        RingPool pool;
+        pool.addGroup({"ROUTE_TABLE"});
+        pool.addGroup({"NEIGH_TABLE"});
+        pool.addGroup({"FDB_TABLE"});
+        pool.addGroup({"DASH_ROUTE_TABLE", "DASH_ROUTE_RULE_TABLE"});
+
+        // dependent groups are merged, dependencies on main thread tables are ignored
+        pool.addDependency("ROUTE_TABLE", "NEIGH_TABLE");
+        pool.addDependency("NEIGH_TABLE", "INTF_TABLE");
+        pool.build();
+
+        EXPECT_EQ(pool.getRings().size(), 3);
+        EXPECT_EQ(pool.getRing("ROUTE_TABLE"), pool.getRing("NEIGH_TABLE"));
+        EXPECT_NE(pool.getRing("ROUTE_TABLE"), pool.getRing("FDB_TABLE"));
+        EXPECT_EQ(pool.getRing("DASH_ROUTE_TABLE"), pool.getRing("DASH_ROUTE_RULE_TABLE"));
+        EXPECT_EQ(pool.getRing("INTF_TABLE"), nullptr);
+
+        EXPECT_TRUE(pool.IsIdle());
+        EXPECT_FALSE(pool.threadCreated());
+
+        pool.getRing("FDB_TABLE")->push([](){});
+        EXPECT_FALSE(pool.IsIdle());
+    }
+
+    TEST_F(OrchDaemonTest, RingPoolThreads)
+    {
+        orchd->enableRingBuffer();
+
+        auto gRingPool = orchd->gRingPool;
+        ASSERT_TRUE(gRingPool != nullptr);
+        EXPECT_TRUE(Executor::gRingPool == gRingPool);
+        EXPECT_TRUE(gRingPool->getRing("ROUTE_TABLE") == orchd->gRingBuffer);
+
+        // the DASH routes depend on the DASH VNETs and share their ring, apart from the routes
+        EXPECT_TRUE(gRingPool->getRing(APP_DASH_ROUTE_GROUP_TABLE_NAME) == gRingPool->getRing(APP_DASH_VNET_TABLE_NAME));
+        EXPECT_TRUE(gRingPool->getRing(APP_DASH_VNET_MAPPING_TABLE_NAME) == gRingPool->getRing(APP_DASH_VNET_TABLE_NAME));
+        EXPECT_TRUE(gRingPool->getRing(APP_DASH_VNET_TABLE_NAME) != orchd->gRingBuffer);
+
+        for (auto &ring : gRingPool->getRings())
+        {
+            if (ring != orchd->gRingBuffer)
+            {
+                orchd->m_ringWorkers.emplace_back(&OrchDaemon::popRing, orchd, ring);
+            }
+        }
+        orchd->ring_thread = std::thread(&OrchDaemon::popRingBuffer, orchd);
+
+        for (auto &ring : gRingPool->getRings())
+        {
+            while (!ring->thread_created)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+
+        std::vector<std::string> tables = {"ROUTE_TABLE", "DASH_ROUTE_TABLE"};
+        auto orch = make_shared<Orch>(&appl_db, tables);
+        auto route_consumer = dynamic_cast<Consumer *>(orch->getExecutor("ROUTE_TABLE"));
+        auto dash_consumer = dynamic_cast<Consumer *>(orch->getExecutor("DASH_ROUTE_TABLE"));
+
+        std::atomic<int> executed{0};
+        route_consumer->processAnyTask([&](){ executed++; });
+        dash_consumer->processAnyTask([&](){ executed++; });
+
+        // both tasks are executed by their own ring threads
+        while (!gRingPool->IsIdle())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        EXPECT_EQ(executed.load(), 2);
+
+        orchd->stopRingThreads();
+        EXPECT_TRUE(orchd->m_ringWorkers.empty());
+        EXPECT_TRUE(Executor::gRingPool == nullptr);
+    }
+
+    class TimerOrch : public Orch
+    {
+    public:
+        TimerOrch(std::atomic<bool> &ringDone) : Orch(&appl_db, std::vector<std::string>{}), m_ringDone(ringDone) {}
+
+        void doTask(swss::SelectableTimer &timer) override
+        {
+            ringDoneOnTimer = m_ringDone.load();
+            timerRan = true;
+        }
+
+        bool timerRan = false;
+        bool ringDoneOnTimer = false;
+
+    private:
+        std::atomic<bool> &m_ringDone;
+    };
+
+    TEST_F(OrchDaemonTest, TimerWaitsForTheRings)
+    {
+        orchd->enableRingBuffer();
+
+        auto gRingPool = orchd->gRingPool;
+        for (auto &ring : gRingPool->getRings())
+        {
+            if (ring != orchd->gRingBuffer)
+            {
+                orchd->m_ringWorkers.emplace_back(&OrchDaemon::popRing, orchd, ring);
+            }
+        }
+        orchd->ring_thread = std::thread(&OrchDaemon::popRingBuffer, orchd);
+        for (auto &ring : gRingPool->getRings())
+        {
+            while (!ring->thread_created)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+
+        std::atomic<bool> ringDone{false};
+        TimerOrch orch(ringDone);
+        ExecutableTimer timer(new SelectableTimer(timespec { .tv_sec = 1, .tv_nsec = 0 }), &orch, "TEST_TIMER");
+
+        // the timer runs on the main thread once the route ring is done
+        orchd->gRingBuffer->push([&ringDone]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            ringDone = true;
+        });
+        orchd->gRingBuffer->notify();
+        timer.execute();
+
+        EXPECT_TRUE(orch.timerRan);
+        EXPECT_TRUE(orch.ringDoneOnTimer);
+
+        orchd->stopRingThreads();
+    }
+
     TEST_F(OrchDaemonTest, TestRedisFlushFailure)
     {
 
@@ -219,4 +355,52 @@ namespace orchdaemon_test
         orchd->disableRingBuffer();
     }
 
+    TEST_F(OrchDaemonTest, DirtyScheduling)
+    {
+        orchd->enableDirtyScheduling();
+
+        std::vector<std::string> tables = {"ROUTE_TABLE", "OTHER_TABLE"};
+        auto orch = new Orch(&appl_db, tables);
+        auto idle_orch = new Orch(&appl_db, std::vector<std::string>{"IDLE_TABLE"});
+        // orchd owns and deletes the orchs in its list
+        orchd->addOrchList(orch);
+        orchd->addOrchList(idle_orch);
+
+        auto route_consumer = dynamic_cast<Consumer *>(orch->getExecutor("ROUTE_TABLE"));
+        auto other_consumer = dynamic_cast<Consumer *>(orch->getExecutor("OTHER_TABLE"));
+
+        // nothing pending, both orchs are skipped
+        EXPECT_FALSE(orch->isDirty());
+        orchd->doOrchTasks();
+        EXPECT_EQ(orchd->getSchedCounters().serviced, 0);
+        EXPECT_EQ(orchd->getSchedCounters().skipped, 2);
+
+        route_consumer->addToSync(KeyOpFieldsValuesTuple("1.1.1.0/24", SET_COMMAND, { { "nexthop", "10.0.0.1" } }));
+        EXPECT_TRUE(route_consumer->isDirty());
+        EXPECT_FALSE(other_consumer->isDirty());
+        EXPECT_TRUE(orch->isDirty());
+        EXPECT_FALSE(idle_orch->isDirty());
+
+        // Orch::doTask(Consumer&) is a no-op, the pending task keeps the consumer scheduled
+        orchd->doOrchTasks();
+        EXPECT_EQ(orchd->getSchedCounters().serviced, 1);
+        EXPECT_EQ(orchd->getSchedCounters().skipped, 1);
+        EXPECT_TRUE(route_consumer->isDirty());
+        EXPECT_TRUE(orch->isDirty());
+
+        // once drained the consumer is no longer scheduled
+        route_consumer->m_toSync.clear();
+        orchd->doOrchTasks();
+        EXPECT_FALSE(route_consumer->isDirty());
+        EXPECT_FALSE(orch->isDirty());
+
+        orchd->doOrchTasks();
+        EXPECT_EQ(orchd->getSchedCounters().serviced, 0);
+        EXPECT_EQ(orchd->getSchedCounters().skipped, 2);
+        EXPECT_EQ(orchd->getSchedCounters().iterations, 4);
+        EXPECT_EQ(orchd->getSchedCounters().totalServiced, 2);
+
+        Orch::gDirtyScheduling = false;
+    }
+
 }
@@ -48,6 +48,11 @@ struct Portal
             return crmOrch->m_resourcesMap;
         }
 
+        static std::map<CrmResourceType, CrmOrch::CrmResourceEntry> &getResourceMap(CrmOrch *crmOrch)
+        {
+            return crmOrch->m_resourcesMap;
+        }
+
         static std::string getCrmAclKey(CrmOrch *crmOrch, sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint)
         {
             return crmOrch->getCrmAclKey(stage, bindPoint);
@@ -0,0 +1,168 @@
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+/*
+ * Benchmark of the PortsOrch lookups: copying getPort() against the
+ * zero-copy findPort(), and the FDB learn and neighbor add rates built on them.
+ */
+namespace portsorch_bench_test
+{
+    using namespace std;
+    using namespace std::chrono;
+    using namespace mock_orch_test;
+
+    const size_t LOOKUPS = 200000;
+    const size_t FDB_LEARNS = 20000;
+    const size_t NEIGHBORS = 250;
+
+    class PortsOrchBench : public MockOrchTest
+    {
+    protected:
+        void ApplyInitialConfigs()
+        {
+            Table port_table = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+            Table vlan_table = Table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+            Table vlan_member_table = Table(m_app_db.get(), APP_VLAN_MEMBER_TABLE_NAME);
+            Table intf_table = Table(m_app_db.get(), APP_INTF_TABLE_NAME);
+
+            auto ports = ut_helper::getInitialSaiPorts();
+            port_table.set(ETHERNET0, ports[ETHERNET0]);
+            port_table.set("PortConfigDone", { { "count", to_string(1) } });
+            port_table.set("PortInitDone", { {} });
+
+            vlan_table.set(VLAN_1000, { { "admin_status", "up" },
+                                        { "mtu", "9100" },
+                                        { "mac", "00:aa:bb:cc:dd:ee" } });
+            vlan_member_table.set(
+                VLAN_1000 + vlan_member_table.getTableNameSeparator() + ETHERNET0,
+                { { "tagging_mode", "untagged" } });
+
+            intf_table.set(VLAN_1000, { { "mac_addr", "00:00:00:00:00:00" } });
+            intf_table.set(
+                VLAN_1000 + intf_table.getTableNameSeparator() + "192.168.0.1/24", {
+                                                                                        { "scope", "global" },
+                                                                                        { "family", "IPv4" },
+                                                                                    });
+
+            gPortsOrch->addExistingData(&port_table);
+            gPortsOrch->addExistingData(&vlan_table);
+            gPortsOrch->addExistingData(&vlan_member_table);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            gIntfsOrch->addExistingData(&intf_table);
+            static_cast<Orch *>(gIntfsOrch)->doTask();
+        }
+
+        static double rate(size_t count, steady_clock::time_point start)
+        {
+            return static_cast<double>(count) / duration_cast<duration<double>>(steady_clock::now() - start).count();
+        }
+    };
+
+    TEST_F(PortsOrchBench, Lookup)
+    {
+        const Port *vlan = gPortsOrch->findPort(VLAN_1000);
+        ASSERT_NE(vlan, nullptr);
+        const Port *eth = gPortsOrch->findPort(ETHERNET0);
+        ASSERT_NE(eth, nullptr);
+        ASSERT_NE(eth->m_bridge_port_id, SAI_NULL_OBJECT_ID);
+
+        // Same port as the copying lookups
+        EXPECT_EQ(gPortsOrch->findPort(vlan->m_vlan_info.vlan_oid), vlan);
+        EXPECT_EQ(gPortsOrch->findPortByBridgePortId(eth->m_bridge_port_id), eth);
+        EXPECT_EQ(gPortsOrch->findPort("Ethernet1000"), nullptr);
+        EXPECT_EQ(gPortsOrch->findPort(static_cast<sai_object_id_t>(0x1234)), nullptr);
+
+        size_t found = 0;
+        auto start = steady_clock::now();
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            Port port;
+            found += gPortsOrch->getPort(vlan->m_vlan_info.vlan_oid, port);
+        }
+        double copyRate = rate(LOOKUPS, start);
+
+        start = steady_clock::now();
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            found += gPortsOrch->findPort(vlan->m_vlan_info.vlan_oid) != nullptr;
+        }
+        double refRate = rate(LOOKUPS, start);
+
+        EXPECT_EQ(found, 2 * LOOKUPS);
+        cout << "[ PortsOrch ] vlan lookup by oid: getPort " << static_cast<uint64_t>(copyRate)
+             << " /sec, findPort " << static_cast<uint64_t>(refRate) << " /sec" << endl;
+    }
+
+    TEST_F(PortsOrchBench, FdbLearn)
+    {
+        const Port *vlan = gPortsOrch->findPort(VLAN_1000);
+        const Port *eth = gPortsOrch->findPort(ETHERNET0);
+        ASSERT_NE(vlan, nullptr);
+        ASSERT_NE(eth, nullptr);
+
+        uint32_t vlanFdbCount = vlan->m_fdb_count;
+        uint32_t ethFdbCount = eth->m_fdb_count;
+
+        sai_fdb_entry_t entry = {};
+        entry.switch_id = gSwitchId;
+        entry.bv_id = vlan->m_vlan_info.vlan_oid;
+
+        auto start = steady_clock::now();
+        for (size_t i = 0; i < FDB_LEARNS; i++)
+        {
+            uint8_t mac[6] = { 0x02, 0x00, 0x00, static_cast<uint8_t>(i >> 16),
+                               static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i) };
+            memcpy(entry.mac_address, mac, sizeof(mac));
+            gFdbOrch->update(SAI_FDB_EVENT_LEARNED, &entry, eth->m_bridge_port_id, SAI_FDB_ENTRY_TYPE_DYNAMIC);
+        }
+        double learnRate = rate(FDB_LEARNS, start);
+
+        // The counters are updated in place
+        EXPECT_EQ(vlan->m_fdb_count, vlanFdbCount + FDB_LEARNS);
+        EXPECT_EQ(eth->m_fdb_count, ethFdbCount + FDB_LEARNS);
+
+        start = steady_clock::now();
+        for (size_t i = 0; i < FDB_LEARNS; i++)
+        {
+            uint8_t mac[6] = { 0x02, 0x00, 0x00, static_cast<uint8_t>(i >> 16),
+                               static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i) };
+            memcpy(entry.mac_address, mac, sizeof(mac));
+            gFdbOrch->update(SAI_FDB_EVENT_AGED, &entry, eth->m_bridge_port_id, SAI_FDB_ENTRY_TYPE_DYNAMIC);
+        }
+        double ageRate = rate(FDB_LEARNS, start);
+
+        EXPECT_EQ(vlan->m_fdb_count, vlanFdbCount);
+        EXPECT_EQ(eth->m_fdb_count, ethFdbCount);
+        cout << "[ PortsOrch ] fdb learn " << static_cast<uint64_t>(learnRate)
+             << " /sec, fdb age " << static_cast<uint64_t>(ageRate) << " /sec" << endl;
+    }
+
+    TEST_F(PortsOrchBench, NeighborAdd)
+    {
+        Table neigh_table = Table(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+
+        for (size_t i = 0; i < NEIGHBORS; i++)
+        {
+            string ip = "192.168.0." + to_string(i + 2);
+            neigh_table.set(VLAN_1000 + neigh_table.getTableNameSeparator() + ip,
+                            { { "neigh", "02:00:00:00:01:" + to_string(10 + i % 90) }, { "family", "IPv4" } });
+        }
+        gNeighOrch->addExistingData(&neigh_table);
+
+        auto start = steady_clock::now();
+        static_cast<Orch *>(gNeighOrch)->doTask();
+        double addRate = rate(NEIGHBORS, start);
+
+        for (size_t i = 0; i < NEIGHBORS; i++)
+        {
+            EXPECT_TRUE(gNeighOrch->hasNextHop(NextHopKey(IpAddress("192.168.0." + to_string(i + 2)), VLAN_1000)));
+        }
+        cout << "[ PortsOrch ] neighbor add " << static_cast<uint64_t>(addRate) << " /sec" << endl;
+    }
+}
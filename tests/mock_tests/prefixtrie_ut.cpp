@@ -0,0 +1,144 @@
+#include "prefixtrie.h"
+#include "routeorch.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <set>
+
+namespace prefixtrie_test
+{
+    using namespace std;
+    using namespace swss;
+
+    string randomV4(mt19937 &rng)
+    {
+        // Few distinct leading octets so prefixes overlap
+        return to_string(10 + rng() % 2) + "." + to_string(rng() % 4) + "." + to_string(rng() % 256) + "." + to_string(rng() % 256);
+    }
+
+    TEST(PrefixTrie, MatchesLinearScan)
+    {
+        mt19937 rng(1);
+        PrefixTrie<int> trie;
+        map<IpPrefix, int> routes;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            IpPrefix prefix(randomV4(rng) + "/" + to_string(rng() % 33));
+            IpPrefix subnet(prefix.getSubnet());
+            if (rng() % 4)
+            {
+                trie.insert(subnet, i);
+                routes[subnet] = i;
+            }
+            else
+            {
+                EXPECT_EQ(trie.erase(subnet), routes.erase(subnet) == 1);
+            }
+            ASSERT_EQ(trie.size(), routes.size());
+
+            IpAddress ip(randomV4(rng));
+            vector<int> covering;
+            trie.forEachCovering(ip, [&covering](int value) { covering.push_back(value); });
+
+            // map order puts the longest covering prefix last
+            vector<int> expected;
+            for (const auto &route : routes)
+            {
+                if (route.first.isAddressInSubnet(ip))
+                {
+                    expected.push_back(route.second);
+                }
+            }
+            ASSERT_EQ(covering, expected);
+
+            int *best = trie.lpm(ip);
+            ASSERT_EQ(best == nullptr, expected.empty());
+            if (best)
+            {
+                EXPECT_EQ(*best, expected.back());
+            }
+
+            IpPrefix range(IpPrefix(randomV4(rng) + "/" + to_string(rng() % 20)).getSubnet());
+            multiset<int> covered, expectedCovered;
+            trie.forEachCovered(range, [&covered](int value) { covered.insert(value); });
+            for (const auto &route : routes)
+            {
+                if (route.first.getMaskLength() >= range.getMaskLength() && range.isAddressInSubnet(route.first.getIp()))
+                {
+                    expectedCovered.insert(route.second);
+                }
+            }
+            ASSERT_EQ(covered, expectedCovered);
+        }
+    }
+
+    TEST(PrefixTrie, V4AndV6AreSeparate)
+    {
+        PrefixTrie<int> trie;
+        trie.insert(IpPrefix("0.0.0.0/0"), 4);
+        trie.insert(IpPrefix("::/0"), 6);
+        trie.insert(IpAddress("2001:db8::1"), 128);
+
+        ASSERT_NE(trie.lpm(IpAddress("1.2.3.4")), nullptr);
+        EXPECT_EQ(*trie.lpm(IpAddress("1.2.3.4")), 4);
+        EXPECT_EQ(*trie.lpm(IpAddress("2001:db8::2")), 6);
+        EXPECT_EQ(*trie.lpm(IpAddress("2001:db8::1")), 128);
+
+        EXPECT_TRUE(trie.erase(IpPrefix("::/0")));
+        EXPECT_EQ(trie.lpm(IpAddress("2001:db8::2")), nullptr);
+        EXPECT_EQ(trie.size(), 2);
+    }
+
+    TEST(PrefixTrie, RouteTableCoveringBench)
+    {
+        const int count = 200000;
+        mt19937 rng(2);
+
+        RouteTable table;
+        table[IpPrefix("0.0.0.0/0")] = RouteNhg();
+        for (int i = 0; i < count; i++)
+        {
+            table[IpPrefix(IpPrefix(randomV4(rng) + "/" + to_string(16 + rng() % 17)).getSubnet())] = RouteNhg();
+        }
+
+        // copies rebuild the index on the new map
+        RouteTable copy = table;
+        EXPECT_EQ(copy.size(), table.size());
+
+        vector<IpAddress> hosts;
+        for (int i = 0; i < 100; i++)
+        {
+            hosts.push_back(IpAddress(randomV4(rng)));
+        }
+
+        using namespace std::chrono;
+
+        size_t scanned = 0;
+        auto start = steady_clock::now();
+        for (const auto &host : hosts)
+        {
+            for (const auto &route : table)
+            {
+                scanned += route.first.isAddressInSubnet(host);
+            }
+        }
+        auto scan_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+
+        size_t walked = 0;
+        start = steady_clock::now();
+        for (const auto &host : hosts)
+        {
+            copy.forEachCovering(host, [&walked](const RouteTable::value_type &) { walked++; });
+            EXPECT_EQ(copy.lpm(host)->first, table.lpm(host)->first);
+        }
+        auto trie_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+
+        EXPECT_EQ(walked, scanned);
+        cout << "[ RouteTable ] " << table.size() << " routes, covering prefixes per host: scan "
+             << scan_ns / hosts.size() << " ns, trie " << trie_ns / hosts.size() << " ns" << endl;
+    }
+}
@@ -0,0 +1,181 @@
+#include "recorder.h"
+
+#include <gtest/gtest.h>
+#include <glob.h>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace recorder_test
+{
+    using namespace swss;
+
+    class RecorderTest : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            m_writer.setRecord(true);
+            m_writer.setRotate(false);
+            m_writer.setLocation(".");
+            m_writer.setFileName(m_fileName);
+            m_writer.setName("Test");
+            std::remove(m_fileName.c_str());
+        }
+
+        void TearDown() override
+        {
+            m_writer.stopRec();
+            std::remove(m_fileName.c_str());
+        }
+
+        std::vector<std::string> readRecords()
+        {
+            std::vector<std::string> records;
+            std::ifstream ifs(m_fileName);
+            std::string line;
+            while (std::getline(ifs, line))
+            {
+                records.push_back(line.substr(line.find('|') + 1));
+            }
+            return records;
+        }
+
+        std::string m_fileName = "recorder_ut.rec";
+        RecWriter m_writer;
+    };
+
+    TEST_F(RecorderTest, LazyRecordSkipsFormatWhenDisabled)
+    {
+        int formatted = 0;
+        auto format = [&formatted]() { formatted++; return std::string("entry"); };
+
+        // not started yet
+        m_writer.record(format);
+        EXPECT_EQ(formatted, 0);
+
+        m_writer.startRec(false);
+        m_writer.record(format);
+        EXPECT_EQ(formatted, 1);
+
+        m_writer.setRecord(false);
+        m_writer.record(format);
+        EXPECT_EQ(formatted, 1);
+
+        m_writer.flush();
+        auto records = readRecords();
+        ASSERT_EQ(records.size(), 2);
+        EXPECT_EQ(records[0], "recording started");
+        EXPECT_EQ(records[1], "entry");
+    }
+
+    TEST_F(RecorderTest, AsyncWriterKeepsOrderPerThread)
+    {
+        const int count = 1000;
+
+        m_writer.startRec(false);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 2; t++)
+        {
+            threads.emplace_back([this, t]() {
+                for (int i = 0; i < count; i++)
+                {
+                    m_writer.record(std::to_string(t) + ":" + std::to_string(i));
+                }
+            });
+        }
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+        m_writer.flush();
+
+        auto records = readRecords();
+        ASSERT_EQ(records.size(), 1 + 2 * count);
+
+        int next[2] = { 0, 0 };
+        for (size_t i = 1; i < records.size(); i++)
+        {
+            int t = std::stoi(records[i]);
+            ASSERT_EQ(records[i], std::to_string(t) + ":" + std::to_string(next[t]));
+            next[t]++;
+        }
+    }
+
+    TEST_F(RecorderTest, BinaryRecordsReadBack)
+    {
+        // '|' and newlines can't break the binary records
+        const std::string value = "ROUTE_TABLE:10.0.0.0/24|SET|nexthop:10.0.0.1\nifname:Ethernet0";
+
+        m_writer.setBinary(true);
+        m_writer.startRec(false);
+        m_writer.record(value);
+        m_writer.flush();
+        m_writer.stopRec();
+
+        // restarting the recording appends to the file without a second header
+        m_writer.startRec(false);
+        m_writer.record([]() { return std::string(); });
+        m_writer.flush();
+
+        std::ifstream ifs(m_fileName, std::ios::binary);
+        RecReader reader(ifs);
+        ASSERT_TRUE(reader.isBinary());
+
+        std::vector<RecEntry> entries;
+        RecEntry entry;
+        while (reader.next(entry))
+        {
+            entries.push_back(entry);
+        }
+
+        ASSERT_EQ(entries.size(), 4);
+        EXPECT_EQ(entries[0].value, "recording started");
+        EXPECT_EQ(entries[1].value, value);
+        EXPECT_EQ(entries[2].value, "recording started");
+        EXPECT_EQ(entries[3].value, "");
+        EXPECT_LE(entries[0].timestamp, entries[1].timestamp);
+        EXPECT_EQ(Recorder::formatTimestamp(entries[1].timestamp).size(), 26);
+    }
+
+    TEST_F(RecorderTest, BinaryRecordingMovesTextFileAside)
+    {
+        m_writer.startRec(false);
+        m_writer.record("text entry");
+        m_writer.flush();
+        m_writer.stopRec();
+
+        m_writer.setBinary(true);
+        m_writer.startRec(false);
+        m_writer.record("binary entry");
+        m_writer.flush();
+
+        // the text recording is kept as is
+        glob_t moved;
+        ASSERT_EQ(glob((m_fileName + ".*").c_str(), 0, nullptr, &moved), 0);
+        ASSERT_EQ(moved.gl_pathc, 1);
+        std::string movedName = moved.gl_pathv[0];
+        globfree(&moved);
+
+        std::ifstream text(movedName);
+        std::string line;
+        ASSERT_TRUE(std::getline(text, line));
+        ASSERT_TRUE(std::getline(text, line));
+        EXPECT_EQ(line.substr(line.find('|') + 1), "text entry");
+        std::remove(movedName.c_str());
+
+        // the new file only has binary records
+        std::ifstream ifs(m_fileName, std::ios::binary);
+        RecReader reader(ifs);
+        ASSERT_TRUE(reader.isBinary());
+
+        RecEntry entry;
+        ASSERT_TRUE(reader.next(entry));
+        EXPECT_EQ(entry.value, "recording started");
+        ASSERT_TRUE(reader.next(entry));
+        EXPECT_EQ(entry.value, "binary entry");
+        EXPECT_FALSE(reader.next(entry));
+    }
+}
@@ -0,0 +1,193 @@
+#include "orch.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+/*
+ * Microbenchmark of the ring buffer: task throughput and wakeup latency of
+ * the ring thread with 1, 2 and 4 producers.
+ */
+namespace ringbuffer_bench_test
+{
+    using namespace std::chrono;
+
+    const size_t TASKS_PER_PRODUCER = 100000;
+    const size_t LATENCY_SAMPLES = 200;
+
+    // Same loop as OrchDaemon::popRing
+    void drainRing(RingBuffer *ring)
+    {
+        std::vector<AnyTask> batch;
+        batch.reserve(RING_SIZE);
+
+        ring->thread_created = true;
+        while (!ring->thread_exited)
+        {
+            ring->pauseThread();
+            ring->setIdle(false);
+            while (ring->popBatch(batch, RING_SIZE))
+            {
+                for (auto &func : batch)
+                {
+                    func();
+                }
+                batch.clear();
+            }
+            ring->setIdle(true);
+        }
+    }
+
+    void stopRing(RingBuffer &ring, std::thread &consumer)
+    {
+        ring.thread_exited = true;
+        ring.notify();
+        consumer.join();
+    }
+
+    class RingBufferBench : public ::testing::TestWithParam<int>
+    {
+    };
+
+    TEST_P(RingBufferBench, Throughput)
+    {
+        const int producers = GetParam();
+
+        RingBuffer ring;
+        std::thread consumer(drainRing, &ring);
+
+        std::atomic<size_t> executed{0};
+        std::vector<std::thread> threads;
+
+        auto start = steady_clock::now();
+        for (int p = 0; p < producers; p++)
+        {
+            threads.emplace_back([&]() {
+                auto entries = std::make_shared<std::deque<swss::KeyOpFieldsValuesTuple>>();
+                for (size_t i = 0; i < TASKS_PER_PRODUCER; i++)
+                {
+                    // same capture size as the task queued by Consumer::execute
+                    ring.pushWait([entries, &executed]() { executed++; });
+                    ring.notify();
+                }
+            });
+        }
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+        while (!ring.IsEmpty() || !ring.IsIdle())
+        {
+            std::this_thread::yield();
+        }
+        auto elapsed = duration_cast<duration<double>>(steady_clock::now() - start).count();
+
+        stopRing(ring, consumer);
+
+        EXPECT_EQ(executed.load(), TASKS_PER_PRODUCER * producers);
+        std::cout << "[ RingBuffer ] producers " << producers
+                  << ": " << static_cast<uint64_t>(executed.load() / elapsed) << " tasks/sec" << std::endl;
+    }
+
+    TEST_P(RingBufferBench, WakeupLatency)
+    {
+        const int producers = GetParam();
+
+        RingBuffer ring;
+        std::thread consumer(drainRing, &ring);
+
+        std::atomic<int64_t> totalNs{0};
+        std::atomic<size_t> samples{0};
+        std::vector<std::thread> threads;
+
+        for (int p = 0; p < producers; p++)
+        {
+            threads.emplace_back([&]() {
+                for (size_t i = 0; i < LATENCY_SAMPLES / producers; i++)
+                {
+                    // let the ring thread park before each sample
+                    std::this_thread::sleep_for(microseconds(200));
+
+                    auto queued = steady_clock::now();
+                    ring.pushWait([queued, &totalNs, &samples]() {
+                        totalNs += duration_cast<nanoseconds>(steady_clock::now() - queued).count();
+                        samples++;
+                    });
+                    ring.notify();
+                }
+            });
+        }
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+        while (!ring.IsEmpty() || !ring.IsIdle())
+        {
+            std::this_thread::yield();
+        }
+
+        stopRing(ring, consumer);
+
+        ASSERT_GT(samples.load(), 0u);
+        std::cout << "[ RingBuffer ] producers " << producers
+                  << ": average wakeup latency " << totalNs.load() / static_cast<int64_t>(samples.load()) << " ns" << std::endl;
+    }
+
+    TEST(RingBufferTask, MoveOnly)
+    {
+        RingBuffer ring(4);
+
+        auto value = std::make_shared<int>(0);
+        AnyTask task = [value]() { (*value)++; };
+        EXPECT_TRUE(ring.push(std::move(task)));
+        EXPECT_FALSE(task);
+
+        // captures larger than the inline storage are still supported
+        std::vector<int> big(RingTask::INLINE_SIZE, 1);
+        std::array<char, RingTask::INLINE_SIZE> pad{};
+        EXPECT_TRUE(ring.push([value, big, pad]() { *value += static_cast<int>(big.size()) + pad[0]; }));
+
+        std::vector<AnyTask> batch;
+        EXPECT_EQ(ring.popBatch(batch, RING_SIZE), 2u);
+        for (auto &func : batch)
+        {
+            func();
+        }
+        EXPECT_EQ(*value, 1 + static_cast<int>(RingTask::INLINE_SIZE));
+        EXPECT_TRUE(ring.IsEmpty());
+    }
+
+    TEST(RingBufferTask, PushFailsWhenFull)
+    {
+        RingBuffer ring(3);
+
+        int executed = 0;
+        EXPECT_TRUE(ring.push([&executed]() { executed++; }));
+        EXPECT_TRUE(ring.push([&executed]() { executed++; }));
+        EXPECT_TRUE(ring.IsFull());
+
+        // a rejected task isn't consumed and can be pushed again later
+        AnyTask task = [&executed]() { executed += 10; };
+        EXPECT_FALSE(ring.push(std::move(task)));
+        EXPECT_TRUE(static_cast<bool>(task));
+
+        AnyTask popped;
+        EXPECT_TRUE(ring.pop(popped));
+        popped();
+        EXPECT_TRUE(ring.push(std::move(task)));
+
+        std::vector<AnyTask> batch;
+        EXPECT_EQ(ring.popBatch(batch, RING_SIZE), 2u);
+        for (auto &func : batch)
+        {
+            func();
+        }
+        EXPECT_EQ(executed, 12);
+    }
+
+    INSTANTIATE_TEST_CASE_P(Producers, RingBufferBench, ::testing::Values(1, 2, 4));
+}
@@ -1026,4 +1026,47 @@ namespace routeorch_test
         ASSERT_EQ(gRouteOrch->gRouteBulker.setting_entries_count(), 0);
         ASSERT_EQ(gRouteOrch->gRouteBulker.removing_entries_count(), 0);
     }
+
+    /* Observer of two hosts that detaches from both on its first route update */
+    class DetachingObserver : public Observer
+    {
+    public:
+        void update(SubjectType, void *) override
+        {
+            updates++;
+            if (detachOnUpdate)
+            {
+                detachOnUpdate = false;
+                for (const auto &host : hosts)
+                {
+                    gRouteOrch->detach(this, host);
+                }
+            }
+        }
+
+        vector<IpAddress> hosts = { IpAddress("3.3.3.5"), IpAddress("3.3.3.6") };
+        bool detachOnUpdate = false;
+        int updates = 0;
+    };
+
+    TEST_F(RouteOrchTest, RouteOrchObserverDetachesDuringUpdate)
+    {
+        DetachingObserver observer;
+        for (const auto &host : observer.hosts)
+        {
+            gRouteOrch->attach(&observer, host);
+        }
+        int attached_updates = observer.updates;
+
+        // The route covers both hosts, the second one is detached while the first is notified
+        observer.detachOnUpdate = true;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"3.3.3.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        ASSERT_EQ(observer.updates, attached_updates + 1);
+    }
 }
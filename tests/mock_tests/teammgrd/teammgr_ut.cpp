@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "../mock_table.h"
+#include "../common/mock_netlink_programmer.h"
 #include "teammgr.h"
 #include <dlfcn.h>
 
@@ -134,6 +135,7 @@ namespace teammgr_ut
         std::shared_ptr<swss::DBConnector> m_app_db;
         std::shared_ptr<swss::DBConnector> m_state_db;
         std::vector<TableConnector> cfg_lag_tables;
+        std::shared_ptr<mock_netlink::MockNetlinkProgrammer> m_netlink;
 
         virtual void SetUp() override
         {
@@ -164,6 +166,7 @@ namespace teammgr_ut
             callback = cb;
             callback_kill = cb_kill;
             callback_fopen = cb_fopen;
+            m_netlink = std::make_shared<mock_netlink::MockNetlinkProgrammer>();
         }
 
         virtual void TearDown() override
@@ -176,7 +179,7 @@ namespace teammgr_ut
 
     TEST_F(TeamMgrTest, testProcessKilledAfterAddLagFailure)
     {
-        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables, m_netlink);
         swss::Table cfg_lag_table = swss::Table(m_config_db.get(), CFG_LAG_TABLE_NAME);
         cfg_lag_table.set("PortChannel382", { { "admin_status", "up" },
                                             { "mtu", "9100" },
@@ -187,6 +190,7 @@ namespace teammgr_ut
         ASSERT_NE(mockCallArgs.size(), 0);
         EXPECT_NE(mockCallArgs.front().find("/usr/bin/teamd -r -t PortChannel382"), std::string::npos);
         EXPECT_EQ(mockCallArgs.size(), 1);
+        EXPECT_TRUE(m_netlink->requests.empty());
         EXPECT_EQ(mockKillCommands.size(), 1);
         EXPECT_EQ(mockKillCommands.front().first, 1234);
         EXPECT_EQ(mockKillCommands.front().second, SIGTERM);
@@ -194,7 +198,7 @@ namespace teammgr_ut
 
     TEST_F(TeamMgrTest, testProcessPidFileMissingAfterAddLagFailure)
     {
-        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables, m_netlink);
         swss::Table cfg_lag_table = swss::Table(m_config_db.get(), CFG_LAG_TABLE_NAME);
         cfg_lag_table.set("PortChannel812", { { "admin_status", "up" },
                                             { "mtu", "9100" },
@@ -206,12 +210,13 @@ namespace teammgr_ut
         ASSERT_NE(mockCallArgs.size(), 0);
         EXPECT_NE(mockCallArgs.front().find("/usr/bin/teamd -r -t PortChannel812"), std::string::npos);
         EXPECT_EQ(mockCallArgs.size(), 1);
+        EXPECT_TRUE(m_netlink->requests.empty());
         EXPECT_EQ(mockKillCommands.size(), 0);
     }
 
     TEST_F(TeamMgrTest, testProcessCleanupAfterAddLag)
     {
-        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables, m_netlink);
         swss::Table cfg_lag_table = swss::Table(m_config_db.get(), CFG_LAG_TABLE_NAME);
         cfg_lag_table.set("PortChannel495", { { "admin_status", "up" },
                                             { "mtu", "9100" },
@@ -219,8 +224,10 @@ namespace teammgr_ut
                                             { "min_links", "2" } });
         teammgr.addExistingData(&cfg_lag_table);
         teammgr.doTask();
-        ASSERT_EQ(mockCallArgs.size(), 3);
+        ASSERT_EQ(mockCallArgs.size(), 1);
         ASSERT_NE(mockCallArgs.front().find("/usr/bin/teamd -r -t PortChannel495"), std::string::npos);
+        ASSERT_EQ(m_netlink->requests, std::vector<std::string>({ "ip link set PortChannel495 up",
+                                                                  "ip link set PortChannel495 mtu 9100" }));
         teammgr.cleanTeamProcesses();
         EXPECT_EQ(mockKillCommands.size(), 2);
         EXPECT_EQ(mockKillCommands.front().first, 5678);
@@ -229,7 +236,7 @@ namespace teammgr_ut
 
     TEST_F(TeamMgrTest, testProcessPidFileMissingDuringCleanup)
     {
-        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables, m_netlink);
         swss::Table cfg_lag_table = swss::Table(m_config_db.get(), CFG_LAG_TABLE_NAME);
         cfg_lag_table.set("PortChannel198", { { "admin_status", "up" },
                                             { "mtu", "9100" },
@@ -240,14 +247,16 @@ namespace teammgr_ut
         teammgr.doTask();
         ASSERT_NE(mockCallArgs.size(), 0);
         EXPECT_NE(mockCallArgs.front().find("/usr/bin/teamd -r -t PortChannel198"), std::string::npos);
-        EXPECT_EQ(mockCallArgs.size(), 3);
+        EXPECT_EQ(mockCallArgs.size(), 1);
+        EXPECT_EQ(m_netlink->requests, std::vector<std::string>({ "ip link set PortChannel198 up",
+                                                                  "ip link set PortChannel198 mtu 9100" }));
         teammgr.cleanTeamProcesses();
         EXPECT_EQ(mockKillCommands.size(), 0);
     }
 
     TEST_F(TeamMgrTest, testSleepDuringCleanup)
     {
-        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables, m_netlink);
         swss::Table cfg_lag_table = swss::Table(m_config_db.get(), CFG_LAG_TABLE_NAME);
         for (int i = 600; i < 620; i++)
         {
@@ -257,7 +266,8 @@ namespace teammgr_ut
         }
         teammgr.addExistingData(&cfg_lag_table);
         teammgr.doTask();
-        ASSERT_EQ(mockCallArgs.size(), 60);
+        ASSERT_EQ(mockCallArgs.size(), 20);
+        ASSERT_EQ(m_netlink->requests.size(), 40);
         std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
         teammgr.cleanTeamProcesses();
         std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
@@ -94,6 +94,7 @@ namespace ut_helper
         sai_api_query((sai_api_t)SAI_API_DASH_VIP, (void**)&sai_dash_vip_api);
         sai_api_query((sai_api_t)SAI_API_DASH_DIRECTION_LOOKUP, (void**)&sai_dash_direction_lookup_api);
         sai_api_query((sai_api_t)SAI_API_DASH_ENI, (void**)&sai_dash_eni_api);
+        sai_api_query((sai_api_t)SAI_API_DASH_ACL, (void**)&sai_dash_acl_api);
         sai_api_query((sai_api_t)SAI_API_DASH_HA, (void**)&sai_dash_ha_api);
         sai_api_query((sai_api_t)SAI_API_DASH_OUTBOUND_CA_TO_PA, (void**)&sai_dash_outbound_ca_to_pa_api);
         sai_api_query((sai_api_t)SAI_API_DASH_PA_VALIDATION, (void**)&sai_dash_pa_validation_api);
@@ -139,6 +140,7 @@ namespace ut_helper
         sai_dash_vip_api = nullptr;
         sai_dash_direction_lookup_api = nullptr;
         sai_dash_eni_api = nullptr;
+        sai_dash_acl_api = nullptr;
         sai_dash_ha_api = nullptr;
         sai_stp_api = nullptr;
         sai_dash_meter_api = nullptr;
@@ -0,0 +1,217 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <deque>
+#include "../mock_table.h"
+#include "../common/mock_netlink_programmer.h"
+#include "warm_restart.h"
+#define private public
+#define protected public
+#include "vlanmgr.h"
+#undef protected
+#undef private
+
+extern swss::MacAddress gMacAddress;
+
+namespace vlanmgr_ut
+{
+    using namespace std;
+    using namespace swss;
+    using mock_netlink::MockNetlinkProgrammer;
+
+    struct VlanMgrTest : public ::testing::Test
+    {
+        shared_ptr<DBConnector> m_config_db;
+        shared_ptr<DBConnector> m_app_db;
+        shared_ptr<DBConnector> m_state_db;
+        shared_ptr<MockNetlinkProgrammer> m_netlink;
+        shared_ptr<VlanMgr> m_vlanMgr;
+
+        virtual void SetUp() override
+        {
+            testing_db::reset();
+            m_config_db = make_shared<DBConnector>("CONFIG_DB", 0);
+            m_app_db = make_shared<DBConnector>("APPL_DB", 0);
+            m_state_db = make_shared<DBConnector>("STATE_DB", 0);
+
+            WarmStart::initialize("vlanmgrd", "swss");
+            gMacAddress = MacAddress("00:aa:bb:cc:dd:ee");
+
+            vector<string> cfg_vlan_tables = {
+                CFG_VLAN_TABLE_NAME,
+                CFG_VLAN_MEMBER_TABLE_NAME,
+            };
+            m_netlink = make_shared<MockNetlinkProgrammer>();
+            m_vlanMgr = make_shared<VlanMgr>(m_config_db.get(), m_app_db.get(), m_state_db.get(),
+                                             cfg_vlan_tables, vector<string>(), m_netlink);
+        }
+
+        void doVlanMemberTask(const deque<KeyOpFieldsValuesTuple> &entries)
+        {
+            auto consumer = dynamic_cast<Consumer *>(m_vlanMgr->getExecutor(CFG_VLAN_MEMBER_TABLE_NAME));
+            consumer->addToSync(entries);
+            static_cast<Orch *>(m_vlanMgr.get())->doTask();
+        }
+
+        bool requested(const string &request)
+        {
+            return find(m_netlink->requests.begin(), m_netlink->requests.end(), request) != m_netlink->requests.end();
+        }
+    };
+
+    TEST_F(VlanMgrTest, CreateBridge)
+    {
+        EXPECT_TRUE(m_netlink->linkExists("Bridge"));
+        EXPECT_TRUE(m_netlink->linkExists("dummy"));
+        EXPECT_TRUE(requested("ip link set dummy master Bridge"));
+        EXPECT_TRUE(requested("bridge vlan del vid 1 dev Bridge self"));
+        EXPECT_TRUE(requested("ip link set Bridge type bridge vlan_filtering 1"));
+        EXPECT_TRUE(requested("ip link set Bridge type bridge no_linklocal_learn 1"));
+        EXPECT_EQ(m_netlink->pending(), 0u);
+        EXPECT_EQ(m_netlink->commits, 4u);
+    }
+
+    TEST_F(VlanMgrTest, AddVlanMember)
+    {
+        Table cfg_vlan_table(m_config_db.get(), CFG_VLAN_TABLE_NAME);
+        Table cfg_vlan_member_table(m_config_db.get(), CFG_VLAN_MEMBER_TABLE_NAME);
+        Table state_port_table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+
+        state_port_table.set("Ethernet0", { { "state", "ok" } });
+        cfg_vlan_table.set("Vlan100", { { "admin_status", "up" } });
+        cfg_vlan_member_table.set("Vlan100|Ethernet0", { { "tagging_mode", "untagged" } });
+        cfg_vlan_member_table.set("Vlan100|Ethernet4", { { "tagging_mode", "tagged" } });
+
+        m_netlink->requests.clear();
+        m_vlanMgr->addExistingData(&cfg_vlan_table);
+        m_vlanMgr->addExistingData(&cfg_vlan_member_table);
+        static_cast<Orch *>(m_vlanMgr.get())->doTask();
+
+        EXPECT_TRUE(m_netlink->linkExists("Vlan100"));
+        EXPECT_TRUE(requested("bridge vlan add vid 100 dev Bridge self"));
+        EXPECT_TRUE(requested("ip link set Vlan100 up"));
+        EXPECT_TRUE(requested("ip link set Ethernet0 master Bridge"));
+        EXPECT_TRUE(requested("bridge vlan add vid 100 dev Ethernet0 pvid untagged"));
+
+        // Ethernet4 is not ready
+        EXPECT_FALSE(requested("ip link set Ethernet4 master Bridge"));
+    }
+
+    TEST_F(VlanMgrTest, RemoveLastVlanMember)
+    {
+        m_vlanMgr->addHostVlan(100);
+        m_vlanMgr->addHostVlan(200);
+        m_vlanMgr->addHostVlanMember(100, "Ethernet0", "tagged");
+        m_vlanMgr->addHostVlanMember(200, "Ethernet0", "untagged");
+
+        // Still a member of Vlan200
+        m_netlink->requests.clear();
+        m_vlanMgr->removeHostVlanMember(100, "Ethernet0");
+        EXPECT_TRUE(requested("bridge vlan del vid 100 dev Ethernet0"));
+        EXPECT_FALSE(requested("ip link set Ethernet0 nomaster"));
+
+        m_vlanMgr->removeHostVlanMember(200, "Ethernet0");
+        EXPECT_TRUE(requested("ip link set Ethernet0 nomaster"));
+    }
+
+    TEST_F(VlanMgrTest, AddVlanMemberFailure)
+    {
+        m_netlink->failures.insert("ip link set PortChannel1 master Bridge");
+        m_netlink->failures.insert("ip link set Ethernet0 master Bridge");
+
+        // The LAG may be being removed, retried later
+        EXPECT_FALSE(m_vlanMgr->addHostVlanMember(100, "PortChannel1", "tagged"));
+        EXPECT_THROW(m_vlanMgr->addHostVlanMember(100, "Ethernet0", "tagged"), runtime_error);
+
+        // The VLAN mtu can't be larger than the members mtu
+        m_netlink->failures.insert("ip link set Vlan100 mtu 9216");
+        EXPECT_FALSE(m_vlanMgr->setHostVlanMtu(100, 9216));
+        EXPECT_TRUE(m_vlanMgr->setHostVlanMtu(100, 1500));
+    }
+
+    TEST_F(VlanMgrTest, BatchVlanMembers)
+    {
+        Table state_port_table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+        Table state_vlan_table(m_state_db.get(), STATE_VLAN_TABLE_NAME);
+        const vector<string> ports = { "Ethernet0", "Ethernet4", "Ethernet8", "Ethernet12" };
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (const auto &port : ports)
+        {
+            state_port_table.set(port, { { "state", "ok" } });
+            for (int vlan_id = 100; vlan_id < 164; vlan_id++)
+            {
+                entries.push_back({ "Vlan" + to_string(vlan_id) + "|" + port, SET_COMMAND, { { "tagging_mode", "tagged" } } });
+            }
+            entries.push_back({ "Vlan200|" + port, SET_COMMAND, { { "tagging_mode", "untagged" } } });
+        }
+        for (int vlan_id = 100; vlan_id < 164; vlan_id++)
+        {
+            state_vlan_table.set("Vlan" + to_string(vlan_id), { { "state", "ok" } });
+        }
+        state_vlan_table.set("Vlan200", { { "state", "ok" } });
+
+        // One range of tagged VLANs and the untagged VLAN per port, in one commit
+        m_netlink->requests.clear();
+        m_netlink->commits = 0;
+        doVlanMemberTask(entries);
+
+        EXPECT_TRUE(requested("bridge vlan add vid 100-163 dev Ethernet0"));
+        EXPECT_TRUE(requested("bridge vlan add vid 200 dev Ethernet12 pvid untagged"));
+        EXPECT_EQ(m_netlink->requests.size(), 4 * ports.size());
+        EXPECT_EQ(m_netlink->vlans["Ethernet4"].size(), 65u);
+        EXPECT_EQ(m_vlanMgr->m_vlanMemberChanges, 65 * ports.size());
+        EXPECT_EQ(m_vlanMgr->m_vlanMemberOperationsSaved, 3 * 65 * ports.size() - 4 * ports.size());
+
+        Table state_vlan_member_table(m_state_db.get(), STATE_VLAN_MEMBER_TABLE_NAME);
+        vector<FieldValueTuple> values;
+        EXPECT_TRUE(state_vlan_member_table.get("Vlan163|Ethernet12", values));
+
+        // Remove the tagged VLANs but a hole, and all the VLANs of Ethernet12
+        entries.clear();
+        for (int vlan_id = 100; vlan_id < 164; vlan_id++)
+        {
+            if (vlan_id != 120)
+            {
+                entries.push_back({ "Vlan" + to_string(vlan_id) + "|Ethernet0", DEL_COMMAND, {} });
+            }
+            entries.push_back({ "Vlan" + to_string(vlan_id) + "|Ethernet12", DEL_COMMAND, {} });
+        }
+        entries.push_back({ "Vlan200|Ethernet12", DEL_COMMAND, {} });
+
+        m_netlink->requests.clear();
+        doVlanMemberTask(entries);
+
+        EXPECT_TRUE(requested("bridge vlan del vid 100-119 dev Ethernet0"));
+        EXPECT_TRUE(requested("bridge vlan del vid 121-163 dev Ethernet0"));
+        EXPECT_TRUE(requested("bridge vlan del vid 100-163 dev Ethernet12"));
+        EXPECT_TRUE(requested("bridge vlan del vid 200 dev Ethernet12"));
+        EXPECT_TRUE(requested("ip link set Ethernet12 nomaster"));
+        EXPECT_FALSE(requested("ip link set Ethernet0 nomaster"));
+        EXPECT_EQ(m_netlink->vlans["Ethernet0"], set<uint16_t>({ 120, 200 }));
+        EXPECT_FALSE(state_vlan_member_table.get("Vlan163|Ethernet12", values));
+        EXPECT_TRUE(state_vlan_member_table.get("Vlan120|Ethernet0", values));
+    }
+
+    TEST_F(VlanMgrTest, BatchVlanMembersLagNotReady)
+    {
+        Table state_lag_table(m_state_db.get(), STATE_LAG_TABLE_NAME);
+        Table state_vlan_table(m_state_db.get(), STATE_VLAN_TABLE_NAME);
+
+        state_lag_table.set("PortChannel1", { { "state", "ok" } });
+        state_vlan_table.set("Vlan100", { { "state", "ok" } });
+        state_vlan_table.set("Vlan101", { { "state", "ok" } });
+
+        // The LAG netdev is not created yet, its members are retried on the next drain
+        m_netlink->failures.insert("ip link set PortChannel1 master Bridge");
+        doVlanMemberTask({ { "Vlan100|PortChannel1", SET_COMMAND, { { "tagging_mode", "tagged" } } },
+                           { "Vlan101|PortChannel1", SET_COMMAND, { { "tagging_mode", "tagged" } } } });
+
+        auto consumer = dynamic_cast<Consumer *>(m_vlanMgr->getExecutor(CFG_VLAN_MEMBER_TABLE_NAME));
+        EXPECT_EQ(consumer->m_toSync.size(), 2u);
+
+        m_netlink->failures.clear();
+        static_cast<Orch *>(m_vlanMgr.get())->doTask();
+        EXPECT_TRUE(consumer->m_toSync.empty());
+        EXPECT_TRUE(requested("bridge vlan add vid 100-101 dev PortChannel1"));
+    }
+}